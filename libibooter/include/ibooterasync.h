@@ -0,0 +1,109 @@
+#ifndef IBOOTERASYNC_H
+#define IBOOTERASYNC_H
+
+#include "libibooter.h"
+#include <pthread.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace ibooter
+{
+
+// What a queued operation came back with. Times are wall clock seconds.
+typedef struct SOpResult
+{
+	unsigned int	nId;
+	ERR_CODE			code;
+	std::string		sResponse;	// console output, for commands that asked for it
+	unsigned long	lBytes;			// file bytes moved
+	double				dQueued;		// between submission and the operation starting
+	double				dElapsed;		// talking to the device
+} SOpResult;
+
+// Called once per operation, in submission order, from whichever thread ran it.
+typedef void (*OpCallback)(const SOpResult &result, void *pContext);
+
+// Queues operations against one connection so callers never block on the device. Submissions return straight away
+// with an operation id; the queue runs them back to back, either on its own thread (Start) or on whatever thread
+// calls RunNext, so one thread can step many devices.
+class CIBootQueue
+{
+	public:
+		CIBootQueue(CIBootConn &conn);
+		~CIBootQueue();
+
+		unsigned int SubmitConnect(OpCallback pCallback = NULL, void *pContext = NULL);
+		unsigned int SubmitCommand(const char *szCmd, bool bResponse = true, OpCallback pCallback = NULL,
+				void *pContext = NULL);
+		unsigned int SubmitSendFile(const char *szFile, unsigned long lLoadAddr, OpCallback pCallback = NULL,
+				void *pContext = NULL);
+		unsigned int SubmitGetFile(const char *szFile, unsigned long lLoadAddr, int nLen, OpCallback pCallback = NULL,
+				void *pContext = NULL);
+
+		// Queues a run of commands that go out one after the other without waiting on the caller. The batch stops at
+		// the first failure; the commands after it complete with IB_FAIL. Returns the id of the last command.
+		unsigned int SubmitBatch(const std::vector<std::string> &vCommands, OpCallback pCallback = NULL,
+				void *pContext = NULL);
+
+		// Runs the next queued operation on the calling thread. Returns false if there was nothing to run or another
+		// thread is already running one for this queue.
+		bool RunNext();
+
+		ERR_CODE Start();
+		void Stop();
+
+		// Blocks until every operation submitted so far has completed.
+		void Wait();
+
+		unsigned int Pending();
+
+	private:
+
+		typedef enum
+		{
+			OP_CONNECT,
+			OP_COMMAND,
+			OP_SEND_FILE,
+			OP_GET_FILE,
+		} OP_TYPE;
+
+		typedef struct SOp
+		{
+			unsigned int	nId;
+			OP_TYPE				type;
+			std::string		sArg;
+			unsigned long	lLoadAddr;
+			int						nLen;
+			bool					bResponse;
+			unsigned int	nBatch;		// non-zero for commands submitted together
+			double				dSubmitted;
+			OpCallback		pCallback;
+			void					*pContext;
+		} SOp;
+
+		unsigned int Submit(SOp *pOp);
+		void Execute(SOp *pOp, SOpResult &result);
+
+		static void *ThreadMain(void *pArg);
+		static double Now();
+
+	private:
+		CIBootConn						&m_conn;
+		std::deque<SOp *>			m_queue;
+		pthread_mutex_t				m_mutex;
+		pthread_cond_t				m_cond;
+		pthread_t							m_thread;
+		bool									m_bThread;
+		bool									m_bStopping;
+		bool									m_bRunning;
+		unsigned int					m_nNextId;
+		unsigned int					m_nNextBatch;
+		unsigned int					m_nFailedBatch;
+		unsigned int					m_nOutstanding;
+
+}; // end class CIBootQueue
+
+}; // end namespace
+
+#endif
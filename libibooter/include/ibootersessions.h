@@ -0,0 +1,80 @@
+#ifndef IBOOTERSESSIONS_H
+#define IBOOTERSESSIONS_H
+
+#include "ibooterasync.h"
+
+namespace ibooter
+{
+
+// Everything one device did, in the order it did it.
+typedef struct SSessionReport
+{
+	SDeviceLocation					location;
+	std::vector<SOpResult>	vResults;
+	ERR_CODE								code;			// first failure, or IB_SUCCESS
+	unsigned long						lBytes;
+	double									dElapsed;	// summed device time
+} SSessionReport;
+
+// Drives every attached device at once. Each device gets its own connection and operation queue; a fixed pool of
+// worker threads steps whichever queues have work, so a slow device only ever ties up one worker and the thread
+// count doesn't grow with the rack.
+class CIBootSessionManager
+{
+	public:
+		CIBootSessionManager(unsigned int nWorkers = 4);
+		~CIBootSessionManager();
+
+		// Opens a session for every attached device and queues a connect on each, replacing any sessions from before.
+		// The workers step the sessions without locking them, so this returns -1 while they're running; Stop first.
+		int OpenAll(int nVendor = CIBootConn::USB_VENDOR_ID, int nProduct = CIBootConn::USB_PRODUCT_ID);
+		unsigned int Count() const;
+
+		// Queued on every session; each device works through its own copy in order.
+		void RunScript(const std::vector<std::string> &vCommands);
+		void SendCommand(const char *szCmd);
+		void SendFile(const char *szFile, unsigned long lLoadAddr);
+
+		ERR_CODE Start();
+		void Stop();
+
+		// Blocks until every device has finished everything queued so far.
+		void Wait();
+
+		void Report(std::vector<SSessionReport> &vReports);
+		unsigned int Failed();
+
+	private:
+
+		typedef struct SSession
+		{
+			CIBootSessionManager	*pManager;
+			CUsbTransport					*pTransport;
+			CIBootConn						*pConn;
+			CIBootQueue						*pQueue;
+			SSessionReport				report;
+		} SSession;
+
+		void Wake();
+		void CloseAll();
+
+		static void Record(const SOpResult &result, void *pContext);
+		static void *WorkerMain(void *pArg);
+
+	private:
+		unsigned int						m_nWorkers;
+		std::vector<SSession *>	m_vSessions;
+		std::vector<pthread_t>	m_vThreads;
+		pthread_mutex_t					m_mutex;
+		pthread_cond_t					m_work;
+		pthread_cond_t					m_done;
+		bool										m_bStopping;
+		unsigned int						m_nGeneration;	// bumped on every submission
+		unsigned int						m_nOutstanding;
+		unsigned int						m_nNext;				// session the next worker starts looking at
+
+}; // end class CIBootSessionManager
+
+}; // end namespace
+
+#endif
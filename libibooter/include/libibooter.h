@@ -1,5 +1,9 @@
+#ifndef LIBIBOOTER_H
+#define LIBIBOOTER_H
+
 #include <usb.h>
 #include <string>
+#include <vector>
 
 namespace ibooter
 {
@@ -16,7 +20,7 @@ typedef enum {
 	IB_DUMPING_BUFFER,
 } ERR_CODE;
 
-const char *errcode_to_str(ERR_CODE code)
+inline const char *errcode_to_str(ERR_CODE code)
 {
 	switch (code)
 	{
@@ -45,21 +49,82 @@ const char *errcode_to_str(ERR_CODE code)
 	}
 }
 
+// Raw endpoint I/O underneath CIBootConn. The default talks to a real device through libusb; anything else that
+// behaves like one (a recorded session, a simulator) can be handed to CIBootConn instead.
+class ITransport
+{
+	public:
+		virtual ~ITransport() {}
+
+		virtual ERR_CODE Open(int nVendor, int nProduct) = 0;
+		virtual void Close() = 0;
+
+		// nLength is the size of the buffer going in and the number of bytes moved coming out
+		virtual ERR_CODE BulkWrite(int nEndpoint, char *pBuffer, int &nLength) = 0;
+		virtual ERR_CODE BulkRead(int nEndpoint, char *pBuffer, int &nLength) = 0;
+		virtual ERR_CODE InterruptWrite(int nEndpoint, char *pBuffer, int &nLength) = 0;
+		virtual ERR_CODE InterruptRead(int nEndpoint, char *pBuffer, int &nLength) = 0;
+};
+
+// Where a device sits on the USB tree: libusb's bus and device names, which stay put for as long as the device
+// stays plugged in.
+typedef struct SDeviceLocation
+{
+	std::string		sBus;
+	std::string		sDevice;
+} SDeviceLocation;
+
+class CUsbTransport : public ITransport
+{
+	public:
+		CUsbTransport();
+		// only ever opens the device at this location
+		CUsbTransport(const SDeviceLocation &location);
+		~CUsbTransport();
+
+		// Rescans the bus and lists every attached device with the given ids.
+		static int Enumerate(int nVendor, int nProduct, std::vector<SDeviceLocation> &vDevices);
+
+		ERR_CODE Open(int nVendor, int nProduct);
+		void Close();
+
+		ERR_CODE BulkWrite(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE BulkRead(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE InterruptWrite(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE InterruptRead(int nEndpoint, char *pBuffer, int &nLength);
+
+	private:
+		struct usb_device *FindDevice(int nVendor, int nProduct) const;
+
+		static void InitUsb();
+
+		static int const USB_TIMEOUT = 1000;
+
+		struct usb_dev_handle *m_pDevice;
+		SDeviceLocation				m_location;
+		bool									m_bLocated;
+};
+
 class CIBootConn
 {
 	public:
 
 	public:
 		CIBootConn(int nVendor = USB_VENDOR_ID, int nProduct = USB_PRODUCT_ID);
+		// pTransport stays owned by the caller and must outlive the connection
+		CIBootConn(ITransport *pTransport, int nVendor = USB_VENDOR_ID, int nProduct = USB_PRODUCT_ID);
 		~CIBootConn();
 
 		ERR_CODE Connect();
 		ERR_CODE Disconnect();
 		ERR_CODE GetFile(const char *szFile, unsigned long lLoadAddr, int nLen);
-		ERR_CODE SendFile(const char *szFile, unsigned long lLoadAddr);
+		ERR_CODE SendFile(const char *szFile, unsigned long lLoadAddr, unsigned long *plSent = NULL);
 		ERR_CODE SendCommand(const char *szCmd);
 		ERR_CODE GetResponse(const char *&ppBuffer);
 
+		static int const USB_VENDOR_ID = 0x05ac;
+		static int const USB_PRODUCT_ID = 0x1280;
+
 	private:
 
 		typedef struct SMessage
@@ -81,8 +146,6 @@ class CIBootConn
 
 	private:
 
-		void CloseUsb();
-
 		ERR_CODE RequestInitial(SMessage *pSend, SMessage *pRcv);
 		ERR_CODE RequestSendCommand(SMessage *pSend, SMessage *pRcv, int nLen);
 		ERR_CODE RequestSendFile(SMessage *pSend, SMessage *pRcv, int nLen, unsigned long lLoadAddr);
@@ -99,11 +162,6 @@ class CIBootConn
 		ERR_CODE WriteSerial(char *pBuffer, int &nLength);
 		ERR_CODE ReadSerial(char *pBuffer, int &nLength);
 
-		struct usb_device *FindDevice(int nVendor, int nProduct) const;
-
-		static int const USB_VENDOR_ID = 0x05ac;
-		static int const USB_PRODUCT_ID = 0x1280;
-
 		static int const USB_WFILE_EP = 0x05; // Write file EP
 		static int const USB_RFILE_EP = 0x85; // Read file EP
 		static int const USB_WCONTROL_EP = 0x04; // Write control EP
@@ -111,12 +169,18 @@ class CIBootConn
 		static int const USB_WSERIAL_EP =  0x02; // Write serial EP
 		static int const USB_RSERIAL_EP = 0x81; // Read serial EP
 
-		static int const USB_TIMEOUT = 1000;
+		static int const FILE_CHUNK = 0x10000;
+
+		static int const POLL_MIN_DELAY = 10000; // us
+		static int const POLL_MAX_DELAY = 250000; // us
+		static int const RESPONSE_TIMEOUT = 10; // s
 
 	private:
 		int 									m_nVendorId;
 		int										m_nProductId;
-		struct usb_dev_handle *m_pDevice;
+		ITransport						*m_pTransport;
+		bool									m_bOwnTransport;
+		bool									m_bConnected;
 		SMessage			 				*m_pSend, *m_pRecv;	
 		std::string		 				m_sResponse;
 
@@ -124,3 +188,4 @@ class CIBootConn
 
 }; // end namespace
 
+#endif
@@ -0,0 +1,291 @@
+#include "ibooterasync.h"
+#include <sys/time.h>
+
+namespace ibooter
+{
+
+CIBootQueue::CIBootQueue(CIBootConn &conn)
+: m_conn(conn), m_bThread(false), m_bStopping(false), m_bRunning(false), m_nNextId(1), m_nNextBatch(1),
+	m_nFailedBatch(0), m_nOutstanding(0)
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_cond, NULL);
+}
+
+CIBootQueue::~CIBootQueue()
+{
+	Stop();
+
+	while (!m_queue.empty())
+	{
+		delete m_queue.front();
+		m_queue.pop_front();
+	}
+
+	pthread_cond_destroy(&m_cond);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+double CIBootQueue::Now()
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+unsigned int CIBootQueue::Submit(SOp *pOp)
+{
+	pOp->dSubmitted = Now();
+
+	// the id is taken under the lock: once queued, a worker may run and delete the op before we get to return
+	pthread_mutex_lock(&m_mutex);
+	unsigned int nId = pOp->nId = m_nNextId++;
+	m_queue.push_back(pOp);
+	m_nOutstanding++;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	return nId;
+}
+
+unsigned int CIBootQueue::SubmitConnect(OpCallback pCallback, void *pContext)
+{
+	SOp *pOp = new SOp;
+	pOp->type = OP_CONNECT;
+	pOp->lLoadAddr = 0;
+	pOp->nLen = 0;
+	pOp->bResponse = false;
+	pOp->nBatch = 0;
+	pOp->pCallback = pCallback;
+	pOp->pContext = pContext;
+
+	return Submit(pOp);
+}
+
+unsigned int CIBootQueue::SubmitCommand(const char *szCmd, bool bResponse, OpCallback pCallback, void *pContext)
+{
+	SOp *pOp = new SOp;
+	pOp->type = OP_COMMAND;
+	pOp->sArg = szCmd;
+	pOp->lLoadAddr = 0;
+	pOp->nLen = 0;
+	pOp->bResponse = bResponse;
+	pOp->nBatch = 0;
+	pOp->pCallback = pCallback;
+	pOp->pContext = pContext;
+
+	return Submit(pOp);
+}
+
+unsigned int CIBootQueue::SubmitSendFile(const char *szFile, unsigned long lLoadAddr, OpCallback pCallback,
+		void *pContext)
+{
+	SOp *pOp = new SOp;
+	pOp->type = OP_SEND_FILE;
+	pOp->sArg = szFile;
+	pOp->lLoadAddr = lLoadAddr;
+	pOp->nLen = 0;
+	pOp->bResponse = false;
+	pOp->nBatch = 0;
+	pOp->pCallback = pCallback;
+	pOp->pContext = pContext;
+
+	return Submit(pOp);
+}
+
+unsigned int CIBootQueue::SubmitGetFile(const char *szFile, unsigned long lLoadAddr, int nLen, OpCallback pCallback,
+		void *pContext)
+{
+	SOp *pOp = new SOp;
+	pOp->type = OP_GET_FILE;
+	pOp->sArg = szFile;
+	pOp->lLoadAddr = lLoadAddr;
+	pOp->nLen = nLen;
+	pOp->bResponse = false;
+	pOp->nBatch = 0;
+	pOp->pCallback = pCallback;
+	pOp->pContext = pContext;
+
+	return Submit(pOp);
+}
+
+unsigned int CIBootQueue::SubmitBatch(const std::vector<std::string> &vCommands, OpCallback pCallback,
+		void *pContext)
+{
+	unsigned int nBatch;
+	pthread_mutex_lock(&m_mutex);
+	nBatch = m_nNextBatch++;
+	pthread_mutex_unlock(&m_mutex);
+
+	unsigned int nId = 0;
+	for (size_t i = 0; i < vCommands.size(); i++)
+	{
+		SOp *pOp = new SOp;
+		pOp->type = OP_COMMAND;
+		pOp->sArg = vCommands[i];
+		pOp->lLoadAddr = 0;
+		pOp->nLen = 0;
+		pOp->bResponse = true;
+		pOp->nBatch = nBatch;
+		pOp->pCallback = pCallback;
+		pOp->pContext = pContext;
+
+		nId = Submit(pOp);
+	}
+
+	return nId;
+}
+
+void CIBootQueue::Execute(SOp *pOp, SOpResult &result)
+{
+	const char *pResponse = NULL;
+
+	switch (pOp->type)
+	{
+		case OP_CONNECT:
+			result.code = m_conn.Connect();
+			break;
+
+		case OP_COMMAND:
+			if ((result.code = m_conn.SendCommand(pOp->sArg.c_str())) == IB_SUCCESS && pOp->bResponse)
+			{
+				result.code = m_conn.GetResponse(pResponse);
+				if (pResponse)
+					result.sResponse = pResponse;
+			}
+			break;
+
+		case OP_SEND_FILE:
+			result.code = m_conn.SendFile(pOp->sArg.c_str(), pOp->lLoadAddr, &result.lBytes);
+			break;
+
+		case OP_GET_FILE:
+			if ((result.code = m_conn.GetFile(pOp->sArg.c_str(), pOp->lLoadAddr, pOp->nLen)) == IB_SUCCESS)
+				result.lBytes = pOp->nLen;
+			break;
+	}
+}
+
+bool CIBootQueue::RunNext()
+{
+	pthread_mutex_lock(&m_mutex);
+	if (m_bRunning || m_queue.empty())
+	{
+		pthread_mutex_unlock(&m_mutex);
+		return false;
+	}
+
+	SOp *pOp = m_queue.front();
+	m_queue.pop_front();
+	m_bRunning = true;
+	bool bSkip = (pOp->nBatch != 0 && pOp->nBatch == m_nFailedBatch);
+	pthread_mutex_unlock(&m_mutex);
+
+	SOpResult result;
+	result.nId = pOp->nId;
+	result.code = IB_FAIL;
+	result.lBytes = 0;
+	result.dElapsed = 0;
+
+	double dStart = Now();
+	result.dQueued = dStart - pOp->dSubmitted;
+
+	if (!bSkip)
+	{
+		Execute(pOp, result);
+		result.dElapsed = Now() - dStart;
+	}
+
+	if (pOp->pCallback)
+		pOp->pCallback(result, pOp->pContext);
+
+	pthread_mutex_lock(&m_mutex);
+	if (result.code != IB_SUCCESS && pOp->nBatch != 0)
+		m_nFailedBatch = pOp->nBatch;
+	m_bRunning = false;
+	m_nOutstanding--;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	delete pOp;
+	return true;
+}
+
+void *CIBootQueue::ThreadMain(void *pArg)
+{
+	CIBootQueue *pQueue = (CIBootQueue *)pArg;
+
+	pthread_mutex_lock(&pQueue->m_mutex);
+	while (!pQueue->m_bStopping)
+	{
+		if (pQueue->m_queue.empty() || pQueue->m_bRunning)
+		{
+			pthread_cond_wait(&pQueue->m_cond, &pQueue->m_mutex);
+			continue;
+		}
+
+		pthread_mutex_unlock(&pQueue->m_mutex);
+		pQueue->RunNext();
+		pthread_mutex_lock(&pQueue->m_mutex);
+	}
+	pthread_mutex_unlock(&pQueue->m_mutex);
+
+	return NULL;
+}
+
+ERR_CODE CIBootQueue::Start()
+{
+	if (m_bThread)
+		return IB_SUCCESS;
+
+	m_bStopping = false;
+	if (pthread_create(&m_thread, NULL, ThreadMain, this) != 0)
+		return IB_FAIL;
+
+	m_bThread = true;
+	return IB_SUCCESS;
+}
+
+void CIBootQueue::Stop()
+{
+	if (!m_bThread)
+		return;
+
+	pthread_mutex_lock(&m_mutex);
+	m_bStopping = true;
+	pthread_cond_broadcast(&m_cond);
+	pthread_mutex_unlock(&m_mutex);
+
+	pthread_join(m_thread, NULL);
+	m_bThread = false;
+}
+
+void CIBootQueue::Wait()
+{
+	pthread_mutex_lock(&m_mutex);
+	while (m_nOutstanding > 0)
+	{
+		if (!m_bThread && !m_bRunning)
+		{
+			// nobody else is going to run them
+			pthread_mutex_unlock(&m_mutex);
+			RunNext();
+			pthread_mutex_lock(&m_mutex);
+			continue;
+		}
+
+		pthread_cond_wait(&m_cond, &m_mutex);
+	}
+	pthread_mutex_unlock(&m_mutex);
+}
+
+unsigned int CIBootQueue::Pending()
+{
+	pthread_mutex_lock(&m_mutex);
+	unsigned int nPending = m_nOutstanding;
+	pthread_mutex_unlock(&m_mutex);
+
+	return nPending;
+}
+
+}; // end namespace
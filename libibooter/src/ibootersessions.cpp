@@ -0,0 +1,246 @@
+#include "ibootersessions.h"
+#include <cassert>
+
+namespace ibooter
+{
+
+CIBootSessionManager::CIBootSessionManager(unsigned int nWorkers)
+: m_nWorkers(nWorkers ? nWorkers : 1), m_bStopping(false), m_nGeneration(0), m_nOutstanding(0), m_nNext(0)
+{
+	pthread_mutex_init(&m_mutex, NULL);
+	pthread_cond_init(&m_work, NULL);
+	pthread_cond_init(&m_done, NULL);
+}
+
+CIBootSessionManager::~CIBootSessionManager()
+{
+	Stop();
+	CloseAll();
+
+	pthread_cond_destroy(&m_done);
+	pthread_cond_destroy(&m_work);
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void CIBootSessionManager::CloseAll()
+{
+	// only ever called with the workers stopped
+	assert(m_vThreads.empty());
+
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+	{
+		SSession *pSession = m_vSessions[i];
+		delete pSession->pQueue;
+		delete pSession->pConn;
+		delete pSession->pTransport;
+		delete pSession;
+	}
+
+	m_vSessions.clear();
+
+	// whatever was still queued went with them
+	pthread_mutex_lock(&m_mutex);
+	m_nOutstanding = 0;
+	pthread_mutex_unlock(&m_mutex);
+}
+
+int CIBootSessionManager::OpenAll(int nVendor, int nProduct)
+{
+	if (!m_vThreads.empty())
+		return -1;
+
+	CloseAll();
+
+	std::vector<SDeviceLocation> vDevices;
+	CUsbTransport::Enumerate(nVendor, nProduct, vDevices);
+
+	pthread_mutex_lock(&m_mutex);
+	m_nOutstanding += vDevices.size();
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t i = 0; i < vDevices.size(); i++)
+	{
+		SSession *pSession = new SSession;
+		pSession->pManager = this;
+		pSession->pTransport = new CUsbTransport(vDevices[i]);
+		pSession->pConn = new CIBootConn(pSession->pTransport, nVendor, nProduct);
+		pSession->pQueue = new CIBootQueue(*pSession->pConn);
+		pSession->report.location = vDevices[i];
+		pSession->report.code = IB_SUCCESS;
+		pSession->report.lBytes = 0;
+		pSession->report.dElapsed = 0;
+		m_vSessions.push_back(pSession);
+
+		pSession->pQueue->SubmitConnect(Record, pSession);
+	}
+
+	Wake();
+	return vDevices.size();
+}
+
+unsigned int CIBootSessionManager::Count() const
+{
+	return m_vSessions.size();
+}
+
+void CIBootSessionManager::Wake()
+{
+	pthread_mutex_lock(&m_mutex);
+	m_nGeneration++;
+	pthread_cond_broadcast(&m_work);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void CIBootSessionManager::RunScript(const std::vector<std::string> &vCommands)
+{
+	// counted first so Wait can't see the queues drain before all of the script is accounted for
+	pthread_mutex_lock(&m_mutex);
+	m_nOutstanding += vCommands.size() * m_vSessions.size();
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+		m_vSessions[i]->pQueue->SubmitBatch(vCommands, Record, m_vSessions[i]);
+
+	Wake();
+}
+
+void CIBootSessionManager::SendCommand(const char *szCmd)
+{
+	pthread_mutex_lock(&m_mutex);
+	m_nOutstanding += m_vSessions.size();
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+		m_vSessions[i]->pQueue->SubmitCommand(szCmd, true, Record, m_vSessions[i]);
+
+	Wake();
+}
+
+void CIBootSessionManager::SendFile(const char *szFile, unsigned long lLoadAddr)
+{
+	pthread_mutex_lock(&m_mutex);
+	m_nOutstanding += m_vSessions.size();
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+		m_vSessions[i]->pQueue->SubmitSendFile(szFile, lLoadAddr, Record, m_vSessions[i]);
+
+	Wake();
+}
+
+void CIBootSessionManager::Record(const SOpResult &result, void *pContext)
+{
+	SSession *pSession = (SSession *)pContext;
+	CIBootSessionManager *pManager = pSession->pManager;
+
+	pthread_mutex_lock(&pManager->m_mutex);
+	pSession->report.vResults.push_back(result);
+	pSession->report.lBytes += result.lBytes;
+	pSession->report.dElapsed += result.dElapsed;
+	if (result.code != IB_SUCCESS && pSession->report.code == IB_SUCCESS)
+		pSession->report.code = result.code;
+
+	pManager->m_nOutstanding--;
+	pthread_cond_broadcast(&pManager->m_done);
+	pthread_mutex_unlock(&pManager->m_mutex);
+}
+
+void *CIBootSessionManager::WorkerMain(void *pArg)
+{
+	CIBootSessionManager *pManager = (CIBootSessionManager *)pArg;
+	// fixed for as long as the workers run: OpenAll refuses to touch the sessions until they've been stopped
+	size_t nSessions = pManager->m_vSessions.size();
+
+	pthread_mutex_lock(&pManager->m_mutex);
+	while (!pManager->m_bStopping)
+	{
+		unsigned int nGeneration = pManager->m_nGeneration;
+		size_t nStart = nSessions ? pManager->m_nNext++ % nSessions : 0;
+		pthread_mutex_unlock(&pManager->m_mutex);
+
+		// RunNext refuses queues that are empty or already being run by another worker
+		bool bRan = false;
+		for (size_t i = 0; i < nSessions && !bRan; i++)
+			bRan = pManager->m_vSessions[(nStart + i) % nSessions]->pQueue->RunNext();
+
+		pthread_mutex_lock(&pManager->m_mutex);
+		if (!bRan && nGeneration == pManager->m_nGeneration && !pManager->m_bStopping)
+			pthread_cond_wait(&pManager->m_work, &pManager->m_mutex);
+	}
+	pthread_mutex_unlock(&pManager->m_mutex);
+
+	return NULL;
+}
+
+ERR_CODE CIBootSessionManager::Start()
+{
+	if (!m_vThreads.empty())
+		return IB_SUCCESS;
+
+	m_bStopping = false;
+
+	unsigned int nWorkers = m_nWorkers;
+	if (nWorkers > m_vSessions.size() && !m_vSessions.empty())
+		nWorkers = m_vSessions.size();
+
+	for (unsigned int i = 0; i < nWorkers; i++)
+	{
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, WorkerMain, this) != 0)
+		{
+			Stop();
+			return IB_FAIL;
+		}
+
+		m_vThreads.push_back(thread);
+	}
+
+	return IB_SUCCESS;
+}
+
+void CIBootSessionManager::Stop()
+{
+	pthread_mutex_lock(&m_mutex);
+	m_bStopping = true;
+	pthread_cond_broadcast(&m_work);
+	pthread_mutex_unlock(&m_mutex);
+
+	for (size_t i = 0; i < m_vThreads.size(); i++)
+		pthread_join(m_vThreads[i], NULL);
+
+	m_vThreads.clear();
+}
+
+void CIBootSessionManager::Wait()
+{
+	pthread_mutex_lock(&m_mutex);
+	while (m_nOutstanding > 0 && !m_vThreads.empty())
+		pthread_cond_wait(&m_done, &m_mutex);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void CIBootSessionManager::Report(std::vector<SSessionReport> &vReports)
+{
+	pthread_mutex_lock(&m_mutex);
+	vReports.clear();
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+		vReports.push_back(m_vSessions[i]->report);
+	pthread_mutex_unlock(&m_mutex);
+}
+
+unsigned int CIBootSessionManager::Failed()
+{
+	unsigned int nFailed = 0;
+
+	pthread_mutex_lock(&m_mutex);
+	for (size_t i = 0; i < m_vSessions.size(); i++)
+	{
+		if (m_vSessions[i]->report.code != IB_SUCCESS)
+			nFailed++;
+	}
+	pthread_mutex_unlock(&m_mutex);
+
+	return nFailed;
+}
+
+}; // end namespace
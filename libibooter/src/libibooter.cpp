@@ -6,48 +6,87 @@
 #include "libibooter.h"
 #include <cstring>
 #include <cstdio>
+#include <ctime>
+#include <unistd.h>
+#include <pthread.h>
 
 namespace ibooter
 {
 
-CIBootConn::CIBootConn(int nVendor, int nProduct)
-: m_nVendorId(nVendor), m_nProductId(nProduct), m_pDevice(NULL)
-{
-	m_pSend = new SMessage;
-	m_pRecv = new SMessage;
+static pthread_once_t g_usbInit = PTHREAD_ONCE_INIT;
 
+void CUsbTransport::InitUsb()
+{
 	usb_init();
+}
+
+CUsbTransport::CUsbTransport()
+: m_pDevice(NULL), m_bLocated(false)
+{
+	pthread_once(&g_usbInit, InitUsb);
 	usb_find_busses();
 	usb_find_devices();
 }
 
-CIBootConn::~CIBootConn()
+// No rescan here: the bus list was just built by Enumerate, and rescanning frees the entries of devices that have
+// gone away while other transports may be walking it.
+CUsbTransport::CUsbTransport(const SDeviceLocation &location)
+: m_pDevice(NULL), m_location(location), m_bLocated(true)
 {
-	Disconnect();
-
-	delete m_pSend;
-	delete m_pRecv;
+	pthread_once(&g_usbInit, InitUsb);
 }
 
-struct usb_device *CIBootConn::FindDevice(int nVendor, int nProduct) const
+int CUsbTransport::Enumerate(int nVendor, int nProduct, std::vector<SDeviceLocation> &vDevices)
 {
+	pthread_once(&g_usbInit, InitUsb);
+	usb_find_busses();
+	usb_find_devices();
+
+	vDevices.clear();
 	for(struct usb_bus *bus = usb_get_busses(); bus; bus = bus->next)
 	{
 		for(struct usb_device *dev = bus->devices; dev; dev = dev->next)
 		{
 			if(dev->descriptor.idVendor == nVendor && dev->descriptor.idProduct == nProduct)
 			{
-				return dev;
+				SDeviceLocation location;
+				location.sBus = bus->dirname;
+				location.sDevice = dev->filename;
+				vDevices.push_back(location);
 			}
 		}
 	}
 
+	return vDevices.size();
+}
+
+CUsbTransport::~CUsbTransport()
+{
+	Close();
+}
+
+struct usb_device *CUsbTransport::FindDevice(int nVendor, int nProduct) const
+{
+	for(struct usb_bus *bus = usb_get_busses(); bus; bus = bus->next)
+	{
+		for(struct usb_device *dev = bus->devices; dev; dev = dev->next)
+		{
+			if(dev->descriptor.idVendor != nVendor || dev->descriptor.idProduct != nProduct)
+				continue;
+
+			if(m_bLocated && (m_location.sBus != bus->dirname || m_location.sDevice != dev->filename))
+				continue;
+
+			return dev;
+		}
+	}
+
 	return NULL;
 }
 
-ERR_CODE CIBootConn::Connect()
+ERR_CODE CUsbTransport::Open(int nVendor, int nProduct)
 {
-	struct usb_device *pDevice = FindDevice(m_nVendorId, m_nProductId);
+	struct usb_device *pDevice = FindDevice(nVendor, nProduct);
 	if (!pDevice)
 		return IB_DEVICE_NOT_FOUND;
 
@@ -55,20 +94,119 @@ ERR_CODE CIBootConn::Connect()
 	if (!pHandle)
 		return IB_FAILED_TO_OPEN;
 
-	m_pDevice = pHandle;
-	if(usb_set_configuration(m_pDevice, 1) < 0)
+	if(usb_set_configuration(pHandle, 1) < 0)
 	{
-		CloseUsb();
+		usb_close(pHandle);
 		return IB_FAILED_TO_CONFIGURE;
 	}
 
-	if(usb_claim_interface(m_pDevice, 0) < 0)
+	if(usb_claim_interface(pHandle, 0) < 0)
 	{
-		CloseUsb();
+		usb_close(pHandle);
 		return IB_FAILED_TO_CLAIM;
 	}
 
+	m_pDevice = pHandle;
+	return IB_SUCCESS;
+}
+
+void CUsbTransport::Close()
+{
+	if (m_pDevice)
+	{
+		usb_release_interface(m_pDevice, 0);
+		usb_close(m_pDevice);
+		m_pDevice = NULL;
+	}
+}
+
+ERR_CODE CUsbTransport::BulkWrite(int nEndpoint, char *pBuffer, int &nLength)
+{
+	if (!m_pDevice)
+		return IB_CONNECTION_LOST;
+
+	int nWritten = 0;
+	if ((nWritten = usb_bulk_write(m_pDevice, nEndpoint, pBuffer, nLength, USB_TIMEOUT)) < 0)
+		return IB_CONNECTION_LOST;
+
+	nLength = nWritten;
+	return IB_SUCCESS;
+}
+
+ERR_CODE CUsbTransport::BulkRead(int nEndpoint, char *pBuffer, int &nLength)
+{
+	if (!m_pDevice)
+		return IB_CONNECTION_LOST;
+
+	int nRead = 0;
+	if ((nRead = usb_bulk_read(m_pDevice, nEndpoint, pBuffer, nLength, USB_TIMEOUT)) < 0)
+		return IB_CONNECTION_LOST;
+
+	nLength = nRead;
+	return IB_SUCCESS;
+}
+
+ERR_CODE CUsbTransport::InterruptWrite(int nEndpoint, char *pBuffer, int &nLength)
+{
+	if (!m_pDevice)
+		return IB_CONNECTION_LOST;
+
+	int nWritten = 0;
+	if ((nWritten = usb_interrupt_write(m_pDevice, nEndpoint, pBuffer, nLength, USB_TIMEOUT)) < 0)
+		return IB_CONNECTION_LOST;
+
+	nLength = nWritten;
+	return IB_SUCCESS;
+}
+
+ERR_CODE CUsbTransport::InterruptRead(int nEndpoint, char *pBuffer, int &nLength)
+{
+	if (!m_pDevice)
+		return IB_CONNECTION_LOST;
+
+	int nRead = 0;
+	if ((nRead = usb_interrupt_read(m_pDevice, nEndpoint, pBuffer, nLength, USB_TIMEOUT)) < 0)
+		return IB_CONNECTION_LOST;
+
+	nLength = nRead;
+	return IB_SUCCESS;
+}
+
+CIBootConn::CIBootConn(int nVendor, int nProduct)
+: m_nVendorId(nVendor), m_nProductId(nProduct), m_pTransport(new CUsbTransport), m_bOwnTransport(true),
+	m_bConnected(false)
+{
+	m_pSend = new SMessage;
+	m_pRecv = new SMessage;
+}
+
+CIBootConn::CIBootConn(ITransport *pTransport, int nVendor, int nProduct)
+: m_nVendorId(nVendor), m_nProductId(nProduct), m_pTransport(pTransport), m_bOwnTransport(false),
+	m_bConnected(false)
+{
+	m_pSend = new SMessage;
+	m_pRecv = new SMessage;
+}
+
+CIBootConn::~CIBootConn()
+{
+	Disconnect();
+
+	if (m_bOwnTransport)
+		delete m_pTransport;
+
+	delete m_pSend;
+	delete m_pRecv;
+}
+
+ERR_CODE CIBootConn::Connect()
+{
 	ERR_CODE code;
+	if ((code = m_pTransport->Open(m_nVendorId, m_nProductId)) != IB_SUCCESS)
+		return code;
+
+	m_bConnected = true;
+
 	if ((code = RequestInitial(m_pSend, m_pRecv)) != IB_SUCCESS)
 		return code;
 
@@ -80,10 +218,10 @@ ERR_CODE CIBootConn::Connect()
 
 ERR_CODE CIBootConn::Disconnect()
 {
-	if (m_pDevice)
+	if (m_bConnected)
 	{
-		usb_release_interface(m_pDevice, 0);
-		CloseUsb();
+		m_pTransport->Close();
+		m_bConnected = false;
 	}
 
 	return IB_SUCCESS;
@@ -95,15 +233,36 @@ ERR_CODE CIBootConn::GetResponse(const char *&ppBuffer)
 	m_sResponse.clear();
 	ppBuffer = NULL;
 
+	// iBoot only hands its output over when asked, so poll: straight away while output is flowing, backing off
+	// while the device has nothing to say, and giving up once it has been quiet for too long.
+	useconds_t nDelay = POLL_MIN_DELAY;
+	time_t tLastOutput = time(NULL);
+
 	do
 	{
-		sleep(1);
+		if ((code = RequestDumpBuffer(m_pSend, m_pRecv)) != IB_SUCCESS)
+			return code;
 
-		RequestDumpBuffer(m_pSend, m_pRecv);
 		if(m_pRecv->cmdcode != MSG_ACK)
 			return IB_COMMAND_NOT_ACK;
 
 		int rcvd = m_pRecv->size;
+		if (rcvd <= 0)
+		{
+			if (time(NULL) - tLastOutput > RESPONSE_TIMEOUT)
+				return IB_FAIL;
+
+			usleep(nDelay);
+			if (nDelay < POLL_MAX_DELAY)
+				nDelay *= 2;
+
+			code = IB_DUMPING_BUFFER;
+			continue;
+		}
+
+		nDelay = POLL_MIN_DELAY;
+		tLastOutput = time(NULL);
+
 		char *buf = new char[rcvd + 1];
 		memset(buf, 0, rcvd + 1);
 
@@ -114,20 +273,15 @@ ERR_CODE CIBootConn::GetResponse(const char *&ppBuffer)
 		}
 
 		m_sResponse += buf;
-
-		code = IB_FAIL; 
-		if (rcvd >= 4)
-		{
-			if ((buf[rcvd-2]==']'&&buf[rcvd-1]==' ')|| (buf[rcvd-3]==']'&&buf[rcvd-2]==' ')|| (buf[rcvd-4]==']'&&buf[rcvd-3]==' ')|| (buf[rcvd-5]==']'&&buf[rcvd-4]==' ')) 
-				code = IB_SUCCESS;
-			else
-			{
-				code = IB_DUMPING_BUFFER;
-			}
-		}
-
 		delete [] buf;
 
+		// done once the prompt ("] ") shows up at the end of the output
+		size_t nPrompt = m_sResponse.rfind("] ");
+		if (nPrompt != std::string::npos && nPrompt + 5 >= m_sResponse.size())
+			code = IB_SUCCESS;
+		else
+			code = IB_DUMPING_BUFFER;
+
 	} while (code == IB_DUMPING_BUFFER);
 
 	if (code == IB_SUCCESS)
@@ -136,17 +290,23 @@ ERR_CODE CIBootConn::GetResponse(const char *&ppBuffer)
 	return code;
 }
 
-ERR_CODE CIBootConn::SendFile(const char *szFile, unsigned long lLoadAddr)
+ERR_CODE CIBootConn::SendFile(const char *szFile, unsigned long lLoadAddr, unsigned long *plSent)
 {
 	FILE *sf = fopen(szFile, "r");
 	if(sf == NULL)
 		return IB_FILE_NOT_FOUND;
 
 	fseek(sf, 0, SEEK_END);
-	int filelen = filelen = ftell(sf);
+	int filelen = ftell(sf);
 	fseek(sf, 0, SEEK_SET);
 
-	RequestSendFile(m_pSend, m_pRecv, filelen, lLoadAddr);
+	ERR_CODE code;
+	if ((code = RequestSendFile(m_pSend, m_pRecv, filelen, lLoadAddr)) != IB_SUCCESS)
+	{
+		fclose(sf);
+		return code;
+	}
+
 	if(m_pRecv->cmdcode != MSG_ACK)
 	{
 		fclose(sf);
@@ -154,14 +314,23 @@ ERR_CODE CIBootConn::SendFile(const char *szFile, unsigned long lLoadAddr)
 	}
 
 	int sent;
-	char buffer[0x4000];
+	char *buf = new char[FILE_CHUNK];
 	do 
 	{
-		sent = fread(buffer, 1, sizeof(buffer), sf);
-		WriteFile(buffer, sent);
-	} while(sent == sizeof(buffer));
+		sent = fread(buf, 1, FILE_CHUNK, sf);
+		if (sent > 0 && (code = WriteFile(buf, sent)) != IB_SUCCESS)
+			break;
+	} while(sent == FILE_CHUNK);
+	delete [] buf;
 	fclose(sf);
 
+	if (code != IB_SUCCESS)
+		return code;
+
+	if (plSent)
+		*plSent = filelen;
+
+	char buffer[64];
 	sprintf(buffer, "setenv filesize 0x%x\n", filelen);
 	return SendCommand(buffer);
 }
@@ -172,28 +341,49 @@ ERR_CODE CIBootConn::GetFile(const char *szFile, unsigned long lLoadAddr, int nL
 	if (sf == NULL)
 		return IB_FILE_NOT_FOUND;
 
-	RequestSendFile(m_pSend, m_pRecv, nLen, lLoadAddr);
+	ERR_CODE code;
+	if ((code = RequestSendFile(m_pSend, m_pRecv, nLen, lLoadAddr)) != IB_SUCCESS)
+	{
+		fclose(sf);
+		return code;
+	}
+
 	if (m_pRecv->cmdcode != MSG_ACK)
 	{
 		fclose(sf);
 		return IB_COMMAND_NOT_ACK;
 	}
 
-	int read = nLen;
-	char *buf = new char[read];
-
-	ERR_CODE code = IB_SUCCESS;
-	if ((code = ReadFile(buf, read)) != IB_SUCCESS)
+	// stream to disk a chunk at a time rather than holding the whole image in memory
+	char *buf = new char[FILE_CHUNK];
+	int left = nLen;
+	while (left > 0)
 	{
-		delete [] buf;
-		fclose(sf);
-		return code;
+		int read = (left > FILE_CHUNK) ? FILE_CHUNK : left;
+		if ((code = ReadFile(buf, read)) != IB_SUCCESS)
+			break;
+
+		if (read == 0)
+		{
+			code = IB_CONNECTION_LOST;
+			break;
+		}
+
+		if (fwrite(buf, 1, read, sf) != (size_t)read)
+		{
+			code = IB_FAIL;
+			break;
+		}
+
+		left -= read;
 	}
 
-	fwrite(buf, 1, read, sf);
 	delete [] buf;
 	fclose(sf);
 
+	if (code != IB_SUCCESS)
+		return code;
+
 	char buffer[64];
 	sprintf(buffer, "setenv filesize 0x%x\n", nLen);
 	return SendCommand(buffer);
@@ -201,38 +391,24 @@ ERR_CODE CIBootConn::GetFile(const char *szFile, unsigned long lLoadAddr, int nL
 
 ERR_CODE CIBootConn::WriteFile(char *pBuffer, int &nLength)
 {
-	int nWritten = 0;
-	if ((nWritten = usb_bulk_write(m_pDevice, USB_WFILE_EP, pBuffer, nLength, USB_TIMEOUT)) < 0)
-		return IB_CONNECTION_LOST;
-
-	nLength = nWritten;
-	return IB_SUCCESS;
+	return m_pTransport->BulkWrite(USB_WFILE_EP, pBuffer, nLength);
 }
 
 ERR_CODE CIBootConn::ReadFile(char *pBuffer, int &nLength)
 {
-	int nRead = 0;
-	if ((nRead = usb_bulk_read(m_pDevice, USB_RFILE_EP, pBuffer, nLength, USB_TIMEOUT)) < 0)
-		return IB_CONNECTION_LOST;
-
-	nLength = nRead;
-	return IB_SUCCESS;
+	return m_pTransport->BulkRead(USB_RFILE_EP, pBuffer, nLength);
 }
 
 ERR_CODE CIBootConn::ReadControl(SMessage *pCtrl)
 {
-	if (usb_interrupt_read(m_pDevice, USB_RCONTROL_EP, (char *)pCtrl, sizeof(*pCtrl), USB_TIMEOUT) < 0) 
-		return IB_CONNECTION_LOST;
-
-	return IB_SUCCESS;
+	int nLength = sizeof(*pCtrl);
+	return m_pTransport->InterruptRead(USB_RCONTROL_EP, (char *)pCtrl, nLength);
 }
 
 ERR_CODE CIBootConn::WriteControl(SMessage *pCtrl)
 {
-	if (usb_interrupt_write(m_pDevice, USB_WCONTROL_EP, (char *)pCtrl, sizeof(*pCtrl), USB_TIMEOUT) < 0)
-		return IB_CONNECTION_LOST;
-
-	return IB_SUCCESS;
+	int nLength = sizeof(*pCtrl);
+	return m_pTransport->InterruptWrite(USB_WCONTROL_EP, (char *)pCtrl, nLength);
 }
 
 ERR_CODE CIBootConn::SendControl(SMessage *pSend, SMessage *pRcv)
@@ -303,7 +479,10 @@ ERR_CODE CIBootConn::SendCommand(const char *pCmd)
 {
 	int sendlen = (int)(((strlen(pCmd)-1)/0x10)+1)*0x10;
 
-	RequestSendCommand(m_pSend, m_pRecv, sendlen);
+	ERR_CODE code;
+	if ((code = RequestSendCommand(m_pSend, m_pRecv, sendlen)) != IB_SUCCESS)
+		return code;
+
 	if(m_pRecv->cmdcode != MSG_ACK)
 		return IB_COMMAND_NOT_ACK;
 
@@ -311,7 +490,7 @@ ERR_CODE CIBootConn::SendCommand(const char *pCmd)
 	memset(sendbuf, 0, sendlen);
 	memcpy(sendbuf, pCmd, strlen(pCmd));
 
-	ERR_CODE code = WriteSerial(sendbuf, sendlen);
+	code = WriteSerial(sendbuf, sendlen);
 	delete [] sendbuf;
 
 	return code;
@@ -319,28 +498,12 @@ ERR_CODE CIBootConn::SendCommand(const char *pCmd)
 
 ERR_CODE CIBootConn::WriteSerial(char *pBuffer, int &nLength)
 {
-	int nWritten = 0;
-	if ((nWritten = usb_bulk_write(m_pDevice, USB_WSERIAL_EP, pBuffer, nLength, USB_TIMEOUT)) < 0)
-		return IB_CONNECTION_LOST;
-
-	nLength = nWritten;
-	return IB_SUCCESS;
+	return m_pTransport->BulkWrite(USB_WSERIAL_EP, pBuffer, nLength);
 }
 
 ERR_CODE CIBootConn::ReadSerial(char *pBuffer, int &nLength)
 {
-	int nRead = 0;
-	if ((nRead = usb_bulk_read(m_pDevice, USB_RSERIAL_EP, pBuffer, nLength, USB_TIMEOUT)) < 0)
-		return IB_CONNECTION_LOST;
-
-	nLength = nRead;
-	return IB_SUCCESS;
-}
-
-void CIBootConn::CloseUsb()
-{
-	usb_close(m_pDevice);
-	m_pDevice = NULL;
+	return m_pTransport->BulkRead(USB_RSERIAL_EP, pBuffer, nLength);
 }
 
 };
@@ -0,0 +1,118 @@
+// Stands in for libusb-0.1 so libibooter builds without it. The bus holds whatever mock devices the tests attached;
+// transfers to one go straight to its CMockDevice.
+
+#include "usb.h"
+#include "fakeusb.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace ibooter;
+
+static std::vector<CMockDevice *> g_vAttached;
+static std::vector<struct usb_device> g_vDevices;
+static struct usb_bus g_bus;
+
+void fakeusb_attach(CMockDevice *pDevice)
+{
+	g_vAttached.push_back(pDevice);
+}
+
+void fakeusb_detach_all()
+{
+	g_vAttached.clear();
+}
+
+static CMockDevice *Device(usb_dev_handle *dev)
+{
+	return (CMockDevice *)dev;
+}
+
+extern "C" {
+
+void usb_init(void)
+{
+}
+
+int usb_find_busses(void)
+{
+	return 0;
+}
+
+// Like the real thing, this rebuilds the list that usb_get_busses hands out
+int usb_find_devices(void)
+{
+	g_vDevices.assign(g_vAttached.size(), usb_device());
+	memset(&g_bus, 0, sizeof(g_bus));
+	strcpy(g_bus.dirname, "001");
+
+	for (size_t i = 0; i < g_vAttached.size(); i++)
+	{
+		struct usb_device *pDevice = &g_vDevices[i];
+		memset(pDevice, 0, sizeof(*pDevice));
+		sprintf(pDevice->filename, "%03d", (int)i + 1);
+		pDevice->bus = &g_bus;
+		pDevice->descriptor.idVendor = CIBootConn::USB_VENDOR_ID;
+		pDevice->descriptor.idProduct = CIBootConn::USB_PRODUCT_ID;
+		pDevice->dev = g_vAttached[i];
+		pDevice->next = (i + 1 < g_vAttached.size()) ? &g_vDevices[i + 1] : NULL;
+		pDevice->prev = i ? &g_vDevices[i - 1] : NULL;
+	}
+
+	g_bus.devices = g_vDevices.empty() ? NULL : &g_vDevices[0];
+	return 0;
+}
+
+struct usb_bus *usb_get_busses(void)
+{
+	return &g_bus;
+}
+
+usb_dev_handle *usb_open(struct usb_device *dev)
+{
+	Device((usb_dev_handle *)dev->dev)->Opened();
+	return (usb_dev_handle *)dev->dev;
+}
+
+int usb_close(usb_dev_handle *dev)
+{
+	Device(dev)->Closed();
+	return 0;
+}
+
+int usb_set_configuration(usb_dev_handle *dev, int configuration)
+{
+	return 0;
+}
+
+int usb_claim_interface(usb_dev_handle *dev, int interface)
+{
+	return 0;
+}
+
+int usb_release_interface(usb_dev_handle *dev, int interface)
+{
+	return 0;
+}
+
+int usb_bulk_write(usb_dev_handle *dev, int ep, const char *bytes, int size, int timeout)
+{
+	return (Device(dev)->Write(ep, bytes, size) == IB_SUCCESS) ? size : -1;
+}
+
+int usb_bulk_read(usb_dev_handle *dev, int ep, char *bytes, int size, int timeout)
+{
+	return (Device(dev)->Read(ep, bytes, size) == IB_SUCCESS) ? size : -1;
+}
+
+int usb_interrupt_write(usb_dev_handle *dev, int ep, const char *bytes, int size, int timeout)
+{
+	return (Device(dev)->Write(ep, bytes, size) == IB_SUCCESS) ? size : -1;
+}
+
+int usb_interrupt_read(usb_dev_handle *dev, int ep, char *bytes, int size, int timeout)
+{
+	return (Device(dev)->Read(ep, bytes, size) == IB_SUCCESS) ? size : -1;
+}
+
+}
@@ -0,0 +1,11 @@
+#ifndef FAKEUSB_H
+#define FAKEUSB_H
+
+#include "mockdevice.h"
+
+// Plugs a mock device into the fake bus, where CUsbTransport (and so CIBootSessionManager) can find it. The device
+// stays owned by the caller and must stay plugged in until the tests are done with it.
+void fakeusb_attach(ibooter::CMockDevice *pDevice);
+void fakeusb_detach_all();
+
+#endif
@@ -0,0 +1,364 @@
+#include "mockdevice.h"
+#include <cstring>
+#include <cstdlib>
+
+namespace ibooter
+{
+
+pthread_mutex_t CMockDevice::s_busyMutex = PTHREAD_MUTEX_INITIALIZER;
+int CMockDevice::s_nBusy = 0;
+int CMockDevice::s_nMaxBusy = 0;
+
+CMockDevice::CMockDevice()
+{
+	SMockOptions options;
+	memset(&options, 0, sizeof(options));
+	Init(options);
+}
+
+CMockDevice::CMockDevice(const SMockOptions &options)
+{
+	Init(options);
+}
+
+void CMockDevice::Init(const SMockOptions &options)
+{
+	m_options = options;
+	pthread_mutex_init(&m_mutex, NULL);
+	m_pMemory = new unsigned char[MEMORY_SIZE];
+	memset(m_pMemory, 0, MEMORY_SIZE);
+	m_nControls = 0;
+	m_nCommandsAcked = 0;
+	m_nOpens = 0;
+	m_nCommandLeft = 0;
+	m_lFileAddr = 0;
+	m_nFileLeft = 0;
+}
+
+CMockDevice::~CMockDevice()
+{
+	delete [] m_pMemory;
+	pthread_mutex_destroy(&m_mutex);
+}
+
+void CMockDevice::Opened()
+{
+	pthread_mutex_lock(&m_mutex);
+	m_nOpens++;
+	m_sOutput += "iBoot mock\n] ";
+	pthread_mutex_unlock(&m_mutex);
+}
+
+void CMockDevice::Closed()
+{
+}
+
+void CMockDevice::Reply(short int cmdcode, int size)
+{
+	SMessage reply;
+	reply.cmdcode = cmdcode;
+	reply.constant = 0x1234;
+	reply.size = size;
+	reply.unknown = 0;
+	m_replies.push_back(reply);
+}
+
+void CMockDevice::Control(const SMessage &msg)
+{
+	switch (msg.cmdcode)
+	{
+		case 0:
+			Reply(MSG_ACK, 0);
+			break;
+
+		case MSG_DUMP_BUFFER:
+			Reply(MSG_ACK, m_sOutput.size());
+			break;
+
+		case MSG_SEND_COMMAND:
+			if (++m_nCommandsAcked == m_options.nRejectCommand)
+			{
+				Reply(MSG_REJECT, 0);
+				break;
+			}
+
+			m_nCommandLeft = msg.size;
+			m_sCommand.clear();
+			Reply(MSG_ACK, 0);
+			break;
+
+		case MSG_SEND_FILE:
+			if (!Memory((unsigned int)msg.unknown, msg.size))
+			{
+				Reply(MSG_REJECT, 0);
+				break;
+			}
+
+			m_lFileAddr = (unsigned int)msg.unknown;
+			m_nFileLeft = msg.size;
+			Reply(MSG_ACK, 0);
+			break;
+
+		default:
+			Reply(MSG_REJECT, 0);
+			break;
+	}
+}
+
+void CMockDevice::Run(const std::string &sCmd)
+{
+	m_vCommands.push_back(sCmd);
+
+	pthread_mutex_lock(&s_busyMutex);
+	if (++s_nBusy > s_nMaxBusy)
+		s_nMaxBusy = s_nBusy;
+	pthread_mutex_unlock(&s_busyMutex);
+
+	// the device is busy, not the host: let other devices get on with it meanwhile
+	pthread_mutex_unlock(&m_mutex);
+	if (m_options.nCommandDelay)
+		usleep(m_options.nCommandDelay);
+	pthread_mutex_lock(&m_mutex);
+
+	pthread_mutex_lock(&s_busyMutex);
+	s_nBusy--;
+	pthread_mutex_unlock(&s_busyMutex);
+
+	m_sOutput += sCmd + "\n";
+
+	if (sCmd.compare(0, 7, "setenv ") == 0)
+	{
+		size_t nSpace = sCmd.find(' ', 7);
+		if (nSpace != std::string::npos)
+			m_env[sCmd.substr(7, nSpace - 7)] = sCmd.substr(nSpace + 1);
+	}
+	else if (sCmd == "printenv")
+	{
+		for (std::map<std::string, std::string>::iterator it = m_env.begin(); it != m_env.end(); ++it)
+			m_sOutput += it->first + " = " + it->second + "\n";
+	}
+	else if (sCmd.compare(0, 5, "echo ") == 0)
+	{
+		m_sOutput += sCmd.substr(5) + "\n";
+	}
+
+	m_sOutput += "] ";
+}
+
+ERR_CODE CMockDevice::Write(int nEndpoint, const char *pBuffer, int &nLength)
+{
+	ERR_CODE code = IB_SUCCESS;
+
+	pthread_mutex_lock(&m_mutex);
+	if (m_options.nDropAfter && m_nControls >= m_options.nDropAfter)
+	{
+		pthread_mutex_unlock(&m_mutex);
+		return IB_CONNECTION_LOST;
+	}
+
+	switch (nEndpoint)
+	{
+		case 0x04:
+			if (nLength != sizeof(SMessage))
+			{
+				code = IB_FAIL;
+				break;
+			}
+
+			{
+				SMessage msg;
+				memcpy(&msg, pBuffer, sizeof(msg));
+				m_nControls++;
+				Control(msg);
+			}
+			break;
+
+		case 0x02:
+			if (nLength > m_nCommandLeft)
+			{
+				code = IB_FAIL;
+				break;
+			}
+
+			m_sCommand.append(pBuffer, nLength);
+			m_nCommandLeft -= nLength;
+			if (m_nCommandLeft == 0)
+			{
+				// padded out with NULs, and newline-terminated by most callers
+				std::string sCmd(m_sCommand.c_str());
+				while (!sCmd.empty() && (sCmd[sCmd.size() - 1] == '\n' || sCmd[sCmd.size() - 1] == '\r'))
+					sCmd.erase(sCmd.size() - 1);
+				Run(sCmd);
+			}
+			break;
+
+		case 0x05:
+			if (nLength > m_nFileLeft)
+			{
+				code = IB_FAIL;
+				break;
+			}
+
+			memcpy(Memory(m_lFileAddr, nLength), pBuffer, nLength);
+			m_lFileAddr += nLength;
+			m_nFileLeft -= nLength;
+			break;
+
+		default:
+			code = IB_FAIL;
+			break;
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+	return code;
+}
+
+ERR_CODE CMockDevice::Read(int nEndpoint, char *pBuffer, int &nLength)
+{
+	ERR_CODE code = IB_SUCCESS;
+
+	pthread_mutex_lock(&m_mutex);
+	if (m_options.nDropAfter && m_nControls >= m_options.nDropAfter)
+	{
+		pthread_mutex_unlock(&m_mutex);
+		return IB_CONNECTION_LOST;
+	}
+
+	switch (nEndpoint)
+	{
+		case 0x83:
+			// nothing to say is a timeout, as far as the host can tell
+			if (m_replies.empty() || nLength < (int)sizeof(SMessage))
+			{
+				code = IB_CONNECTION_LOST;
+				break;
+			}
+
+			memcpy(pBuffer, &m_replies.front(), sizeof(SMessage));
+			m_replies.pop_front();
+			nLength = sizeof(SMessage);
+			break;
+
+		case 0x81:
+			if (nLength > (int)m_sOutput.size())
+				nLength = m_sOutput.size();
+
+			memcpy(pBuffer, m_sOutput.data(), nLength);
+			m_sOutput.erase(0, nLength);
+			break;
+
+		case 0x85:
+			if (nLength > m_nFileLeft)
+				nLength = m_nFileLeft;
+
+			memcpy(pBuffer, Memory(m_lFileAddr, nLength), nLength);
+			m_lFileAddr += nLength;
+			m_nFileLeft -= nLength;
+			break;
+
+		default:
+			code = IB_FAIL;
+			break;
+	}
+
+	pthread_mutex_unlock(&m_mutex);
+	return code;
+}
+
+std::vector<std::string> CMockDevice::Commands()
+{
+	pthread_mutex_lock(&m_mutex);
+	std::vector<std::string> vCommands = m_vCommands;
+	pthread_mutex_unlock(&m_mutex);
+
+	return vCommands;
+}
+
+std::string CMockDevice::Env(const std::string &sName)
+{
+	pthread_mutex_lock(&m_mutex);
+	std::string sValue = m_env[sName];
+	pthread_mutex_unlock(&m_mutex);
+
+	return sValue;
+}
+
+unsigned char *CMockDevice::Memory(unsigned long lAddr, unsigned long lLength)
+{
+	if (lAddr < MEMORY_BASE || lAddr - MEMORY_BASE + lLength > MEMORY_SIZE)
+		return NULL;
+
+	return m_pMemory + (lAddr - MEMORY_BASE);
+}
+
+int CMockDevice::Opens()
+{
+	pthread_mutex_lock(&m_mutex);
+	int nOpens = m_nOpens;
+	pthread_mutex_unlock(&m_mutex);
+
+	return nOpens;
+}
+
+int CMockDevice::MaxBusy()
+{
+	pthread_mutex_lock(&s_busyMutex);
+	int nMax = s_nMaxBusy;
+	pthread_mutex_unlock(&s_busyMutex);
+
+	return nMax;
+}
+
+void CMockDevice::ResetBusy()
+{
+	pthread_mutex_lock(&s_busyMutex);
+	s_nBusy = 0;
+	s_nMaxBusy = 0;
+	pthread_mutex_unlock(&s_busyMutex);
+}
+
+CMockTransport::CMockTransport(CMockDevice &device)
+: m_device(device), m_bOpen(false)
+{
+}
+
+ERR_CODE CMockTransport::Open(int nVendor, int nProduct)
+{
+	if (nVendor != CIBootConn::USB_VENDOR_ID || nProduct != CIBootConn::USB_PRODUCT_ID)
+		return IB_DEVICE_NOT_FOUND;
+
+	m_bOpen = true;
+	m_device.Opened();
+	return IB_SUCCESS;
+}
+
+void CMockTransport::Close()
+{
+	if (m_bOpen)
+	{
+		m_bOpen = false;
+		m_device.Closed();
+	}
+}
+
+ERR_CODE CMockTransport::BulkWrite(int nEndpoint, char *pBuffer, int &nLength)
+{
+	return m_bOpen ? m_device.Write(nEndpoint, pBuffer, nLength) : IB_CONNECTION_LOST;
+}
+
+ERR_CODE CMockTransport::BulkRead(int nEndpoint, char *pBuffer, int &nLength)
+{
+	return m_bOpen ? m_device.Read(nEndpoint, pBuffer, nLength) : IB_CONNECTION_LOST;
+}
+
+ERR_CODE CMockTransport::InterruptWrite(int nEndpoint, char *pBuffer, int &nLength)
+{
+	return m_bOpen ? m_device.Write(nEndpoint, pBuffer, nLength) : IB_CONNECTION_LOST;
+}
+
+ERR_CODE CMockTransport::InterruptRead(int nEndpoint, char *pBuffer, int &nLength)
+{
+	return m_bOpen ? m_device.Read(nEndpoint, pBuffer, nLength) : IB_CONNECTION_LOST;
+}
+
+}; // end namespace
@@ -0,0 +1,114 @@
+#ifndef MOCKDEVICE_H
+#define MOCKDEVICE_H
+
+#include "libibooter.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <deque>
+#include <map>
+
+namespace ibooter
+{
+
+// How a mock device should misbehave
+typedef struct SMockOptions
+{
+	useconds_t	nCommandDelay;	// time each command takes to run
+	int					nRejectCommand;	// refuse the Nth command with MSG_REJECT (0 = never)
+	int					nDropAfter;			// every transfer after this many control messages fails (0 = never)
+} SMockOptions;
+
+// Answers the iBoot protocol CIBootConn speaks, over the same endpoints: commands are echoed and followed by a
+// prompt, setenv and printenv work, and files land in (and come out of) a memory window at MEMORY_BASE.
+class CMockDevice
+{
+	public:
+		CMockDevice();
+		CMockDevice(const SMockOptions &options);
+		~CMockDevice();
+
+		ERR_CODE Write(int nEndpoint, const char *pBuffer, int &nLength);
+		ERR_CODE Read(int nEndpoint, char *pBuffer, int &nLength);
+
+		void Opened();
+		void Closed();
+
+		// Every command the device has run, in the order it ran them
+		std::vector<std::string> Commands();
+		std::string Env(const std::string &sName);
+		unsigned char *Memory(unsigned long lAddr, unsigned long lLength);
+		int Opens();
+
+		// The most devices that were running a command at the same moment
+		static int MaxBusy();
+		static void ResetBusy();
+
+		static unsigned long const MEMORY_BASE = 0x09000000;
+		static unsigned long const MEMORY_SIZE = 0x800000;
+
+	private:
+
+		typedef struct SMessage
+		{
+			short int cmdcode;
+			short int constant;
+			int 			size;
+			int 			unknown;
+		} SMessage;
+
+		static const short int MSG_DUMP_BUFFER		= 0x802;
+		static const short int MSG_SEND_COMMAND		=	0x803;
+		static const short int MSG_SEND_FILE			=	0x805;
+		static const short int MSG_ACK						=	0x808;
+		static const short int MSG_REJECT					=	0x809;
+
+		void Init(const SMockOptions &options);
+		void Control(const SMessage &msg);
+		void Run(const std::string &sCmd);
+		void Reply(short int cmdcode, int size);
+
+	private:
+		SMockOptions												m_options;
+		pthread_mutex_t											m_mutex;
+		std::deque<SMessage>								m_replies;
+		std::string													m_sOutput;
+		std::vector<std::string>						m_vCommands;
+		std::map<std::string, std::string>	m_env;
+		unsigned char												*m_pMemory;
+		int																	m_nControls;
+		int																	m_nCommandsAcked;
+		int																	m_nOpens;
+
+		// what the next bulk transfer is for
+		int																	m_nCommandLeft;
+		std::string													m_sCommand;
+		unsigned long												m_lFileAddr;
+		int																	m_nFileLeft;
+
+		static pthread_mutex_t							s_busyMutex;
+		static int													s_nBusy;
+		static int													s_nMaxBusy;
+};
+
+// Hands CIBootConn's transfers straight to a mock device.
+class CMockTransport : public ITransport
+{
+	public:
+		CMockTransport(CMockDevice &device);
+
+		ERR_CODE Open(int nVendor, int nProduct);
+		void Close();
+
+		ERR_CODE BulkWrite(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE BulkRead(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE InterruptWrite(int nEndpoint, char *pBuffer, int &nLength);
+		ERR_CODE InterruptRead(int nEndpoint, char *pBuffer, int &nLength);
+
+	private:
+		CMockDevice	&m_device;
+		bool				m_bOpen;
+};
+
+}; // end namespace
+
+#endif
@@ -0,0 +1,404 @@
+// test_ibooter: runs CIBootConn, CIBootQueue and CIBootSessionManager against mock devices, so the protocol, the
+// file transfers, the queue's ordering and failure handling and the session workers are checked without a phone
+// attached.
+
+#include "libibooter.h"
+#include "ibooterasync.h"
+#include "ibootersessions.h"
+#include "mockdevice.h"
+#include "fakeusb.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+using namespace ibooter;
+
+#define CHECK(condition) Check((condition), #condition, __FILE__, __LINE__)
+
+static int g_nFailures = 0;
+
+static void Check(bool bOk, const char *szWhat, const char *szFile, int nLine)
+{
+	if (bOk)
+		return;
+
+	fprintf(stderr, "%s:%d: check failed: %s\n", szFile, nLine, szWhat);
+	g_nFailures++;
+}
+
+static std::string TempPath()
+{
+	char szPath[] = "/tmp/test_ibooterXXXXXX";
+	int fd = mkstemp(szPath);
+	if (fd >= 0)
+		close(fd);
+
+	return szPath;
+}
+
+static std::string WriteNoise(size_t nLength, std::vector<unsigned char> &vData)
+{
+	std::string sPath = TempPath();
+	unsigned int nSeed = nLength;
+
+	vData.resize(nLength);
+	for (size_t i = 0; i < nLength; i++)
+	{
+		nSeed = nSeed * 1103515245 + 12345;
+		vData[i] = nSeed >> 16;
+	}
+
+	FILE *f = fopen(sPath.c_str(), "wb");
+	fwrite(&vData[0], 1, nLength, f);
+	fclose(f);
+
+	return sPath;
+}
+
+static bool FileIs(const std::string &sPath, const unsigned char *pData, size_t nLength)
+{
+	std::vector<unsigned char> vContents(nLength + 1);
+	FILE *f = fopen(sPath.c_str(), "rb");
+	if (!f)
+		return false;
+
+	bool bSame = fread(&vContents[0], 1, nLength + 1, f) == nLength && memcmp(&vContents[0], pData, nLength) == 0;
+	fclose(f);
+
+	return bSame;
+}
+
+static void TestConnection()
+{
+	CMockDevice device;
+	CMockTransport transport(device);
+	CIBootConn conn(&transport);
+
+	CHECK(conn.Connect() == IB_SUCCESS);
+	CHECK(conn.SendCommand("echo hello there\n") == IB_SUCCESS);
+
+	const char *pResponse = NULL;
+	CHECK(conn.GetResponse(pResponse) == IB_SUCCESS);
+	CHECK(pResponse && strstr(pResponse, "hello there\n"));
+
+	CHECK(conn.Disconnect() == IB_SUCCESS);
+	CHECK(conn.SendCommand("echo gone\n") != IB_SUCCESS);
+	CHECK(device.Commands().size() == 1);
+}
+
+static void TestFiles()
+{
+	CMockDevice device;
+	CMockTransport transport(device);
+	CIBootConn conn(&transport);
+	std::vector<unsigned char> vData;
+
+	// not a whole number of chunks, so the last write is a short one
+	size_t nLength = 5 * 0x10000 + 1000;
+	std::string sSend = WriteNoise(nLength, vData);
+	std::string sGet = TempPath();
+
+	CHECK(conn.Connect() == IB_SUCCESS);
+
+	unsigned long lSent = 0;
+	CHECK(conn.SendFile(sSend.c_str(), CMockDevice::MEMORY_BASE, &lSent) == IB_SUCCESS);
+	CHECK(lSent == nLength);
+	CHECK(memcmp(device.Memory(CMockDevice::MEMORY_BASE, nLength), &vData[0], nLength) == 0);
+	CHECK(strtoul(device.Env("filesize").c_str(), NULL, 0) == nLength);
+
+	CHECK(conn.GetFile(sGet.c_str(), CMockDevice::MEMORY_BASE, nLength) == IB_SUCCESS);
+	CHECK(FileIs(sGet, &vData[0], nLength));
+
+	CHECK(conn.SendFile("/nonexistent/file", CMockDevice::MEMORY_BASE) == IB_FILE_NOT_FOUND);
+
+	unlink(sSend.c_str());
+	unlink(sGet.c_str());
+}
+
+typedef struct SCollected
+{
+	pthread_mutex_t					mutex;
+	std::vector<SOpResult>	vResults;
+} SCollected;
+
+static void Collect(const SOpResult &result, void *pContext)
+{
+	SCollected *pCollected = (SCollected *)pContext;
+
+	pthread_mutex_lock(&pCollected->mutex);
+	pCollected->vResults.push_back(result);
+	pthread_mutex_unlock(&pCollected->mutex);
+}
+
+// Results come back once each, in the order the operations were submitted, with the right responses
+static void CheckInOrder(SCollected &collected, const std::vector<unsigned int> &vIds)
+{
+	CHECK(collected.vResults.size() == vIds.size());
+	for (size_t i = 0; i < collected.vResults.size() && i < vIds.size(); i++)
+	{
+		CHECK(collected.vResults[i].nId == vIds[i]);
+		CHECK(collected.vResults[i].code == IB_SUCCESS);
+	}
+}
+
+static void TestQueue(bool bThread)
+{
+	CMockDevice device;
+	CMockTransport transport(device);
+	CIBootConn conn(&transport);
+	CIBootQueue queue(conn);
+	SCollected collected;
+	std::vector<unsigned int> vIds;
+	std::vector<unsigned char> vData;
+	std::string sSend = WriteNoise(200000, vData);
+	char szCmd[64];
+
+	pthread_mutex_init(&collected.mutex, NULL);
+
+	if (bThread)
+		CHECK(queue.Start() == IB_SUCCESS);
+
+	vIds.push_back(queue.SubmitConnect(Collect, &collected));
+	for (int i = 0; i < 30; i++)
+	{
+		sprintf(szCmd, "echo line %d\n", i);
+		vIds.push_back(queue.SubmitCommand(szCmd, true, Collect, &collected));
+	}
+	vIds.push_back(queue.SubmitSendFile(sSend.c_str(), CMockDevice::MEMORY_BASE, Collect, &collected));
+
+	queue.Wait();
+	CHECK(queue.Pending() == 0);
+	CheckInOrder(collected, vIds);
+
+	for (int i = 0; i < 30 && i + 1 < (int)collected.vResults.size(); i++)
+	{
+		sprintf(szCmd, "line %d\n", i);
+		CHECK(collected.vResults[i + 1].sResponse.find(szCmd) != std::string::npos);
+	}
+
+	CHECK(collected.vResults.back().lBytes == vData.size());
+	CHECK(memcmp(device.Memory(CMockDevice::MEMORY_BASE, vData.size()), &vData[0], vData.size()) == 0);
+
+	// and the device saw the commands in that order too
+	std::vector<std::string> vCommands = device.Commands();
+	CHECK(vCommands.size() == 31);
+	for (int i = 0; i < 30 && i < (int)vCommands.size(); i++)
+	{
+		sprintf(szCmd, "echo line %d", i);
+		CHECK(vCommands[i] == szCmd);
+	}
+
+	queue.Stop();
+	pthread_mutex_destroy(&collected.mutex);
+	unlink(sSend.c_str());
+}
+
+// A batch stops at its first failure; what comes after the batch still runs
+static void TestBatchFailure()
+{
+	SMockOptions options;
+	memset(&options, 0, sizeof(options));
+	options.nRejectCommand = 3;
+
+	CMockDevice device(options);
+	CMockTransport transport(device);
+	CIBootConn conn(&transport);
+	CIBootQueue queue(conn);
+	SCollected collected;
+	std::vector<std::string> vBatch;
+
+	pthread_mutex_init(&collected.mutex, NULL);
+
+	for (int i = 0; i < 5; i++)
+	{
+		char szCmd[64];
+		sprintf(szCmd, "echo batch %d\n", i);
+		vBatch.push_back(szCmd);
+	}
+
+	queue.SubmitConnect(Collect, &collected);
+	queue.SubmitBatch(vBatch, Collect, &collected);
+	queue.SubmitCommand("echo after\n", true, Collect, &collected);
+	queue.Wait();
+
+	CHECK(collected.vResults.size() == 7);
+	if (collected.vResults.size() == 7)
+	{
+		CHECK(collected.vResults[1].code == IB_SUCCESS);
+		CHECK(collected.vResults[2].code == IB_SUCCESS);
+		CHECK(collected.vResults[3].code == IB_COMMAND_NOT_ACK);
+		CHECK(collected.vResults[4].code == IB_FAIL && collected.vResults[4].dElapsed == 0);
+		CHECK(collected.vResults[5].code == IB_FAIL && collected.vResults[5].dElapsed == 0);
+		CHECK(collected.vResults[6].code == IB_SUCCESS);
+	}
+
+	std::vector<std::string> vCommands = device.Commands();
+	CHECK(vCommands.size() == 3);
+	CHECK(!vCommands.empty() && vCommands.back() == "echo after");
+
+	pthread_mutex_destroy(&collected.mutex);
+}
+
+// A device that stops answering fails what's queued for it instead of hanging the queue
+static void TestConnectionLost()
+{
+	SMockOptions options;
+	memset(&options, 0, sizeof(options));
+	options.nDropAfter = 4;
+
+	CMockDevice device(options);
+	CMockTransport transport(device);
+	CIBootConn conn(&transport);
+	CIBootQueue queue(conn);
+	SCollected collected;
+
+	pthread_mutex_init(&collected.mutex, NULL);
+	CHECK(queue.Start() == IB_SUCCESS);
+
+	queue.SubmitConnect(Collect, &collected);
+	for (int i = 0; i < 5; i++)
+		queue.SubmitCommand("echo doomed\n", true, Collect, &collected);
+	queue.Wait();
+
+	CHECK(collected.vResults.size() == 6);
+	CHECK(!collected.vResults.empty() && collected.vResults.back().code == IB_CONNECTION_LOST);
+
+	queue.Stop();
+	pthread_mutex_destroy(&collected.mutex);
+}
+
+// Every device works through its own copy of everything, in order, several at once but never more than the workers
+static void TestSessions()
+{
+	SMockOptions options;
+	memset(&options, 0, sizeof(options));
+	options.nCommandDelay = 20000;
+
+	std::vector<CMockDevice *> vDevices;
+	for (int i = 0; i < 6; i++)
+	{
+		vDevices.push_back(new CMockDevice(options));
+		fakeusb_attach(vDevices.back());
+	}
+
+	std::vector<std::string> vScript;
+	for (int i = 0; i < 8; i++)
+	{
+		char szCmd[64];
+		sprintf(szCmd, "setenv step %d\n", i);
+		vScript.push_back(szCmd);
+	}
+
+	CMockDevice::ResetBusy();
+
+	{
+		CIBootSessionManager manager(3);
+		CHECK(manager.OpenAll() == 6);
+		CHECK(manager.Start() == IB_SUCCESS);
+
+		manager.RunScript(vScript);
+		manager.SendCommand("printenv\n");
+		manager.Wait();
+
+		CHECK(manager.Failed() == 0);
+
+		std::vector<SSessionReport> vReports;
+		manager.Report(vReports);
+		CHECK(vReports.size() == 6);
+		for (size_t i = 0; i < vReports.size(); i++)
+		{
+			CHECK(vReports[i].vResults.size() == 1 + vScript.size() + 1);
+			CHECK(vReports[i].code == IB_SUCCESS);
+			CHECK(!vReports[i].vResults.empty() && vReports[i].vResults.back().sResponse.find("step = 7") != std::string::npos);
+		}
+
+		CHECK(CMockDevice::MaxBusy() > 1);
+		CHECK(CMockDevice::MaxBusy() <= 3);
+
+		// the workers are walking the sessions, so they can't be replaced underneath them
+		CHECK(manager.OpenAll() == -1);
+		CHECK(manager.Count() == 6);
+
+		manager.Stop();
+		CHECK(manager.OpenAll() == 6);
+		CHECK(manager.Start() == IB_SUCCESS);
+		manager.SendCommand("echo again\n");
+		manager.Wait();
+		CHECK(manager.Failed() == 0);
+	}
+
+	for (size_t i = 0; i < vDevices.size(); i++)
+	{
+		std::vector<std::string> vCommands = vDevices[i]->Commands();
+		CHECK(vCommands.size() == vScript.size() + 2);
+		for (size_t j = 0; j < vScript.size() && j < vCommands.size(); j++)
+			CHECK(vCommands[j] + "\n" == vScript[j]);
+
+		CHECK(vDevices[i]->Opens() == 2);
+		delete vDevices[i];
+	}
+
+	fakeusb_detach_all();
+}
+
+// One device failing shows up against that device alone
+static void TestSessionFailure()
+{
+	SMockOptions options;
+	memset(&options, 0, sizeof(options));
+
+	CMockDevice good1(options), good2(options);
+	options.nRejectCommand = 2;
+	CMockDevice bad(options);
+
+	fakeusb_attach(&good1);
+	fakeusb_attach(&bad);
+	fakeusb_attach(&good2);
+
+	{
+		CIBootSessionManager manager(2);
+		CHECK(manager.OpenAll() == 3);
+		CHECK(manager.Start() == IB_SUCCESS);
+
+		std::vector<std::string> vScript;
+		vScript.push_back("echo one\n");
+		vScript.push_back("echo two\n");
+		vScript.push_back("echo three\n");
+		manager.RunScript(vScript);
+		manager.Wait();
+
+		CHECK(manager.Failed() == 1);
+
+		std::vector<SSessionReport> vReports;
+		manager.Report(vReports);
+		CHECK(vReports.size() == 3 && vReports[1].code == IB_COMMAND_NOT_ACK);
+	}
+
+	CHECK(good1.Commands().size() == 3);
+	CHECK(bad.Commands().size() == 1);
+	CHECK(good2.Commands().size() == 3);
+
+	fakeusb_detach_all();
+}
+
+int main(int argc, char **argv)
+{
+	TestConnection();
+	TestFiles();
+	TestQueue(false);
+	TestQueue(true);
+	TestBatchFailure();
+	TestConnectionLost();
+	TestSessions();
+	TestSessionFailure();
+
+	if (g_nFailures > 0)
+	{
+		fprintf(stderr, "test_ibooter: %d checks failed\n", g_nFailures);
+		return 1;
+	}
+
+	printf("test_ibooter: ok\n");
+	return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef FAKE_USB_H
+#define FAKE_USB_H
+
+// The part of the libusb-0.1 API libibooter uses, so the tests build and run without libusb or a device. fakeusb.cpp
+// implements it.
+
+#include <limits.h>
+#include <stdint.h>
+
+#define PATH_MAX_USB 4096
+
+struct usb_device_descriptor
+{
+	uint8_t		bLength;
+	uint8_t		bDescriptorType;
+	uint16_t	bcdUSB;
+	uint8_t		bDeviceClass;
+	uint8_t		bDeviceSubClass;
+	uint8_t		bDeviceProtocol;
+	uint8_t		bMaxPacketSize0;
+	uint16_t	idVendor;
+	uint16_t	idProduct;
+	uint16_t	bcdDevice;
+	uint8_t		iManufacturer;
+	uint8_t		iProduct;
+	uint8_t		iSerialNumber;
+	uint8_t		bNumConfigurations;
+};
+
+struct usb_bus;
+
+struct usb_device
+{
+	struct usb_device							*next, *prev;
+	char													filename[PATH_MAX_USB + 1];
+	struct usb_bus								*bus;
+	struct usb_device_descriptor	descriptor;
+	void													*dev;
+};
+
+struct usb_bus
+{
+	struct usb_bus		*next, *prev;
+	char							dirname[PATH_MAX_USB + 1];
+	struct usb_device	*devices;
+	uint32_t					location;
+};
+
+struct usb_dev_handle;
+typedef struct usb_dev_handle usb_dev_handle;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void usb_init(void);
+int usb_find_busses(void);
+int usb_find_devices(void);
+struct usb_bus *usb_get_busses(void);
+
+usb_dev_handle *usb_open(struct usb_device *dev);
+int usb_close(usb_dev_handle *dev);
+int usb_set_configuration(usb_dev_handle *dev, int configuration);
+int usb_claim_interface(usb_dev_handle *dev, int interface);
+int usb_release_interface(usb_dev_handle *dev, int interface);
+
+int usb_bulk_write(usb_dev_handle *dev, int ep, const char *bytes, int size, int timeout);
+int usb_bulk_read(usb_dev_handle *dev, int ep, char *bytes, int size, int timeout);
+int usb_interrupt_write(usb_dev_handle *dev, int ep, const char *bytes, int size, int timeout);
+int usb_interrupt_read(usb_dev_handle *dev, int ep, char *bytes, int size, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
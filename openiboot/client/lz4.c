@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "lz4.h"
+
+#define LZ4_MINMATCH 4
+#define LZ4_LASTLITERALS 5
+#define LZ4_MFLIMIT 12
+#define LZ4_MAXOFFSET 65535
+#define LZ4_HASH_BITS 16
+
+// input is read a chunk at a time, keeping the last window of it around for matches to refer back to
+#define LZ4_WINDOW 0x10000
+#define LZ4_CHUNK 0x40000
+
+typedef struct Compressor {
+	FILE* in;
+	long inStart;
+	FILE* out;
+	size_t written;
+	int failed;
+
+	// buffer holds the input from stream offset base up to filled
+	uint8_t* buffer;
+	size_t base;
+	size_t filled;
+} Compressor;
+
+static uint32_t hash(const uint8_t* p) {
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return (v * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+static void put(Compressor* c, const void* data, size_t len) {
+	if(!c->failed && fwrite(data, 1, len, c->out) != len)
+		c->failed = 1;
+
+	c->written += len;
+}
+
+static void putByte(Compressor* c, uint8_t b) {
+	put(c, &b, 1);
+}
+
+static void putLength(Compressor* c, size_t len) {
+	while(len >= 255) {
+		putByte(c, 255);
+		len -= 255;
+	}
+	putByte(c, len);
+}
+
+// Copies the input between two stream offsets to the output. A long run of literals can start before what's still
+// buffered, in which case the start of it is read back from the file.
+static void putLiterals(Compressor* c, size_t from, size_t to) {
+	if(from < c->base) {
+		uint8_t piece[4096];
+		long resume = ftell(c->in);
+
+		if(resume < 0 || fseek(c->in, c->inStart + from, SEEK_SET) != 0) {
+			c->failed = 1;
+			return;
+		}
+
+		while(from < c->base) {
+			size_t toRead = c->base - from;
+			if(toRead > sizeof(piece))
+				toRead = sizeof(piece);
+
+			if(fread(piece, 1, toRead, c->in) != toRead) {
+				c->failed = 1;
+				return;
+			}
+
+			put(c, piece, toRead);
+			from += toRead;
+		}
+
+		if(fseek(c->in, resume, SEEK_SET) != 0) {
+			c->failed = 1;
+			return;
+		}
+	}
+
+	put(c, c->buffer + (from - c->base), to - from);
+}
+
+static void putSequence(Compressor* c, size_t anchor, size_t literalLength, size_t offset, size_t matchLength) {
+	uint8_t token = ((literalLength >= 15) ? 15 : literalLength) << 4;
+
+	if(offset != 0) {
+		matchLength -= LZ4_MINMATCH;
+		token |= (matchLength >= 15) ? 15 : matchLength;
+	}
+
+	putByte(c, token);
+	if(literalLength >= 15)
+		putLength(c, literalLength - 15);
+
+	putLiterals(c, anchor, anchor + literalLength);
+
+	if(offset == 0)
+		return;
+
+	putByte(c, offset & 0xFF);
+	putByte(c, offset >> 8);
+	if(matchLength >= 15)
+		putLength(c, matchLength - 15);
+}
+
+size_t lz4_compress_file(FILE* in, size_t len, FILE* out) {
+	Compressor c;
+	// positions are stream offsets stored off by one, so that zero means empty
+	uint32_t* table = (uint32_t*) calloc(1 << LZ4_HASH_BITS, sizeof(uint32_t));
+	size_t anchor = 0;
+	size_t ip = 0;
+
+	memset(&c, 0, sizeof(c));
+	c.in = in;
+	c.inStart = ftell(in);
+	c.out = out;
+	c.buffer = (uint8_t*) malloc(LZ4_WINDOW + LZ4_CHUNK);
+
+	if(!table || !c.buffer || c.inStart < 0) {
+		free(table);
+		free(c.buffer);
+		return 0;
+	}
+
+	while(!c.failed) {
+		// slide the window up to just behind where matching resumes, then top the buffer up from the file
+		size_t keep = (ip > LZ4_WINDOW) ? (ip - LZ4_WINDOW) : 0;
+		if(keep > c.base) {
+			memmove(c.buffer, c.buffer + (keep - c.base), c.filled - keep);
+			c.base = keep;
+		}
+
+		size_t toRead = (LZ4_WINDOW + LZ4_CHUNK) - (c.filled - c.base);
+		if(toRead > len - c.filled)
+			toRead = len - c.filled;
+
+		if(fread(c.buffer + (c.filled - c.base), 1, toRead, in) != toRead) {
+			c.failed = 1;
+			break;
+		}
+		c.filled += toRead;
+
+		// Matches can't start within the last few bytes of the stream, or run into its last literals. Short of the
+		// end, they stop where the buffer does; the hash needs a few bytes past where it starts.
+		size_t matchLimit = (len > LZ4_MFLIMIT) ? (len - LZ4_MFLIMIT) : 0;
+		size_t extendLimit = (len > LZ4_LASTLITERALS) ? (len - LZ4_LASTLITERALS) : 0;
+		if(c.filled < len) {
+			if(matchLimit > c.filled - LZ4_MFLIMIT)
+				matchLimit = c.filled - LZ4_MFLIMIT;
+			if(extendLimit > c.filled)
+				extendLimit = c.filled;
+		}
+
+		while(ip < matchLimit && !c.failed) {
+			const uint8_t* p = c.buffer + (ip - c.base);
+			uint32_t h = hash(p);
+			uint32_t candidate = table[h];
+			table[h] = ip + 1;
+
+			if(candidate == 0 || (candidate - 1) < c.base || ip - (candidate - 1) > LZ4_MAXOFFSET
+					|| memcmp(c.buffer + (candidate - 1 - c.base), p, LZ4_MINMATCH) != 0) {
+				++ip;
+				continue;
+			}
+
+			size_t match = candidate - 1;
+			size_t end = ip + LZ4_MINMATCH;
+			while(end < extendLimit && c.buffer[end - c.base] == c.buffer[match + (end - ip) - c.base])
+				++end;
+
+			putSequence(&c, anchor, ip - anchor, ip - match, end - ip);
+			ip = end;
+			anchor = ip;
+		}
+
+		if(c.filled == len)
+			break;
+	}
+
+	// the stream always ends on literals
+	if(len > 0 && !c.failed)
+		putSequence(&c, anchor, len - anchor, 0, 0);
+
+	free(table);
+	free(c.buffer);
+	return c.failed ? 0 : c.written;
+}
@@ -0,0 +1,14 @@
+#ifndef OIBC_LZ4_H
+#define OIBC_LZ4_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Compresses len bytes read from in into a single unbounded LZ4 block written to out, the format the device's
+// sendfilez decoder streams from. Only a window's worth of the input is held at once; in must be seekable, since
+// literals that fall out of the window are read back from it. Returns the compressed length, or 0 on a read or write
+// error.
+size_t lz4_compress_file(FILE* in, size_t len, FILE* out);
+
+#endif
@@ -0,0 +1,966 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include <libusb-1.0/libusb.h>
+
+#include "oibc-usb.h"
+#include "lz4.h"
+
+#define EP_DATA_IN 0x81
+#define EP_DATA_OUT 0x02
+#define EP_CONTROL_IN 0x83
+#define EP_CONTROL_OUT 0x04
+#define EP_CONSOLE_IN 0x85
+
+#define CONTROL_TIMEOUT 1000
+#define DATA_TIMEOUT 5000
+
+// how long to wait before asking again after the device said it has nothing for us
+#define POLL_INTERVAL 20000
+
+// The device DMAs file data straight to its destination, so keep several large transfers queued on the data
+// endpoints and refill each one as soon as it completes.
+#define TRANSFER_SIZE 0x10000
+#define TRANSFERS_IN_FLIGHT 4
+
+#define DEFAULT_ADDRESS "0x09000000"
+
+// Firmware that supports it pushes console output on its own endpoint as it's printed; keep a couple of reads
+// posted there so it never has to wait on us.
+#define PUSH_SIZE 0x1000
+#define PUSH_TRANSFERS 2
+
+// checked transfers go one CRC-verified chunk at a time
+#define CHUNK_SIZE OPENIBOOT_CHUNK_MAX
+#define CHUNK_RETRIES 5
+
+typedef struct Job {
+	struct Job* next;
+
+	// what to send after SENDCOMMAND: either an in-memory buffer or an open file
+	char* buffer;
+	FILE* file;
+	size_t length;
+
+	// where the next length bytes of dumped output should go instead of the console
+	FILE* capture;
+	size_t captureLength;
+
+	// file uploads report how long they took; rawLength is the size before compression
+	size_t rawLength;
+	struct timeval started;
+
+	// checked transfers move file to or from device memory at address, offset bytes in so far
+	int checked;
+	int download;
+	int verifying;
+	uint32_t address;
+	size_t offset;
+	size_t skipped;
+	int retries;
+	int retransmits;
+} Job;
+
+typedef enum State {
+	StateIdle,
+	StatePushSetup,
+	StatePolling,
+	StateDumping,
+	StateWaitGoAhead,
+	StateSending,
+	StateChunkVerify,
+	StateChunkGoAhead,
+	StateChunkSending,
+	StateChunkAck,
+	StateChunkReceiving
+} State;
+
+static libusb_device_handle* Device = NULL;
+static int Interface = -1;
+
+static OIBCOutputHandler OutputHandler = NULL;
+static pthread_t EventThread;
+static int EventThreadStarted = 0;
+static volatile int Running = 0;
+
+static pthread_mutex_t JobLock = PTHREAD_MUTEX_INITIALIZER;
+static Job* JobHead = NULL;
+static Job* JobTail = NULL;
+
+// everything below is only touched from the event thread
+static State CurrentState = StateIdle;
+static Job* CurrentJob = NULL;
+static struct timeval NextPoll;
+
+static struct libusb_transfer* ReplyTransfer = NULL;
+static OpenIBootChunkCmd Reply;
+
+static struct libusb_transfer* ChunkTransfer = NULL;
+static unsigned char* ChunkBuffer = NULL;
+static size_t ChunkLength = 0;
+static uint32_t ChunkCRC = 0;
+
+static uint32_t CRCTable[256];
+
+static int PushTried = 0;
+static int PushEnabled = 0;
+
+static struct libusb_transfer* DataTransfers[TRANSFERS_IN_FLIGHT];
+static int DataFree = 0;
+static int DataInFlight = 0;
+static size_t DataLeft = 0;
+static size_t DataSent = 0;
+
+static FILE* Capture = NULL;
+static size_t CaptureLeft = 0;
+
+static void replyReceived(struct libusb_transfer* transfer);
+static void commandSent(struct libusb_transfer* transfer);
+static void dataDone(struct libusb_transfer* transfer);
+static void chunkDone(struct libusb_transfer* transfer);
+static void nextChunk();
+static void dropJob(Job* job);
+
+static void fail(const char* what, int status) {
+	if(Running)
+		fprintf(stderr, "oibc: %s failed (%d), giving up.\n", what, status);
+
+	Running = 0;
+}
+
+// the same CRC-32 as crc32() in the firmware's util.c
+static void crcInit() {
+	uint32_t i, j;
+
+	for(i = 0; i < 256; i++) {
+		uint32_t c = i;
+		for(j = 0; j < 8; j++)
+			c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+		CRCTable[i] = c;
+	}
+}
+
+static uint32_t crc32(const unsigned char* buffer, size_t len) {
+	uint32_t crc = 0xFFFFFFFF;
+
+	while(len-- > 0)
+		crc = CRCTable[(crc ^ *(buffer++)) & 0xFF] ^ (crc >> 8);
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+static void sendMessage(const OpenIBootChunkCmd* message, int len, int wantReply) {
+	struct libusb_transfer* transfer = libusb_alloc_transfer(0);
+	OpenIBootChunkCmd* cmd = (OpenIBootChunkCmd*) malloc(sizeof(OpenIBootChunkCmd));
+	if(!transfer || !cmd) {
+		fail("allocating a command", LIBUSB_ERROR_NO_MEM);
+		return;
+	}
+
+	memcpy(cmd, message, sizeof(OpenIBootChunkCmd));
+
+	// fire and forget: libusb frees the transfer and the command once it's out
+	libusb_fill_interrupt_transfer(transfer, Device, EP_CONTROL_OUT, (unsigned char*) cmd, len,
+		commandSent, NULL, CONTROL_TIMEOUT);
+	transfer->flags = LIBUSB_TRANSFER_FREE_BUFFER | LIBUSB_TRANSFER_FREE_TRANSFER;
+
+	int ret = libusb_submit_transfer(transfer);
+	if(ret != 0) {
+		libusb_free_transfer(transfer);
+		fail("sending a command", ret);
+		return;
+	}
+
+	if(wantReply) {
+		ret = libusb_submit_transfer(ReplyTransfer);
+		if(ret != 0)
+			fail("waiting for a reply", ret);
+	}
+}
+
+static void sendControl(uint32_t command, uint32_t dataLen, int wantReply) {
+	OpenIBootChunkCmd cmd;
+
+	memset(&cmd, 0, sizeof(cmd));
+	cmd.command = command;
+	cmd.dataLen = dataLen;
+	sendMessage(&cmd, sizeof(OpenIBootCmd), wantReply);
+}
+
+static void sendChunkControl(uint32_t command) {
+	OpenIBootChunkCmd cmd;
+
+	cmd.command = command;
+	cmd.dataLen = ChunkLength;
+	cmd.address = CurrentJob->address + CurrentJob->offset;
+	cmd.crc = ChunkCRC;
+	sendMessage(&cmd, sizeof(OpenIBootChunkCmd), 1);
+}
+
+static void commandSent(struct libusb_transfer* transfer) {
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED)
+		fail("sending a command", transfer->status);
+}
+
+static void consume(const unsigned char* data, size_t len) {
+	if(CaptureLeft > 0) {
+		size_t toCapture = (len > CaptureLeft) ? CaptureLeft : len;
+		fwrite(data, 1, toCapture, Capture);
+		CaptureLeft -= toCapture;
+		if(CaptureLeft == 0) {
+			fclose(Capture);
+			Capture = NULL;
+		}
+
+		data += toCapture;
+		len -= toCapture;
+	}
+
+	if(len > 0 && OutputHandler)
+		OutputHandler((const char*) data, len);
+}
+
+static int fill(unsigned char* buffer, size_t len) {
+	if(CurrentJob->file) {
+		if(fread(buffer, 1, len, CurrentJob->file) != len)
+			return -1;
+	} else {
+		memcpy(buffer, CurrentJob->buffer + DataSent, len);
+	}
+
+	DataSent += len;
+	return 0;
+}
+
+static void submitData() {
+	while(Running && DataFree > 0 && DataLeft > 0) {
+		struct libusb_transfer* transfer = DataTransfers[--DataFree];
+		size_t toTransfer = (DataLeft > TRANSFER_SIZE) ? TRANSFER_SIZE : DataLeft;
+
+		if(CurrentState == StateSending) {
+			if(fill(transfer->buffer, toTransfer) != 0) {
+				DataTransfers[DataFree++] = transfer;
+				fail("reading the file to send", -1);
+				return;
+			}
+			transfer->endpoint = EP_DATA_OUT;
+			transfer->type = LIBUSB_TRANSFER_TYPE_BULK;
+		} else {
+			transfer->endpoint = EP_DATA_IN;
+			transfer->type = LIBUSB_TRANSFER_TYPE_BULK;
+		}
+
+		transfer->length = toTransfer;
+
+		int ret = libusb_submit_transfer(transfer);
+		if(ret != 0) {
+			DataTransfers[DataFree++] = transfer;
+			fail("queueing a bulk transfer", ret);
+			return;
+		}
+
+		DataLeft -= toTransfer;
+		++DataInFlight;
+	}
+}
+
+static void reportThroughput(Job* job) {
+	struct timeval now;
+	char message[200];
+
+	gettimeofday(&now, NULL);
+	double elapsed = (now.tv_sec - job->started.tv_sec) + (now.tv_usec - job->started.tv_usec) / 1000000.0;
+	if(elapsed <= 0)
+		elapsed = 0.000001;
+
+	int len = snprintf(message, sizeof(message), "oibc: sent %u bytes as %u in %.2f s: %.0f KB/s effective, %.0f KB/s on the wire\n",
+		(unsigned int) job->rawLength, (unsigned int) job->length, elapsed,
+		job->rawLength / elapsed / 1024, job->length / elapsed / 1024);
+
+	if(OutputHandler)
+		OutputHandler(message, len);
+}
+
+static void finishJob() {
+	if(CurrentJob->rawLength > 0)
+		reportThroughput(CurrentJob);
+
+	if(CurrentJob->file)
+		fclose(CurrentJob->file);
+
+	free(CurrentJob->buffer);
+	free(CurrentJob);
+	CurrentJob = NULL;
+}
+
+static void dataDone(struct libusb_transfer* transfer) {
+	--DataInFlight;
+	DataTransfers[DataFree++] = transfer;
+
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED) {
+		fail("a bulk transfer", transfer->status);
+		return;
+	}
+
+	if(CurrentState == StateDumping) {
+		// Transfers on one endpoint complete in the order they were queued, so the data can be handed on as it
+		// arrives. If the device ended one early, the rest of the stream is still coming; ask for it again.
+		consume(transfer->buffer, transfer->actual_length);
+		DataLeft += transfer->length - transfer->actual_length;
+	}
+
+	submitData();
+
+	if(DataInFlight > 0 || DataLeft > 0)
+		return;
+
+	if(CurrentState == StateSending) {
+		finishJob();
+	} else {
+		// there may be more where that came from, ask right away
+		gettimeofday(&NextPoll, NULL);
+	}
+
+	CurrentState = StateIdle;
+}
+
+static void finishChecked(const char* problem) {
+	Job* job = CurrentJob;
+	char message[300];
+	int len;
+
+	if(problem) {
+		len = snprintf(message, sizeof(message), "oibc: checked transfer stopped at offset 0x%x: %s. Run it again to resume.\n",
+			(unsigned int) job->offset, problem);
+	} else {
+		struct timeval now;
+		gettimeofday(&now, NULL);
+		double elapsed = (now.tv_sec - job->started.tv_sec) + (now.tv_usec - job->started.tv_usec) / 1000000.0;
+		if(elapsed <= 0)
+			elapsed = 0.000001;
+
+		len = snprintf(message, sizeof(message), "oibc: %s %u bytes in %.2f s (%.0f KB/s), %u already in place, %d chunks resent\n",
+			job->download ? "received" : "sent", (unsigned int) (job->length - job->skipped), elapsed,
+			(job->length - job->skipped) / elapsed / 1024, (unsigned int) job->skipped, job->retransmits);
+	}
+
+	if(OutputHandler)
+		OutputHandler(message, len);
+
+	// the summary above already covers it
+	job->rawLength = 0;
+	finishJob();
+	CurrentState = StateIdle;
+}
+
+// fills ChunkBuffer with the local file's contents at the current offset
+static int loadChunk() {
+	Job* job = CurrentJob;
+
+	if(fseek(job->file, job->offset, SEEK_SET) != 0)
+		return -1;
+
+	if(fread(ChunkBuffer, 1, ChunkLength, job->file) != ChunkLength)
+		return -1;
+
+	ChunkCRC = crc32(ChunkBuffer, ChunkLength);
+	return 0;
+}
+
+static void submitChunk(unsigned char endpoint) {
+	libusb_fill_bulk_transfer(ChunkTransfer, Device, endpoint, ChunkBuffer, ChunkLength, chunkDone, NULL, DATA_TIMEOUT);
+
+	int ret = libusb_submit_transfer(ChunkTransfer);
+	if(ret != 0)
+		fail("queueing a bulk transfer", ret);
+}
+
+static void chunkOK() {
+	CurrentJob->offset += ChunkLength;
+	CurrentJob->retries = 0;
+	nextChunk();
+}
+
+static void chunkBad() {
+	++CurrentJob->retransmits;
+	if(++CurrentJob->retries > CHUNK_RETRIES) {
+		finishChecked("too many CRC errors");
+		return;
+	}
+
+	nextChunk();
+}
+
+static void nextChunk() {
+	Job* job = CurrentJob;
+
+	if(job->offset >= job->length) {
+		finishChecked(NULL);
+		return;
+	}
+
+	ChunkLength = job->length - job->offset;
+	if(ChunkLength > CHUNK_SIZE)
+		ChunkLength = CHUNK_SIZE;
+
+	if(job->verifying) {
+		// Skip whatever is already in place on the other end. When downloading, the local file runs out once we
+		// reach the part that never made it.
+		if(loadChunk() == 0) {
+			CurrentState = StateChunkVerify;
+			sendChunkControl(OPENIBOOTCMD_VERIFYCHUNK);
+			return;
+		}
+
+		job->verifying = 0;
+	}
+
+	if(job->download) {
+		ChunkCRC = 0;
+	} else if(loadChunk() != 0) {
+		finishChecked("cannot read the file");
+		return;
+	}
+
+	CurrentState = StateChunkGoAhead;
+	sendChunkControl(job->download ? OPENIBOOTCMD_GETCHUNK : OPENIBOOTCMD_SENDCHUNK);
+}
+
+static void chunkDone(struct libusb_transfer* transfer) {
+	if(transfer->status == LIBUSB_TRANSFER_TIMED_OUT && CurrentJob->retries < CHUNK_RETRIES) {
+		// The other end is still expecting the rest of this chunk; carry on with just that. The CRC catches
+		// anything that went wrong.
+		++CurrentJob->retries;
+		transfer->buffer += transfer->actual_length;
+		transfer->length -= transfer->actual_length;
+		int ret = libusb_submit_transfer(transfer);
+		if(ret != 0)
+			fail("queueing a bulk transfer", ret);
+		return;
+	}
+
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED) {
+		fail("a bulk transfer", transfer->status);
+		return;
+	}
+
+	if(CurrentState == StateChunkSending) {
+		CurrentState = StateChunkAck;
+		int ret = libusb_submit_transfer(ReplyTransfer);
+		if(ret != 0)
+			fail("waiting for a reply", ret);
+		return;
+	}
+
+	if(crc32(ChunkBuffer, ChunkLength) != ChunkCRC) {
+		chunkBad();
+		return;
+	}
+
+	if(fseek(CurrentJob->file, CurrentJob->offset, SEEK_SET) != 0
+			|| fwrite(ChunkBuffer, 1, ChunkLength, CurrentJob->file) != ChunkLength) {
+		finishChecked("cannot write the file");
+		return;
+	}
+
+	chunkOK();
+}
+
+static void chunkReply() {
+	Job* job = CurrentJob;
+
+	if(Reply.address != job->address + job->offset || Reply.dataLen != ChunkLength) {
+		finishChecked("the device answered for a different chunk");
+		return;
+	}
+
+	switch(CurrentState) {
+		case StateChunkVerify:
+			if(Reply.command == OPENIBOOTCMD_CHUNK_ACK) {
+				job->skipped += ChunkLength;
+				chunkOK();
+			} else {
+				job->verifying = 0;
+				nextChunk();
+			}
+			break;
+
+		case StateChunkGoAhead:
+			if(Reply.command == OPENIBOOTCMD_SENDCHUNK_GOAHEAD) {
+				CurrentState = StateChunkSending;
+				submitChunk(EP_DATA_OUT);
+			} else if(Reply.command == OPENIBOOTCMD_GETCHUNK_GOAHEAD) {
+				ChunkCRC = Reply.crc;
+				CurrentState = StateChunkReceiving;
+				submitChunk(EP_DATA_IN);
+			} else {
+				finishChecked("the device turned the chunk away, it is busy with another file transfer or takes shorter chunks");
+			}
+			break;
+
+		case StateChunkAck:
+			if(Reply.command == OPENIBOOTCMD_CHUNK_ACK)
+				chunkOK();
+			else
+				chunkBad();
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void pushReceived(struct libusb_transfer* transfer) {
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED) {
+		fail("receiving console output", transfer->status);
+		return;
+	}
+
+	if(transfer->actual_length > 0 && OutputHandler)
+		OutputHandler((const char*) transfer->buffer, transfer->actual_length);
+
+	int ret = libusb_submit_transfer(transfer);
+	if(ret != 0)
+		fail("receiving console output", ret);
+}
+
+static void startPush() {
+	int i;
+
+	for(i = 0; i < PUSH_TRANSFERS; i++) {
+		struct libusb_transfer* transfer = libusb_alloc_transfer(0);
+		unsigned char* buffer = (unsigned char*) malloc(PUSH_SIZE);
+		if(!transfer || !buffer) {
+			fail("allocating console transfers", LIBUSB_ERROR_NO_MEM);
+			return;
+		}
+
+		// no timeout: output arrives whenever the device prints something
+		libusb_fill_bulk_transfer(transfer, Device, EP_CONSOLE_IN, buffer, PUSH_SIZE, pushReceived, NULL, 0);
+		int ret = libusb_submit_transfer(transfer);
+		if(ret != 0) {
+			fail("receiving console output", ret);
+			return;
+		}
+	}
+
+	PushEnabled = 1;
+}
+
+static void replyReceived(struct libusb_transfer* transfer) {
+	if(transfer->status == LIBUSB_TRANSFER_TIMED_OUT && CurrentState == StatePushSetup) {
+		// older firmware ignores the request, keep polling for output
+		CurrentState = StateIdle;
+		return;
+	}
+
+	if(transfer->status == LIBUSB_TRANSFER_TIMED_OUT) {
+		int ret = libusb_submit_transfer(transfer);
+		if(ret != 0)
+			fail("waiting for a reply", ret);
+		return;
+	}
+
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED) {
+		fail("waiting for a reply", transfer->status);
+		return;
+	}
+
+	if(CurrentState == StatePushSetup && Reply.command == OPENIBOOTCMD_CONSOLE_PUSH) {
+		if(Reply.dataLen)
+			startPush();
+
+		CurrentState = StateIdle;
+	} else if(CurrentState == StatePolling && Reply.command == OPENIBOOTCMD_DUMPBUFFER_LEN) {
+		if(Reply.dataLen == 0) {
+			gettimeofday(&NextPoll, NULL);
+			NextPoll.tv_usec += POLL_INTERVAL;
+			NextPoll.tv_sec += NextPoll.tv_usec / 1000000;
+			NextPoll.tv_usec %= 1000000;
+			CurrentState = StateIdle;
+			return;
+		}
+
+		CurrentState = StateDumping;
+		DataLeft = Reply.dataLen;
+		sendControl(OPENIBOOTCMD_DUMPBUFFER_GOAHEAD, Reply.dataLen, 0);
+		submitData();
+	} else if(CurrentState == StateWaitGoAhead && Reply.command == OPENIBOOTCMD_SENDCOMMAND_GOAHEAD) {
+		CurrentState = StateSending;
+		DataLeft = CurrentJob->length;
+		DataSent = 0;
+		submitData();
+	} else if(CurrentState == StateWaitGoAhead && Reply.command == OPENIBOOTCMD_SENDCOMMAND_NAK) {
+		char message[100];
+		int len = snprintf(message, sizeof(message), "oibc: the device turned away a %u byte command, it's too long.\n",
+			(unsigned int) Reply.dataLen);
+		if(OutputHandler)
+			OutputHandler(message, len);
+
+		if(Capture == CurrentJob->capture) {
+			Capture = NULL;
+			CaptureLeft = 0;
+		}
+		dropJob(CurrentJob);
+		CurrentJob = NULL;
+		CurrentState = StateIdle;
+	} else if(CurrentState == StateChunkVerify || CurrentState == StateChunkGoAhead || CurrentState == StateChunkAck) {
+		chunkReply();
+	} else {
+		// not what we were waiting for, keep listening
+		int ret = libusb_submit_transfer(transfer);
+		if(ret != 0)
+			fail("waiting for a reply", ret);
+	}
+}
+
+static void startNext() {
+	struct timeval now;
+
+	if(!PushTried) {
+		PushTried = 1;
+		CurrentState = StatePushSetup;
+		sendControl(OPENIBOOTCMD_CONSOLE_PUSH, 1, 1);
+		return;
+	}
+
+	pthread_mutex_lock(&JobLock);
+	CurrentJob = JobHead;
+	if(CurrentJob) {
+		JobHead = CurrentJob->next;
+		if(!JobHead)
+			JobTail = NULL;
+	}
+	pthread_mutex_unlock(&JobLock);
+
+	if(CurrentJob) {
+		if(CurrentJob->capture) {
+			Capture = CurrentJob->capture;
+			CaptureLeft = CurrentJob->captureLength;
+		}
+
+		gettimeofday(&CurrentJob->started, NULL);
+
+		if(CurrentJob->checked) {
+			CurrentJob->verifying = 1;
+			nextChunk();
+			return;
+		}
+
+		CurrentState = StateWaitGoAhead;
+		sendControl(OPENIBOOTCMD_SENDCOMMAND, CurrentJob->length, 1);
+		return;
+	}
+
+	// With pushes on, the only thing left to poll for is a file being read back with getfile.
+	if(PushEnabled && CaptureLeft == 0)
+		return;
+
+	gettimeofday(&now, NULL);
+	if(timercmp(&now, &NextPoll, <))
+		return;
+
+	CurrentState = StatePolling;
+	sendControl(OPENIBOOTCMD_DUMPBUFFER, 0, 1);
+}
+
+static void* eventLoop(void* arg) {
+	while(Running) {
+		if(CurrentState == StateIdle)
+			startNext();
+
+		// Nothing here spins: when idle we sleep until the next console poll is due, and a queued job waits at
+		// most that long to go out.
+		struct timeval timeout = {0, POLL_INTERVAL};
+		libusb_handle_events_timeout(NULL, &timeout);
+	}
+
+	return NULL;
+}
+
+static int queueJob(char* buffer, FILE* file, size_t length, size_t rawLength, FILE* capture, size_t captureLength) {
+	Job* job = (Job*) malloc(sizeof(Job));
+	if(!job)
+		return -1;
+
+	job->next = NULL;
+	job->buffer = buffer;
+	job->file = file;
+	job->length = length;
+	job->capture = capture;
+	job->captureLength = captureLength;
+	job->rawLength = rawLength;
+	job->checked = 0;
+
+	pthread_mutex_lock(&JobLock);
+	if(JobTail)
+		JobTail->next = job;
+	else
+		JobHead = job;
+	JobTail = job;
+	pthread_mutex_unlock(&JobLock);
+
+	return 0;
+}
+
+int oibc_send_command(const char* command, size_t len) {
+	char* buffer = (char*) malloc(len);
+	if(!buffer)
+		return -1;
+
+	memcpy(buffer, command, len);
+	return queueJob(buffer, NULL, len, 0, NULL, 0);
+}
+
+int oibc_send_file(FILE* file, size_t len, const char* address) {
+	char command[100];
+	snprintf(command, sizeof(command), "sendfile %s", address ? address : DEFAULT_ADDRESS);
+
+	if(oibc_send_command(command, strlen(command)) != 0)
+		return -1;
+
+	return queueJob(NULL, file, len, len, NULL, 0);
+}
+
+int oibc_send_file_compressed(FILE* file, size_t len, const char* address) {
+	char command[100];
+	// The length has to be known before SENDCOMMAND goes out, so compress the whole thing up front, a piece at a
+	// time, into a temporary file that's then sent like any other.
+	FILE* compressed = tmpfile();
+	size_t compressedLength = 0;
+
+	if(compressed)
+		compressedLength = lz4_compress_file(file, len, compressed);
+
+	fclose(file);
+
+	if(!compressed || (compressedLength == 0 && len > 0) || fseek(compressed, 0, SEEK_SET) != 0) {
+		if(compressed)
+			fclose(compressed);
+		return -1;
+	}
+
+	snprintf(command, sizeof(command), "sendfilez %s %d", address ? address : DEFAULT_ADDRESS, (int) len);
+	if(oibc_send_command(command, strlen(command)) != 0) {
+		fclose(compressed);
+		return -1;
+	}
+
+	return queueJob(NULL, compressed, compressedLength, len, NULL, 0);
+}
+
+static int queueChecked(FILE* file, size_t len, const char* address, int download) {
+	Job* job = (Job*) calloc(1, sizeof(Job));
+	if(!job)
+		return -1;
+
+	job->file = file;
+	job->length = len;
+	job->checked = 1;
+	job->download = download;
+	job->address = strtoul(address ? address : DEFAULT_ADDRESS, NULL, 0);
+
+	pthread_mutex_lock(&JobLock);
+	if(JobTail)
+		JobTail->next = job;
+	else
+		JobHead = job;
+	JobTail = job;
+	pthread_mutex_unlock(&JobLock);
+
+	return 0;
+}
+
+int oibc_send_file_checked(FILE* file, size_t len, const char* address) {
+	return queueChecked(file, len, address, 0);
+}
+
+int oibc_get_file_checked(FILE* file, size_t len, const char* address) {
+	return queueChecked(file, len, address, 1);
+}
+
+int oibc_get_file(FILE* file, size_t len, const char* address) {
+	char command[100];
+	snprintf(command, sizeof(command), "getfile %s %d", address ? address : DEFAULT_ADDRESS, (int) len);
+
+	char* buffer = strdup(command);
+	if(!buffer)
+		return -1;
+
+	return queueJob(buffer, NULL, strlen(buffer), 0, file, len);
+}
+
+static int findInterface(libusb_device* dev) {
+	struct libusb_config_descriptor* config;
+	int found = -1;
+	int i, a;
+
+	if(libusb_get_config_descriptor(dev, 0, &config) != 0)
+		return -1;
+
+	for(i = 0; i < config->bNumInterfaces && found < 0; i++) {
+		for(a = 0; a < config->interface[i].num_altsetting; a++) {
+			const struct libusb_interface_descriptor* desc = &config->interface[i].altsetting[a];
+			if(desc->bInterfaceClass == 0xFF && desc->bInterfaceSubClass == 0xFF && desc->bInterfaceProtocol == 0x51) {
+				found = desc->bInterfaceNumber;
+				break;
+			}
+		}
+	}
+
+	libusb_free_config_descriptor(config);
+	return found;
+}
+
+int oibc_open(uint16_t vendor, uint16_t product) {
+	libusb_device** list;
+	ssize_t count;
+	ssize_t i;
+	int ret = 1;
+
+	if(libusb_init(NULL) != 0)
+		return 1;
+
+	count = libusb_get_device_list(NULL, &list);
+	for(i = 0; i < count; i++) {
+		struct libusb_device_descriptor desc;
+		if(libusb_get_device_descriptor(list[i], &desc) != 0)
+			continue;
+
+		if(desc.idVendor != vendor || desc.idProduct != product)
+			continue;
+
+		Interface = findInterface(list[i]);
+		if(Interface < 0)
+			continue;
+
+		if(libusb_open(list[i], &Device) != 0) {
+			ret = 2;
+			break;
+		}
+
+		if(libusb_claim_interface(Device, Interface) != 0) {
+			libusb_close(Device);
+			Device = NULL;
+			ret = 3;
+			break;
+		}
+
+		ret = 0;
+		break;
+	}
+
+	libusb_free_device_list(list, 1);
+
+	if(ret != 0)
+		libusb_exit(NULL);
+
+	return ret;
+}
+
+int oibc_start(OIBCOutputHandler handler) {
+	int i;
+
+	OutputHandler = handler;
+
+	ReplyTransfer = libusb_alloc_transfer(0);
+	if(!ReplyTransfer)
+		return -1;
+
+	libusb_fill_interrupt_transfer(ReplyTransfer, Device, EP_CONTROL_IN, (unsigned char*) &Reply, sizeof(Reply),
+		replyReceived, NULL, CONTROL_TIMEOUT);
+
+	ChunkTransfer = libusb_alloc_transfer(0);
+	ChunkBuffer = (unsigned char*) malloc(CHUNK_SIZE);
+	if(!ChunkTransfer || !ChunkBuffer)
+		return -1;
+
+	crcInit();
+
+	DataFree = 0;
+	for(i = 0; i < TRANSFERS_IN_FLIGHT; i++) {
+		struct libusb_transfer* transfer = libusb_alloc_transfer(0);
+		unsigned char* buffer = (unsigned char*) malloc(TRANSFER_SIZE);
+		if(!transfer || !buffer)
+			return -1;
+
+		libusb_fill_bulk_transfer(transfer, Device, EP_DATA_IN, buffer, TRANSFER_SIZE, dataDone, NULL, DATA_TIMEOUT);
+		DataTransfers[DataFree++] = transfer;
+	}
+
+	// a previous connection may have left any of this behind
+	DataInFlight = 0;
+	DataLeft = 0;
+	DataSent = 0;
+	Capture = NULL;
+	CaptureLeft = 0;
+	PushTried = 0;
+	PushEnabled = 0;
+
+	gettimeofday(&NextPoll, NULL);
+	CurrentState = StateIdle;
+	Running = 1;
+
+	if(pthread_create(&EventThread, NULL, eventLoop, NULL) != 0) {
+		Running = 0;
+		return -1;
+	}
+
+	EventThreadStarted = 1;
+	return 0;
+}
+
+void oibc_wait() {
+	if(EventThreadStarted) {
+		pthread_join(EventThread, NULL);
+		EventThreadStarted = 0;
+	}
+}
+
+static void dropJob(Job* job) {
+	if(job->file)
+		fclose(job->file);
+
+	if(job->capture && job->capture != job->file)
+		fclose(job->capture);
+
+	free(job->buffer);
+	free(job);
+}
+
+void oibc_close() {
+	// the event thread may already have stopped on an error, but it still has to be joined
+	Running = 0;
+	oibc_wait();
+
+	// whatever didn't make it out goes with the connection
+	if(CurrentJob) {
+		if(Capture == CurrentJob->capture)
+			Capture = NULL;
+		dropJob(CurrentJob);
+		CurrentJob = NULL;
+	}
+
+	if(Capture) {
+		fclose(Capture);
+		Capture = NULL;
+	}
+
+	pthread_mutex_lock(&JobLock);
+	while(JobHead) {
+		Job* job = JobHead;
+		JobHead = job->next;
+		dropJob(job);
+	}
+	JobTail = NULL;
+	pthread_mutex_unlock(&JobLock);
+
+	if(Device) {
+		libusb_release_interface(Device, Interface);
+		libusb_close(Device);
+		Device = NULL;
+	}
+
+	libusb_exit(NULL);
+}
@@ -0,0 +1,61 @@
+#ifndef OIBC_USB_H
+#define OIBC_USB_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define OPENIBOOTCMD_DUMPBUFFER 0
+#define OPENIBOOTCMD_DUMPBUFFER_LEN 1
+#define OPENIBOOTCMD_DUMPBUFFER_GOAHEAD 2
+#define OPENIBOOTCMD_SENDCOMMAND 3
+#define OPENIBOOTCMD_SENDCOMMAND_GOAHEAD 4
+#define OPENIBOOTCMD_SENDCHUNK 5
+#define OPENIBOOTCMD_SENDCHUNK_GOAHEAD 6
+#define OPENIBOOTCMD_GETCHUNK 7
+#define OPENIBOOTCMD_GETCHUNK_GOAHEAD 8
+#define OPENIBOOTCMD_VERIFYCHUNK 9
+#define OPENIBOOTCMD_CHUNK_ACK 10
+#define OPENIBOOTCMD_CHUNK_NAK 11
+#define OPENIBOOTCMD_CONSOLE_PUSH 12
+#define OPENIBOOTCMD_SENDCOMMAND_NAK 13
+
+// the most a checked transfer moves per chunk; longer chunks are turned away with OPENIBOOTCMD_CHUNK_NAK
+#define OPENIBOOT_CHUNK_MAX 0x10000
+
+typedef struct OpenIBootCmd {
+	uint32_t command;
+	uint32_t dataLen;
+}  __attribute__ ((__packed__)) OpenIBootCmd;
+
+typedef struct OpenIBootChunkCmd {
+	uint32_t command;
+	uint32_t dataLen;
+	uint32_t address;
+	uint32_t crc;
+}  __attribute__ ((__packed__)) OpenIBootChunkCmd;
+
+#define OPENIBOOT_VENDOR 0x0525
+#define OPENIBOOT_PRODUCT 0x1280
+
+// Called from the USB event thread with every piece of console output, in order.
+typedef void (*OIBCOutputHandler)(const char* data, size_t len);
+
+int oibc_open(uint16_t vendor, uint16_t product);
+void oibc_close();
+
+int oibc_start(OIBCOutputHandler handler);
+void oibc_wait();
+
+// These only queue the request; it goes out in order once the event thread gets to it. File handles are closed by
+// the transport once the transfer is finished.
+int oibc_send_command(const char* command, size_t len);
+int oibc_send_file(FILE* file, size_t len, const char* address);
+int oibc_send_file_compressed(FILE* file, size_t len, const char* address);
+int oibc_get_file(FILE* file, size_t len, const char* address);
+
+// CRC-checked transfers: chunks that fail their check are sent again, and chunks the other side already holds
+// are skipped, so rerunning an interrupted transfer picks up where it stopped.
+int oibc_send_file_checked(FILE* file, size_t len, const char* address);
+int oibc_get_file_checked(FILE* file, size_t len, const char* address);
+
+#endif
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "../oibc-usb.h"
+#include "harness.h"
+
+int HarnessFailures = 0;
+
+static pthread_mutex_t OutputLock = PTHREAD_MUTEX_INITIALIZER;
+static char* Output = NULL;
+static size_t OutputLength = 0;
+static size_t OutputSize = 0;
+
+static void outputReceived(const char* data, size_t len) {
+	pthread_mutex_lock(&OutputLock);
+
+	if(OutputLength + len + 1 > OutputSize) {
+		OutputSize = (OutputLength + len + 1) * 2;
+		Output = (char*) realloc(Output, OutputSize);
+	}
+
+	memcpy(Output + OutputLength, data, len);
+	OutputLength += len;
+	Output[OutputLength] = '\0';
+
+	pthread_mutex_unlock(&OutputLock);
+}
+
+void harness_check(int ok, const char* what, const char* file, int line) {
+	if(ok)
+		return;
+
+	fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+	++HarnessFailures;
+}
+
+int harness_connect(const LoopbackOptions* options) {
+	pthread_mutex_lock(&OutputLock);
+	OutputLength = 0;
+	if(Output)
+		Output[0] = '\0';
+	pthread_mutex_unlock(&OutputLock);
+
+	loopback_connect(options);
+
+	if(oibc_open(OPENIBOOT_VENDOR, OPENIBOOT_PRODUCT) != 0) {
+		fprintf(stderr, "cannot open the loopback device\n");
+		return -1;
+	}
+
+	if(oibc_start(outputReceived) != 0) {
+		fprintf(stderr, "cannot start the client\n");
+		oibc_close();
+		return -1;
+	}
+
+	return 0;
+}
+
+void harness_disconnect() {
+	oibc_close();
+}
+
+int harness_wait(const char* text, int seconds) {
+	int i;
+
+	for(i = 0; i < seconds * 1000; i++) {
+		pthread_mutex_lock(&OutputLock);
+		int found = Output && strstr(Output, text) != NULL;
+		pthread_mutex_unlock(&OutputLock);
+
+		if(found)
+			return 1;
+
+		usleep(1000);
+	}
+
+	fprintf(stderr, "timed out waiting for \"%s\"\n", text);
+	return 0;
+}
+
+void harness_settle(int milliseconds) {
+	usleep(milliseconds * 1000);
+}
+
+char* harness_output() {
+	char* output;
+
+	pthread_mutex_lock(&OutputLock);
+	output = strdup(Output ? Output : "");
+	pthread_mutex_unlock(&OutputLock);
+
+	return output;
+}
+
+FILE* harness_file(const uint8_t* data, size_t length) {
+	FILE* file = tmpfile();
+	if(!file)
+		return NULL;
+
+	if(length > 0 && fwrite(data, 1, length, file) != length) {
+		fclose(file);
+		return NULL;
+	}
+
+	rewind(file);
+	return file;
+}
+
+void harness_noise(uint8_t* buffer, size_t length, uint32_t seed) {
+	size_t i;
+
+	// xorshift, so every run sees the same bytes
+	for(i = 0; i < length; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		buffer[i] = seed >> 24;
+	}
+}
+
+int harness_finish(const char* name) {
+	if(HarnessFailures > 0) {
+		fprintf(stderr, "%s: %d checks failed\n", name, HarnessFailures);
+		return 1;
+	}
+
+	printf("%s: ok\n", name);
+	return 0;
+}
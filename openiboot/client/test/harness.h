@@ -0,0 +1,36 @@
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <stdio.h>
+#include "loopback.h"
+
+// Shared by the client tests: runs oibc-usb.c against the loopback device and keeps everything it prints.
+
+#define CHECK(condition) harness_check((condition), #condition, __FILE__, __LINE__)
+
+extern int HarnessFailures;
+
+void harness_check(int ok, const char* what, const char* file, int line);
+
+// Plugs in a device with the given options, then opens and starts the client against it.
+int harness_connect(const LoopbackOptions* options);
+void harness_disconnect();
+
+// Waits until the console output seen since the last connect contains text, for at most seconds.
+int harness_wait(const char* text, int seconds);
+
+// Waits for the output to settle, for when a test wants to look at what didn't happen.
+void harness_settle(int milliseconds);
+
+// A copy of the console output seen since the last connect, for the caller to free.
+char* harness_output();
+
+// A temporary file holding a copy of data, rewound and ready to hand to the client.
+FILE* harness_file(const uint8_t* data, size_t length);
+
+// Fills buffer with the same noise every time for the same seed.
+void harness_noise(uint8_t* buffer, size_t length, uint32_t seed);
+
+int harness_finish(const char* name);
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Just enough of libusb-1.0's interface for oibc-usb.c, implemented by loopback.c against a model of the device
+ * instead of real hardware. The names, fields and values are libusb's own, so oibc-usb.c builds against this
+ * unchanged.
+ */
+
+#ifndef LOOPBACK_LIBUSB_H
+#define LOOPBACK_LIBUSB_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/time.h>
+
+typedef struct libusb_context libusb_context;
+typedef struct libusb_device libusb_device;
+typedef struct libusb_device_handle libusb_device_handle;
+
+enum libusb_error {
+	LIBUSB_SUCCESS = 0,
+	LIBUSB_ERROR_IO = -1,
+	LIBUSB_ERROR_INVALID_PARAM = -2,
+	LIBUSB_ERROR_NO_DEVICE = -4,
+	LIBUSB_ERROR_NOT_FOUND = -5,
+	LIBUSB_ERROR_BUSY = -6,
+	LIBUSB_ERROR_NO_MEM = -11
+};
+
+enum libusb_transfer_type {
+	LIBUSB_TRANSFER_TYPE_CONTROL = 0,
+	LIBUSB_TRANSFER_TYPE_ISOCHRONOUS = 1,
+	LIBUSB_TRANSFER_TYPE_BULK = 2,
+	LIBUSB_TRANSFER_TYPE_INTERRUPT = 3
+};
+
+enum libusb_transfer_status {
+	LIBUSB_TRANSFER_COMPLETED,
+	LIBUSB_TRANSFER_ERROR,
+	LIBUSB_TRANSFER_TIMED_OUT,
+	LIBUSB_TRANSFER_CANCELLED,
+	LIBUSB_TRANSFER_STALL,
+	LIBUSB_TRANSFER_NO_DEVICE,
+	LIBUSB_TRANSFER_OVERFLOW
+};
+
+enum libusb_transfer_flags {
+	LIBUSB_TRANSFER_SHORT_NOT_OK = 1 << 0,
+	LIBUSB_TRANSFER_FREE_BUFFER = 1 << 1,
+	LIBUSB_TRANSFER_FREE_TRANSFER = 1 << 2
+};
+
+struct libusb_transfer;
+
+typedef void (*libusb_transfer_cb_fn)(struct libusb_transfer* transfer);
+
+struct libusb_transfer {
+	libusb_device_handle* dev_handle;
+	uint8_t flags;
+	unsigned char endpoint;
+	unsigned char type;
+	unsigned int timeout;
+	enum libusb_transfer_status status;
+	int length;
+	int actual_length;
+	libusb_transfer_cb_fn callback;
+	void* user_data;
+	unsigned char* buffer;
+	int num_iso_packets;
+};
+
+struct libusb_device_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint16_t bcdUSB;
+	uint8_t bDeviceClass;
+	uint8_t bDeviceSubClass;
+	uint8_t bDeviceProtocol;
+	uint8_t bMaxPacketSize0;
+	uint16_t idVendor;
+	uint16_t idProduct;
+	uint16_t bcdDevice;
+	uint8_t iManufacturer;
+	uint8_t iProduct;
+	uint8_t iSerialNumber;
+	uint8_t bNumConfigurations;
+};
+
+struct libusb_interface_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint8_t bInterfaceNumber;
+	uint8_t bAlternateSetting;
+	uint8_t bNumEndpoints;
+	uint8_t bInterfaceClass;
+	uint8_t bInterfaceSubClass;
+	uint8_t bInterfaceProtocol;
+	uint8_t iInterface;
+};
+
+struct libusb_interface {
+	const struct libusb_interface_descriptor* altsetting;
+	int num_altsetting;
+};
+
+struct libusb_config_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint16_t wTotalLength;
+	uint8_t bNumInterfaces;
+	uint8_t bConfigurationValue;
+	uint8_t iConfiguration;
+	uint8_t bmAttributes;
+	uint8_t MaxPower;
+	const struct libusb_interface* interface;
+};
+
+int libusb_init(libusb_context** ctx);
+void libusb_exit(libusb_context* ctx);
+
+ssize_t libusb_get_device_list(libusb_context* ctx, libusb_device*** list);
+void libusb_free_device_list(libusb_device** list, int unref_devices);
+int libusb_get_device_descriptor(libusb_device* dev, struct libusb_device_descriptor* desc);
+int libusb_get_config_descriptor(libusb_device* dev, uint8_t config_index, struct libusb_config_descriptor** config);
+void libusb_free_config_descriptor(struct libusb_config_descriptor* config);
+
+int libusb_open(libusb_device* dev, libusb_device_handle** handle);
+void libusb_close(libusb_device_handle* dev_handle);
+int libusb_claim_interface(libusb_device_handle* dev, int interface_number);
+int libusb_release_interface(libusb_device_handle* dev, int interface_number);
+
+struct libusb_transfer* libusb_alloc_transfer(int iso_packets);
+void libusb_free_transfer(struct libusb_transfer* transfer);
+int libusb_submit_transfer(struct libusb_transfer* transfer);
+int libusb_handle_events_timeout(libusb_context* ctx, struct timeval* tv);
+
+static inline void libusb_fill_bulk_transfer(struct libusb_transfer* transfer, libusb_device_handle* dev_handle,
+		unsigned char endpoint, unsigned char* buffer, int length, libusb_transfer_cb_fn callback, void* user_data,
+		unsigned int timeout) {
+	transfer->dev_handle = dev_handle;
+	transfer->endpoint = endpoint;
+	transfer->type = LIBUSB_TRANSFER_TYPE_BULK;
+	transfer->timeout = timeout;
+	transfer->buffer = buffer;
+	transfer->length = length;
+	transfer->user_data = user_data;
+	transfer->callback = callback;
+}
+
+static inline void libusb_fill_interrupt_transfer(struct libusb_transfer* transfer, libusb_device_handle* dev_handle,
+		unsigned char endpoint, unsigned char* buffer, int length, libusb_transfer_cb_fn callback, void* user_data,
+		unsigned int timeout) {
+	libusb_fill_bulk_transfer(transfer, dev_handle, endpoint, buffer, length, callback, user_data, timeout);
+	transfer->type = LIBUSB_TRANSFER_TYPE_INTERRUPT;
+}
+
+#endif
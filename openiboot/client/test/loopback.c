@@ -0,0 +1,810 @@
+/*
+ * The libusb half of the loopback: transfers submitted by oibc-usb.c are handed to a model of the device when the
+ * event thread calls libusb_handle_events_timeout, and completed in order from there, callbacks and all.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include <libusb-1.0/libusb.h>
+
+#include "../oibc-usb.h"
+#include "loopback.h"
+#include "lz4stream.h"
+
+#define EP_DATA_IN 0x81
+#define EP_DATA_OUT 0x02
+#define EP_CONTROL_IN 0x83
+#define EP_CONTROL_OUT 0x04
+#define EP_CONSOLE_IN 0x85
+
+// the firmware's sizes: packet-sized console writes, file data as big as the controller takes, pushes up to a page
+#define PACKET_SIZE 512
+#define FILE_BYTES_AT_A_TIME 0x10000
+#define CONSOLE_PUSH_LEN 0x1000
+#define COMMAND_BUFFER_LEN 512
+
+typedef struct Transfer {
+	struct libusb_transfer transfer;	// first, so the two convert freely
+	struct Transfer* next;
+	struct timeval deadline;
+} Transfer;
+
+// what the device has queued to go out on a bulk IN endpoint, one usb_send_bulk call each
+typedef struct Write {
+	struct Write* next;
+	uint8_t* data;
+	size_t length;
+	size_t sent;
+	int stall;		// time the host's transfer out halfway through
+	int push;
+} Write;
+
+typedef struct Reply {
+	struct Reply* next;
+	OpenIBootChunkCmd message;
+	int length;
+} Reply;
+
+typedef enum RxMode {
+	RxCommand,
+	RxFile,
+	RxChunk
+} RxMode;
+
+struct libusb_device {
+	int unused;
+};
+
+struct libusb_device_handle {
+	int unused;
+};
+
+static pthread_mutex_t Lock = PTHREAD_MUTEX_INITIALIZER;
+
+static libusb_device Device;
+static libusb_device_handle Handle;
+static libusb_device* DeviceList[] = {&Device, NULL};
+
+static const struct libusb_interface_descriptor InterfaceDescriptor = {9, 4, 0, 0, 5, 0xFF, 0xFF, 0x51, 0};
+static const struct libusb_interface Interface = {&InterfaceDescriptor, 1};
+static struct libusb_config_descriptor ConfigDescriptor = {9, 2, 0, 1, 1, 0, 0x80, 0, &Interface};
+
+static Transfer* Pending = NULL;
+
+static LoopbackOptions Options;
+static LoopbackStats Stats;
+static int Gone;
+
+static uint8_t Memory[LOOPBACK_MEMORY_SIZE];
+
+static char* Scrollback = NULL;
+static size_t ScrollbackLength = 0;
+static size_t ScrollbackSize = 0;
+
+static Reply* Replies = NULL;
+static Write* DataWrites = NULL;
+static Write* ConsoleWrites = NULL;
+
+static RxMode Mode;
+static uint8_t* RxPtr;
+static uint32_t RxLeft;
+static uint32_t RxLength;
+static uint8_t CommandBuffer[COMMAND_BUFFER_LEN];
+static uint32_t FileAddress;		// set by sendfile, for the next SENDCOMMAND's data
+static uint32_t FileZLength;		// set by sendfilez: what the data decompresses to
+static LZ4Stream Decompress;
+
+static uint32_t GetFileAddress;
+static uint32_t GetFileLeft;
+
+static OpenIBootChunkCmd Chunk;
+static int ChunksAcked;
+static int StallNext;
+
+static int PushOn;
+static int PushInFlight;
+
+static uint32_t CRCTable[256];
+
+static uint32_t crc32(const uint8_t* buffer, size_t len) {
+	uint32_t crc = 0xFFFFFFFF;
+
+	if(CRCTable[1] == 0) {
+		uint32_t i, j;
+		for(i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for(j = 0; j < 8; j++)
+				c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+			CRCTable[i] = c;
+		}
+	}
+
+	while(len-- > 0)
+		crc = CRCTable[(crc ^ *(buffer++)) & 0xFF] ^ (crc >> 8);
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+static uint8_t* memoryAt(uint32_t address, size_t length) {
+	if(address < LOOPBACK_MEMORY_BASE || (address - LOOPBACK_MEMORY_BASE) + length > LOOPBACK_MEMORY_SIZE)
+		return NULL;
+
+	return Memory + (address - LOOPBACK_MEMORY_BASE);
+}
+
+/* The device */
+
+static void queueReply(uint32_t command, uint32_t dataLen, uint32_t address, uint32_t crc, int length) {
+	Reply* reply = (Reply*) calloc(1, sizeof(Reply));
+	reply->message.command = command;
+	reply->message.dataLen = dataLen;
+	reply->message.address = address;
+	reply->message.crc = crc;
+	reply->length = length;
+
+	Reply** tail = &Replies;
+	while(*tail)
+		tail = &(*tail)->next;
+	*tail = reply;
+}
+
+static void replyChunk(uint32_t command, uint32_t crc) {
+	queueReply(command, Chunk.dataLen, Chunk.address, crc, sizeof(OpenIBootChunkCmd));
+}
+
+static Write* queueWrite(Write** queue, const uint8_t* data, size_t length) {
+	Write* write = (Write*) calloc(1, sizeof(Write));
+	write->data = (uint8_t*) malloc(length);
+	memcpy(write->data, data, length);
+	write->length = length;
+
+	while(*queue)
+		queue = &(*queue)->next;
+	*queue = write;
+
+	return write;
+}
+
+static void flushScrollback(uint8_t* to, size_t length) {
+	memcpy(to, Scrollback, length);
+	memmove(Scrollback, Scrollback + length, ScrollbackLength - length);
+	ScrollbackLength -= length;
+}
+
+static void pushConsole() {
+	if(!PushOn || PushInFlight || ScrollbackLength == 0)
+		return;
+
+	size_t length = (ScrollbackLength > CONSOLE_PUSH_LEN) ? CONSOLE_PUSH_LEN : ScrollbackLength;
+	if(length > 1 && (length % PACKET_SIZE) == 0)
+		--length;
+
+	uint8_t buffer[CONSOLE_PUSH_LEN];
+	flushScrollback(buffer, length);
+	queueWrite(&ConsoleWrites, buffer, length)->push = 1;
+	PushInFlight = 1;
+}
+
+static void print(const char* text) {
+	size_t length = strlen(text);
+
+	if(ScrollbackLength + length > ScrollbackSize) {
+		ScrollbackSize = (ScrollbackLength + length) * 2;
+		Scrollback = (char*) realloc(Scrollback, ScrollbackSize);
+	}
+
+	memcpy(Scrollback + ScrollbackLength, text, length);
+	ScrollbackLength += length;
+
+	pushConsole();
+}
+
+static void runCommand(char* command) {
+	char buffer[COMMAND_BUFFER_LEN + 100];
+	char* argv[8];
+	int argc = 0;
+	char* saved;
+	char* token;
+
+	++Stats.commands;
+
+	for(token = strtok_r(command, " \r\n", &saved); token && argc < 8; token = strtok_r(NULL, " \r\n", &saved))
+		argv[argc++] = token;
+
+	if(argc == 0)
+		return;
+
+	if(strcmp(argv[0], "sendfile") == 0 && argc >= 2) {
+		FileAddress = strtoul(argv[1], NULL, 0);
+		FileZLength = 0;
+	} else if(strcmp(argv[0], "sendfilez") == 0 && argc >= 3) {
+		FileAddress = strtoul(argv[1], NULL, 0);
+		FileZLength = strtoul(argv[2], NULL, 0);
+	} else if(strcmp(argv[0], "getfile") == 0 && argc >= 3) {
+		GetFileAddress = strtoul(argv[1], NULL, 0);
+		GetFileLeft = strtoul(argv[2], NULL, 0);
+		if(!memoryAt(GetFileAddress, GetFileLeft)) {
+			++Stats.errors;
+			GetFileLeft = 0;
+		}
+	} else if(strcmp(argv[0], "echo") == 0) {
+		int i;
+		buffer[0] = '\0';
+		for(i = 1; i < argc; i++) {
+			strcat(buffer, argv[i]);
+			strcat(buffer, (i + 1 < argc) ? " " : "");
+		}
+		strcat(buffer, "\r\n");
+		print(buffer);
+	} else {
+		snprintf(buffer, sizeof(buffer), "unknown command: %s\r\n", argv[0]);
+		print(buffer);
+	}
+}
+
+static void dataReceived() {
+	char message[100];
+
+	if(Mode == RxChunk) {
+		uint32_t crc = crc32(memoryAt(Chunk.address, Chunk.dataLen), Chunk.dataLen);
+		if(crc == Chunk.crc) {
+			++ChunksAcked;
+			replyChunk(OPENIBOOTCMD_CHUNK_ACK, crc);
+			if(Options.failAfterChunks && ChunksAcked >= Options.failAfterChunks)
+				Gone = 1;
+		} else {
+			replyChunk(OPENIBOOTCMD_CHUNK_NAK, crc);
+		}
+	} else if(Mode == RxFile && FileZLength) {
+		uint32_t length = Decompress.out - Decompress.start;
+		if(lz4_stream_done(&Decompress))
+			snprintf(message, sizeof(message), "file received (%u bytes from %u compressed)\r\n", length, RxLength);
+		else
+			snprintf(message, sizeof(message), "sendfilez: decompression failed after %u bytes.\r\n", length);
+		FileAddress = 0;
+		FileZLength = 0;
+		print(message);
+	} else if(Mode == RxFile) {
+		FileAddress = 0;
+		snprintf(message, sizeof(message), "file received (%u bytes)\r\n", RxLength);
+		print(message);
+	} else {
+		CommandBuffer[RxLength] = '\0';
+		runCommand((char*) CommandBuffer);
+	}
+
+	Mode = RxCommand;
+}
+
+static void receive(const uint8_t* data, size_t length) {
+	if(RxLeft == 0) {
+		++Stats.errors;
+		return;
+	}
+
+	if(length > RxLeft) {
+		// the firmware only ever arms receives for what it was told is coming
+		++Stats.errors;
+		length = RxLeft;
+	}
+
+	if(Mode == RxFile && FileZLength) {
+		// the firmware stages it and decompresses into place; feeding the decoder straight from here is the same
+		if(lz4_stream_feed(&Decompress, data, length) != 0)
+			++Stats.errors;
+	} else {
+		memcpy(RxPtr, data, length);
+	}
+
+	if(Mode == RxChunk && Options.corruptChunkOut && (Stats.chunks % Options.corruptChunkOut) == 0
+			&& RxPtr == memoryAt(Chunk.address, 0)) {
+		++Stats.chunksCorrupted;
+		RxPtr[0] ^= 0x40;
+	}
+
+	RxPtr += length;
+	RxLeft -= length;
+
+	if(RxLeft == 0)
+		dataReceived();
+}
+
+// The firmware turns a chunk longer than it takes away before it looks at memory or works out a CRC
+static int chunkTooLong() {
+	uint32_t max = Options.chunkMax ? Options.chunkMax : OPENIBOOT_CHUNK_MAX;
+
+	if(Chunk.dataLen <= max)
+		return 0;
+
+	++Stats.chunksRejected;
+	replyChunk(OPENIBOOTCMD_CHUNK_NAK, 0);
+	return 1;
+}
+
+static int startChunk() {
+	if(!memoryAt(Chunk.address, Chunk.dataLen) || Chunk.dataLen == 0) {
+		++Stats.errors;
+		replyChunk(OPENIBOOTCMD_CHUNK_NAK, 0);
+		return 0;
+	}
+
+	++Stats.chunks;
+	StallNext = Options.stallChunk && (Stats.chunks % Options.stallChunk) == 0;
+	return 1;
+}
+
+static void controlReceived(const OpenIBootChunkCmd* cmd, int length) {
+	if(length < (int) sizeof(OpenIBootCmd)) {
+		++Stats.errors;
+		return;
+	}
+
+	switch(cmd->command) {
+		case OPENIBOOTCMD_DUMPBUFFER:
+			++Stats.polls;
+			queueReply(OPENIBOOTCMD_DUMPBUFFER_LEN, GetFileLeft ? GetFileLeft : ScrollbackLength, 0, 0, sizeof(OpenIBootCmd));
+			break;
+
+		case OPENIBOOTCMD_DUMPBUFFER_GOAHEAD:
+			{
+				size_t left = cmd->dataLen;
+				while(left > 0) {
+					uint8_t buffer[FILE_BYTES_AT_A_TIME];
+					size_t toSend;
+					if(GetFileLeft > 0) {
+						toSend = (left > FILE_BYTES_AT_A_TIME) ? FILE_BYTES_AT_A_TIME : left;
+						queueWrite(&DataWrites, memoryAt(GetFileAddress, toSend), toSend);
+						GetFileAddress += toSend;
+						GetFileLeft -= toSend;
+						if(GetFileLeft == 0)
+							print("file sent.\r\n");
+					} else {
+						toSend = (left > PACKET_SIZE) ? PACKET_SIZE : left;
+						if(toSend > ScrollbackLength) {
+							++Stats.errors;
+							break;
+						}
+						flushScrollback(buffer, toSend);
+						queueWrite(&DataWrites, buffer, toSend);
+					}
+					left -= toSend;
+				}
+			}
+			break;
+
+		case OPENIBOOTCMD_SENDCOMMAND:
+			if(!FileAddress && cmd->dataLen >= COMMAND_BUFFER_LEN) {
+				++Stats.commandsRejected;
+				queueReply(OPENIBOOTCMD_SENDCOMMAND_NAK, cmd->dataLen, 0, 0, sizeof(OpenIBootCmd));
+				break;
+			}
+
+			RxLength = RxLeft = cmd->dataLen;
+			if(FileAddress) {
+				Mode = RxFile;
+				RxPtr = memoryAt(FileAddress, FileZLength ? FileZLength : cmd->dataLen);
+				if(FileZLength && RxPtr)
+					lz4_stream_init(&Decompress, RxPtr, FileZLength);
+				if(!RxPtr) {
+					++Stats.errors;
+					break;
+				}
+			} else {
+				Mode = RxCommand;
+				RxPtr = CommandBuffer;
+			}
+			queueReply(OPENIBOOTCMD_SENDCOMMAND_GOAHEAD, cmd->dataLen, 0, 0, sizeof(OpenIBootCmd));
+			if(RxLeft == 0)
+				dataReceived();
+			break;
+
+		case OPENIBOOTCMD_SENDCHUNK:
+			if(length < (int) sizeof(OpenIBootChunkCmd)) {
+				++Stats.errors;
+				break;
+			}
+
+			Chunk = *cmd;
+			if(chunkTooLong()) {
+				break;
+			} else if(FileAddress || RxLeft > 0) {
+				replyChunk(OPENIBOOTCMD_CHUNK_NAK, 0);
+			} else if(startChunk()) {
+				Mode = RxChunk;
+				RxPtr = memoryAt(Chunk.address, Chunk.dataLen);
+				RxLength = RxLeft = Chunk.dataLen;
+				replyChunk(OPENIBOOTCMD_SENDCHUNK_GOAHEAD, Chunk.crc);
+			}
+			break;
+
+		case OPENIBOOTCMD_GETCHUNK:
+			if(length < (int) sizeof(OpenIBootChunkCmd)) {
+				++Stats.errors;
+				break;
+			}
+
+			Chunk = *cmd;
+			if(!chunkTooLong() && startChunk()) {
+				uint8_t* data = memoryAt(Chunk.address, Chunk.dataLen);
+				replyChunk(OPENIBOOTCMD_GETCHUNK_GOAHEAD, crc32(data, Chunk.dataLen));
+
+				Write* write = queueWrite(&DataWrites, data, Chunk.dataLen);
+				write->stall = StallNext;
+				if(Options.corruptChunkIn && (Stats.chunks % Options.corruptChunkIn) == 0) {
+					++Stats.chunksCorrupted;
+					write->data[0] ^= 0x40;
+				}
+
+				if(Options.failAfterChunks && ++ChunksAcked >= Options.failAfterChunks)
+					Gone = 1;
+			}
+			break;
+
+		case OPENIBOOTCMD_VERIFYCHUNK:
+			if(length < (int) sizeof(OpenIBootChunkCmd)) {
+				++Stats.errors;
+				break;
+			}
+
+			Chunk = *cmd;
+			if(!chunkTooLong()) {
+				uint8_t* data = memoryAt(Chunk.address, Chunk.dataLen);
+				uint32_t crc = data ? crc32(data, Chunk.dataLen) : 0;
+				replyChunk((data && crc == Chunk.crc) ? OPENIBOOTCMD_CHUNK_ACK : OPENIBOOTCMD_CHUNK_NAK, crc);
+			}
+			break;
+
+		case OPENIBOOTCMD_CONSOLE_PUSH:
+			// older firmware doesn't answer at all
+			if(!Options.push)
+				break;
+
+			PushOn = (cmd->dataLen != 0);
+			queueReply(OPENIBOOTCMD_CONSOLE_PUSH, PushOn, 0, 0, sizeof(OpenIBootCmd));
+			pushConsole();
+			break;
+
+		default:
+			++Stats.errors;
+			break;
+	}
+}
+
+/* libusb */
+
+static void complete(Transfer** done, Transfer* t, enum libusb_transfer_status status) {
+	Transfer** p = &Pending;
+	while(*p != t)
+		p = &(*p)->next;
+	*p = t->next;
+
+	t->transfer.status = status;
+	t->next = NULL;
+	while(*done)
+		done = &(*done)->next;
+	*done = t;
+}
+
+// Hands whatever the device has written so far to the host's transfer; TRUE once the transfer is finished
+static int fillFromWrites(Write** queue, Transfer* t, enum libusb_transfer_status* status) {
+	struct libusb_transfer* transfer = &t->transfer;
+
+	*status = LIBUSB_TRANSFER_COMPLETED;
+
+	while(*queue && transfer->actual_length < transfer->length) {
+		Write* write = *queue;
+		size_t room = transfer->length - transfer->actual_length;
+		size_t toCopy = write->length - write->sent;
+
+		// a stalled write only gets halfway before the host gives up on it
+		if(write->stall)
+			toCopy = write->length / 2 - write->sent;
+
+		if(toCopy > room)
+			toCopy = room;
+
+		memcpy(transfer->buffer + transfer->actual_length, write->data + write->sent, toCopy);
+		transfer->actual_length += toCopy;
+		write->sent += toCopy;
+
+		if(write->stall && write->sent == write->length / 2) {
+			write->stall = 0;
+			++Stats.chunksStalled;
+			*status = LIBUSB_TRANSFER_TIMED_OUT;
+			return 1;
+		}
+
+		if(write->sent < write->length)
+			return transfer->actual_length == transfer->length;
+
+		// a short packet ends the host's transfer early
+		int shortPacket = (write->length % PACKET_SIZE) != 0;
+
+		*queue = write->next;
+		if(write->push) {
+			PushInFlight = 0;
+			pushConsole();
+		}
+
+		free(write->data);
+		free(write);
+
+		if(shortPacket || transfer->actual_length == transfer->length)
+			return 1;
+	}
+
+	return transfer->actual_length == transfer->length;
+}
+
+// One pass over everything pending, in the order it was submitted; returns the transfers that finished
+static Transfer* service() {
+	Transfer* done = NULL;
+	Transfer* t = Pending;
+	int dataBusy = 0;
+	int consoleBusy = 0;
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+
+	while(t) {
+		Transfer* next = t->next;
+		struct libusb_transfer* transfer = &t->transfer;
+		enum libusb_transfer_status status;
+
+		if(Gone) {
+			complete(&done, t, LIBUSB_TRANSFER_NO_DEVICE);
+		} else if(transfer->endpoint == EP_CONTROL_OUT) {
+			transfer->actual_length = transfer->length;
+			controlReceived((const OpenIBootChunkCmd*) transfer->buffer, transfer->length);
+			complete(&done, t, LIBUSB_TRANSFER_COMPLETED);
+		} else if(transfer->endpoint == EP_DATA_OUT) {
+			size_t length = transfer->length;
+			if(Mode == RxChunk && StallNext) {
+				StallNext = 0;
+				++Stats.chunksStalled;
+				length /= 2;
+				status = LIBUSB_TRANSFER_TIMED_OUT;
+			} else {
+				status = LIBUSB_TRANSFER_COMPLETED;
+			}
+
+			transfer->actual_length = length;
+			receive(transfer->buffer, length);
+			complete(&done, t, status);
+		} else if(transfer->endpoint == EP_CONTROL_IN) {
+			if(Replies) {
+				Reply* reply = Replies;
+				Replies = reply->next;
+				transfer->actual_length = (reply->length < transfer->length) ? reply->length : transfer->length;
+				memcpy(transfer->buffer, &reply->message, transfer->actual_length);
+				free(reply);
+				complete(&done, t, LIBUSB_TRANSFER_COMPLETED);
+			} else if(transfer->timeout && timercmp(&now, &t->deadline, >)) {
+				complete(&done, t, LIBUSB_TRANSFER_TIMED_OUT);
+			}
+		} else if(transfer->endpoint == EP_DATA_IN || transfer->endpoint == EP_CONSOLE_IN) {
+			// only the oldest transfer on an endpoint is being filled
+			int* busy = (transfer->endpoint == EP_DATA_IN) ? &dataBusy : &consoleBusy;
+			Write** queue = (transfer->endpoint == EP_DATA_IN) ? &DataWrites : &ConsoleWrites;
+			if(!*busy) {
+				*busy = 1;
+				if(fillFromWrites(queue, t, &status))
+					complete(&done, t, status);
+				else if(transfer->timeout && timercmp(&now, &t->deadline, >))
+					complete(&done, t, LIBUSB_TRANSFER_TIMED_OUT);
+			}
+		} else {
+			complete(&done, t, LIBUSB_TRANSFER_STALL);
+		}
+
+		t = next;
+	}
+
+	return done;
+}
+
+int libusb_handle_events_timeout(libusb_context* ctx, struct timeval* tv) {
+	int handled = 0;
+
+	while(1) {
+		pthread_mutex_lock(&Lock);
+		Transfer* done = service();
+		pthread_mutex_unlock(&Lock);
+
+		if(!done)
+			break;
+
+		while(done) {
+			Transfer* next = done->next;
+			struct libusb_transfer* transfer = &done->transfer;
+			uint8_t flags = transfer->flags;
+
+			transfer->callback(transfer);
+
+			if(flags & LIBUSB_TRANSFER_FREE_BUFFER)
+				free(transfer->buffer);
+			if(flags & LIBUSB_TRANSFER_FREE_TRANSFER)
+				libusb_free_transfer(transfer);
+
+			done = next;
+			++handled;
+		}
+	}
+
+	// nothing to do: wait as the real thing would, just not for as long
+	if(!handled) {
+		long wait = tv ? (tv->tv_sec * 1000000 + tv->tv_usec) : 1000;
+		usleep((wait < 1000) ? wait : 1000);
+	}
+
+	return 0;
+}
+
+struct libusb_transfer* libusb_alloc_transfer(int iso_packets) {
+	Transfer* t = (Transfer*) calloc(1, sizeof(Transfer));
+	return t ? &t->transfer : NULL;
+}
+
+void libusb_free_transfer(struct libusb_transfer* transfer) {
+	free(transfer);
+}
+
+int libusb_submit_transfer(struct libusb_transfer* transfer) {
+	Transfer* t = (Transfer*) transfer;
+	Transfer** tail;
+	int dataInFlight = 0;
+
+	pthread_mutex_lock(&Lock);
+
+	if(Gone) {
+		pthread_mutex_unlock(&Lock);
+		return LIBUSB_ERROR_NO_DEVICE;
+	}
+
+	transfer->actual_length = 0;
+	gettimeofday(&t->deadline, NULL);
+	t->deadline.tv_sec += transfer->timeout / 1000;
+	t->deadline.tv_usec += (transfer->timeout % 1000) * 1000;
+	t->deadline.tv_sec += t->deadline.tv_usec / 1000000;
+	t->deadline.tv_usec %= 1000000;
+
+	t->next = NULL;
+	for(tail = &Pending; *tail; tail = &(*tail)->next) {
+		if((*tail)->transfer.endpoint == EP_DATA_IN || (*tail)->transfer.endpoint == EP_DATA_OUT)
+			++dataInFlight;
+	}
+	*tail = t;
+
+	if(transfer->endpoint == EP_DATA_IN || transfer->endpoint == EP_DATA_OUT) {
+		if(++dataInFlight > Stats.maxDataInFlight)
+			Stats.maxDataInFlight = dataInFlight;
+	}
+
+	pthread_mutex_unlock(&Lock);
+	return 0;
+}
+
+int libusb_init(libusb_context** ctx) {
+	return 0;
+}
+
+void libusb_exit(libusb_context* ctx) {
+}
+
+ssize_t libusb_get_device_list(libusb_context* ctx, libusb_device*** list) {
+	*list = DeviceList;
+	return 1;
+}
+
+void libusb_free_device_list(libusb_device** list, int unref_devices) {
+}
+
+int libusb_get_device_descriptor(libusb_device* dev, struct libusb_device_descriptor* desc) {
+	memset(desc, 0, sizeof(*desc));
+	desc->bLength = sizeof(*desc);
+	desc->idVendor = OPENIBOOT_VENDOR;
+	desc->idProduct = OPENIBOOT_PRODUCT;
+	desc->bNumConfigurations = 1;
+	return 0;
+}
+
+int libusb_get_config_descriptor(libusb_device* dev, uint8_t config_index, struct libusb_config_descriptor** config) {
+	*config = &ConfigDescriptor;
+	return 0;
+}
+
+void libusb_free_config_descriptor(struct libusb_config_descriptor* config) {
+}
+
+int libusb_open(libusb_device* dev, libusb_device_handle** handle) {
+	*handle = &Handle;
+	return 0;
+}
+
+void libusb_close(libusb_device_handle* dev_handle) {
+}
+
+int libusb_claim_interface(libusb_device_handle* dev, int interface_number) {
+	return 0;
+}
+
+int libusb_release_interface(libusb_device_handle* dev, int interface_number) {
+	return 0;
+}
+
+/* The test's side */
+
+static void freeWrites(Write** queue) {
+	while(*queue) {
+		Write* write = *queue;
+		*queue = write->next;
+		free(write->data);
+		free(write);
+	}
+}
+
+void loopback_connect(const LoopbackOptions* options) {
+	pthread_mutex_lock(&Lock);
+
+	// Whatever the last host left queued is dropped. The transfers it still owns are its business; the ones libusb
+	// was to free on completion are ours.
+	while(Pending) {
+		Transfer* t = Pending;
+		Pending = t->next;
+		if(t->transfer.flags & LIBUSB_TRANSFER_FREE_BUFFER)
+			free(t->transfer.buffer);
+		if(t->transfer.flags & LIBUSB_TRANSFER_FREE_TRANSFER)
+			free(t);
+	}
+
+	while(Replies) {
+		Reply* reply = Replies;
+		Replies = reply->next;
+		free(reply);
+	}
+
+	freeWrites(&DataWrites);
+	freeWrites(&ConsoleWrites);
+
+	Options = *options;
+	memset(&Stats, 0, sizeof(Stats));
+	Gone = 0;
+	ScrollbackLength = 0;
+	Mode = RxCommand;
+	RxLeft = 0;
+	FileAddress = 0;
+	FileZLength = 0;
+	GetFileLeft = 0;
+	ChunksAcked = 0;
+	StallNext = 0;
+	PushOn = 0;
+	PushInFlight = 0;
+
+	pthread_mutex_unlock(&Lock);
+}
+
+uint8_t* loopback_memory(uint32_t address, size_t length) {
+	return memoryAt(address, length);
+}
+
+void loopback_clear_memory() {
+	pthread_mutex_lock(&Lock);
+	memset(Memory, 0, sizeof(Memory));
+	pthread_mutex_unlock(&Lock);
+}
+
+void loopback_print(const char* text) {
+	pthread_mutex_lock(&Lock);
+	print(text);
+	pthread_mutex_unlock(&Lock);
+}
+
+void loopback_stats(LoopbackStats* stats) {
+	pthread_mutex_lock(&Lock);
+	*stats = Stats;
+	pthread_mutex_unlock(&Lock);
+}
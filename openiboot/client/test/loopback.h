@@ -0,0 +1,47 @@
+#ifndef LOOPBACK_H
+#define LOOPBACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A stand-in for a device running openiboot, behind the libusb calls oibc-usb.c makes. It speaks the same protocol as
+// the firmware's openiboot.c over the same endpoints, with its memory window and console kept on the host, and can
+// be told to misbehave the way a real link does.
+
+#define LOOPBACK_MEMORY_BASE 0x09000000
+#define LOOPBACK_MEMORY_SIZE (8 * 1024 * 1024)
+
+typedef struct LoopbackOptions {
+	int push;				// answer CONSOLE_PUSH, as current firmware does
+	int corruptChunkOut;	// flip a byte in every Nth chunk the device receives (0 = never)
+	int corruptChunkIn;		// flip a byte in every Nth chunk the device sends, after its CRC is taken
+	int stallChunk;			// every Nth chunk's bulk transfer times out halfway through
+	int failAfterChunks;	// the device goes away once this many chunks have been acknowledged (0 = never)
+	uint32_t chunkMax;		// longest chunk the device takes (0 = OPENIBOOT_CHUNK_MAX, as the firmware)
+} LoopbackOptions;
+
+typedef struct LoopbackStats {
+	int commands;			// commands received and run
+	int commandsRejected;	// too long for the command buffer, turned away with SENDCOMMAND_NAK
+	int polls;				// DUMPBUFFER requests
+	int chunks;				// checked chunks started, including resends
+	int chunksCorrupted;
+	int chunksStalled;
+	int chunksRejected;		// longer than the device takes, turned away with CHUNK_NAK
+	int maxDataInFlight;	// most bulk data transfers the host had queued at once
+	int errors;				// requests the firmware would have choked on
+} LoopbackStats;
+
+// Plugs in a freshly reset device. Its memory is left as it was, so a transfer can be resumed across connections.
+void loopback_connect(const LoopbackOptions* options);
+
+// Where device address lands in the host's copy of the device memory, or NULL if it's outside it.
+uint8_t* loopback_memory(uint32_t address, size_t length);
+void loopback_clear_memory();
+
+// Prints to the device's console, as bufferPrintf would.
+void loopback_print(const char* text);
+
+void loopback_stats(LoopbackStats* stats);
+
+#endif
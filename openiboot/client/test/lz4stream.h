@@ -0,0 +1,24 @@
+#ifndef LZ4STREAM_H
+#define LZ4STREAM_H
+
+#include <stdint.h>
+
+// The firmware's sendfilez decoder (lz4.c), built against its own headers; those can't be mixed with the host's, so
+// what's used from includes/lz4.h is restated here.
+
+typedef struct LZ4Stream {
+	uint8_t* start;
+	uint8_t* out;
+	uint8_t* end;
+	int state;
+	uint8_t token;
+	uint32_t literalLength;
+	uint32_t matchLength;
+	uint32_t offset;
+} LZ4Stream;
+
+void lz4_stream_init(LZ4Stream* stream, void* destination, uint32_t length);
+int lz4_stream_feed(LZ4Stream* stream, const uint8_t* data, uint32_t length);
+int lz4_stream_done(LZ4Stream* stream);
+
+#endif
@@ -0,0 +1,266 @@
+/*
+ * test_loopback: drives the client's transport through the loopback device the way oibc and linux use it, and
+ * checks that what arrives on either end is what was sent, in order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "../oibc-usb.h"
+#include "harness.h"
+
+#define COMMANDS 200
+#define FILE_SIZE (1024 * 1024)
+#define ADDRESS "0x09000000"
+
+static void sendCommand(const char* command) {
+	CHECK(oibc_send_command(command, strlen(command)) == 0);
+}
+
+// Every command's output arrives, once and in the order the commands were queued
+static void testCommands(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char command[64];
+	int i;
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	for(i = 0; i < COMMANDS; i++) {
+		snprintf(command, sizeof(command), "echo line %d", i);
+		sendCommand(command);
+	}
+
+	snprintf(command, sizeof(command), "line %d\r\n", COMMANDS - 1);
+	CHECK(harness_wait(command, 10));
+
+	char* output = harness_output();
+	const char* at = output;
+	for(i = 0; i < COMMANDS && at; i++) {
+		snprintf(command, sizeof(command), "line %d\r\n", i);
+		at = strstr(at, command);
+		CHECK(at != NULL);
+		if(at)
+			at += strlen(command);
+	}
+	free(output);
+
+	sendCommand("bogus");
+	CHECK(harness_wait("unknown command: bogus", 5));
+
+	loopback_stats(&stats);
+	CHECK(stats.commands == COMMANDS + 1);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+}
+
+// A command too long for the device's buffer is turned away, and the ones after it still run
+static void testLongCommand(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char command[600];
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	// 511 bytes still fits with its terminator, 512 doesn't
+	memset(command, ' ', sizeof(command));
+	memcpy(command, "echo fits", 9);
+	command[511] = '\0';
+	sendCommand(command);
+
+	memcpy(command, "echo too long", 13);
+	command[511] = ' ';
+	command[512] = '\0';
+	sendCommand(command);
+	sendCommand("echo after");
+
+	CHECK(harness_wait("after\r\n", 5));
+
+	char* output = harness_output();
+	CHECK(strstr(output, "fits") != NULL);
+	CHECK(strstr(output, "too long ") == NULL);
+	CHECK(strstr(output, "turned away a 512 byte command") != NULL);
+	free(output);
+
+	loopback_stats(&stats);
+	CHECK(stats.commands == 2);
+	CHECK(stats.commandsRejected == 1);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+}
+
+// Output printed while nobody is asking for it still shows up; with pushes on, nobody has to ask
+static void testIdleOutput(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	// give the client time to find out whether the device pushes
+	harness_settle(push ? 100 : 1200);
+	loopback_print("out of the blue\r\n");
+	CHECK(harness_wait("out of the blue\r\n", 5));
+
+	harness_settle(200);
+	loopback_stats(&stats);
+	if(push)
+		CHECK(stats.polls == 0);
+	else
+		CHECK(stats.polls > 0);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+}
+
+static void testSendFile(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char expected[64];
+	uint8_t* data = (uint8_t*) malloc(FILE_SIZE);
+
+	harness_noise(data, FILE_SIZE, 0x1234 + push);
+	loopback_clear_memory();
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		free(data);
+		return;
+	}
+
+	CHECK(oibc_send_file(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+
+	snprintf(expected, sizeof(expected), "file received (%d bytes)", FILE_SIZE);
+	CHECK(harness_wait(expected, 10));
+	CHECK(harness_wait("oibc: sent", 5));
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE) == 0);
+
+	loopback_stats(&stats);
+	CHECK(stats.maxDataInFlight > 1);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+	free(data);
+}
+
+static void testSendFileCompressed(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char expected[64];
+	uint8_t* data = (uint8_t*) malloc(FILE_SIZE);
+
+	// half noise, half padding, like most kernels and ramdisks
+	memset(data, 0, FILE_SIZE);
+	harness_noise(data, FILE_SIZE / 2, 0x9abc + push);
+	loopback_clear_memory();
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		free(data);
+		return;
+	}
+
+	CHECK(oibc_send_file_compressed(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+
+	snprintf(expected, sizeof(expected), "file received (%d bytes from ", FILE_SIZE);
+	CHECK(harness_wait(expected, 10));
+	snprintf(expected, sizeof(expected), "oibc: sent %d bytes as ", FILE_SIZE);
+	CHECK(harness_wait(expected, 5));
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE) == 0);
+
+	loopback_stats(&stats);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+	free(data);
+}
+
+static void testGetFile(int push) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char path[] = "/tmp/test_loopbackXXXXXX";
+	uint8_t* data = (uint8_t*) malloc(FILE_SIZE);
+	struct stat st;
+	int i;
+
+	harness_noise(data, FILE_SIZE, 0x5678 + push);
+	memcpy(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE);
+
+	int fd = mkstemp(path);
+	CHECK(fd >= 0);
+	FILE* file = fdopen(fd, "wb");
+
+	options.push = push;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		free(data);
+		return;
+	}
+
+	CHECK(oibc_get_file(file, FILE_SIZE, ADDRESS) == 0);
+	CHECK(harness_wait("file sent.", 10));
+
+	// the client closes the file once the last of it is in
+	for(i = 0; i < 5000; i++) {
+		if(stat(path, &st) == 0 && st.st_size == FILE_SIZE)
+			break;
+		harness_settle(1);
+	}
+	harness_settle(10);
+
+	CHECK(st.st_size == FILE_SIZE);
+
+	uint8_t* received = (uint8_t*) malloc(FILE_SIZE);
+	FILE* check = fopen(path, "rb");
+	CHECK(check && fread(received, 1, FILE_SIZE, check) == FILE_SIZE);
+	CHECK(memcmp(received, data, FILE_SIZE) == 0);
+	if(check)
+		fclose(check);
+
+	// and none of the file leaked onto the console
+	char* output = harness_output();
+	CHECK(strlen(output) < 100);
+	free(output);
+
+	loopback_stats(&stats);
+	CHECK(stats.maxDataInFlight > 1);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+	unlink(path);
+	free(received);
+	free(data);
+}
+
+int main(int argc, char* argv[]) {
+	int push;
+
+	for(push = 1; push >= 0; push--) {
+		testCommands(push);
+		testLongCommand(push);
+		testIdleOutput(push);
+		testSendFile(push);
+		testSendFileCompressed(push);
+		testGetFile(push);
+	}
+
+	return harness_finish("test_loopback");
+}
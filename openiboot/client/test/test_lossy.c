@@ -0,0 +1,284 @@
+/*
+ * test_lossy: runs checked transfers over a loopback device that corrupts chunks, stalls them halfway and drops off
+ * the bus, and checks that the file still arrives intact and that rerunning an interrupted transfer resumes it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../oibc-usb.h"
+#include "harness.h"
+
+#define CHUNK 0x10000
+#define FILE_SIZE (16 * CHUNK + 1234)
+#define ADDRESS "0x09000000"
+
+typedef struct Summary {
+	unsigned int moved;
+	unsigned int inPlace;
+	int resent;
+} Summary;
+
+// Waits for the client's report on a checked transfer and picks it apart
+static int waitSummary(int download, Summary* summary) {
+	const char* prefix = download ? "oibc: received " : "oibc: sent ";
+	float seconds, rate;
+	int ok = 0;
+
+	if(!harness_wait(" chunks resent", 20))
+		return 0;
+
+	char* output = harness_output();
+	const char* at = strstr(output, prefix);
+	if(at) {
+		ok = sscanf(at + strlen(prefix), "%u bytes in %f s (%f KB/s), %u already in place, %d chunks resent",
+			&summary->moved, &seconds, &rate, &summary->inPlace, &summary->resent) == 5;
+	}
+
+	if(!ok)
+		fprintf(stderr, "cannot make sense of: %s\n", output);
+
+	free(output);
+	return ok;
+}
+
+static int sameAsFile(const char* path, const uint8_t* data, size_t length) {
+	uint8_t* contents = (uint8_t*) malloc(length + 1);
+	FILE* file = fopen(path, "rb");
+	int same = file && fread(contents, 1, length + 1, file) == length && memcmp(contents, data, length) == 0;
+
+	if(file)
+		fclose(file);
+
+	free(contents);
+	return same;
+}
+
+// Waits for the device to have seen at least count chunks, as a stand-in for watching it fail partway
+static void waitChunks(int count) {
+	LoopbackStats stats;
+	int i;
+
+	for(i = 0; i < 5000; i++) {
+		loopback_stats(&stats);
+		if(stats.chunks >= count)
+			break;
+		harness_settle(1);
+	}
+
+	harness_settle(100);
+}
+
+static void testSend(const LoopbackOptions* options, const uint8_t* data) {
+	LoopbackStats stats;
+	Summary summary;
+
+	loopback_clear_memory();
+	if(harness_connect(options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_send_file_checked(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+	CHECK(waitSummary(0, &summary));
+	CHECK(summary.moved == FILE_SIZE);
+	CHECK(summary.inPlace == 0);
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE) == 0);
+
+	loopback_stats(&stats);
+	CHECK(stats.errors == 0);
+	if(options->corruptChunkOut)
+		CHECK(stats.chunksCorrupted > 0 && summary.resent == stats.chunksCorrupted);
+	if(options->stallChunk)
+		CHECK(stats.chunksStalled > 0);
+
+	harness_disconnect();
+}
+
+static void testGet(const LoopbackOptions* options, const uint8_t* data) {
+	LoopbackStats stats;
+	Summary summary;
+	char path[] = "/tmp/test_lossyXXXXXX";
+
+	memcpy(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE);
+
+	int fd = mkstemp(path);
+	CHECK(fd >= 0);
+
+	if(harness_connect(options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_get_file_checked(fdopen(fd, "r+b"), FILE_SIZE, ADDRESS) == 0);
+	CHECK(waitSummary(1, &summary));
+	CHECK(summary.moved == FILE_SIZE);
+	CHECK(summary.inPlace == 0);
+
+	loopback_stats(&stats);
+	CHECK(stats.errors == 0);
+	if(options->corruptChunkIn)
+		CHECK(stats.chunksCorrupted > 0 && summary.resent == stats.chunksCorrupted);
+	if(options->stallChunk)
+		CHECK(stats.chunksStalled > 0);
+
+	harness_disconnect();
+
+	CHECK(sameAsFile(path, data, FILE_SIZE));
+	unlink(path);
+}
+
+// The device goes away partway through; the same transfer run again only moves what's missing
+static void testResumeSend(const uint8_t* data) {
+	LoopbackOptions options = {0};
+	Summary summary;
+
+	loopback_clear_memory();
+	options.failAfterChunks = 6;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_send_file_checked(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+	waitChunks(options.failAfterChunks);
+	harness_disconnect();
+
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE) != 0);
+
+	options.failAfterChunks = 0;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_send_file_checked(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+	CHECK(waitSummary(0, &summary));
+	CHECK(summary.inPlace == 6 * CHUNK);
+	CHECK(summary.moved == FILE_SIZE - 6 * CHUNK);
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE) == 0);
+
+	harness_disconnect();
+}
+
+static void testResumeGet(const uint8_t* data) {
+	LoopbackOptions options = {0};
+	Summary summary;
+	char path[] = "/tmp/test_lossyXXXXXX";
+
+	memcpy(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE);
+
+	int fd = mkstemp(path);
+	CHECK(fd >= 0);
+	close(fd);
+
+	options.failAfterChunks = 6;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_get_file_checked(fopen(path, "r+b"), FILE_SIZE, ADDRESS) == 0);
+	waitChunks(options.failAfterChunks);
+	harness_disconnect();
+
+	CHECK(!sameAsFile(path, data, FILE_SIZE));
+
+	options.failAfterChunks = 0;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	// the chunk that was on its way when the device went never made it
+	CHECK(oibc_get_file_checked(fopen(path, "r+b"), FILE_SIZE, ADDRESS) == 0);
+	CHECK(waitSummary(1, &summary));
+	CHECK(summary.inPlace == 5 * CHUNK);
+	CHECK(summary.moved == FILE_SIZE - 5 * CHUNK);
+
+	harness_disconnect();
+
+	CHECK(sameAsFile(path, data, FILE_SIZE));
+	unlink(path);
+}
+
+// A device that takes shorter chunks than the client sends turns them away before touching its memory, and the
+// client stops rather than retrying forever
+static void testOversized(const uint8_t* data) {
+	LoopbackOptions options = {0};
+	LoopbackStats stats;
+	char path[] = "/tmp/test_lossyXXXXXX";
+
+	loopback_clear_memory();
+	options.push = 1;
+	options.chunkMax = CHUNK / 2;
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_send_file_checked(harness_file(data, FILE_SIZE), FILE_SIZE, ADDRESS) == 0);
+	CHECK(harness_wait("checked transfer stopped at offset 0x0: the device turned the chunk away", 20));
+	CHECK(memcmp(loopback_memory(LOOPBACK_MEMORY_BASE, CHUNK), data, CHUNK) != 0);
+
+	loopback_stats(&stats);
+	CHECK(stats.chunksRejected > 0);
+	CHECK(stats.chunks == 0);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+
+	memcpy(loopback_memory(LOOPBACK_MEMORY_BASE, FILE_SIZE), data, FILE_SIZE);
+
+	int fd = mkstemp(path);
+	CHECK(fd >= 0);
+
+	if(harness_connect(&options) != 0) {
+		CHECK(0);
+		return;
+	}
+
+	CHECK(oibc_get_file_checked(fdopen(fd, "r+b"), FILE_SIZE, ADDRESS) == 0);
+	CHECK(harness_wait("checked transfer stopped at offset 0x0: the device turned the chunk away", 20));
+
+	loopback_stats(&stats);
+	CHECK(stats.chunksRejected > 0);
+	CHECK(stats.chunks == 0);
+	CHECK(stats.errors == 0);
+
+	harness_disconnect();
+	unlink(path);
+}
+
+int main(int argc, char* argv[]) {
+	LoopbackOptions options;
+	uint8_t* data = (uint8_t*) malloc(FILE_SIZE);
+
+	harness_noise(data, FILE_SIZE, 0xfeed);
+
+	memset(&options, 0, sizeof(options));
+	options.push = 1;
+	testSend(&options, data);
+	testGet(&options, data);
+
+	options.corruptChunkOut = 3;
+	testSend(&options, data);
+
+	options.corruptChunkOut = 0;
+	options.corruptChunkIn = 4;
+	testGet(&options, data);
+
+	options.corruptChunkIn = 0;
+	options.stallChunk = 5;
+	testSend(&options, data);
+	testGet(&options, data);
+
+	testResumeSend(data);
+	testResumeGet(data);
+	testOversized(data);
+
+	free(data);
+	return harness_finish("test_lossy");
+}
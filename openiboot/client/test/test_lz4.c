@@ -0,0 +1,119 @@
+/*
+ * test_lz4: round-trips data through the client's streaming compressor and the firmware's sendfilez decoder, fed in
+ * pieces the way USB transfers would arrive.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../lz4.h"
+#include "lz4stream.h"
+#include "harness.h"
+
+// bigger than the compressor's window and chunk put together, so the window has to slide
+#define BIG (3 * 1024 * 1024)
+
+static void roundTrip(const char* name, const uint8_t* data, size_t length, size_t prefix, size_t piece) {
+	FILE* in = tmpfile();
+	FILE* out = tmpfile();
+	uint8_t* padding = (uint8_t*) calloc(1, prefix + 1);
+
+	// the compressor starts wherever the file position is
+	fwrite(padding, 1, prefix, in);
+	fwrite(data, 1, length, in);
+	fseek(in, prefix, SEEK_SET);
+
+	size_t compressedLength = lz4_compress_file(in, length, out);
+	if(length > 0 && compressedLength == 0) {
+		fprintf(stderr, "%s: compression failed\n", name);
+		CHECK(0);
+		return;
+	}
+
+	uint8_t* compressed = (uint8_t*) malloc(compressedLength + 1);
+	rewind(out);
+	CHECK(fread(compressed, 1, compressedLength, out) == compressedLength);
+
+	uint8_t* decompressed = (uint8_t*) malloc(length + 1);
+	LZ4Stream stream;
+	size_t offset = 0;
+	int ok = 1;
+
+	lz4_stream_init(&stream, decompressed, length);
+	while(offset < compressedLength && ok) {
+		size_t toFeed = compressedLength - offset;
+		if(toFeed > piece)
+			toFeed = piece;
+
+		ok = (lz4_stream_feed(&stream, compressed + offset, toFeed) == 0);
+		offset += toFeed;
+	}
+
+	if(!ok || !lz4_stream_done(&stream) || memcmp(decompressed, data, length) != 0) {
+		fprintf(stderr, "%s: %u bytes did not survive the round trip\n", name, (unsigned int) length);
+		CHECK(0);
+	}
+
+	if(length >= BIG)
+		printf("%-12s %8u -> %8u bytes\n", name, (unsigned int) length, (unsigned int) compressedLength);
+
+	fclose(in);
+	fclose(out);
+	free(padding);
+	free(compressed);
+	free(decompressed);
+}
+
+// Fills buffer with something like a firmware image: runs of repeats and near-repeats between stretches of noise
+static void makeMixed(uint8_t* buffer, size_t length) {
+	size_t i = 0;
+	uint32_t seed = 99;
+
+	harness_noise(buffer, length, 7);
+	while(i < length) {
+		seed = seed * 1103515245 + 12345;
+		size_t run = 16 + ((seed >> 8) % 4096);
+		size_t back = 1 + ((seed >> 4) % 60000);
+		if(i + run > length)
+			run = length - i;
+
+		if(i > back && (seed & 0x10000)) {
+			size_t j;
+			for(j = 0; j < run; j++)
+				buffer[i + j] = buffer[i + j - back];
+		}
+
+		i += run;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	uint8_t* data = (uint8_t*) malloc(BIG);
+	size_t length;
+
+	memset(data, 0, BIG);
+	roundTrip("empty", data, 0, 0, 1);
+
+	for(length = 1; length <= 40; length++) {
+		memset(data, 'a', length);
+		roundTrip("short", data, length, 3, 1);
+	}
+
+	memset(data, 0, BIG);
+	roundTrip("zeros", data, BIG, 0, 0x10000);
+
+	harness_noise(data, BIG, 1);
+	roundTrip("noise", data, BIG, 17, 0x1FE00);
+
+	// a stretch of noise longer than everything buffered, so its literals have to be read back from the file
+	memset(data, 0x55, BIG);
+	harness_noise(data + 1000, BIG / 2, 2);
+	roundTrip("long-literal", data, BIG, 512, 777);
+
+	makeMixed(data, BIG);
+	roundTrip("mixed", data, BIG, 0, 4096);
+
+	free(data);
+	return harness_finish("test_lz4");
+}
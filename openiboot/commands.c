@@ -16,8 +16,10 @@
 #include "dma.h"
 #include "nand.h"
 #include "ftl.h"
+#include "usbmsc.h"
 #include "i2c.h"
 #include "hfs/fs.h"
+#include "splash.h"
 #include "aes.h"
 #include "accel.h"
 #include "sdio.h"
@@ -28,6 +30,7 @@
 #include "radio.h"
 #include "als.h"
 #include "piezo.h"
+#include "log.h"
 
 void cmd_reboot(int argc, char** argv) {
 	Reboot();
@@ -499,7 +502,12 @@ void cmd_dma(int argc, char** argv) {
 	int controller = 0;
 	int channel = 0;
 	bufferPrintf("dma_request: %d\r\n", dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, NULL));
-	bufferPrintf("dma_perform(controller: %d, channel %d): %d\r\n", controller, channel, dma_perform(source, dest, size, FALSE, &controller, &channel));
+	int error = dma_perform(source, dest, size, FALSE, &controller, &channel);
+	bufferPrintf("dma_perform(controller: %d, channel %d): %d\r\n", controller, channel, error);
+	if(error != 0) {
+		dma_cancel(controller, channel);
+		return;
+	}
 	bufferPrintf("dma_finish(controller: %d, channel %d): %d\r\n", controller, channel, dma_finish(controller, channel, 500));
 }
 
@@ -661,6 +669,31 @@ void cmd_ftl_sync(int argc, char** argv) {
 		bufferPrintf("Error.\r\n");
 }
 
+void cmd_usbmsc(int argc, char** argv) {
+	int writable = (argc > 1 && strcmp(argv[1], "rw") == 0);
+	if(argc > 1 && !writable) {
+		bufferPrintf("Usage: %s [rw]\r\n", argv[0]);
+		return;
+	}
+
+	msc_start(writable);
+}
+
+#ifndef NO_HFS
+#ifndef NO_STBIMAGE
+void cmd_splash(int argc, char** argv) {
+	if(argc < 3) {
+		bufferPrintf("Usage: %s <partition> <file>\r\n", argv[0]);
+		return;
+	}
+
+	framebuffer_setdisplaytext(FALSE);
+	if(splash_draw(parseNumber(argv[1]), argv[2]) != 0)
+		framebuffer_setdisplaytext(TRUE);
+}
+#endif
+#endif
+
 void cmd_bdev_read(int argc, char** argv) {
 	if(argc < 4) {
 		bufferPrintf("Usage: %s <address> <offset> <bytes>\r\n", argv[0]);
@@ -719,6 +752,17 @@ void cmd_version(int argc, char** argv) {
 	bufferPrintf("%s\r\n", OPENIBOOT_VERSION_STR);
 }
 
+void cmd_log(int argc, char** argv) {
+	if(argc >= 3) {
+		if(log_set_level(argv[1], parseNumber(argv[2])) != 0) {
+			bufferPrintf("Usage: %s [<general|ftl|nand|usb|dma> <level>]\r\n", argv[0]);
+			return;
+		}
+	}
+
+	bufferPrintf("log: %d records drained\r\n", log_drain());
+}
+
 void cmd_time(int argc, char** argv) {
 	int day;
 	int month;
@@ -1140,12 +1184,16 @@ OPIBCommand CommandList[] =
 		{"ftl_read", "read a page of FTL into RAM", cmd_ftl_read},
 		{"ftl_mapping", "print FTL mapping information", cmd_ftl_mapping},
 		{"ftl_sync", "commit the current FTL context", cmd_ftl_sync},
+		{"usbmsc", "export the FTL over USB as mass storage (read-only unless 'rw')", cmd_usbmsc},
 		{"bdev_read", "read bytes from a NAND block device", cmd_bdev_read},
 #ifndef NO_HFS
 		{"fs_ls", "list files and folders", fs_cmd_ls},
 		{"fs_cat", "display a file", fs_cmd_cat},
 		{"fs_extract", "extract a file into memory", fs_cmd_extract},
 		{"fs_add", "store a file from memory", fs_cmd_add},
+#ifndef NO_STBIMAGE
+		{"splash", "draw a PNG, or a raw screen image, from a file", cmd_splash},
+#endif
 #endif
 		{"nor_read", "read a block of NOR into RAM", cmd_nor_read},
 		{"nor_write", "write RAM into NOR", cmd_nor_write},
@@ -1193,6 +1241,7 @@ OPIBCommand CommandList[] =
 		{"go", "jump to a specified address (interrupts disabled)", cmd_go},
 		{"jump", "jump to a specified address (interrupts enabled)", cmd_jump},
 		{"version", "display the version string", cmd_version},
+		{"log", "flush deferred log records, optionally setting a subsystem's level", cmd_log},
 		{"time", "display the current time according to the RTC", cmd_time},
 		{"wdt", "display the current wdt stats", cmd_wdt},
 		{"audiohw_transfers_done", "display how many times the audio buffer has been played", cmd_audiohw_transfers_done},
@@ -35,10 +35,16 @@ static const uint32_t PeripheralLookupTable[][DMA_NUMCONTROLLERS] = {
 };
 
 static volatile DMARequest requests[DMA_NUMCONTROLLERS][DMA_NUMCHANNELS];
-static DMALinkedList* DMALists[DMA_NUMCONTROLLERS][DMA_NUMCHANNELS];
 
 static DMALinkedList StaticDMALists[DMA_NUMCONTROLLERS][DMA_NUMCHANNELS];
 
+static DMALinkedList DescriptorPool[DMA_DESCRIPTOR_POOL_SIZE];
+static DMALinkedList* FreeDescriptors = NULL;
+static int FreeDescriptorCount = 0;
+
+static DMATransfer TransferPool[DMA_TRANSFER_POOL_SIZE];
+static DMATransfer* FreeTransfers = NULL;
+
 static void dispatchRequest(volatile DMARequest *request, int controller, int channel);
 
 static void dmaIRQHandler(uint32_t controller);
@@ -47,6 +53,21 @@ static volatile int Controller0FreeChannels[DMA_NUMCHANNELS] = {0};
 static volatile int Controller1FreeChannels[DMA_NUMCHANNELS] = {0};
 
 int dma_setup() {
+	int i;
+
+	FreeDescriptors = NULL;
+	for(i = 0; i < DMA_DESCRIPTOR_POOL_SIZE; i++) {
+		DescriptorPool[i].next = FreeDescriptors;
+		FreeDescriptors = &DescriptorPool[i];
+	}
+	FreeDescriptorCount = DMA_DESCRIPTOR_POOL_SIZE;
+
+	FreeTransfers = NULL;
+	for(i = 0; i < DMA_TRANSFER_POOL_SIZE; i++) {
+		TransferPool[i].next = FreeTransfers;
+		FreeTransfers = &TransferPool[i];
+	}
+
 	clock_gate_switch(DMAC0_CLOCKGATE, ON);
 	clock_gate_switch(DMAC1_CLOCKGATE, ON);
 
@@ -168,136 +189,362 @@ int dma_request(int Source, int SourceTransferWidth, int SourceBurstSize, int De
 	config |= 1 << DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE;
 	config |= 1 << DMAC0Control0_SOURCEAHBMASTERSELECT;
 
+	requests[*controller - 1][*channel].control = config;
 	SET_REG(DMACControl, config);
 
 	return 0;
 }
 
-int dma_perform(uint32_t Source, uint32_t Destination, int size, int continueList, int* controller, int* channel) {
-	uint32_t regSrcAddress;
-	uint32_t regDestAddress;
-	uint32_t regLLI;
-	uint32_t regControl0;
-	uint32_t regConfiguration;
+static DMALinkedList* allocDescriptors(int count) {
+	DMALinkedList* list;
+	DMALinkedList* last;
+	int i;
 
-	const uint32_t regControl0Mask = ~(DMAC0Control0_SIZEMASK | DMAC0Control0_SOURCEINCREMENT | DMAC0Control0_DESTINATIONINCREMENT);
+	EnterCriticalSection();
+	if(count <= FreeDescriptorCount) {
+		list = last = FreeDescriptors;
+		for(i = 1; i < count; i++)
+			last = last->next;
+
+		FreeDescriptors = last->next;
+		FreeDescriptorCount -= count;
+		last->next = NULL;
+		LeaveCriticalSection();
+		return list;
+	}
+	LeaveCriticalSection();
 
-	uint32_t regOffset = (*channel * DMAChannelRegSize);
+	// Pool exhausted or chain too long for it, use the heap instead
+	list = malloc(count * sizeof(DMALinkedList));
+	if(!list)
+		return NULL;
 
-	if(*controller == 1) {
+	for(i = 0; i < (count - 1); i++)
+		list[i].next = &list[i + 1];
+	list[count - 1].next = NULL;
+
+	return list;
+}
+
+static void freeDescriptors(DMALinkedList* list) {
+	DMALinkedList* last;
+	int count;
+
+	if(list < DescriptorPool || list >= (DescriptorPool + DMA_DESCRIPTOR_POOL_SIZE)) {
+		free(list);
+		return;
+	}
+
+	count = 1;
+	last = list;
+	while(last->next != NULL) {
+		last = last->next;
+		count++;
+	}
+
+	EnterCriticalSection();
+	last->next = FreeDescriptors;
+	FreeDescriptors = list;
+	FreeDescriptorCount += count;
+	LeaveCriticalSection();
+}
+
+static DMATransfer* allocTransfer() {
+	DMATransfer* transfer;
+
+	EnterCriticalSection();
+	transfer = FreeTransfers;
+	if(transfer)
+		FreeTransfers = transfer->next;
+	LeaveCriticalSection();
+
+	return transfer;
+}
+
+static void freeTransfer(DMATransfer* transfer) {
+	if(transfer->list)
+		freeDescriptors(transfer->list);
+
+	EnterCriticalSection();
+	transfer->list = NULL;
+	transfer->next = FreeTransfers;
+	FreeTransfers = transfer;
+	LeaveCriticalSection();
+}
+
+static uint32_t getChannelRegisters(int controller, int channel) {
+	uint32_t regOffset = channel * DMAChannelRegSize;
+
+	if(controller == 1) {
 		regOffset += DMAC0;
-	} else if(*controller == 2) {
+	} else if(controller == 2) {
 		regOffset += DMAC1;
 	}
 
-	regSrcAddress = regOffset + DMAC0SrcAddress;
-	regDestAddress = regOffset + DMAC0DestAddress;
-	regLLI = regOffset + DMAC0LLI;
-	regControl0 = regOffset + DMAC0Control0;
-	regConfiguration = regOffset + DMAC0Configuration;
-
-	int transfers = size/(1 << DMAC0Control0_DWIDTH(GET_REG(regControl0)));
-
-	uint32_t sourcePeripheral = 0;
-	uint32_t destPeripheral = 0;
-	uint32_t flowControl = 0;
-	uint32_t sourceIncrement = 0;
-	uint32_t destinationIncrement = 0;
-
-	if(Source <= (sizeof(AddressLookupTable)/sizeof(uint32_t))) {
-		if(Destination <= (sizeof(AddressLookupTable)/sizeof(uint32_t))) {
-			SET_REG(regSrcAddress, AddressLookupTable[Source]);
-			SET_REG(regDestAddress, AddressLookupTable[Destination]);
-			sourcePeripheral = PeripheralLookupTable[Source][*controller - 1];
-			destPeripheral = PeripheralLookupTable[Destination][*controller - 1];
+	return regOffset;
+}
+
+static int isPeripheral(uint32_t address) {
+	return address <= (sizeof(AddressLookupTable)/sizeof(uint32_t));
+}
+
+static uint32_t getConfiguration(uint32_t Source, uint32_t Destination, int controller) {
+	uint32_t sourcePeripheral;
+	uint32_t destPeripheral;
+	uint32_t flowControl;
+
+	if(isPeripheral(Source)) {
+		sourcePeripheral = PeripheralLookupTable[Source][controller - 1];
+		if(isPeripheral(Destination)) {
+			destPeripheral = PeripheralLookupTable[Destination][controller - 1];
 			flowControl =  DMAC0Configuration_FLOWCNTRL_P2P;
 		} else {
-			SET_REG(regSrcAddress, AddressLookupTable[Source]);
-			SET_REG(regDestAddress, Destination);
-			sourcePeripheral = PeripheralLookupTable[Source][*controller - 1];
-			destPeripheral = PeripheralLookupTable[DMA_MEMORY][*controller - 1];
+			destPeripheral = PeripheralLookupTable[DMA_MEMORY][controller - 1];
 			flowControl =  DMAC0Configuration_FLOWCNTRL_P2M;
-			destinationIncrement = 1 << DMAC0Control0_DESTINATIONINCREMENT;
 		}
 	} else {
-		if(Destination <= (sizeof(AddressLookupTable)/sizeof(uint32_t))) {
-			SET_REG(regSrcAddress, Source);
-			SET_REG(regDestAddress, AddressLookupTable[Destination]);
-			sourcePeripheral = PeripheralLookupTable[DMA_MEMORY][*controller - 1];
-			destPeripheral = PeripheralLookupTable[Destination][*controller - 1];
+		sourcePeripheral = PeripheralLookupTable[DMA_MEMORY][controller - 1];
+		if(isPeripheral(Destination)) {
+			destPeripheral = PeripheralLookupTable[Destination][controller - 1];
 			flowControl =  DMAC0Configuration_FLOWCNTRL_M2P;
-			sourceIncrement = 1 << DMAC0Control0_SOURCEINCREMENT;
 		} else {
-			SET_REG(regSrcAddress, Source);
-			SET_REG(regDestAddress, Destination);
-			sourcePeripheral = PeripheralLookupTable[DMA_MEMORY][*controller - 1];
-			destPeripheral = PeripheralLookupTable[DMA_MEMORY][*controller - 1];
+			destPeripheral = PeripheralLookupTable[DMA_MEMORY][controller - 1];
 			flowControl =  DMAC0Configuration_FLOWCNTRL_M2M;
-			sourceIncrement = 1 << DMAC0Control0_SOURCEINCREMENT;
-			destinationIncrement = 1 << DMAC0Control0_DESTINATIONINCREMENT;
 		}
 	}
 
-	if(!continueList) {
-		uint32_t src = GET_REG(regSrcAddress);
-		uint32_t dest = GET_REG(regDestAddress);
-		if(transfers > 0xFFF) {
-			SET_REG(regControl0, GET_REG(regControl0) & ~(1 << DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE));
-
-			if(DMALists[*controller - 1][*channel])
-				free(DMALists[*controller - 1][*channel]);
-
-			DMALinkedList* item = DMALists[*controller - 1][*channel] = malloc(((transfers + 0xDFF) / 0xE00) * sizeof(DMALinkedList));
-			SET_REG(regLLI, (uint32_t)item);
-			do {
-				transfers -= 0xE00;
-				
-				if(sourceIncrement != 0) {
-					src += 0xE00 << DMAC0Control0_DWIDTH(GET_REG(regControl0));
-				}
-				if(destinationIncrement != 0) {
-					dest += 0xE00 << DMAC0Control0_DWIDTH(GET_REG(regControl0));
-				}
-
-				item->source = src;
-				item->destination = dest;
-
-				if(transfers <= 0xE00) {
-					item->control = destinationIncrement | sourceIncrement | (regControl0Mask & GET_REG(regControl0)) | (transfers & DMAC0Control0_SIZEMASK)
-						| (1 << DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE);
-					item->next = NULL;
-				} else {
-					item->control = destinationIncrement | sourceIncrement | (regControl0Mask & GET_REG(regControl0)) | 0xE00;
-					item->next = item + 1;
-					item = item->next;
-				}
-			} while(transfers > 0xE00);
-
-			CleanAndInvalidateCPUDataCache();
-			transfers = 0xE00;
-		} else {
-			SET_REG(regLLI, 0);
-		}
+	return DMAC0Configuration_CHANNELENABLED | DMAC0Configuration_TERMINALCOUNTINTERRUPTMASK
+			| (flowControl << DMAC0Configuration_FLOWCNTRLSHIFT)
+			| (destPeripheral << DMAC0Configuration_DESTPERIPHERALSHIFT)
+			| (sourcePeripheral << DMAC0Configuration_SRCPERIPHERALSHIFT);
+}
+
+// Must match how fillDescriptors splits a piece up
+static int countDescriptors(int size, uint32_t control) {
+	int transfers = size/(1 << DMAC0Control0_DWIDTH(control));
+	int count = 1;
+
+	if(transfers <= 0)
+		return 0;
+
+	while(transfers > DMAC0Control0_SIZEMASK) {
+		transfers -= DMA_LLI_MAXTRANSFERS;
+		count++;
+	}
+
+	return count;
+}
+
+// Fills in descriptors starting at item for one contiguous piece, returns the last one used
+static DMALinkedList* fillDescriptors(DMALinkedList* item, uint32_t control, uint32_t src, int sourceIncrement, uint32_t dest, int destinationIncrement, int size) {
+	const uint32_t regControl0Mask = ~(DMAC0Control0_SIZEMASK | DMAC0Control0_SOURCEINCREMENT | DMAC0Control0_DESTINATIONINCREMENT
+			| (1 << DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE));
+
+	int shift = DMAC0Control0_DWIDTH(control);
+	int transfers = size >> shift;
+	DMALinkedList* last = item;
+
+	while(transfers > 0) {
+		int toTransfer = transfers;
+		if(toTransfer > DMAC0Control0_SIZEMASK)
+			toTransfer = DMA_LLI_MAXTRANSFERS;
+
+		item->source = src;
+		item->destination = dest;
+		item->control = (sourceIncrement ? (1 << DMAC0Control0_SOURCEINCREMENT) : 0)
+			| (destinationIncrement ? (1 << DMAC0Control0_DESTINATIONINCREMENT) : 0)
+			| (regControl0Mask & control) | (toTransfer & DMAC0Control0_SIZEMASK);
+
+		if(sourceIncrement)
+			src += toTransfer << shift;
+
+		if(destinationIncrement)
+			dest += toTransfer << shift;
+
+		transfers -= toTransfer;
+		last = item;
+		item = item->next;
+	}
+
+	return last;
+}
+
+static void startTransfer(int controller, int channel, DMATransfer* transfer) {
+	uint32_t regOffset = getChannelRegisters(controller, channel);
+	DMALinkedList* first = transfer->list;
+
+	SET_REG(regOffset + DMAC0SrcAddress, first->source);
+	SET_REG(regOffset + DMAC0DestAddress, first->destination);
+	SET_REG(regOffset + DMAC0LLI, (uint32_t)first->next);
+	SET_REG(regOffset + DMAC0Control0, first->control);
+	SET_REG(regOffset + DMAC0Configuration, transfer->configuration);
+}
+
+// Starts the transfer right away if the channel is idle, otherwise chains it behind the ones already queued
+static void submitTransfer(int controller, int channel, DMATransfer* transfer, DMALinkedList* last) {
+	volatile DMARequest* request = &requests[controller - 1][channel];
+
+	last->control |= 1 << DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE;
+	last->next = NULL;
+
+	// The controller reads every descriptor but the first one from memory
+	if(transfer->list->next != NULL)
+		CleanAndInvalidateCPUDataCache();
+
+	transfer->next = NULL;
+
+	EnterCriticalSection();
+	request->done = FALSE;
+	if(request->current == NULL) {
+		request->current = transfer;
+		startTransfer(controller, channel, transfer);
+	} else if(request->queueTail == NULL) {
+		request->queueHead = request->queueTail = transfer;
 	} else {
-		StaticDMALists[*controller - 1][*channel].control = GET_REG(regControl0);
-		SET_REG(regLLI, (uint32_t)&StaticDMALists[*controller - 1][*channel]);
+		request->queueTail->next = transfer;
+		request->queueTail = transfer;
 	}
+	LeaveCriticalSection();
+}
 
-	SET_REG(regControl0, (GET_REG(regControl0) & regControl0Mask) | destinationIncrement | sourceIncrement | (transfers & DMAC0Control0_SIZEMASK));
-	SET_REG(regConfiguration, DMAC0Configuration_CHANNELENABLED | DMAC0Configuration_TERMINALCOUNTINTERRUPTMASK
-			| (flowControl << DMAC0Configuration_FLOWCNTRLSHIFT)
-			| (destPeripheral << DMAC0Configuration_DESTPERIPHERALSHIFT)
-			| (sourcePeripheral << DMAC0Configuration_SRCPERIPHERALSHIFT));
+int dma_perform(uint32_t Source, uint32_t Destination, int size, int continueList, int* controller, int* channel) {
+	uint32_t regOffset = getChannelRegisters(*controller, *channel);
+	uint32_t configuration = getConfiguration(Source, Destination, *controller);
+	uint32_t control = requests[*controller - 1][*channel].control;
+
+	uint32_t src = isPeripheral(Source) ? AddressLookupTable[Source] : Source;
+	uint32_t dest = isPeripheral(Destination) ? AddressLookupTable[Destination] : Destination;
+
+	if(continueList) {
+		const uint32_t regControl0Mask = ~(DMAC0Control0_SIZEMASK | DMAC0Control0_SOURCEINCREMENT | DMAC0Control0_DESTINATIONINCREMENT);
+		uint32_t sourceIncrement = isPeripheral(Source) ? 0 : (1 << DMAC0Control0_SOURCEINCREMENT);
+		uint32_t destinationIncrement = isPeripheral(Destination) ? 0 : (1 << DMAC0Control0_DESTINATIONINCREMENT);
+		int transfers = size/(1 << DMAC0Control0_DWIDTH(control));
+
+		SET_REG(regOffset + DMAC0SrcAddress, src);
+		SET_REG(regOffset + DMAC0DestAddress, dest);
+		StaticDMALists[*controller - 1][*channel].control = GET_REG(regOffset + DMAC0Control0);
+		SET_REG(regOffset + DMAC0LLI, (uint32_t)&StaticDMALists[*controller - 1][*channel]);
+		SET_REG(regOffset + DMAC0Control0, (control & regControl0Mask) | destinationIncrement | sourceIncrement | (transfers & DMAC0Control0_SIZEMASK));
+		SET_REG(regOffset + DMAC0Configuration, configuration);
+		return 0;
+	}
+
+	int count = countDescriptors(size, control);
+	if(count == 0)
+		return ERROR_DMA;
+
+	DMATransfer* transfer = allocTransfer();
+	if(!transfer)
+		return ERROR_BUSY;
+
+	transfer->list = allocDescriptors(count);
+	if(!transfer->list) {
+		freeTransfer(transfer);
+		return ERROR_BUSY;
+	}
+
+	transfer->configuration = configuration;
+	transfer->handler = NULL;
+
+	DMALinkedList* last = fillDescriptors(transfer->list, control, src, !isPeripheral(Source), dest, !isPeripheral(Destination), size);
+	submitTransfer(*controller, *channel, transfer, last);
+
+	return 0;
+}
+
+// Like a memory to memory dma_perform, except the source doesn't move: the word at Pattern is written across all of
+// Destination. Pattern has to be in memory, not just in the cache.
+int dma_fill(uint32_t Pattern, uint32_t Destination, int size, int* controller, int* channel) {
+	uint32_t control = requests[*controller - 1][*channel].control;
+
+	int count = countDescriptors(size, control);
+	if(count == 0)
+		return ERROR_DMA;
+
+	DMATransfer* transfer = allocTransfer();
+	if(!transfer)
+		return ERROR_BUSY;
+
+	transfer->list = allocDescriptors(count);
+	if(!transfer->list) {
+		freeTransfer(transfer);
+		return ERROR_BUSY;
+	}
+
+	transfer->configuration = getConfiguration(Pattern, Destination, *controller);
+	transfer->handler = NULL;
+
+	DMALinkedList* last = fillDescriptors(transfer->list, control, Pattern, FALSE, Destination, TRUE, size);
+	submitTransfer(*controller, *channel, transfer, last);
+
+	return 0;
+}
+
+// Moves a list of memory segments as one chained transfer. The side given as DMA_MEMORY walks the segments, the other
+// side stays put: a peripheral's FIFO, or a word in memory to fill the segments with. handler, if set, is called in
+// place of the channel's handler once this transfer is done.
+int dma_perform_sg(uint32_t Source, uint32_t Destination, const DMASegment* segments, int count, int* controller, int* channel, DMAHandler handler) {
+	uint32_t control = requests[*controller - 1][*channel].control;
+	int numDescriptors = 0;
+	int i;
+
+	// Exactly one side of a scatter-gather transfer is described by the segment list
+	if((Source == DMA_MEMORY) == (Destination == DMA_MEMORY))
+		return ERROR_DMA;
+
+	for(i = 0; i < count; i++)
+		numDescriptors += countDescriptors(segments[i].length, control);
+
+	if(numDescriptors == 0)
+		return ERROR_DMA;
+
+	DMATransfer* transfer = allocTransfer();
+	if(!transfer)
+		return ERROR_BUSY;
+
+	transfer->list = allocDescriptors(numDescriptors);
+	if(!transfer->list) {
+		freeTransfer(transfer);
+		return ERROR_BUSY;
+	}
+
+	// DMA_MEMORY is in the peripheral tables, so configure against a real address for the segment side
+	transfer->configuration = getConfiguration((Source == DMA_MEMORY) ? segments[0].address : Source,
+			(Destination == DMA_MEMORY) ? segments[0].address : Destination, *controller);
+	transfer->handler = handler;
+
+	DMALinkedList* item = transfer->list;
+	DMALinkedList* last = item;
+	for(i = 0; i < count; i++) {
+		if(countDescriptors(segments[i].length, control) == 0)
+			continue;
+
+		uint32_t src = (Source == DMA_MEMORY) ? segments[i].address : (isPeripheral(Source) ? AddressLookupTable[Source] : Source);
+		uint32_t dest = (Destination == DMA_MEMORY) ? segments[i].address : (isPeripheral(Destination) ? AddressLookupTable[Destination] : Destination);
+
+		last = fillDescriptors(item, control, src, Source == DMA_MEMORY, dest, Destination == DMA_MEMORY, segments[i].length);
+		item = last->next;
+	}
+
+	submitTransfer(*controller, *channel, transfer, last);
 
 	return 0;
 }
 
+int dma_busy(int controller, int channel) {
+	return !requests[controller - 1][channel].done;
+}
+
 int dma_finish(int controller, int channel, int timeout) {
 	uint64_t startTime = timer_get_system_microtime();
 	while(!requests[controller - 1][channel].done) {
 		if(has_elapsed(startTime, timeout * 1000)) {
 			return -1;
 		}
+
+		// Let other tasks run until the completion interrupt, or just keep polling if we can't block
+		task_wait((TaskQueue*) &requests[controller - 1][channel].waiters, timeout * 1000);
 	}
 
 	EnterCriticalSection();
@@ -312,6 +559,40 @@ int dma_finish(int controller, int channel, int timeout) {
 	return 0;
 }
 
+// Hands back a channel from dma_request without waiting for it to finish, e.g. when a transfer on it couldn't be set
+// up. Whatever is still running or queued on the channel is stopped and dropped.
+void dma_cancel(int controller, int channel) {
+	volatile DMARequest* request = &requests[controller - 1][channel];
+	uint32_t regOffset = getChannelRegisters(controller, channel);
+	DMATransfer* transfers;
+
+	EnterCriticalSection();
+	SET_REG(regOffset + DMAC0Configuration, GET_REG(regOffset + DMAC0Configuration) & ~DMAC0Configuration_CHANNELENABLED);
+
+	transfers = request->current;
+	if(transfers)
+		transfers->next = request->queueHead;
+	else
+		transfers = request->queueHead;
+
+	request->current = NULL;
+	request->queueHead = NULL;
+	request->queueTail = NULL;
+	request->started = FALSE;
+	request->done = FALSE;
+	if(controller == 1)
+		Controller0FreeChannels[channel] = 0;
+	else if(controller == 2)
+		Controller1FreeChannels[channel] = 0;
+	LeaveCriticalSection();
+
+	while(transfers) {
+		DMATransfer* next = transfers->next;
+		freeTransfer(transfers);
+		transfers = next;
+	}
+}
+
 int dma_shutdown()
 {
 	SET_REG(DMAC0 + DMACConfiguration, ~DMACConfiguration_ENABLE);
@@ -369,9 +650,32 @@ void dma_resume(int controller, int channel) {
 
 
 static void dispatchRequest(volatile DMARequest *request, int controller, int channel) {
-	// TODO: Implement this
-	request->done = TRUE;
-	if(request->handler)
-		request->handler(1, controller, channel);
+	DMATransfer* transfer = request->current;
+	DMAHandler handler = request->handler;
+
+	if(transfer) {
+		if(transfer->handler)
+			handler = transfer->handler;
+
+		// Kick off the next chained transfer before doing anything else so the channel doesn't sit idle
+		request->current = request->queueHead;
+		if(request->queueHead) {
+			request->queueHead = request->queueHead->next;
+			if(request->queueHead == NULL)
+				request->queueTail = NULL;
+
+			startTransfer(controller, channel, request->current);
+		}
+
+		freeTransfer(transfer);
+	}
+
+	if(request->current == NULL) {
+		request->done = TRUE;
+		task_wake((TaskQueue*) &request->waiters);
+	}
+
+	if(handler)
+		handler(1, controller, channel);
 }
 
@@ -0,0 +1,361 @@
+/*
+ * dmaemu: runs openiboot's DMA driver (dma.c) against a PL080 modelled in software and checks the descriptor chains
+ * it builds for scatter-gather transfers: one or more descriptors per segment, split where a segment is longer than
+ * a descriptor can count, and handed to the right completion handler once done.
+ *
+ * usage: dmaemu
+ *
+ * The controller's registers are plain memory. Where a transfer moves memory, the host side runs the descriptors the
+ * way the controller would before raising the completion interrupt itself.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+// The firmware's headers can't be mixed with the host's, so what's used from them is restated here.
+
+#define TRUE 1
+#define FALSE 0
+
+#define DMAC0 0x38200000
+#define DMAC1 0x39900000
+#define DMAC_REGISTERS_SIZE 0x1000
+
+#define DMAC0Control0_DWIDTH(x) (((x) >> 21) & 0x7)
+#define DMAC0Control0_SOURCEINCREMENT (1 << 26)
+#define DMAC0Control0_DESTINATIONINCREMENT (1 << 27)
+#define DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE (1U << 31)
+#define DMAC0Control0_SIZEMASK 0xFFF
+#define DMAC0Configuration_FLOWCNTRL(x) (((x) >> 11) & 0x7)
+#define DMAC0Configuration_FLOWCNTRL_M2M 0x0
+#define DMAC0Configuration_FLOWCNTRL_P2M 0x2
+
+#define DMA_LLI_MAXTRANSFERS 0xE00
+#define DMA_DESCRIPTOR_POOL_SIZE 256
+
+#define ERROR_DMA 0x13
+
+#define DMA_MEMORY 25
+#define DMA_NAND 8
+#define NAND_FIFO 0x38A00080
+
+typedef void (*DMAHandler)(int status, int controller, int channel);
+
+typedef struct DMASegment {
+	uint32_t address;
+	uint32_t length;
+} DMASegment;
+
+int dma_setup();
+int dma_request(int Source, int SourceTransferWidth, int SourceBurstSize, int Destination, int DestinationTransferWidth, int DestinationBurstSize, int* controller, int* channel, DMAHandler handler);
+int dma_perform_sg(uint32_t Source, uint32_t Destination, const DMASegment* segments, int count, int* controller, int* channel, DMAHandler handler);
+int dma_busy(int controller, int channel);
+int dma_finish(int controller, int channel, int timeout);
+void dma_cancel(int controller, int channel);
+
+int emu_descriptors(int controller, int channel, uint32_t* out, int max);
+uint32_t emu_configuration(int controller, int channel);
+void emu_interrupt(int controller, int channel);
+int emu_free_descriptors();
+
+#define MEMORY_SIZE 0x100000
+#define MAX_DESCRIPTORS 32
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static int Failures = 0;
+
+static uint8_t* Memory;
+
+// completion handlers called so far, and with what
+static int TransferDoneCalls;
+static int ChannelDoneCalls;
+static int DoneController;
+static int DoneChannel;
+
+static void check(int ok, const char* what, int line) {
+	if(ok)
+		return;
+
+	fprintf(stderr, "dmaemu.c:%d: check failed: %s\n", line, what);
+	++Failures;
+}
+
+static uint32_t address(uint32_t offset) {
+	return (uint32_t)(uintptr_t)(Memory + offset);
+}
+
+static void transferDone(int status, int controller, int channel) {
+	TransferDoneCalls++;
+	DoneController = controller;
+	DoneChannel = channel;
+}
+
+static void channelDone(int status, int controller, int channel) {
+	ChannelDoneCalls++;
+}
+
+static void resetCalls() {
+	TransferDoneCalls = 0;
+	ChannelDoneCalls = 0;
+	DoneController = 0;
+	DoneChannel = -1;
+}
+
+// What the controller does with a memory to memory chain: each descriptor moves its count of units, stepping
+// whichever side it says to.
+static void run(const uint32_t* descriptors, int count) {
+	int i;
+	for(i = 0; i < count; i++) {
+		uint32_t control = descriptors[(i * 3) + 2];
+		uint8_t* src = (uint8_t*)(uintptr_t) descriptors[(i * 3) + 0];
+		uint8_t* dest = (uint8_t*)(uintptr_t) descriptors[(i * 3) + 1];
+		int width = 1 << DMAC0Control0_DWIDTH(control);
+		int units = control & DMAC0Control0_SIZEMASK;
+
+		while(units-- > 0) {
+			memcpy(dest, src, width);
+			if(control & DMAC0Control0_SOURCEINCREMENT)
+				src += width;
+			if(control & DMAC0Control0_DESTINATIONINCREMENT)
+				dest += width;
+		}
+	}
+}
+
+// Checks a descriptor's addresses and count, and that only the last one of a transfer interrupts
+static void expectDescriptor(const uint32_t* descriptor, uint32_t src, uint32_t dest, uint32_t units, int last, int line) {
+	check(descriptor[0] == src, "descriptor source", line);
+	check(descriptor[1] == dest, "descriptor destination", line);
+	check((descriptor[2] & DMAC0Control0_SIZEMASK) == units, "descriptor count", line);
+	check(((descriptor[2] & DMAC0Control0_TERMINALCOUNTINTERRUPTENABLE) != 0) == last, "descriptor interrupt", line);
+}
+
+// NAND into a page buffer and a spare buffer with nothing between them, then into a buffer longer than a descriptor
+// can count. Words, so 0x2345 of them go as 0xE00, 0xE00 and 0x745.
+static void testScatter() {
+	uint32_t descriptors[MAX_DESCRIPTORS * 3];
+	int controller = 0;
+	int channel = 0;
+	int i;
+
+	DMASegment segments[] = {
+		{address(0x1000), 0x800},
+		{address(0x2000), 0},
+		{address(0x3000), 0x40},
+		{address(0x10000), 0x2345 * 4}
+	};
+
+	resetCalls();
+	CHECK(dma_request(DMA_NAND, 4, 4, DMA_MEMORY, 4, 4, &controller, &channel, channelDone) == 0);
+	CHECK(dma_perform_sg(DMA_NAND, DMA_MEMORY, segments, 4, &controller, &channel, transferDone) == 0);
+	CHECK(DMAC0Configuration_FLOWCNTRL(emu_configuration(controller, channel)) == DMAC0Configuration_FLOWCNTRL_P2M);
+
+	int count = emu_descriptors(controller, channel, descriptors, MAX_DESCRIPTORS);
+	CHECK(count == 5);
+	if(count == 5) {
+		expectDescriptor(&descriptors[0], NAND_FIFO, address(0x1000), 0x200, FALSE, __LINE__);
+		expectDescriptor(&descriptors[3], NAND_FIFO, address(0x3000), 0x10, FALSE, __LINE__);
+		expectDescriptor(&descriptors[6], NAND_FIFO, address(0x10000), DMA_LLI_MAXTRANSFERS, FALSE, __LINE__);
+		expectDescriptor(&descriptors[9], NAND_FIFO, address(0x10000 + (DMA_LLI_MAXTRANSFERS * 4)), DMA_LLI_MAXTRANSFERS,
+				FALSE, __LINE__);
+		expectDescriptor(&descriptors[12], NAND_FIFO, address(0x10000 + (DMA_LLI_MAXTRANSFERS * 8)),
+				0x2345 - (2 * DMA_LLI_MAXTRANSFERS), TRUE, __LINE__);
+
+		for(i = 0; i < count; i++) {
+			CHECK(!(descriptors[(i * 3) + 2] & DMAC0Control0_SOURCEINCREMENT));
+			CHECK(descriptors[(i * 3) + 2] & DMAC0Control0_DESTINATIONINCREMENT);
+			CHECK(DMAC0Control0_DWIDTH(descriptors[(i * 3) + 2]) == 2);
+		}
+	}
+
+	// the FIFO isn't there to read from, so just finish
+	CHECK(dma_busy(controller, channel));
+	emu_interrupt(controller, channel);
+
+	// the transfer's own handler stands in for the channel's
+	CHECK(TransferDoneCalls == 1);
+	CHECK(ChannelDoneCalls == 0);
+	CHECK(DoneController == controller);
+	CHECK(DoneChannel == channel);
+	CHECK(!dma_busy(controller, channel));
+	CHECK(dma_finish(controller, channel, 0) == 0);
+	CHECK(emu_free_descriptors() == DMA_DESCRIPTOR_POOL_SIZE);
+}
+
+// A box filled the way lcd.c does it: a run per line, each longer than a descriptor can count, with the rest of each
+// line left alone
+static void testFill() {
+	uint32_t descriptors[MAX_DESCRIPTORS * 3];
+	const uint32_t lineBytes = 0x1400 * 4;
+	const uint32_t runBytes = 0x1234 * 4;
+	const uint32_t first = 0x20000 + 0x40;
+	const uint32_t pattern = 0x8000;
+	const int lines = 3;
+	int controller = 0;
+	int channel = 0;
+	DMASegment segments[3];
+	int i;
+
+	memset(Memory, 0xAA, MEMORY_SIZE);
+	*(uint32_t*)(Memory + pattern) = 0x12345678;
+
+	for(i = 0; i < lines; i++) {
+		segments[i].address = address(first + (i * lineBytes));
+		segments[i].length = runBytes;
+	}
+
+	resetCalls();
+	CHECK(dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, NULL) == 0);
+	CHECK(dma_perform_sg(address(pattern), DMA_MEMORY, segments, lines, &controller, &channel, transferDone) == 0);
+	CHECK(DMAC0Configuration_FLOWCNTRL(emu_configuration(controller, channel)) == DMAC0Configuration_FLOWCNTRL_M2M);
+
+	int count = emu_descriptors(controller, channel, descriptors, MAX_DESCRIPTORS);
+	CHECK(count == lines * 2);
+	if(count == lines * 2) {
+		for(i = 0; i < lines; i++) {
+			uint32_t line = address(first + (i * lineBytes));
+			expectDescriptor(&descriptors[i * 6], address(pattern), line, DMA_LLI_MAXTRANSFERS, FALSE, __LINE__);
+			expectDescriptor(&descriptors[(i * 6) + 3], address(pattern), line + (DMA_LLI_MAXTRANSFERS * 4),
+					0x1234 - DMA_LLI_MAXTRANSFERS, i == (lines - 1), __LINE__);
+		}
+
+		for(i = 0; i < count; i++) {
+			CHECK(!(descriptors[(i * 3) + 2] & DMAC0Control0_SOURCEINCREMENT));
+			CHECK(descriptors[(i * 3) + 2] & DMAC0Control0_DESTINATIONINCREMENT);
+		}
+
+		run(descriptors, count);
+	}
+
+	emu_interrupt(controller, channel);
+	CHECK(TransferDoneCalls == 1);
+	CHECK(dma_finish(controller, channel, 0) == 0);
+
+	int filled = TRUE;
+	int untouched = TRUE;
+	uint32_t offset;
+	for(offset = 0x20000; offset < 0x20000 + (lines * lineBytes); offset += 4) {
+		uint32_t inLine = (offset - 0x20000) % lineBytes;
+		uint32_t word = *(uint32_t*)(Memory + offset);
+		if(inLine >= 0x40 && inLine < (0x40 + runBytes))
+			filled = filled && (word == 0x12345678);
+		else
+			untouched = untouched && (word == 0xAAAAAAAA);
+	}
+
+	CHECK(filled);
+	CHECK(untouched);
+	CHECK(emu_free_descriptors() == DMA_DESCRIPTOR_POOL_SIZE);
+}
+
+// Two transfers queued on one channel: the second starts when the first is done, and each goes to its own handler,
+// or the channel's if it hasn't got one
+static void testQueued() {
+	uint32_t descriptors[MAX_DESCRIPTORS * 3];
+	const uint32_t pattern = 0x8000;
+	int controller = 0;
+	int channel = 0;
+
+	DMASegment firstSegments[] = {{address(0x30000), 0x100}, {address(0x31000), 0x100}};
+	DMASegment secondSegments[] = {{address(0x40000), 0x100}};
+
+	memset(Memory, 0, MEMORY_SIZE);
+	*(uint32_t*)(Memory + pattern) = 0xCAFEF00D;
+
+	resetCalls();
+	CHECK(dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, channelDone) == 0);
+	CHECK(dma_perform_sg(address(pattern), DMA_MEMORY, firstSegments, 2, &controller, &channel, transferDone) == 0);
+	CHECK(dma_perform_sg(address(pattern), DMA_MEMORY, secondSegments, 1, &controller, &channel, NULL) == 0);
+
+	int count = emu_descriptors(controller, channel, descriptors, MAX_DESCRIPTORS);
+	CHECK(count == 2);
+	if(count == 2) {
+		expectDescriptor(&descriptors[0], address(pattern), address(0x30000), 0x40, FALSE, __LINE__);
+		expectDescriptor(&descriptors[3], address(pattern), address(0x31000), 0x40, TRUE, __LINE__);
+		run(descriptors, count);
+	}
+
+	emu_interrupt(controller, channel);
+	CHECK(TransferDoneCalls == 1);
+	CHECK(ChannelDoneCalls == 0);
+	CHECK(dma_busy(controller, channel));
+
+	count = emu_descriptors(controller, channel, descriptors, MAX_DESCRIPTORS);
+	CHECK(count == 1);
+	if(count == 1) {
+		expectDescriptor(&descriptors[0], address(pattern), address(0x40000), 0x40, TRUE, __LINE__);
+		run(descriptors, count);
+	}
+
+	emu_interrupt(controller, channel);
+	CHECK(TransferDoneCalls == 1);
+	CHECK(ChannelDoneCalls == 1);
+	CHECK(!dma_busy(controller, channel));
+	CHECK(dma_finish(controller, channel, 0) == 0);
+
+	CHECK(*(uint32_t*)(Memory + 0x310FC) == 0xCAFEF00D);
+	CHECK(*(uint32_t*)(Memory + 0x31100) == 0);
+	CHECK(*(uint32_t*)(Memory + 0x400FC) == 0xCAFEF00D);
+	CHECK(emu_free_descriptors() == DMA_DESCRIPTOR_POOL_SIZE);
+}
+
+// Lists that don't say what to do are turned away before anything is queued
+static void testRejected() {
+	int controller = 0;
+	int channel = 0;
+
+	DMASegment segments[] = {{address(0x1000), 0x100}};
+	DMASegment empty[] = {{address(0x1000), 0}, {address(0x2000), 2}};
+
+	CHECK(dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, NULL) == 0);
+
+	// neither side, or both, walking the segments
+	CHECK(dma_perform_sg(DMA_MEMORY, DMA_MEMORY, segments, 1, &controller, &channel, NULL) == ERROR_DMA);
+	CHECK(dma_perform_sg(address(0x8000), DMA_NAND, segments, 1, &controller, &channel, NULL) == ERROR_DMA);
+
+	// nothing a whole word long
+	CHECK(dma_perform_sg(address(0x8000), DMA_MEMORY, empty, 2, &controller, &channel, NULL) == ERROR_DMA);
+	CHECK(dma_perform_sg(address(0x8000), DMA_MEMORY, segments, 0, &controller, &channel, NULL) == ERROR_DMA);
+
+	CHECK(dma_busy(controller, channel));
+	dma_cancel(controller, channel);
+	CHECK(emu_free_descriptors() == DMA_DESCRIPTOR_POOL_SIZE);
+}
+
+int main(int argc, char* argv[]) {
+	// dma.c programs the controllers, so give it registers to write to
+	if(mmap((void*) DMAC0, DMAC_REGISTERS_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0)
+			!= (void*) DMAC0
+			|| mmap((void*) DMAC1, DMAC_REGISTERS_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0)
+			!= (void*) DMAC1) {
+		perror("dmaemu: DMA registers");
+		return 1;
+	}
+
+	// Transfers are described with 32-bit addresses
+	Memory = mmap(NULL, MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if(Memory == MAP_FAILED) {
+		perror("dmaemu: memory");
+		return 1;
+	}
+
+	dma_setup();
+
+	testScatter();
+	testFill();
+	testQueued();
+	testRejected();
+
+	if(Failures > 0) {
+		fprintf(stderr, "dmaemu: %d checks failed\n", Failures);
+		return 1;
+	}
+
+	printf("dmaemu: ok\n");
+	return 0;
+}
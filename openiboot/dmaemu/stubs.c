@@ -0,0 +1,24 @@
+/*
+ * Everything dma.c reaches for outside itself. dmaemu runs on one thread and raises the completion interrupt by
+ * hand, so none of it has anything to do.
+ */
+
+#include "openiboot.h"
+#include "timer.h"
+#include "tasks.h"
+#include "clock.h"
+#include "interrupt.h"
+#include "openiboot-asmhelpers.h"
+
+void EnterCriticalSection() {}
+void LeaveCriticalSection() {}
+void CleanAndInvalidateCPUDataCache() {}
+
+uint64_t timer_get_system_microtime() { return 0; }
+int has_elapsed(uint64_t startTime, uint64_t elapsedTime) { return TRUE; }
+int task_wait(TaskQueue* queue, uint64_t timeout) { return 0; }
+void task_wake(TaskQueue* queue) {}
+
+void clock_gate_switch(uint32_t gate, OnOff on_off) {}
+int interrupt_install(int irq_no, InterruptServiceRoutine handler, uint32_t token) { return 0; }
+int interrupt_enable(int irq_no) { return 0; }
@@ -0,0 +1,53 @@
+/*
+ * The firmware side of dmaemu: dma.c itself, plus what the host side needs to look at a channel the way the
+ * controller would and to raise its completion interrupt. Built against openiboot's own headers, never the host's.
+ */
+
+#include "../dma.c"
+
+// Copies out the descriptors the channel would run next, as source, destination and control words, the first one
+// from the channel's registers and the rest by following the chain. Returns how many there are, or -1 if the link
+// register doesn't point at the rest of the chain.
+int emu_descriptors(int controller, int channel, uint32_t* out, int max) {
+	uint32_t regOffset = getChannelRegisters(controller, channel);
+	DMATransfer* transfer = requests[controller - 1][channel].current;
+	DMALinkedList* item;
+	int count;
+
+	if(!transfer || max < 1)
+		return 0;
+
+	out[0] = GET_REG(regOffset + DMAC0SrcAddress);
+	out[1] = GET_REG(regOffset + DMAC0DestAddress);
+	out[2] = GET_REG(regOffset + DMAC0Control0);
+
+	if(GET_REG(regOffset + DMAC0LLI) != (uint32_t) transfer->list->next)
+		return -1;
+
+	count = 1;
+	for(item = transfer->list->next; item != NULL && count < max; item = item->next) {
+		out[(count * 3) + 0] = item->source;
+		out[(count * 3) + 1] = item->destination;
+		out[(count * 3) + 2] = item->control;
+		count++;
+	}
+
+	return count;
+}
+
+uint32_t emu_configuration(int controller, int channel) {
+	return GET_REG(getChannelRegisters(controller, channel) + DMAC0Configuration);
+}
+
+// The terminal count interrupt for a channel, as the controller raises it at the end of a transfer
+void emu_interrupt(int controller, int channel) {
+	uint32_t base = (controller == 1) ? DMAC0 : DMAC1;
+
+	SET_REG(base + DMACIntTCStatus, 1 << channel);
+	dmaIRQHandler(controller);
+	SET_REG(base + DMACIntTCStatus, 0);
+}
+
+int emu_free_descriptors() {
+	return FreeDescriptorCount;
+}
@@ -5,102 +5,162 @@
 #include "hardware/timer.h"
 #include "openiboot-asmhelpers.h"
 
-Event EventList;
+// Pending events are kept in a binary min-heap ordered by deadline. Instead of a fixed tick,
+// the event timer is programmed as a one-shot for whatever is at the top of the heap.
+static Event* EventHeap[EVENT_MAX];
+static int EventCount = 0;
+
+int EventHasInit = FALSE;
 
-static void init_event_list();
 static void eventTimerHandler();
+static void programEventTimer();
 
 int event_setup() {
 	// In our implementation, we set TicksPerSec when we setup the clock
 	// so we don't have to do it here
 
-	init_event_list();
+	EventCount = 0;
 
 	Timers[EventTimer].handler2 = eventTimerHandler;
 
-	// Initialize the timer hardware for something that goes off once every 100 Hz.
-	// The handler for the timer will reset it so it's periodic
-	timer_init(EventTimer, TicksPerSec/100, 0, 0, 0, FALSE, FALSE, FALSE, TRUE);
+	// The timer only gets turned on once there is an event to wait for
+	timer_on_off(EventTimer, OFF);
 
-	// Turn the timer on
-	timer_on_off(EventTimer, ON);
+	EventHasInit = TRUE;
 
 	return 0;
 }
 
-static void init_event_list() {
-	EventList.list.next = &EventList;
-	EventList.list.prev = &EventList;
+static void heapSwap(int a, int b) {
+	Event* tmp = EventHeap[a];
+	EventHeap[a] = EventHeap[b];
+	EventHeap[b] = tmp;
+
+	EventHeap[a]->heapIndex = a + 1;
+	EventHeap[b]->heapIndex = b + 1;
 }
 
-static void eventTimerHandler() {
-	uint64_t curTime;
-	Event* event;
+static void heapSiftUp(int i) {
+	while(i > 0) {
+		int parent = (i - 1) / 2;
+		if(EventHeap[parent]->deadline <= EventHeap[i]->deadline)
+			break;
 
-	curTime = timer_get_system_microtime();
+		heapSwap(i, parent);
+		i = parent;
+	}
+}
 
-	while(EventList.list.next != &EventList) {	// Just keep checking the first event on the list until the list is empty
-							// This works because we remove events as we dispatch them
+static void heapSiftDown(int i) {
+	while(TRUE) {
+		int left = (2 * i) + 1;
+		int right = left + 1;
+		int smallest = i;
 
-		event = EventList.list.next;
+		if(left < EventCount && EventHeap[left]->deadline < EventHeap[smallest]->deadline)
+			smallest = left;
 
-		if(event == NULL) {
-			break;
-		}
+		if(right < EventCount && EventHeap[right]->deadline < EventHeap[smallest]->deadline)
+			smallest = right;
 
-		if(curTime >= event->deadline) {
-			// take it off the list and dispatch it
-			((Event*)(event->list.next))->list.prev = event->list.prev;
-			((Event*)(event->list.prev))->list.next = event->list.next;
-			event->list.next = NULL;
-			event->list.prev = NULL;
-			event->handler(event, event->opaque);
-		} else {
-			// The event queue is sorted, so we can just stop looping on the first
-			// event that hasn't been triggered
+		if(smallest == i)
 			break;
-		}
+
+		heapSwap(i, smallest);
+		i = smallest;
 	}
 }
 
+static int heapInsert(Event* event) {
+	if(EventCount >= EVENT_MAX)
+		return -1;
+
+	EventHeap[EventCount] = event;
+	event->heapIndex = ++EventCount;
+	heapSiftUp(EventCount - 1);
+
+	return 0;
+}
+
+static void heapRemove(Event* event) {
+	int i = event->heapIndex - 1;
+
+	event->heapIndex = 0;
+	EventCount--;
+
+	if(i == EventCount)
+		return;
+
+	// Fill the hole with the last element and move it to wherever it belongs
+	EventHeap[i] = EventHeap[EventCount];
+	EventHeap[i]->heapIndex = i + 1;
+
+	if(i > 0 && EventHeap[(i - 1) / 2]->deadline > EventHeap[i]->deadline)
+		heapSiftUp(i);
+	else
+		heapSiftDown(i);
+}
+
+static void programEventTimer() {
+	if(EventCount == 0) {
+		timer_on_off(EventTimer, OFF);
+		return;
+	}
+
+	uint64_t curTime = timer_get_system_microtime();
+	uint64_t deadline = EventHeap[0]->deadline;
+	uint64_t delay = (deadline > curTime) ? (deadline - curTime) : 0;
+
+	if(delay < EVENT_MIN_DELAY)
+		delay = EVENT_MIN_DELAY;
+
+	// Far away deadlines are reached in steps so the count always fits the timer
+	if(delay > EVENT_MAX_DELAY)
+		delay = EVENT_MAX_DELAY;
+
+	timer_init(EventTimer, (delay * TicksPerSec) / uSecPerSec, 0, 0, 0, FALSE, FALSE, FALSE, TRUE);
+	timer_on_off(EventTimer, ON);
+}
+
+static void eventTimerHandler() {
+	uint64_t curTime;
+	Event* event;
+
+	curTime = timer_get_system_microtime();
+
+	// Keep taking the earliest event off the heap until we hit one that isn't due yet.
+	// Handlers are free to add themselves back.
+	while(EventCount > 0 && EventHeap[0]->deadline <= curTime) {
+		event = EventHeap[0];
+		heapRemove(event);
+		event->handler(event, event->opaque);
+	}
+
+	programEventTimer();
+}
+
 int event_add(Event* newEvent, uint64_t timeout, EventHandler handler, void* opaque) {
 	EnterCriticalSection();
 
-	// If this item is already on a list, take it off
-	if(newEvent->list.prev != NULL || newEvent->list.next != NULL) {
-		if(newEvent->list.next != NULL) {
-			((Event*)(newEvent->list.next))->list.prev = newEvent->list.prev;
-		}
-		if(newEvent->list.prev != NULL) {
-			((Event*)(newEvent->list.prev))->list.next = newEvent->list.next;
-		}
-		newEvent->list.next = NULL;
-		newEvent->list.prev = NULL;
+	// If this item is already scheduled, take it off
+	if(newEvent->heapIndex != 0) {
+		heapRemove(newEvent);
 	}
 
 	newEvent->handler = handler;
+	newEvent->opaque = opaque;
 	newEvent->interval = timeout;
 	newEvent->deadline = timer_get_system_microtime() + timeout;
 
-	Event* insertAt = &EventList;
-
-	while(insertAt != insertAt->list.next) {
-		// Find the event that this occurs after
-		if(insertAt->deadline > newEvent->deadline) {
-			break;
-		}
-		insertAt = insertAt->list.next;
-		if(insertAt == &EventList) {
-			// We're after the whole list, so just insert after everyone else (after head)
-			break;
-		}
+	if(heapInsert(newEvent) != 0) {
+		LeaveCriticalSection();
+		return -1;
 	}
 
-	// Insert before insertAt
-	newEvent->list.next = insertAt;
-	newEvent->list.prev = insertAt->list.prev;
-	((Event*)insertAt->list.prev)->list.next = newEvent;
-	insertAt->list.prev = newEvent;
+	// Only a new earliest deadline needs the timer moved
+	if(newEvent->heapIndex == 1) {
+		programEventTimer();
+	}
 
 	LeaveCriticalSection();
 
@@ -110,16 +170,9 @@ int event_add(Event* newEvent, uint64_t timeout, EventHandler handler, void* opa
 int event_readd(Event* event, uint64_t new_interval) {
 	EnterCriticalSection();
 
-	// If this item is already on a list, take it off
-	if(event->list.prev != NULL || event->list.next != NULL) {
-		if(event->list.next != NULL) {
-			((Event*)(event->list.next))->list.prev = event->list.prev;
-		}
-		if(event->list.prev != NULL) {
-			((Event*)(event->list.prev))->list.next = event->list.next;
-		}
-		event->list.next = NULL;
-		event->list.prev = NULL;
+	// If this item is already scheduled, take it off
+	if(event->heapIndex != 0) {
+		heapRemove(event);
 	}
 
 	uint64_t interval;
@@ -134,9 +187,19 @@ int event_readd(Event* event, uint64_t new_interval) {
 		interval = new_interval;
 	}
 
-	event_add(event, interval, event->handler, event->opaque);
+	int ret = event_add(event, interval, event->handler, event->opaque);
 	LeaveCriticalSection();
 
-	return 0;
+	return ret;
 }
 
+void event_remove(Event* event) {
+	EnterCriticalSection();
+
+	// An early wakeup is harmless, so the timer is left alone
+	if(event->heapIndex != 0) {
+		heapRemove(event);
+	}
+
+	LeaveCriticalSection();
+}
@@ -0,0 +1,640 @@
+/*
+ * fbemu: runs openiboot's display path (framebuffer.c, and lcd.c's windows and line primitives) on the host, against
+ * memory standing in for the LCD window, and times it.
+ *
+ * usage: fbemu [-565|-888] [-s WIDTHxHEIGHT]... [-n iterations] [-d directory] [-c] [-g|-G golden]
+ *
+ *   -565, -888  window format to run; both by default
+ *   -s          panel size to run, which also decides the console font; repeat it to run several (default and
+ *               smallest 320x480)
+ *   -n          iterations of each benchmark (default 100)
+ *   -d          write what the panel would show after each benchmark to <directory>/<benchmark>-<size>-<format>.ppm
+ *   -c          instead of timing anything, check the blend and pixel format conversions bit for bit against the
+ *               per-pixel code they replaced
+ *   -g          compare what the panel would show after each benchmark with the hashes in the golden file
+ *   -G          write those hashes to the golden file instead, after a change that's meant to alter the output
+ *
+ * With -g or -G every benchmark runs GOLDEN_ITERATIONS times, whatever -n says, so it always ends on the same frame.
+ *
+ * Times are for the host CPU, so compare them with each other rather than with the phone.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/mman.h>
+
+// The firmware's headers can't be mixed with the host's, so what's used from them is restated here.
+
+#define TRUE 1
+#define FALSE 0
+
+typedef enum ColorSpace {
+	RGB565 = 3,
+	RGB888 = 6
+} ColorSpace;
+
+typedef struct FramebufferImage {
+	int width;
+	int height;
+	ColorSpace colorSpace;
+	int rle;
+	const void* data;
+	uint32_t length;
+} FramebufferImage;
+
+typedef struct Window Window;
+
+Window* emu_create_window(uint32_t memory, int width, int height, int rgb888);
+uint32_t emu_memory_end();
+uint32_t emu_window_address(Window* window);
+uint32_t emu_line_bytes(Window* window);
+void emu_fill(uint32_t color);
+
+int framebuffer_setup();
+void framebuffer_print_force(const char* str);
+void framebuffer_setloc(int x, int y);
+void framebuffer_setcolors(uint32_t fore, uint32_t back);
+void framebuffer_clear();
+void framebuffer_draw_image(uint32_t* image, int x, int y, int width, int height);
+void framebuffer_draw_asset(const FramebufferImage* image, int x, int y);
+void framebuffer_capture_image(uint32_t* image, int x, int y, int width, int height);
+void framebuffer_blend_image(uint32_t* dst, int dstWidth, int dstHeight, uint32_t* src, int srcWidth, int srcHeight, int x, int y);
+void framebuffer_draw_rect_hgradient(int starting, int ending, int x, int y, int width, int height);
+void framebuffer_frames_start(int surfaces);
+void framebuffer_frame_begin();
+void framebuffer_frame_end();
+void framebuffer_frames_stop();
+
+#include "../images/HeaderRaw.h"
+#include "../images/iPhoneOSRaw.h"
+#include "../images/iPhoneOSSelectedRaw.h"
+
+// the iPhone's panel, when no -s is given
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 480
+#define MAX_SCREENS 4
+
+#define LCD_REGISTERS 0x38900000
+#define LCD_REGISTERS_SIZE 0x2000
+#define MEMORY_SIZE (16 * 1024 * 1024)
+
+#define IMAGE_WIDTH 200
+#define IMAGE_HEIGHT 100
+
+#define GOLDEN_ITERATIONS 3
+#define GOLDEN_MAX 64
+
+static Window* window;
+static int rgb888;
+static int screenWidth;
+static int screenHeight;
+static uint8_t* screenRGB;
+static int iterations = 100;
+static const char* dumpDirectory = NULL;
+static int checking = FALSE;
+static int failures = 0;
+
+static const char* goldenPath = NULL;
+static int goldenWrite = FALSE;
+static FILE* goldenOut = NULL;
+static int goldenCount = 0;
+static int goldenMatched = 0;
+static char goldenNames[GOLDEN_MAX][32];
+static uint64_t goldenHashes[GOLDEN_MAX];
+
+static uint32_t* imageRGBA;
+static uint32_t* imageUnder;
+static uint32_t* imageBlended;
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+// The surface the window is pointing the panel at, as 8-bit RGB
+static void surface(uint8_t* rgb) {
+	const uint8_t* line = (const uint8_t*)(uintptr_t) emu_window_address(window);
+	int x, y;
+	for(y = 0; y < screenHeight; y++) {
+		for(x = 0; x < screenWidth; x++) {
+			if(rgb888) {
+				uint32_t p = ((const uint32_t*) line)[x];
+				rgb[0] = p >> 16;
+				rgb[1] = p >> 8;
+				rgb[2] = p;
+			} else {
+				uint16_t p = ((const uint16_t*) line)[x];
+				rgb[0] = ((p >> 11) & 0x1F) << 3;
+				rgb[1] = ((p >> 5) & 0x3F) << 2;
+				rgb[2] = (p & 0x1F) << 3;
+			}
+			rgb += 3;
+		}
+		line += emu_line_bytes(window);
+	}
+}
+
+// "<benchmark>-<size>-<format>", as frames are named in dumps and golden files
+static void frameName(char* frame, size_t size, const char* name) {
+	snprintf(frame, size, "%s-%dx%d-%s", name, screenWidth, screenHeight, rgb888 ? "888" : "565");
+}
+
+static void dump(const char* name) {
+	char frame[32];
+	char path[1024];
+	frameName(frame, sizeof(frame), name);
+	snprintf(path, sizeof(path), "%s/%s.ppm", dumpDirectory, frame);
+
+	FILE* f = fopen(path, "wb");
+	if(!f) {
+		perror(path);
+		return;
+	}
+
+	surface(screenRGB);
+	fprintf(f, "P6\n%d %d\n255\n", screenWidth, screenHeight);
+	fwrite(screenRGB, 1, screenWidth * screenHeight * 3, f);
+	fclose(f);
+}
+
+// Golden frames are kept as a 64-bit FNV-1a hash of the surface, one "<frame> <hash>" per line
+static uint64_t hashSurface() {
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	int i;
+
+	surface(screenRGB);
+	for(i = 0; i < screenWidth * screenHeight * 3; i++) {
+		hash ^= screenRGB[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+static int loadGolden() {
+	FILE* f = fopen(goldenPath, "r");
+	if(!f) {
+		perror(goldenPath);
+		return FALSE;
+	}
+
+	unsigned long long hash;
+	while(goldenCount < GOLDEN_MAX && fscanf(f, "%31s %llx", goldenNames[goldenCount], &hash) == 2)
+		goldenHashes[goldenCount++] = hash;
+
+	fclose(f);
+	return TRUE;
+}
+
+static void golden(const char* name) {
+	char frame[32];
+	uint64_t hash = hashSurface();
+	int i;
+
+	frameName(frame, sizeof(frame), name);
+
+	if(goldenWrite) {
+		fprintf(goldenOut, "%s %016llx\n", frame, (unsigned long long) hash);
+		return;
+	}
+
+	for(i = 0; i < goldenCount; i++) {
+		if(strcmp(goldenNames[i], frame) != 0)
+			continue;
+
+		if(goldenHashes[i] == hash) {
+			goldenMatched++;
+		} else {
+			fprintf(stderr, "fbemu: %s differs from %s (%016llx); look at it with -d, and rewrite the file with -G if "
+				"that's intended\n", frame, goldenPath, (unsigned long long) hash);
+			failures++;
+		}
+		return;
+	}
+
+	fprintf(stderr, "fbemu: %s isn't in %s\n", frame, goldenPath);
+	failures++;
+}
+
+static void bench(const char* name, void (*setup)(), void (*run)(int i), void (*teardown)()) {
+	if(setup)
+		setup();
+
+	double start = now();
+	int i;
+	for(i = 0; i < iterations; i++)
+		run(i);
+	double elapsed = now() - start;
+
+	if(teardown)
+		teardown();
+
+	if(!goldenPath)
+		printf("%-10s %dx%d %s %10.1f us\n", name, screenWidth, screenHeight, rgb888 ? "888" : "565", elapsed / iterations);
+
+	if(dumpDirectory)
+		dump(name);
+
+	if(goldenPath)
+		golden(name);
+}
+
+static void clearRun(int i) {
+	framebuffer_setcolors(0xFFFFFF, (i & 1) ? 0x000000 : 0x204080);
+	framebuffer_clear();
+}
+
+static void textSetup() {
+	framebuffer_setcolors(0xFFFFFF, 0x000000);
+	framebuffer_clear();
+}
+
+// A screenful of text, in place
+static void textRun(int i) {
+	static const char line[] = "The quick brown fox jumps over the lazy dog. 0123456789!";
+	int row;
+	for(row = 0; row < 48; row++) {
+		framebuffer_setloc(0, row);
+		framebuffer_print_force(line);
+	}
+}
+
+// A screenful of lines, each one scrolling the console
+static void scrollRun(int i) {
+	int row;
+	for(row = 0; row < 48; row++)
+		framebuffer_print_force("scrolling\n");
+}
+
+static void gradientRun(int i) {
+	framebuffer_draw_rect_hgradient(0, 42, 0, 0, screenWidth, screenHeight);
+}
+
+static void imageRun(int i) {
+	framebuffer_draw_image(imageRGBA, (screenWidth - IMAGE_WIDTH) / 2, 100, IMAGE_WIDTH, IMAGE_HEIGHT);
+}
+
+static void assetRun(int i) {
+	framebuffer_draw_asset(&rawHeader, (screenWidth - rawHeader.width) / 2, 17);
+	framebuffer_draw_asset((i & 1) ? &rawiPhoneOSSelected : &rawiPhoneOS, (screenWidth - rawiPhoneOS.width) / 2, 84);
+}
+
+static void blendSetup() {
+	gradientRun(0);
+	framebuffer_capture_image(imageUnder, (screenWidth - IMAGE_WIDTH) / 2, 300, IMAGE_WIDTH, IMAGE_HEIGHT);
+}
+
+static void blendRun(int i) {
+	memcpy(imageBlended, imageUnder, IMAGE_WIDTH * IMAGE_HEIGHT * sizeof(uint32_t));
+	framebuffer_blend_image(imageBlended, IMAGE_WIDTH, IMAGE_HEIGHT, imageRGBA, IMAGE_WIDTH, IMAGE_HEIGHT, 0, 0);
+}
+
+static void blendTeardown() {
+	framebuffer_draw_image(imageBlended, (screenWidth - IMAGE_WIDTH) / 2, 300, IMAGE_WIDTH, IMAGE_HEIGHT);
+}
+
+static void framesSetup() {
+	gradientRun(0);
+	framebuffer_frames_start(2);
+}
+
+// What a menu selection change costs: two items redrawn and flipped
+static void framesRun(int i) {
+	framebuffer_frame_begin();
+	framebuffer_draw_asset((i & 1) ? &rawiPhoneOSSelected : &rawiPhoneOS, (screenWidth - rawiPhoneOS.width) / 2, 84);
+	framebuffer_draw_asset((i & 1) ? &rawiPhoneOS : &rawiPhoneOSSelected, (screenWidth - rawiPhoneOS.width) / 2, 207);
+	framebuffer_frame_end();
+}
+
+static void framesTeardown() {
+	framebuffer_frames_stop();
+}
+
+// A translucent test card: colour ramps across, alpha ramping down
+static void makeImage() {
+	imageRGBA = malloc(IMAGE_WIDTH * IMAGE_HEIGHT * sizeof(uint32_t));
+	imageUnder = malloc(IMAGE_WIDTH * IMAGE_HEIGHT * sizeof(uint32_t));
+	imageBlended = malloc(IMAGE_WIDTH * IMAGE_HEIGHT * sizeof(uint32_t));
+
+	int x, y;
+	for(y = 0; y < IMAGE_HEIGHT; y++) {
+		for(x = 0; x < IMAGE_WIDTH; x++) {
+			uint32_t r = (x * 255) / IMAGE_WIDTH;
+			uint32_t g = (y * 255) / IMAGE_HEIGHT;
+			uint32_t b = 255 - r;
+			uint32_t a = 255 - ((y * 255) / IMAGE_HEIGHT);
+			imageRGBA[(y * IMAGE_WIDTH) + x] = (a << 24) | (b << 16) | (g << 8) | r;
+		}
+	}
+}
+
+// The per-pixel conversions framebuffer.c started out with, and its original blend, as the reference for -c
+
+#define BGR32(x) ((((((x) >> 11) & 0x1F) << 3) << 16) | (((((x) >> 5) & 0x3F) << 2) << 8) | (((x) & 0x1F) << 3))
+#define RGB16(x) (((((x) & 0xFF) >> 3) << 11) | (((((x) >> 8) & 0xFF) >> 2) << 5) | ((((x) >> 16) & 0xFF) >> 3))
+#define RGBA2BGR(x) ((((x) >> 16) & 0xFF) | ((((x) >> 8) & 0xFF) << 8) | (((x) & 0xFF) << 16))
+
+static void referenceBlend(uint32_t* dst, int dstWidth, uint32_t* src, int srcWidth, int srcHeight, int x, int y) {
+	uint32_t sx;
+	uint32_t sy;
+	for(sy = 0; sy < srcHeight; sy++) {
+		for(sx = 0; sx < srcWidth; sx++) {
+			uint32_t* dstPixel = &dst[((sy + y) * dstWidth) + (sx + x)];
+			uint32_t* srcPixel = &src[(sy * srcWidth) + sx];
+			*dstPixel =
+				((((*dstPixel & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + ((((*srcPixel >> 16) & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8)) << 16
+				| (((((*dstPixel >> 8) & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + ((((*srcPixel >> 8) & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8)) << 8
+				| (((((*dstPixel >> 16) & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + (((*srcPixel & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8));
+		}
+	}
+}
+
+static uint32_t noise() {
+	static uint32_t seed = 1;
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+static void mismatch(const char* what, int x, int y, uint32_t got, uint32_t expected) {
+	// the blend is checked before there's a window
+	if(failures++ < 10)
+		fprintf(stderr, "fbemu: %s %s at (%d, %d): 0x%08x, expected 0x%08x\n", what, !window ? "" : rgb888 ? "888" : "565",
+			x, y, got, expected);
+}
+
+static uint32_t readPixel(int x, int y) {
+	const uint8_t* line = (const uint8_t*)(uintptr_t) emu_window_address(window) + (y * emu_line_bytes(window));
+	return rgb888 ? ((const uint32_t*) line)[x] : ((const uint16_t*) line)[x];
+}
+
+static void writePixel(int x, int y, uint32_t p) {
+	uint8_t* line = (uint8_t*)(uintptr_t) emu_window_address(window) + (y * emu_line_bytes(window));
+	if(rgb888)
+		((uint32_t*) line)[x] = p;
+	else
+		((uint16_t*) line)[x] = p;
+}
+
+// Every alpha against random colours on both sides, inside a larger destination that must be left alone elsewhere
+static void checkBlend() {
+	int srcWidth = 256;
+	int srcHeight = 40;
+	int dstWidth = 300;
+	int dstHeight = 50;
+	uint32_t* src = malloc(srcWidth * srcHeight * sizeof(uint32_t));
+	uint32_t* dst = malloc(dstWidth * dstHeight * sizeof(uint32_t));
+	uint32_t* expected = malloc(dstWidth * dstHeight * sizeof(uint32_t));
+	int x, y;
+
+	for(y = 0; y < srcHeight; y++) {
+		for(x = 0; x < srcWidth; x++)
+			src[(y * srcWidth) + x] = (noise() & 0x00FFFFFF) | ((uint32_t) x << 24);
+	}
+
+	for(x = 0; x < dstWidth * dstHeight; x++)
+		dst[x] = noise();
+
+	memcpy(expected, dst, dstWidth * dstHeight * sizeof(uint32_t));
+	referenceBlend(expected, dstWidth, src, srcWidth, srcHeight, 7, 5);
+	framebuffer_blend_image(dst, dstWidth, dstHeight, src, srcWidth, srcHeight, 7, 5);
+
+	for(y = 0; y < dstHeight; y++) {
+		for(x = 0; x < dstWidth; x++) {
+			if(dst[(y * dstWidth) + x] != expected[(y * dstWidth) + x])
+				mismatch("blend", x, y, dst[(y * dstWidth) + x], expected[(y * dstWidth) + x]);
+		}
+	}
+
+	free(expected);
+	free(dst);
+	free(src);
+}
+
+// Images drawn at every alignment and at widths either side of a whole number of pixel pairs, leaving their
+// surroundings alone
+static void checkDraw() {
+	static const int widths[] = {1, 2, 3, 4, 5, 63, 64, 65};
+	uint32_t image[65 * 3];
+	uint32_t left[3];
+	uint32_t right[3];
+	int i, x0, x, y;
+
+	for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+		int width = widths[i];
+		for(x0 = 8; x0 < 12; x0++) {
+			for(y = 0; y < 3; y++) {
+				left[y] = noise() & (rgb888 ? 0xFFFFFFFF : 0xFFFF);
+				right[y] = noise() & (rgb888 ? 0xFFFFFFFF : 0xFFFF);
+				writePixel(x0 - 1, 10 + y, left[y]);
+				writePixel(x0 + width, 10 + y, right[y]);
+			}
+
+			for(x = 0; x < width * 3; x++)
+				image[x] = noise();
+
+			framebuffer_draw_image(image, x0, 10, width, 3);
+
+			for(y = 0; y < 3; y++) {
+				for(x = 0; x < width; x++) {
+					uint32_t p = image[(y * width) + x];
+					uint32_t expected = rgb888 ? RGBA2BGR(p) : RGB16(p);
+					if(readPixel(x0 + x, 10 + y) != expected)
+						mismatch("draw", x0 + x, 10 + y, readPixel(x0 + x, 10 + y), expected);
+				}
+
+				if(readPixel(x0 - 1, 10 + y) != left[y])
+					mismatch("draw, left of the image,", x0 - 1, 10 + y, readPixel(x0 - 1, 10 + y), left[y]);
+				if(readPixel(x0 + width, 10 + y) != right[y])
+					mismatch("draw, right of the image,", x0 + width, 10 + y, readPixel(x0 + width, 10 + y), right[y]);
+			}
+		}
+	}
+}
+
+static void checkCapture() {
+	static const int widths[] = {1, 2, 3, 4, 5, 63, 64, 65};
+	uint32_t image[65 * 3 + 1];
+	int i, x0, x, y;
+
+	for(y = 20; y < 23; y++) {
+		for(x = 0; x < 80; x++)
+			writePixel(x, y, noise() & (rgb888 ? 0xFFFFFFFF : 0xFFFF));
+	}
+
+	for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+		int width = widths[i];
+		for(x0 = 8; x0 < 12; x0++) {
+			image[width * 3] = 0xDEADBEEF;
+			framebuffer_capture_image(image, x0, 20, width, 3);
+
+			for(y = 0; y < 3; y++) {
+				for(x = 0; x < width; x++) {
+					uint32_t p = readPixel(x0 + x, 20 + y);
+					uint32_t expected = rgb888 ? p : BGR32(p);
+					if(image[(y * width) + x] != expected)
+						mismatch("capture", x0 + x, 20 + y, image[(y * width) + x], expected);
+				}
+			}
+
+			if(image[width * 3] != 0xDEADBEEF)
+				mismatch("capture, past the image,", width, 3, image[width * 3], 0xDEADBEEF);
+		}
+	}
+}
+
+static void run(uint32_t memory) {
+	window = emu_create_window(memory, screenWidth, screenHeight, rgb888);
+	if(!window) {
+		fprintf(stderr, "fbemu: cannot create window\n");
+		exit(1);
+	}
+
+	if(emu_memory_end() > (memory + MEMORY_SIZE)) {
+		fprintf(stderr, "fbemu: window needs more than %d bytes\n", MEMORY_SIZE);
+		exit(1);
+	}
+
+	framebuffer_setup();
+
+	if(checking) {
+		checkDraw();
+		checkCapture();
+		return;
+	}
+
+	bench("clear", NULL, clearRun, NULL);
+	bench("text", textSetup, textRun, NULL);
+	bench("scroll", textSetup, scrollRun, NULL);
+	bench("gradient", NULL, gradientRun, NULL);
+	bench("image", NULL, imageRun, NULL);
+	bench("asset", NULL, assetRun, NULL);
+	bench("blend", blendSetup, blendRun, blendTeardown);
+	bench("frames", framesSetup, framesRun, framesTeardown);
+}
+
+static void usage(const char* self) {
+	fprintf(stderr, "usage: %s [-565|-888] [-s WIDTHxHEIGHT]... [-n iterations] [-d directory] [-c] [-g|-G golden]\n", self);
+	exit(1);
+}
+
+int main(int argc, char* argv[]) {
+	int run565 = TRUE;
+	int run888 = TRUE;
+	int widths[MAX_SCREENS];
+	int heights[MAX_SCREENS];
+	int screens = 0;
+
+	int i;
+	for(i = 1; i < argc; i++) {
+		if(strcmp(argv[i], "-565") == 0) {
+			run888 = FALSE;
+		} else if(strcmp(argv[i], "-888") == 0) {
+			run565 = FALSE;
+		} else if(strcmp(argv[i], "-s") == 0 && (i + 1) < argc) {
+			// the benchmarks are laid out for a panel at least as big as the iPhone's
+			if(screens == MAX_SCREENS || sscanf(argv[++i], "%dx%d", &widths[screens], &heights[screens]) != 2
+					|| widths[screens] < SCREEN_WIDTH || heights[screens] < SCREEN_HEIGHT)
+				usage(argv[0]);
+			screens++;
+		} else if(strcmp(argv[i], "-n") == 0 && (i + 1) < argc) {
+			iterations = atoi(argv[++i]);
+			if(iterations <= 0)
+				usage(argv[0]);
+		} else if(strcmp(argv[i], "-d") == 0 && (i + 1) < argc) {
+			dumpDirectory = argv[++i];
+		} else if(strcmp(argv[i], "-c") == 0) {
+			checking = TRUE;
+		} else if((strcmp(argv[i], "-g") == 0 || strcmp(argv[i], "-G") == 0) && (i + 1) < argc) {
+			goldenWrite = (argv[i][1] == 'G');
+			goldenPath = argv[++i];
+		} else {
+			usage(argv[0]);
+		}
+	}
+
+	if(checking && goldenPath)
+		usage(argv[0]);
+
+	if(screens == 0) {
+		widths[0] = SCREEN_WIDTH;
+		heights[0] = SCREEN_HEIGHT;
+		screens = 1;
+	}
+
+	if(goldenPath) {
+		iterations = GOLDEN_ITERATIONS;
+
+		if(goldenWrite) {
+			goldenOut = fopen(goldenPath, "w");
+			if(!goldenOut) {
+				perror(goldenPath);
+				return 1;
+			}
+		} else if(!loadGolden()) {
+			return 1;
+		}
+	}
+
+	// lcd.c programs the controller as it sets the window up, so give it registers to write to
+	if(mmap((void*) LCD_REGISTERS, LCD_REGISTERS_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0)
+			!= (void*) LCD_REGISTERS) {
+		perror("fbemu: LCD registers");
+		return 1;
+	}
+
+	// Window memory is handed around as 32-bit addresses
+	void* memory = mmap(NULL, MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if(memory == MAP_FAILED) {
+		perror("fbemu: window memory");
+		return 1;
+	}
+
+	makeImage();
+
+	if(checking)
+		checkBlend();
+
+	for(i = 0; i < screens; i++) {
+		screenWidth = widths[i];
+		screenHeight = heights[i];
+		screenRGB = malloc(screenWidth * screenHeight * 3);
+
+		if(run565) {
+			rgb888 = FALSE;
+			run((uint32_t)(uintptr_t) memory);
+		}
+
+		if(run888) {
+			rgb888 = TRUE;
+			run((uint32_t)(uintptr_t) memory);
+		}
+
+		free(screenRGB);
+	}
+
+	if(checking) {
+		if(failures > 0) {
+			fprintf(stderr, "fbemu: %d pixels differ\n", failures);
+			return 1;
+		}
+
+		printf("fbemu: bit exact\n");
+	}
+
+	if(goldenOut)
+		fclose(goldenOut);
+
+	if(goldenPath && !goldenWrite) {
+		if(failures > 0)
+			return 1;
+
+		printf("fbemu: %d frames match %s\n", goldenMatched, goldenPath);
+	}
+
+	return 0;
+}
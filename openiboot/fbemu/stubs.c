@@ -0,0 +1,49 @@
+/*
+ * Everything lcd.c and framebuffer.c reach for outside the display path. None of it is used by what fbemu draws;
+ * they only have to link. The DMA paths stay off because task_can_block says no.
+ */
+
+#include "openiboot.h"
+#include "util.h"
+#include "timer.h"
+#include "tasks.h"
+#include "dma.h"
+#include "gpio.h"
+#include "spi.h"
+#include "i2c.h"
+#include "pmu.h"
+#include "clock.h"
+#include "power.h"
+#include "nvram.h"
+#include "openiboot-asmhelpers.h"
+
+void bufferPrintf(const char* format, ...) {}
+unsigned long int parseNumber(const char* str) { return 0; }
+const char* nvram_getvar(const char* name) { return NULL; }
+
+uint64_t timer_get_system_microtime() { return 0; }
+void udelay(uint64_t delay) {}
+int has_elapsed(uint64_t startTime, uint64_t elapsedTime) { return TRUE; }
+int task_can_block() { return FALSE; }
+
+void CleanAndInvalidateCPUDataCache() {}
+int dma_request(int Source, int SourceTransferWidth, int SourceBurstSize, int Destination, int DestinationTransferWidth,
+		int DestinationBurstSize, int* controller, int* channel, DMAHandler handler) { return -1; }
+int dma_perform(uint32_t Source, uint32_t Destination, int size, int continueList, int* controller, int* channel) { return -1; }
+int dma_fill(uint32_t Pattern, uint32_t Destination, int size, int* controller, int* channel) { return -1; }
+int dma_perform_sg(uint32_t Source, uint32_t Destination, const DMASegment* segments, int count, int* controller, int* channel,
+		DMAHandler handler) { return -1; }
+int dma_busy(int controller, int channel) { return FALSE; }
+int dma_finish(int controller, int channel, int timeout) { return 0; }
+void dma_cancel(int controller, int channel) {}
+
+void clock_gate_switch(uint32_t gate, OnOff on_off) {}
+uint32_t clock_get_frequency(FrequencyBase freqBase) { return 0; }
+int power_ctrl(uint32_t device, OnOff on_off) { return 0; }
+void gpio_custom_io(int port, int bits) {}
+void gpio_pin_output(int port, int bit) {}
+int pmu_write_reg(int reg, int data, int verify) { return 0; }
+int pmu_write_regs(const PMURegisterData* regs, int num) { return 0; }
+int spi_tx(int port, const uint8_t* buffer, int len, int block, int unknown) { return len; }
+int spi_rx(int port, uint8_t* buffer, int len, int block, int noTransmitJunk) { return len; }
+void spi_set_baud(int port, int baud, SPIOption13 option13, int isMaster, int isActiveLow, int lastClockEdgeMissing) {}
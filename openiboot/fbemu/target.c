@@ -0,0 +1,39 @@
+/*
+ * The firmware side of fbemu: lcd.c itself, so its window setup and line primitives run unmodified, plus the few
+ * entry points the host side needs. Built against openiboot's own headers, never the host's.
+ */
+
+#include "../lcd.c"
+
+Window* emu_create_window(uint32_t memory, int width, int height, int rgb888) {
+	NextFramebuffer = memory;
+	numWindows = 2;
+
+	currentWindow = createWindow(0, 0, width, height, rgb888 ? RGB888 : RGB565);
+	if(!currentWindow)
+		return NULL;
+
+	CurFramebuffer = currentWindow->framebuffer.buffer;
+	return currentWindow;
+}
+
+uint32_t emu_memory_end() {
+	return NextFramebuffer;
+}
+
+// What the panel would be scanning out of for the window right now
+uint32_t emu_window_address(Window* window) {
+	return GET_REG(LCD + 0x58 + ((window->lcdCon[0] - 1) * 0x18) + 8);
+}
+
+uint32_t emu_line_bytes(Window* window) {
+	return window->lineBytes;
+}
+
+void emu_fill(uint32_t color) {
+	lcd_fill(color);
+}
+
+void emu_scroll(int lines, uint32_t fill) {
+	lcd_window_scroll(currentWindow, lines, fill);
+}
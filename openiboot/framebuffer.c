@@ -2,13 +2,13 @@
 #include "framebuffer.h"
 #include "lcd.h"
 #include "util.h"
-#include "pcf/6x10.h"
+#include "pcf/ConsoleFont.h"
 
 static int TWidth;
 static int THeight;
 static int X;
 static int Y;
-static OpenIBootFont* Font;
+static const FramebufferFont* Font;
 
 static uint32_t FBWidth;
 static uint32_t FBHeight;
@@ -19,6 +19,41 @@ static int DisplayText = FALSE;
 static uint32_t BackgroundColor;
 static uint32_t ForegroundColor;
 
+// The biggest font that still leaves the console this many columns is used
+#define FRAMEBUFFER_MIN_COLUMNS 50
+
+// Every byte a glyph row can have, already in framebuffer pixels for the current colors. RGB565 packs two pixels a
+// word. Wider fonts are drawn a byte of each row at a time, so a glyph costs a lookup per eight pixels at any size.
+static uint32_t RowSpans[1 << 8][8];
+static int RowSpansValid = FALSE;
+static uint32_t RowSpansFore;
+static uint32_t RowSpansBack;
+static ColorSpace RowSpansColorSpace;
+
+// Between framebuffer_frame_begin and framebuffer_frame_end, drawing goes to a hidden surface and what it touches is
+// recorded. Too many rectangles and they're merged into their bounding box.
+#define FRAMEBUFFER_MAX_DIRTY 8
+
+typedef struct DirtyList {
+	FramebufferRect rects[FRAMEBUFFER_MAX_DIRTY];
+	int num;
+} DirtyList;
+
+static int FramesActive = FALSE;
+static int InFrame = FALSE;
+static int NumSurfaces;
+static volatile uint32_t* Surfaces[LCD_WINDOW_SURFACES];	// 0 is where the window was when frames started
+static uint32_t SurfaceFrame[LCD_WINDOW_SURFACES];			// last frame each surface holds all of
+static int SurfaceStale[LCD_WINDOW_SURFACES];				// never brought up to date at all
+static int Front;
+static int Back;
+static uint32_t FrameCount;
+
+// What each of the last few frames changed, by frame number, so a surface that's behind can catch up on just that.
+// Drawing done outside a frame counts towards the frame on screen.
+static DirtyList History[LCD_WINDOW_SURFACES - 1];
+static DirtyList Dirty;
+
 #define BGR16(x) ((((((x) >> 16) & 0xFF) >> 3) << 11) | (((((x) >> 8) & 0xFF) >> 2) << 5) | (((x) & 0xFF) >> 3))
 #define BGR32(x) ((((((x) >> 11) & 0x1F) << 3) << 16) | (((((x) >> 5) & 0x3F) << 2) << 8) | (((x) & 0x1F) << 3))
 
@@ -26,11 +61,6 @@ static uint32_t ForegroundColor;
 
 #define RGBA2BGR(x) ((((x) >> 16) & 0xFF) | ((((x) >> 8) & 0xFF) << 8) | (((x) & 0xFF) << 16))
 
-inline int getCharPixel(OpenIBootFont* font, int ch, int x, int y) {
-	register int bitIndex = ((font->width * font->height) * ch) + (font->width * y) + x;
-	return (font->data[bitIndex / 8] >> (bitIndex % 8)) & 0x1;
-}
-
 inline volatile uint32_t* PixelFromCoords(register uint32_t x, register uint32_t y) {
 	return CurFramebuffer + (y * FBWidth) + x;
 }
@@ -39,12 +69,116 @@ inline volatile uint16_t* PixelFromCoords565(register uint32_t x, register uint3
 	return ((uint16_t*)CurFramebuffer) + (y * FBWidth) + x;
 }
 
+static const uint8_t* glyphRows(int c) {
+	int index = (c & 0xFF) - Font->firstChar;
+	int glyph = (index >= 0 && index < Font->numChars) ? Font->encoding[index] : Font->defaultGlyph;
+	return Font->glyphs + (glyph * Font->height * Font->rowBytes);
+}
+
+static void selectFont() {
+	int i;
+	Font = &fontsConsole[0];
+	for(i = 1; i < (sizeof(fontsConsole) / sizeof(fontsConsole[0])); i++) {
+		if((FBWidth / fontsConsole[i].width) >= FRAMEBUFFER_MIN_COLUMNS && fontsConsole[i].width > Font->width)
+			Font = &fontsConsole[i];
+	}
+
+	RowSpansValid = FALSE;
+}
+
+static void buildRowSpans() {
+	ColorSpace colorSpace = currentWindow->framebuffer.colorSpace;
+
+	if(RowSpansValid && RowSpansFore == ForegroundColor && RowSpansBack == BackgroundColor && RowSpansColorSpace == colorSpace)
+		return;
+
+	uint16_t fgcolor = BGR16(ForegroundColor);
+	uint16_t bgcolor = BGR16(BackgroundColor);
+
+	uint32_t bits = (Font->width < 8) ? Font->width : 8;
+
+	int pattern;
+	for(pattern = 0; pattern < (1 << bits); pattern++) {
+		uint32_t sx;
+		for(sx = 0; sx < bits; sx++) {
+			int set = (pattern >> sx) & 0x1;
+			if(colorSpace == RGB888)
+				RowSpans[pattern][sx] = set ? ForegroundColor : BackgroundColor;
+			else
+				((uint16_t*) RowSpans[pattern])[sx] = set ? fgcolor : bgcolor;
+		}
+	}
+
+	RowSpansFore = ForegroundColor;
+	RowSpansBack = BackgroundColor;
+	RowSpansColorSpace = colorSpace;
+	RowSpansValid = TRUE;
+}
+
+static void drawGlyph888(int c) {
+	register volatile uint32_t* line = PixelFromCoords(Font->width * X, Font->height * Y);
+	register const uint8_t* rows = glyphRows(c);
+	register uint32_t width = Font->width;
+	register uint32_t sy;
+	for(sy = 0; sy < Font->height; sy++) {
+		register uint32_t sx;
+		for(sx = 0; sx < width; sx += 8) {
+			register const uint32_t* span = RowSpans[*(rows++)];
+			register uint32_t n = ((width - sx) < 8) ? (width - sx) : 8;
+			register uint32_t i;
+			for(i = 0; i < n; i++) {
+				line[sx + i] = span[i];
+			}
+		}
+		line += FBWidth;
+	}
+}
+
+static void drawGlyph565(int c) {
+	register volatile uint16_t* line = PixelFromCoords565(Font->width * X, Font->height * Y);
+	register const uint8_t* rows = glyphRows(c);
+	register uint32_t width = Font->width;
+	register uint32_t sy;
+
+	// two pixels per store whenever every row of the glyph starts on a word; every byte but a row's last is eight
+	// pixels, so the pairs never straddle two spans
+	if(((uint32_t) line & 0x3) == 0 && (width & 0x1) == 0 && (FBWidth & 0x1) == 0) {
+		for(sy = 0; sy < Font->height; sy++) {
+			register volatile uint32_t* dst = (volatile uint32_t*) line;
+			register uint32_t sx;
+			for(sx = 0; sx < width; sx += 8) {
+				register const uint32_t* span = RowSpans[*(rows++)];
+				register uint32_t words = (((width - sx) < 8) ? (width - sx) : 8) / 2;
+				register uint32_t i;
+				for(i = 0; i < words; i++) {
+					dst[i] = span[i];
+				}
+				dst += words;
+			}
+			line += FBWidth;
+		}
+	} else {
+		for(sy = 0; sy < Font->height; sy++) {
+			register uint32_t sx;
+			for(sx = 0; sx < width; sx += 8) {
+				register const uint16_t* span = (const uint16_t*) RowSpans[*(rows++)];
+				register uint32_t n = ((width - sx) < 8) ? (width - sx) : 8;
+				register uint32_t i;
+				for(i = 0; i < n; i++) {
+					line[sx + i] = span[i];
+				}
+			}
+			line += FBWidth;
+		}
+	}
+}
+
 int framebuffer_setup() {
-	Font = (OpenIBootFont*) fontData;
 	BackgroundColor = COLOR_BLACK;
 	ForegroundColor = COLOR_WHITE;
 	FBWidth = currentWindow->framebuffer.width;
 	FBHeight = currentWindow->framebuffer.height;
+	selectFont();
 	TWidth = FBWidth / Font->width;
 	THeight = FBHeight / Font->height;
 	framebuffer_clear();
@@ -63,6 +197,7 @@ void framebuffer_setdisplaytext(int onoff) {
 
 void framebuffer_clear() {
 	lcd_fill(BackgroundColor);
+	framebuffer_invalidate(0, 0, FBWidth, FBHeight);
 	X = 0;
 	Y = 0;
 }
@@ -107,30 +242,9 @@ void framebuffer_print_force(const char* str) {
 	}
 }
 
-static void scrollup888() {
-	register volatile uint32_t* newFirstLine = PixelFromCoords(0, Font->height);
-	register volatile uint32_t* oldFirstLine = PixelFromCoords(0, 0);
-	register volatile uint32_t* end = oldFirstLine + (FBWidth * FBHeight);
-	while(newFirstLine < end) {
-		*(oldFirstLine++) = *(newFirstLine++);
-	}
-	while(oldFirstLine < end) {
-		*(oldFirstLine++) = BackgroundColor;
-	}
-	Y--;
-}
-
-static void scrollup565() {
-	register volatile uint16_t* newFirstLine = PixelFromCoords565(0, Font->height);
-	register volatile uint16_t* oldFirstLine = PixelFromCoords565(0, 0);
-	register volatile uint16_t* end = oldFirstLine + (FBWidth * FBHeight);
-	uint16_t bgcolor = BGR16(BackgroundColor);
-	while(newFirstLine < end) {
-		*(oldFirstLine++) = *(newFirstLine++);
-	}
-	while(oldFirstLine < end) {
-		*(oldFirstLine++) = bgcolor;
-	}
+// The LCD window is moved down over the line instead of the pixels being moved up under it
+static void scrollup() {
+	lcd_window_scroll(currentWindow, Font->height, BackgroundColor);
 	Y--;
 }
 
@@ -141,18 +255,9 @@ void framebuffer_putc888(int c) {
 		X = 0;
 		Y++;
 	} else {
-		register uint32_t sx;
-		register uint32_t sy;
-		for(sy = 0; sy < Font->height; sy++) {
-			for(sx = 0; sx < Font->width; sx++) {
-				if(getCharPixel(Font, c, sx, sy)) {
-					*(PixelFromCoords(sx + (Font->width * X), sy + (Font->height * Y))) = ForegroundColor;
-				} else {
-					*(PixelFromCoords(sx + (Font->width * X), sy + (Font->height * Y))) = BackgroundColor;
-				}
-			}
-		}
-
+		buildRowSpans();
+		drawGlyph888(c);
+		framebuffer_invalidate(Font->width * X, Font->height * Y, Font->width, Font->height);
 		X++;
 	}
 
@@ -162,32 +267,20 @@ void framebuffer_putc888(int c) {
 	}
 
 	if(Y == THeight) {
-		scrollup888();
+		scrollup();
 	}
 }
 
 void framebuffer_putc565(int c) {
-	uint16_t fgcolor = BGR16(ForegroundColor);
-	uint16_t bgcolor = BGR16(BackgroundColor);
-
 	if(c == '\r') {
 		X = 0;
 	} else if(c == '\n') {
 		X = 0;
 		Y++;
 	} else {
-		register uint32_t sx;
-		register uint32_t sy;
-		for(sy = 0; sy < Font->height; sy++) {
-			for(sx = 0; sx < Font->width; sx++) {
-				if(getCharPixel(Font, c, sx, sy)) {
-					*(PixelFromCoords565(sx + (Font->width * X), sy + (Font->height * Y))) = fgcolor;
-				} else {
-					*(PixelFromCoords565(sx + (Font->width * X), sy + (Font->height * Y))) = bgcolor;
-				}
-			}
-		}
-
+		buildRowSpans();
+		drawGlyph565(c);
+		framebuffer_invalidate(Font->width * X, Font->height * Y, Font->width, Font->height);
 		X++;
 	}
 
@@ -197,7 +290,7 @@ void framebuffer_putc565(int c) {
 	}
 
 	if(Y == THeight) {
-		scrollup565();
+		scrollup();
 	}
 }
 
@@ -209,54 +302,161 @@ void framebuffer_putc(int c)
 		framebuffer_putc565(c);
 }
 
-static void framebuffer_draw_image888(uint32_t* image, int x, int y, int width, int height) {
-	register uint32_t sx;
-	register uint32_t sy;
-	for(sy = 0; sy < height; sy++) {
-		for(sx = 0; sx < width; sx++) {
-			*(PixelFromCoords(sx + x, sy + y)) = RGBA2BGR(image[(sy * width) + sx]);
-		}
+// Row converters. They give the same pixels as the macros above, but work a row at a time and, on the 565 side, move
+// two pixels per 32-bit load or store whenever the 16-bit end of the row is word aligned.
+
+static void rowRGBAto888(uint32_t* dst, const uint32_t* src, int count) {
+	while(count >= 4) {
+		dst[0] = RGBA2BGR(src[0]);
+		dst[1] = RGBA2BGR(src[1]);
+		dst[2] = RGBA2BGR(src[2]);
+		dst[3] = RGBA2BGR(src[3]);
+		dst += 4;
+		src += 4;
+		count -= 4;
+	}
+
+	while(count-- > 0) {
+		*dst = RGBA2BGR(*src);
+		dst++;
+		src++;
 	}
 }
 
-static void framebuffer_draw_image565(uint32_t* image, int x, int y, int width, int height) {
-	register uint32_t sx;
-	register uint32_t sy;
-	for(sy = 0; sy < height; sy++) {
-		for(sx = 0; sx < width; sx++) {
-			*(PixelFromCoords565(sx + x, sy + y)) = RGB16(image[(sy * width) + sx]);
-		}
+static void rowRGBAto565(uint16_t* dst, const uint32_t* src, int count) {
+	if(count > 0 && ((uint32_t) dst & 0x2)) {
+		*(dst++) = RGB16(*src);
+		src++;
+		count--;
+	}
+
+	uint32_t* pair = (uint32_t*) dst;
+	while(count >= 2) {
+		*(pair++) = RGB16(src[0]) | (RGB16(src[1]) << 16);
+		src += 2;
+		count -= 2;
+	}
+
+	if(count > 0)
+		*((uint16_t*) pair) = RGB16(*src);
+}
+
+static void row565to888(uint32_t* dst, const uint16_t* src, int count) {
+	if(count > 0 && ((uint32_t) src & 0x2)) {
+		*(dst++) = BGR32(*src);
+		src++;
+		count--;
+	}
+
+	const uint32_t* pair = (const uint32_t*) src;
+	while(count >= 2) {
+		uint32_t two = *(pair++);
+		dst[0] = BGR32(two & 0xFFFF);
+		dst[1] = BGR32(two >> 16);
+		dst += 2;
+		count -= 2;
 	}
+
+	if(count > 0)
+		*dst = BGR32(*((const uint16_t*) pair));
+}
+
+static void framebuffer_draw_image888(uint32_t* image, int x, int y, int width, int height) {
+	int sy;
+	for(sy = 0; sy < height; sy++)
+		rowRGBAto888((uint32_t*) PixelFromCoords(x, y + sy), &image[sy * width], width);
+}
+
+static void framebuffer_draw_image565(uint32_t* image, int x, int y, int width, int height) {
+	int sy;
+	for(sy = 0; sy < height; sy++)
+		rowRGBAto565((uint16_t*) PixelFromCoords565(x, y + sy), &image[sy * width], width);
 }
 
 void framebuffer_draw_image(uint32_t* image, int x, int y, int width, int height)
 {
+	framebuffer_invalidate(x, y, width, height);
+
 	if(currentWindow->framebuffer.colorSpace == RGB888)
 		framebuffer_draw_image888(image, x, y, width, height);
 	else
 		framebuffer_draw_image565(image, x, y, width, height);
 }
 
-static void framebuffer_capture_image888(uint32_t* image, int x, int y, int width, int height) {
-	register uint32_t sx;
-	register uint32_t sy;
-	for(sy = 0; sy < height; sy++) {
-		for(sx = 0; sx < width; sx++) {
-			image[(sy * width) + sx] = *(PixelFromCoords(sx + x, sy + y));
+// Images in the window's own format go in a row at a time. Anything else is converted as it's drawn.
+void framebuffer_draw_asset(const FramebufferImage* image, int x, int y) {
+	ColorSpace colorSpace = currentWindow->framebuffer.colorSpace;
+	int pixelBytes = (colorSpace == RGB888) ? 4 : 2;
+
+	framebuffer_invalidate(x, y, image->width, image->height);
+
+	if(!image->rle && image->colorSpace == colorSpace) {
+		const uint8_t* src = (const uint8_t*) image->data;
+		uint32_t rowBytes = image->width * pixelBytes;
+		int sy;
+		for(sy = 0; sy < image->height; sy++) {
+			void* dst = (colorSpace == RGB888) ? (void*) PixelFromCoords(x, y + sy) : (void*) PixelFromCoords565(x, y + sy);
+			memcpy(dst, src, rowBytes);
+			src += rowBytes;
 		}
+		return;
 	}
-}
 
-static void framebuffer_capture_image565(uint32_t* image, int x, int y, int width, int height) {
-	register uint32_t sx;
-	register uint32_t sy;
-	for(sy = 0; sy < height; sy++) {
-		for(sx = 0; sx < width; sx++) {
-			image[(sy * width) + sx] = BGR32(*(PixelFromCoords565(sx + x, sy + y)));
+	volatile uint32_t* line888 = PixelFromCoords(x, y);
+	volatile uint16_t* line565 = PixelFromCoords565(x, y);
+	int sx = 0;
+	int sy = 0;
+	uint32_t i = 0;
+
+	while(i < image->length && sy < image->height) {
+		uint32_t count = 1;
+		uint32_t pixel;
+
+		if(image->colorSpace == RGB888) {
+			const uint32_t* data = (const uint32_t*) image->data;
+			if(image->rle)
+				count = data[i++];
+			pixel = data[i++];
+			if(colorSpace != RGB888)
+				pixel = BGR16(pixel);
+		} else {
+			const uint16_t* data = (const uint16_t*) image->data;
+			if(image->rle)
+				count = data[i++];
+			pixel = data[i++];
+			if(colorSpace == RGB888)
+				pixel = BGR32(pixel);
+		}
+
+		while(count > 0 && sy < image->height) {
+			if(colorSpace == RGB888)
+				line888[sx] = pixel;
+			else
+				line565[sx] = pixel;
+
+			count--;
+			if(++sx == image->width) {
+				sx = 0;
+				sy++;
+				line888 += FBWidth;
+				line565 += FBWidth;
+			}
 		}
 	}
 }
 
+static void framebuffer_capture_image888(uint32_t* image, int x, int y, int width, int height) {
+	int sy;
+	for(sy = 0; sy < height; sy++)
+		memcpy(&image[sy * width], (void*) PixelFromCoords(x, y + sy), width * sizeof(uint32_t));
+}
+
+static void framebuffer_capture_image565(uint32_t* image, int x, int y, int width, int height) {
+	int sy;
+	for(sy = 0; sy < height; sy++)
+		row565to888(&image[sy * width], (const uint16_t*) PixelFromCoords565(x, y + sy), width);
+}
+
 void framebuffer_capture_image(uint32_t* image, int x, int y, int width, int height)
 {
 	if(currentWindow->framebuffer.colorSpace == RGB888)
@@ -266,6 +466,7 @@ void framebuffer_capture_image(uint32_t* image, int x, int y, int width, int hei
 }
 
 void framebuffer_draw_rect(uint32_t color, int x, int y, int width, int height) {
+	framebuffer_invalidate(x, y, width + 1, height + 1);
 	currentWindow->framebuffer.hline(&currentWindow->framebuffer, x, y, width, color);
 	currentWindow->framebuffer.hline(&currentWindow->framebuffer, x, y + height, width, color);
 	currentWindow->framebuffer.vline(&currentWindow->framebuffer, y, x, height, color);
@@ -288,22 +489,40 @@ uint32_t* framebuffer_load_image(const char* data, int len, int* width, int* hei
 #endif
 #endif
 
+// Scales the red and blue channels of a pixel together, and then green: each channel keeps eight bits of headroom in
+// its half of the word, so the product of a channel and a weight of up to 0x100 never carries into its neighbour.
+// The per-channel result is the same floor((c * w) / 256) the unpacked version took.
+#define SCALE_RB(p, w) (((((p) & 0x00FF00FF) * (w)) >> 8) & 0x00FF00FF)
+#define SCALE_G(p, w) (((((p) & 0x0000FF00) * (w)) >> 8) & 0x0000FF00)
+
+// dst comes from framebuffer_capture_image, src from framebuffer_load_image; the result is in src's channel order,
+// ready for framebuffer_draw_image.
 void framebuffer_blend_image(uint32_t* dst, int dstWidth, int dstHeight, uint32_t* src, int srcWidth, int srcHeight, int x, int y) {
-	register uint32_t sx;
-	register uint32_t sy;
+	int sx;
+	int sy;
 	for(sy = 0; sy < srcHeight; sy++) {
+		uint32_t* dstPixel = &dst[((sy + y) * dstWidth) + x];
+		const uint32_t* srcPixel = &src[sy * srcWidth];
 		for(sx = 0; sx < srcWidth; sx++) {
-			register uint32_t* dstPixel = &dst[((sy + y) * dstWidth) + (sx + x)];
-			register uint32_t* srcPixel = &src[(sy * srcWidth) + sx];
-			*dstPixel =
-				((((*dstPixel & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + ((((*srcPixel >> 16) & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8)) << 16
-				| (((((*dstPixel >> 8) & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + ((((*srcPixel >> 8) & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8)) << 8
-				| (((((*dstPixel >> 16) & 0xFF) * (0x100 - (*srcPixel >> 24))) >> 8) + (((*srcPixel & 0xFF) * ((*srcPixel >> 24) + 1)) >> 8));
+			uint32_t s = srcPixel[sx];
+			uint32_t alpha = s >> 24;
+
+			if(alpha == 0xFF) {
+				// (c * 0x100) >> 8 for the source and (c * 1) >> 8 for what's under it
+				dstPixel[sx] = s & 0x00FFFFFF;
+				continue;
+			}
+
+			uint32_t d = RGBA2BGR(dstPixel[sx]);
+			uint32_t under = 0x100 - alpha;
+			uint32_t over = alpha + 1;
+			dstPixel[sx] = (SCALE_RB(d, under) | SCALE_G(d, under)) + (SCALE_RB(s, over) | SCALE_G(s, over));
 		}
 	}
-}	
+}
 
 void framebuffer_draw_rect_hgradient(int starting, int ending, int x, int y, int width, int height) {
+	framebuffer_invalidate(x, y, width, height);
 	int step = (ending - starting) * 1000 / height;
 	int level = starting * 1000;
 	int i;
@@ -314,3 +533,190 @@ void framebuffer_draw_rect_hgradient(int starting, int ending, int x, int y, int
 	}
 }
 
+static void setTarget(volatile uint32_t* buffer) {
+	CurFramebuffer = buffer;
+	currentWindow->framebuffer.buffer = buffer;
+}
+
+static int bytesPerPixel() {
+	return (currentWindow->framebuffer.colorSpace == RGB888) ? 4 : 2;
+}
+
+static uint32_t screenBytes() {
+	return currentWindow->framebuffer.lineWidth * FBHeight * bytesPerPixel();
+}
+
+static void copyRect(volatile uint32_t* to, volatile uint32_t* from, const FramebufferRect* rect) {
+	uint32_t lineBytes = currentWindow->framebuffer.lineWidth * bytesPerPixel();
+	uint32_t offset = (rect->y * lineBytes) + (rect->x * bytesPerPixel());
+	uint32_t length = rect->width * bytesPerPixel();
+
+	int line;
+	for(line = 0; line < rect->height; line++) {
+		memcpy((uint8_t*) to + offset, (uint8_t*) from + offset, length);
+		offset += lineBytes;
+	}
+}
+
+static void addDirty(DirtyList* list, int x, int y, int width, int height) {
+	if(x < 0) {
+		width += x;
+		x = 0;
+	}
+
+	if(y < 0) {
+		height += y;
+		y = 0;
+	}
+
+	if((x + width) > FBWidth)
+		width = FBWidth - x;
+
+	if((y + height) > FBHeight)
+		height = FBHeight - y;
+
+	if(width <= 0 || height <= 0)
+		return;
+
+	FramebufferRect rect = {x, y, width, height};
+
+	// fold it into anything it overlaps, so no pixel is copied twice
+	int i;
+	for(i = 0; i < list->num; i++) {
+		FramebufferRect* d = &list->rects[i];
+		if(rect.x <= (d->x + d->width) && d->x <= (rect.x + rect.width)
+				&& rect.y <= (d->y + d->height) && d->y <= (rect.y + rect.height)) {
+			int right = ((d->x + d->width) > (rect.x + rect.width)) ? (d->x + d->width) : (rect.x + rect.width);
+			int bottom = ((d->y + d->height) > (rect.y + rect.height)) ? (d->y + d->height) : (rect.y + rect.height);
+			rect.x = (d->x < rect.x) ? d->x : rect.x;
+			rect.y = (d->y < rect.y) ? d->y : rect.y;
+			rect.width = right - rect.x;
+			rect.height = bottom - rect.y;
+
+			// the grown rectangle may now touch others, so start over without this one
+			list->rects[i] = list->rects[--list->num];
+			i = -1;
+		}
+	}
+
+	if(list->num == FRAMEBUFFER_MAX_DIRTY) {
+		for(i = 0; i < list->num; i++) {
+			FramebufferRect* d = &list->rects[i];
+			int right = ((d->x + d->width) > (rect.x + rect.width)) ? (d->x + d->width) : (rect.x + rect.width);
+			int bottom = ((d->y + d->height) > (rect.y + rect.height)) ? (d->y + d->height) : (rect.y + rect.height);
+			rect.x = (d->x < rect.x) ? d->x : rect.x;
+			rect.y = (d->y < rect.y) ? d->y : rect.y;
+			rect.width = right - rect.x;
+			rect.height = bottom - rect.y;
+		}
+		list->num = 0;
+	}
+
+	list->rects[list->num++] = rect;
+}
+
+void framebuffer_invalidate(int x, int y, int width, int height) {
+	if(InFrame)
+		addDirty(&Dirty, x, y, width, height);
+	else if(FramesActive)
+		addDirty(&History[FrameCount % (NumSurfaces - 1)], x, y, width, height);
+}
+
+// Brings a surface up to what's on screen, copying only what changed in the frames it missed
+static void catchUp(int surface) {
+	if(SurfaceStale[surface]) {
+		memcpy((void*) Surfaces[surface], (void*) Surfaces[Front], screenBytes());
+	} else {
+		uint32_t frame;
+		for(frame = SurfaceFrame[surface] + 1; frame <= FrameCount; frame++) {
+			DirtyList* changed = &History[frame % (NumSurfaces - 1)];
+			int i;
+			for(i = 0; i < changed->num; i++)
+				copyRect(Surfaces[surface], Surfaces[Front], &changed->rects[i]);
+		}
+	}
+
+	SurfaceFrame[surface] = FrameCount;
+	SurfaceStale[surface] = FALSE;
+}
+
+void framebuffer_frames_start(int surfaces) {
+	if(FramesActive)
+		return;
+
+	if(surfaces < 2)
+		surfaces = 2;
+
+	if(surfaces > LCD_WINDOW_SURFACES)
+		surfaces = LCD_WINDOW_SURFACES;
+
+	NumSurfaces = surfaces;
+
+	int i;
+	for(i = 0; i < NumSurfaces; i++) {
+		Surfaces[i] = lcd_window_surface(currentWindow, i);
+		SurfaceFrame[i] = 0;
+		SurfaceStale[i] = (i != 0);
+	}
+
+	for(i = 0; i < (NumSurfaces - 1); i++)
+		History[i].num = 0;
+
+	Front = 0;
+	FrameCount = 0;
+	Dirty.num = 0;
+	InFrame = FALSE;
+	FramesActive = TRUE;
+}
+
+void framebuffer_frame_begin() {
+	if(!FramesActive || InFrame)
+		return;
+
+	Back = (Front + 1) % NumSurfaces;
+	catchUp(Back);
+
+	setTarget(Surfaces[Back]);
+	Dirty.num = 0;
+	InFrame = TRUE;
+}
+
+void framebuffer_frame_end() {
+	if(!InFrame)
+		return;
+
+	InFrame = FALSE;
+
+	if(Dirty.num > 0) {
+		FrameCount++;
+		History[FrameCount % (NumSurfaces - 1)] = Dirty;
+		SurfaceFrame[Back] = FrameCount;
+
+		lcd_window_flip(currentWindow, Surfaces[Back]);
+		Front = Back;
+		Dirty.num = 0;
+	} else if(FrameCount > 0) {
+		// not shown, so it has to see anything drawn straight to the screen from here on
+		SurfaceFrame[Back] = FrameCount - 1;
+	} else {
+		SurfaceStale[Back] = TRUE;
+	}
+
+	setTarget(Surfaces[Front]);
+}
+
+void framebuffer_frames_stop() {
+	if(!FramesActive)
+		return;
+
+	framebuffer_frame_end();
+
+	if(Front != 0) {
+		catchUp(0);
+		lcd_window_flip(currentWindow, Surfaces[0]);
+		Front = 0;
+	}
+
+	setTarget(Surfaces[0]);
+	FramesActive = FALSE;
+}
@@ -2,6 +2,7 @@
 #include "ftl.h"
 #include "nand.h"
 #include "util.h"
+#include "log.h"
 
 #define FTL_ID_V1 0x43303033
 #define FTL_ID_V2 0x43303034
@@ -31,18 +32,18 @@ static int findDeviceInfoBBT(int bank, void* deviceInfoBBT) {
 		int badBlockCount = 0;
 		for(page = 0; page < Geometry->pagesPerBlock; page++) {
 			if(badBlockCount > 2) {
-				DebugPrintf("ftl: findDeviceInfoBBT - too many bad pages, skipping block %d\r\n", block);
+				LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: findDeviceInfoBBT - too many bad pages, skipping block %d\r\n", block);
 				break;
 			}
 
 			int ret = nand_read_alternate_ecc(bank, (block * Geometry->pagesPerBlock) + page, buffer);
 			if(ret != 0) {
 				if(ret == 1) {
-					DebugPrintf("ftl: findDeviceInfoBBT - found 'badBlock' on bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
+					LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: findDeviceInfoBBT - found 'badBlock' on bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
 					badBlockCount++;
 				}
 
-				DebugPrintf("ftl: findDeviceInfoBBT - skipping bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
+				LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: findDeviceInfoBBT - skipping bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
 				continue;
 			}
 
@@ -54,7 +55,7 @@ static int findDeviceInfoBBT(int bank, void* deviceInfoBBT) {
 				free(buffer);
 				return TRUE;
 			} else {
-				DebugPrintf("ftl: did not find signature on bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
+				LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: did not find signature on bank %d, page %d\r\n", (block * Geometry->pagesPerBlock) + page);
 			}
 		}
 	}
@@ -1128,7 +1129,7 @@ static int FTL_Restore() {
 	{
 		if((block % 1000) == 0)
 		{
-			bufferPrintf("ftl: restore scanning virtual blocks %d - %d\r\n", block,
+			LogPrintf(LOG_FTL, LOG_INFO, "ftl: restore scanning virtual blocks %d - %d\r\n", block,
 					block + ((((Geometry->userSuBlksTotal + 23) - block) > 1000) ? 999 : ((Geometry->userSuBlksTotal + 23) - block - 1)));
 		}
 
@@ -1182,7 +1183,7 @@ static int FTL_Restore() {
 
 		if((block % 1000) == 0)
 		{
-			bufferPrintf("ftl: restore scanning logical blocks %d - %d\r\n", block,
+			LogPrintf(LOG_FTL, LOG_INFO, "ftl: restore scanning logical blocks %d - %d\r\n", block,
 					block + (((Geometry->userSuBlksTotal - block) > 1000) ? 999 : (Geometry->userSuBlksTotal - block - 1)));
 		}
 
@@ -1476,7 +1477,7 @@ static int FTL_Restore() {
 		if(pLog[i].pagesUsed != pLog[i].pagesCurrent)
 			pLog[i].isSequential = 0;
 
-		bufferPrintf("ftl: restore -- log %d, wLbn = %d, wVbn = %d, pagesUsed = %d, pagesCurrent = %d, isSequential = %d\r\n",
+		LogPrintf(LOG_FTL, LOG_INFO, "ftl: restore -- log %d, wLbn = %d, wVbn = %d, pagesUsed = %d, pagesCurrent = %d, isSequential = %d\r\n",
 				i, pLog[i].wLbn, pLog[i].wVbn, pLog[i].pagesUsed, pLog[i].pagesCurrent, pLog[i].isSequential);
 	}
 
@@ -3086,7 +3087,7 @@ int ftl_setup() {
 	int i;
 	int foundSignature = FALSE;
 
-	DebugPrintf("ftl: Attempting to read %d pages from first block of first bank.\r\n", Geometry->pagesPerBlock);
+	LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: Attempting to read %d pages from first block of first bank.\r\n", Geometry->pagesPerBlock);
 	uint8_t* buffer = malloc(Geometry->bytesPerPage);
 	for(i = 0; i < Geometry->pagesPerBlock; i++) {
 		int ret;
@@ -3097,10 +3098,10 @@ int ftl_setup() {
 				foundSignature = TRUE;
 				break;
 			} else {
-				DebugPrintf("ftl: Found non-matching signature: %x\r\n", ((uint32_t*) buffer));
+				LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: Found non-matching signature: %x\r\n", ((uint32_t*) buffer));
 			}
 		} else {
-			DebugPrintf("ftl: page %d of first bank is unreadable: %x!\r\n", i, ret);
+			LogPrintf(LOG_FTL, LOG_DEBUG, "ftl: page %d of first bank is unreadable: %x!\r\n", i, ret);
 		}
 	}
 	free(buffer);
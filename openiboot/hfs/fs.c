@@ -265,6 +265,68 @@ int fs_extract(int partition, const char* file, void* location) {
 	return ret;
 }
 
+FSFile* fs_open(int partition, const char* file) {
+	FSFile* f = (FSFile*) malloc(sizeof(FSFile));
+	if(!f)
+		return NULL;
+
+	memset(f, 0, sizeof(FSFile));
+
+	f->io = bdev_open(partition);
+	if(f->io == NULL) {
+		bufferPrintf("fs: cannot read partition!\r\n");
+		free(f);
+		return NULL;
+	}
+
+	f->volume = openVolume(f->io);
+	if(f->volume == NULL) {
+		CLOSE(f->io);
+		free(f);
+		return NULL;
+	}
+
+	f->record = getRecordFromPath(file, f->volume, NULL, NULL);
+	if(f->record == NULL || f->record->recordType != kHFSPlusFileRecord) {
+		fs_close(f);
+		return NULL;
+	}
+
+	HFSPlusCatalogFile* catalogFile = (HFSPlusCatalogFile*) f->record;
+	f->fileIO = openRawFile(catalogFile->fileID, &catalogFile->dataFork, f->record, f->volume);
+	if(f->fileIO == NULL) {
+		fs_close(f);
+		return NULL;
+	}
+
+	f->size = catalogFile->dataFork.logicalSize;
+	return f;
+}
+
+uint32_t fs_read(FSFile* f, void* buffer, uint32_t size) {
+	if(size > (f->size - f->offset))
+		size = f->size - f->offset;
+
+	if(size == 0)
+		return 0;
+
+	if(!READ(f->fileIO, f->offset, size, buffer))
+		return 0;
+
+	f->offset += size;
+	return size;
+}
+
+void fs_close(FSFile* f) {
+	if(f->fileIO)
+		CLOSE(f->fileIO);
+
+	free(f->record);
+	closeVolume(f->volume);
+	CLOSE(f->io);
+	free(f);
+}
+
 void fs_cmd_extract(int argc, char** argv) {
 	Volume* volume;
 	io_func* io;
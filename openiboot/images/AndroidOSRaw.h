@@ -0,0 +1,250 @@
+// generated by png2raw from AndroidOS.png
+
+const uint16_t dataAndroidOSRaw[] = {
+	0x037f, 0x0000, 0x0001, 0x39e7, 0x0001, 0x630c, 0x0018, 0x0000, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x004f, 0x0000, 0x0001, 0x2945, 
+	0x0001, 0x7bef, 0x0001, 0x39c7, 0x0016, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x7bcf, 0x0001, 0x4208, 0x0050, 0x0000, 0x0001, 0x5aeb, 
+	0x0001, 0x738e, 0x0001, 0x0020, 0x0015, 0x0000, 0x0002, 0x6b4d, 
+	0x0051, 0x0000, 0x0001, 0x18c3, 0x0001, 0x7bcf, 0x0001, 0x4a69, 
+	0x0014, 0x0000, 0x0001, 0x3186, 0x0001, 0x7bcf, 0x0001, 0x3186, 
+	0x0052, 0x0000, 0x0001, 0x528a, 0x0001, 0x7bcf, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0001, 0x10a2, 0x0001, 0x3186, 0x0001, 0x39e7, 
+	0x0001, 0x4228, 0x0001, 0x4208, 0x0001, 0x39e7, 0x0001, 0x4228, 
+	0x0001, 0x4208, 0x0001, 0x3186, 0x0001, 0x18c3, 0x0005, 0x0000, 
+	0x0001, 0x738e, 0x0001, 0x630c, 0x0053, 0x0000, 0x0001, 0x0841, 
+	0x0001, 0x7bcf, 0x0001, 0x528a, 0x0001, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x52aa, 0x0001, 0x6b6d, 0x0004, 0x7bef, 0x0003, 0x8410, 
+	0x0003, 0x7bef, 0x0001, 0x738e, 0x0001, 0x5aeb, 0x0001, 0x2945, 
+	0x0001, 0x0000, 0x0001, 0x39c7, 0x0001, 0x7bcf, 0x0001, 0x18e3, 
+	0x0054, 0x0000, 0x0001, 0x4228, 0x0001, 0x7bef, 0x0001, 0x738e, 
+	0x0002, 0x7bef, 0x000c, 0x8410, 0x0002, 0x7bef, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0001, 0x5acb, 0x0054, 0x0000, 0x0001, 0x2965, 
+	0x0001, 0x738e, 0x0002, 0x7bef, 0x0010, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x73ae, 0x0001, 0x39e7, 0x0051, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x630c, 0x0002, 0x7bef, 0x0015, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x6b4d, 0x0001, 0x18c3, 0x004e, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0018, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x31a6, 0x004c, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x001a, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x31a6, 0x004a, 0x0000, 0x0001, 0x2124, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x7bef, 0x0010, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x31a6, 0x0048, 0x0000, 0x0001, 0x1082, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x9492, 
+	0x0001, 0xb5b6, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x000e, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x9492, 0x0001, 0xb5b6, 0x0001, 0x9cf3, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x2104, 0x0047, 0x0000, 0x0001, 0x630c, 0x0001, 0x7bef, 
+	0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8c51, 0x0001, 0xef7d, 
+	0x0001, 0xffff, 0x0001, 0xf7be, 0x0001, 0x94b2, 0x0001, 0x7bef, 
+	0x000c, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8c71, 0x0001, 0xef7d, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0001, 0x94b2, 0x0001, 0x7bef, 
+	0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b6d, 0x0001, 0x0020, 
+	0x0045, 0x0000, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0004, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x94b2, 0x0003, 0xffff, 0x0001, 0xad55, 
+	0x0001, 0x7bcf, 0x000c, 0x8410, 0x0001, 0x7bef, 0x0001, 0x94b2, 
+	0x0003, 0xffff, 0x0001, 0xa534, 0x0001, 0x7bcf, 0x0004, 0x8410, 
+	0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0044, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0xce59, 
+	0x0001, 0xffff, 0x0001, 0xd69a, 0x0010, 0x8410, 0x0001, 0xc638, 
+	0x0001, 0xffdf, 0x0001, 0xdedb, 0x0001, 0x8430, 0x0001, 0x7bef, 
+	0x0004, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x10a2, 
+	0x0043, 0x0000, 0x0001, 0x39c7, 0x0001, 0x7bef, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8c71, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x000f, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8c71, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a49, 
+	0x0043, 0x0000, 0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0008, 0x8410, 
+	0x0001, 0x7bef, 0x0012, 0x8410, 0x0001, 0x7bef, 0x0008, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x0020, 0x0041, 0x0000, 
+	0x0001, 0x18e3, 0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x3186, 0x0041, 0x0000, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 0x0041, 0x0000, 
+	0x0001, 0x5acb, 0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x6b6d, 0x0041, 0x0000, 0x0001, 0x6b6d, 0x0001, 0x7bef, 
+	0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b6d, 0x0041, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x0841, 
+	0x0040, 0x0000, 0x0001, 0x4208, 0x0001, 0x528a, 0x0026, 0x4a69, 
+	0x0001, 0x528a, 0x0001, 0x4a49, 0x0001, 0x0020, 0x0037, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x4a49, 0x0001, 0x5aeb, 0x0001, 0x5acb, 
+	0x0001, 0x39c7, 0x0001, 0x0841, 0x0031, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0x5acb, 0x0001, 0x5aeb, 0x0001, 0x4a69, 0x0001, 0x18e3, 
+	0x002e, 0x0000, 0x0001, 0x3186, 0x0001, 0x7bcf, 0x0004, 0x7bef, 
+	0x0001, 0x738e, 0x0001, 0x18e3, 0x0002, 0x0000, 0x0001, 0x5acb, 
+	0x0001, 0x6b6d, 0x0026, 0x6b4d, 0x0001, 0x6b6d, 0x0001, 0x630c, 
+	0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0x6b6d, 
+	0x0002, 0x7bef, 0x0001, 0x8410, 0x0002, 0x7bef, 0x0001, 0x4208, 
+	0x002c, 0x0000, 0x0001, 0x18c3, 0x0001, 0x7bcf, 0x0001, 0x7bef, 
+	0x0004, 0x8410, 0x0001, 0x7bcf, 0x0001, 0x738e, 0x0001, 0x0020, 
+	0x0001, 0x0000, 0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0026, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x0000, 
+	0x0001, 0x632c, 0x0001, 0x7bcf, 0x0004, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x2965, 0x002b, 0x0000, 0x0001, 0x4a49, 0x0001, 0x7bcf, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x31a6, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x18c3, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5aeb, 0x002b, 0x0000, 0x0001, 0x6b6d, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x738e, 0x002b, 0x0000, 0x0001, 0x73ae, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x002b, 0x0000, 0x0001, 0x73ae, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x73ae, 0x002b, 0x0000, 0x0001, 0x73ae, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x73ae, 0x002b, 0x0000, 0x0001, 0x73ae, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0000, 
+	0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x73ae, 0x0016, 0x0000, 0x0015, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0020, 0x0001, 0x73ae, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0001, 0x0020, 0x0001, 0x6b4d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0020, 0x0001, 0x39e7, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0016, 0x0020, 0x0015, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x002b, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x002b, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x002b, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x002b, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x002b, 0x0841, 
+	0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 0x002b, 0x0841, 
+	0x0001, 0x52aa, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x4228, 0x0001, 0x0841, 0x0001, 0x6b4d, 0x0028, 0x8410, 
+	0x0001, 0x73ae, 0x0001, 0x0841, 0x0001, 0x2945, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x632c, 0x002b, 0x0841, 
+	0x0001, 0x2124, 0x0002, 0x7bef, 0x0004, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x10a2, 0x0001, 0x0841, 0x0001, 0x6b4d, 
+	0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x738e, 0x0001, 0x7bcf, 0x0005, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x39c7, 0x002c, 0x0841, 0x0001, 0x4228, 0x0002, 0x7bef, 
+	0x0002, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x3186, 
+	0x0002, 0x0841, 0x0001, 0x6b6d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x2124, 0x0001, 0x73ae, 
+	0x0002, 0x7bef, 0x0001, 0x8410, 0x0002, 0x7bef, 0x0001, 0x52aa, 
+	0x002e, 0x0841, 0x0001, 0x2945, 0x0001, 0x632c, 0x0002, 0x6b6d, 
+	0x0001, 0x528a, 0x0001, 0x18c3, 0x0003, 0x0841, 0x0001, 0x6b6d, 
+	0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0001, 0x1082, 0x0001, 0x4a49, 0x0002, 0x6b6d, 0x0001, 0x632c, 
+	0x0001, 0x31a6, 0x0018, 0x0841, 0x0020, 0x0861, 0x0001, 0x6b6d, 
+	0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0881, 0x0040, 0x0861, 
+	0x0001, 0x6b6d, 0x0028, 0x8410, 0x0001, 0x73ae, 0x0001, 0x0881, 
+	0x0040, 0x0861, 0x0001, 0x6b6d, 0x0028, 0x8410, 0x0001, 0x73ae, 
+	0x0001, 0x0881, 0x0040, 0x0861, 0x0001, 0x632c, 0x0001, 0x7bcf, 
+	0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x738e, 0x0041, 0x0861, 
+	0x0001, 0x31c6, 0x0002, 0x7bef, 0x0025, 0x8410, 0x0001, 0x7bcf, 
+	0x0001, 0x4a69, 0x0042, 0x0861, 0x0001, 0x4a69, 0x0002, 0x7bef, 
+	0x0023, 0x8410, 0x0001, 0x7bef, 0x0001, 0x632c, 0x0044, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x73ae, 0x0001, 0x8410, 0x0003, 0x7bef, 
+	0x000a, 0x8410, 0x0006, 0x7bef, 0x000a, 0x8410, 0x0004, 0x7bef, 
+	0x0001, 0x73ae, 0x0001, 0x4a89, 0x0001, 0x0881, 0x0045, 0x0861, 
+	0x0001, 0x0881, 0x0001, 0x2144, 0x0002, 0x39e7, 0x0001, 0x31c6, 
+	0x0001, 0x52ca, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x3a07, 0x0005, 0x39e7, 0x0001, 0x73ae, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x5aeb, 0x0001, 0x31c6, 
+	0x0001, 0x39e7, 0x0001, 0x3a07, 0x0001, 0x2985, 0x0001, 0x0881, 
+	0x004c, 0x0861, 0x0001, 0x31a6, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x0881, 0x0005, 0x0861, 
+	0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x4228, 
+	0x0051, 0x0861, 0x0001, 0x31a6, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x0881, 0x0005, 0x0861, 0x0001, 0x6b8d, 
+	0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x4228, 0x0051, 0x0861, 
+	0x0001, 0x31a6, 0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x0881, 0x0005, 0x0861, 0x0001, 0x6b8d, 0x0001, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x4228, 0x0029, 0x0861, 0x0028, 0x1082, 
+	0x0001, 0x39c7, 0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x10a2, 0x0005, 0x1082, 0x0001, 0x738e, 0x0001, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x4228, 0x0051, 0x1082, 0x0001, 0x39c7, 
+	0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x10a2, 
+	0x0005, 0x1082, 0x0001, 0x738e, 0x0001, 0x7bef, 0x0007, 0x8410, 
+	0x0001, 0x4228, 0x0051, 0x1082, 0x0001, 0x39c7, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x10a2, 0x0005, 0x1082, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x4228, 
+	0x0051, 0x1082, 0x0001, 0x39c7, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x10a2, 0x0005, 0x1082, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x4228, 0x0051, 0x1082, 
+	0x0001, 0x39c7, 0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x10a2, 0x0005, 0x1082, 0x0001, 0x738e, 0x0001, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x4228, 0x0051, 0x1082, 0x0001, 0x39c7, 
+	0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x10a2, 
+	0x0005, 0x1082, 0x0001, 0x738e, 0x0001, 0x7bef, 0x0007, 0x8410, 
+	0x0001, 0x4a49, 0x0051, 0x1082, 0x0001, 0x39c7, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x10a2, 0x0005, 0x1082, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x4a49, 
+	0x0051, 0x1082, 0x0001, 0x31a6, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x738e, 0x0006, 0x1082, 0x0001, 0x632c, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a49, 
+	0x0052, 0x1082, 0x0001, 0x6b6d, 0x0001, 0x7bcf, 0x0005, 0x8410, 
+	0x0001, 0x7bcf, 0x0001, 0x4a49, 0x0006, 0x1082, 0x0001, 0x31a6, 
+	0x0001, 0x7bcf, 0x0005, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 
+	0x0001, 0x18c3, 0x0052, 0x1082, 0x0001, 0x2124, 0x0001, 0x738e, 
+	0x0005, 0x7bef, 0x0001, 0x630c, 0x0008, 0x1082, 0x0001, 0x528a, 
+	0x0005, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x31a6, 0x002a, 0x1082, 
+	0x002a, 0x10a2, 0x0001, 0x18e3, 0x0001, 0x52aa, 0x0001, 0x738e, 
+	0x0001, 0x73ce, 0x0001, 0x6b6d, 0x0001, 0x3a07, 0x000a, 0x10a2, 
+	0x0001, 0x31a6, 0x0001, 0x6b4d, 0x0001, 0x73ae, 0x0001, 0x738e, 
+	0x0001, 0x5aeb, 0x0001, 0x2124, 0x03ee, 0x10a2, 0x0499, 0x18c3, 
+	0x01ac, 0x18e3, 
+};
+
+const FramebufferImage rawAndroidOS = {107, 107, RGB565, TRUE, dataAndroidOSRaw, 1946};
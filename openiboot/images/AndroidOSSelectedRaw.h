@@ -0,0 +1,1036 @@
+// generated by png2raw from AndroidOSSelected.png
+
+const uint16_t dataAndroidOSSelectedRaw[] = {
+	0x000a, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 0x0052, 0x18e3, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0012, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x2965, 0x0001, 0x4208, 0x0056, 0x4a49, 0x0001, 0x4228, 
+	0x0001, 0x31a6, 0x0001, 0x18e3, 0x000d, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x3186, 0x0003, 0x4a49, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0021, 0x2965, 0x0011, 0x3186, 0x0020, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x39e7, 0x0003, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x10a2, 
+	0x000a, 0x0000, 0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x4228, 0x0001, 0x2945, 0x0001, 0x0841, 0x0019, 0x0000, 
+	0x0006, 0x0020, 0x0005, 0x0841, 0x000f, 0x0861, 0x0005, 0x0841, 
+	0x0007, 0x0020, 0x0017, 0x0000, 0x0001, 0x0020, 0x0001, 0x18e3, 
+	0x0001, 0x4208, 0x0002, 0x4a49, 0x0001, 0x2965, 0x0008, 0x0000, 
+	0x0001, 0x1082, 0x0002, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x0841, 
+	0x0019, 0x0000, 0x0004, 0x0020, 0x0004, 0x0841, 0x0004, 0x0861, 
+	0x0012, 0x1082, 0x0003, 0x0861, 0x0004, 0x0841, 0x0005, 0x0020, 
+	0x0018, 0x0000, 0x0001, 0x2124, 0x0002, 0x4a49, 0x0001, 0x2965, 
+	0x0006, 0x0000, 0x0001, 0x0861, 0x0002, 0x4a49, 0x0001, 0x2945, 
+	0x0019, 0x0000, 0x0003, 0x0020, 0x0004, 0x0841, 0x0002, 0x0861, 
+	0x0007, 0x1082, 0x000d, 0x10a2, 0x0007, 0x1082, 0x0002, 0x0861, 
+	0x0004, 0x0841, 0x0004, 0x0020, 0x0017, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x2104, 0x0005, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0018, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0005, 0x1082, 
+	0x0017, 0x10a2, 0x0005, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 
+	0x0004, 0x0020, 0x0016, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0001, 0x18e3, 0x0001, 0x4a49, 
+	0x0001, 0x4208, 0x0017, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 
+	0x0001, 0x0861, 0x0004, 0x1082, 0x001f, 0x10a2, 0x0004, 0x1082, 
+	0x0001, 0x0861, 0x0003, 0x0841, 0x0004, 0x0020, 0x0015, 0x0000, 
+	0x0001, 0x2965, 0x0001, 0x4a49, 0x0001, 0x3186, 0x0003, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x18c3, 0x0015, 0x0000, 
+	0x0003, 0x0020, 0x0002, 0x0841, 0x0002, 0x0861, 0x0004, 0x1082, 
+	0x0003, 0x10a2, 0x0001, 0x4a49, 0x0001, 0x6b4d, 0x0007, 0x10a2, 
+	0x000b, 0x18c3, 0x0006, 0x10a2, 0x0001, 0x5aeb, 0x0001, 0x5acb, 
+	0x0004, 0x10a2, 0x0004, 0x1082, 0x0002, 0x0861, 0x0002, 0x0841, 
+	0x0004, 0x0020, 0x0013, 0x0000, 0x0001, 0x0020, 0x0001, 0x4228, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x4a49, 0x0001, 0x4208, 0x0015, 0x0000, 0x0002, 0x0020, 
+	0x0003, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 0x0006, 0x10a2, 
+	0x0001, 0x39c7, 0x0001, 0x7bef, 0x0001, 0x4a49, 0x0016, 0x18c3, 
+	0x0001, 0x31a6, 0x0001, 0x7bef, 0x0001, 0x528a, 0x0007, 0x10a2, 
+	0x0003, 0x1082, 0x0001, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 
+	0x0013, 0x0000, 0x0001, 0x2945, 0x0001, 0x4a49, 0x0001, 0x2124, 
+	0x0001, 0x0000, 0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x2945, 
+	0x0013, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0003, 0x1082, 0x0008, 0x10a2, 0x0001, 0x18c3, 0x0001, 0x632c, 
+	0x0001, 0x73ae, 0x0001, 0x18e3, 0x0007, 0x18c3, 0x0007, 0x18e3, 
+	0x0007, 0x18c3, 0x0002, 0x738e, 0x0003, 0x18c3, 0x0007, 0x10a2, 
+	0x0003, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 
+	0x0012, 0x0000, 0x0001, 0x1082, 0x0001, 0x4a49, 0x0001, 0x39c7, 
+	0x0001, 0x0000, 0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x18c3, 
+	0x0012, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x0861, 
+	0x0002, 0x1082, 0x0007, 0x10a2, 0x0004, 0x18c3, 0x0001, 0x3186, 
+	0x0001, 0x7bef, 0x0001, 0x5aeb, 0x0001, 0x18c3, 0x0013, 0x18e3, 
+	0x0001, 0x4228, 0x0001, 0x7bcf, 0x0001, 0x4228, 0x0006, 0x18c3, 
+	0x0006, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0003, 0x0020, 0x0011, 0x0000, 0x0002, 0x4a49, 0x0001, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0011, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 
+	0x0006, 0x10a2, 0x0006, 0x18c3, 0x0001, 0x18e3, 0x0001, 0x630c, 
+	0x0001, 0x7bef, 0x0001, 0x2945, 0x0003, 0x18e3, 0x0001, 0x2104, 
+	0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x528a, 0x0001, 0x52aa, 
+	0x0002, 0x528a, 0x0002, 0x52aa, 0x0001, 0x4228, 0x0001, 0x3186, 
+	0x0001, 0x2104, 0x0004, 0x18e3, 0x0001, 0x7bcf, 0x0001, 0x6b6d, 
+	0x0002, 0x18e3, 0x0007, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 0x0010, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0020, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000f, 0x0000, 0x0003, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0006, 0x10a2, 
+	0x0005, 0x18c3, 0x0004, 0x18e3, 0x0001, 0x2124, 0x0001, 0x7bef, 
+	0x0001, 0x630c, 0x0001, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x632c, 
+	0x0001, 0x73ae, 0x0001, 0x8410, 0x0003, 0x7bef, 0x0003, 0x8410, 
+	0x0002, 0x7bef, 0x0001, 0x8410, 0x0001, 0x7bcf, 0x0001, 0x6b4d, 
+	0x0001, 0x4208, 0x0001, 0x2104, 0x0001, 0x4a69, 0x0001, 0x7bef, 
+	0x0001, 0x39c7, 0x0005, 0x18e3, 0x0006, 0x18c3, 0x0005, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 
+	0x000f, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000e, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 0x0002, 0x1082, 
+	0x0005, 0x10a2, 0x0005, 0x18c3, 0x0006, 0x18e3, 0x0001, 0x2104, 
+	0x0001, 0x5acb, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0002, 0x7bef, 
+	0x000c, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x7bcf, 
+	0x0001, 0x7bef, 0x0001, 0x6b4d, 0x0002, 0x2104, 0x0006, 0x18e3, 
+	0x0005, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x000e, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000d, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0003, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 
+	0x0006, 0x18e3, 0x0002, 0x2104, 0x0001, 0x4a49, 0x0001, 0x73ae, 
+	0x0002, 0x7bef, 0x0010, 0x8410, 0x0002, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x528a, 0x0001, 0x2124, 0x0003, 0x2104, 0x0005, 0x18e3, 
+	0x0005, 0x18c3, 0x0004, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x000d, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000c, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 
+	0x0005, 0x18e3, 0x0003, 0x2104, 0x0001, 0x2965, 0x0001, 0x6b6d, 
+	0x0002, 0x7bef, 0x0015, 0x8410, 0x0001, 0x7bef, 0x0001, 0x738e, 
+	0x0001, 0x31a6, 0x0004, 0x2104, 0x0005, 0x18e3, 0x0004, 0x18c3, 
+	0x0005, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x000c, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000b, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 0x0004, 0x18e3, 
+	0x0004, 0x2104, 0x0001, 0x39e7, 0x0002, 0x7bef, 0x0018, 0x8410, 
+	0x0002, 0x7bef, 0x0001, 0x4a69, 0x0005, 0x2104, 0x0004, 0x18e3, 
+	0x0005, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x000b, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000a, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0004, 0x2104, 0x0001, 0x2124, 0x0001, 0x39e7, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x001a, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x4a69, 0x0002, 0x2124, 0x0004, 0x2104, 0x0004, 0x18e3, 
+	0x0004, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x000a, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000a, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0004, 0x18c3, 
+	0x0004, 0x18e3, 0x0004, 0x2104, 0x0001, 0x2124, 0x0001, 0x4228, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0010, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0003, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x528a, 0x0002, 0x2124, 0x0005, 0x2104, 0x0003, 0x18e3, 
+	0x0004, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0009, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0004, 0x18c3, 
+	0x0003, 0x18e3, 0x0004, 0x2104, 0x0002, 0x2124, 0x0001, 0x31a6, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x9492, 0x0001, 0xb5b6, 0x0001, 0x9cd3, 0x0001, 0x7bef, 
+	0x000e, 0x8410, 0x0001, 0x7bef, 0x0001, 0x9492, 0x0001, 0xb5b6, 
+	0x0001, 0x9cf3, 0x0001, 0x7bef, 0x0003, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x4208, 0x0004, 0x2124, 0x0003, 0x2104, 0x0004, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x0008, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0004, 0x18c3, 
+	0x0003, 0x18e3, 0x0003, 0x2104, 0x0004, 0x2124, 0x0001, 0x6b6d, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8c51, 
+	0x0001, 0xef7d, 0x0001, 0xffff, 0x0001, 0xf7be, 0x0001, 0x94b2, 
+	0x0001, 0x7bef, 0x000c, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8c71, 
+	0x0001, 0xef7d, 0x0001, 0xffff, 0x0001, 0xffdf, 0x0001, 0x94b2, 
+	0x0001, 0x7bef, 0x0003, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 
+	0x0001, 0x2965, 0x0001, 0x2945, 0x0004, 0x2124, 0x0002, 0x2104, 
+	0x0004, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0007, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 0x0004, 0x2124, 
+	0x0001, 0x5acb, 0x0001, 0x7bef, 0x0004, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x94b2, 0x0003, 0xffff, 0x0001, 0xad55, 0x0001, 0x7bcf, 
+	0x000c, 0x8410, 0x0001, 0x7bef, 0x0001, 0x94b2, 0x0003, 0xffff, 
+	0x0001, 0xa534, 0x0001, 0x7bcf, 0x0004, 0x8410, 0x0001, 0x7bcf, 
+	0x0001, 0x632c, 0x0002, 0x2945, 0x0004, 0x2124, 0x0002, 0x2104, 
+	0x0004, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0006, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 
+	0x0001, 0x2945, 0x0001, 0x2965, 0x0002, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0xce59, 0x0001, 0xffff, 0x0001, 0xd69a, 0x0010, 0x8410, 
+	0x0001, 0xc638, 0x0001, 0xffdf, 0x0001, 0xdedb, 0x0001, 0x8430, 
+	0x0001, 0x7bef, 0x0004, 0x8410, 0x0002, 0x7bef, 0x0001, 0x39e7, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0006, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0005, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x5acb, 0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8c71, 0x0001, 0x8410, 0x0001, 0x7bef, 0x000f, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8c71, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0005, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0x73ae, 0x0001, 0x7bef, 0x0008, 0x8410, 
+	0x0001, 0x7bef, 0x0012, 0x8410, 0x0001, 0x7bef, 0x0008, 0x8410, 
+	0x0002, 0x7bef, 0x0001, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 0x0001, 0x2965, 
+	0x0001, 0x4228, 0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x52aa, 0x0003, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 
+	0x0003, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0004, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0004, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0001, 0x630c, 
+	0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b4d, 
+	0x0001, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 
+	0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0004, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0003, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0003, 0x2965, 0x0001, 0x3186, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0003, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 
+	0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0003, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0003, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0026, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 0x0001, 0x73ae, 
+	0x0029, 0x7bef, 0x0001, 0x39e7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0002, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x5aeb, 0x0006, 0x6b4d, 0x0009, 0x6b6d, 0x000b, 0x738e, 
+	0x000a, 0x6b6d, 0x0004, 0x6b4d, 0x0001, 0x632c, 0x0001, 0x39c7, 
+	0x0003, 0x31a6, 0x0001, 0x3186, 0x0003, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0001, 0x39c7, 0x0001, 0x630c, 0x0001, 0x6b6d, 
+	0x0001, 0x6b4d, 0x0001, 0x5acb, 0x0001, 0x39c7, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x39e7, 0x0003, 0x4208, 
+	0x0003, 0x4228, 0x0003, 0x4a49, 0x0011, 0x4a69, 0x0004, 0x4a49, 
+	0x0002, 0x4228, 0x0003, 0x4208, 0x0003, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x52aa, 0x0002, 0x6b6d, 0x0001, 0x632c, 
+	0x0001, 0x4208, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0001, 0x4a69, 0x0006, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x31a6, 
+	0x0001, 0x39c7, 0x0001, 0x6b6d, 0x000e, 0x7bcf, 0x000e, 0x7bef, 
+	0x000c, 0x7bcf, 0x0001, 0x73ae, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0001, 0x4208, 0x0003, 0x7bef, 0x0001, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x5acb, 0x0001, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0003, 0x2104, 0x0001, 0x2124, 0x0001, 0x39e7, 0x0002, 0x7bef, 
+	0x0004, 0x8410, 0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0001, 0x39e7, 
+	0x0001, 0x39c7, 0x0001, 0x73ae, 0x0001, 0x7bef, 0x0026, 0x8410, 
+	0x0002, 0x7bef, 0x0001, 0x4208, 0x0001, 0x39e7, 0x0002, 0x7bcf, 
+	0x0004, 0x8410, 0x0002, 0x7bef, 0x0001, 0x528a, 0x0001, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0001, 0x630c, 0x0001, 0x7bcf, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x5aeb, 0x0001, 0x39e7, 0x0001, 0x73ae, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x4208, 0x0001, 0x528a, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b6d, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x738e, 0x0001, 0x39e7, 0x0001, 0x73ae, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x4208, 0x0001, 0x632c, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0001, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0001, 0x2945, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x738e, 0x0001, 0x39e7, 0x0001, 0x73ae, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x4208, 0x0001, 0x632c, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0002, 0x7bef, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0001, 0x2945, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4208, 0x0001, 0x73ae, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4228, 0x0001, 0x6b4d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0002, 0x7bef, 0x0001, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4208, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4228, 
+	0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0002, 0x7bef, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4228, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4228, 0x0001, 0x6b4d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0002, 0x7bef, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4228, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x6b4d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x73ae, 
+	0x0001, 0x4228, 0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x4a49, 0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 0x0003, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4228, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x6b6d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4a49, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a69, 0x0001, 0x6b6d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0002, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0841, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4a49, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a69, 0x0001, 0x6b6d, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a49, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x4a69, 
+	0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0001, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x4a49, 0x0001, 0x7bcf, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x4a69, 0x0001, 0x6b6d, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0001, 0x7bcf, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x528a, 0x0001, 0x738e, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x4a69, 0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x528a, 0x0001, 0x738e, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0002, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0001, 0x7bcf, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x528a, 0x0001, 0x738e, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0001, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x6b6d, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x738e, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 
+	0x0001, 0x630c, 0x0001, 0x7bef, 0x0006, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x73ae, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x4a69, 
+	0x0002, 0x7bef, 0x0004, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x0001, 0x7bcf, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x4a69, 0x0001, 0x8410, 
+	0x0001, 0x7bcf, 0x0005, 0x8410, 0x0001, 0x7bef, 0x0001, 0x5aeb, 
+	0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0001, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x630c, 0x0002, 0x7bef, 0x0002, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x632c, 0x0001, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x7bcf, 
+	0x0029, 0x8410, 0x0001, 0x52aa, 0x0001, 0x4a69, 0x0001, 0x5aeb, 
+	0x0001, 0x8410, 0x0002, 0x7bef, 0x0001, 0x8410, 0x0002, 0x7bef, 
+	0x0001, 0x6b6d, 0x0001, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0001, 0x31a6, 0x0001, 0x4a69, 0x0003, 0x7bcf, 
+	0x0001, 0x6b6d, 0x0001, 0x4a69, 0x0001, 0x4228, 0x0002, 0x4a49, 
+	0x0001, 0x7bef, 0x0029, 0x8410, 0x0001, 0x52aa, 0x0001, 0x4a69, 
+	0x0001, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x6b4d, 0x0003, 0x7bcf, 
+	0x0001, 0x5aeb, 0x0001, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0841, 
+	0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0002, 0x39e7, 
+	0x0002, 0x4208, 0x0001, 0x4228, 0x0002, 0x4a49, 0x0001, 0x7bcf, 
+	0x0028, 0x8410, 0x0001, 0x7bef, 0x0001, 0x528a, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x39e7, 0x0002, 0x4208, 
+	0x0002, 0x4228, 0x0001, 0x4a49, 0x0001, 0x7bcf, 0x0028, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x528a, 0x0002, 0x4a49, 0x0002, 0x4228, 
+	0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0881, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0002, 0x39c7, 0x0002, 0x39e7, 0x0001, 0x4208, 0x0002, 0x4228, 
+	0x0001, 0x4a49, 0x0001, 0x7bcf, 0x0029, 0x8410, 0x0001, 0x528a, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0002, 0x39e7, 
+	0x0002, 0x4208, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0026, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x4a69, 0x0001, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 
+	0x0002, 0x39e7, 0x0001, 0x4208, 0x0002, 0x4228, 0x0001, 0x6b4d, 
+	0x0002, 0x7bef, 0x0025, 0x8410, 0x0001, 0x7bcf, 0x0001, 0x73ae, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 0x0002, 0x39c7, 
+	0x0002, 0x39e7, 0x0002, 0x4208, 0x0002, 0x4228, 0x0001, 0x738e, 
+	0x0002, 0x7bef, 0x0023, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0003, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0881, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x39e7, 0x0002, 0x4208, 
+	0x0002, 0x4228, 0x0001, 0x4a49, 0x0001, 0x6b4d, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0003, 0x7bef, 0x000a, 0x8410, 0x0006, 0x7bef, 
+	0x000a, 0x8410, 0x0005, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0841, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 0x0002, 0x39c7, 
+	0x0002, 0x39e7, 0x0002, 0x4208, 0x0002, 0x4228, 0x0001, 0x4a49, 
+	0x0001, 0x4a69, 0x0001, 0x5aeb, 0x0001, 0x6b6d, 0x0001, 0x738e, 
+	0x0001, 0x6b6d, 0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0002, 0x7bcf, 0x0003, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0002, 0x7bef, 0x0003, 0x738e, 0x0001, 0x632c, 0x0001, 0x528a, 
+	0x0001, 0x4a69, 0x0002, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0881, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0001, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x39e7, 
+	0x0002, 0x4208, 0x0002, 0x4228, 0x0002, 0x4a49, 0x0003, 0x4a69, 
+	0x0001, 0x528a, 0x0001, 0x632c, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x630c, 0x0005, 0x5aeb, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x6b6d, 
+	0x0001, 0x52aa, 0x0002, 0x528a, 0x0002, 0x4a69, 0x0002, 0x4a49, 
+	0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0881, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0001, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0002, 0x39c7, 0x0001, 0x39e7, 0x0002, 0x4208, 0x0002, 0x4228, 
+	0x0002, 0x4a49, 0x0003, 0x4a69, 0x0001, 0x632c, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0006, 0x5aeb, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x6b6d, 0x0002, 0x528a, 
+	0x0002, 0x4a69, 0x0003, 0x4a49, 0x0002, 0x4228, 0x0001, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x0881, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x39e7, 
+	0x0002, 0x4208, 0x0002, 0x4228, 0x0002, 0x4a49, 0x0002, 0x4a69, 
+	0x0001, 0x630c, 0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 
+	0x0001, 0x5aeb, 0x0005, 0x5acb, 0x0001, 0x8410, 0x0001, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x6b6d, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0003, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x0881, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x39e7, 0x0002, 0x4208, 
+	0x0002, 0x4228, 0x0003, 0x4a49, 0x0001, 0x630c, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0006, 0x5acb, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x6b4d, 0x0002, 0x4a69, 
+	0x0003, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x39e7, 
+	0x0002, 0x4208, 0x0002, 0x4228, 0x0002, 0x4a49, 0x0001, 0x630c, 
+	0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x5acb, 
+	0x0005, 0x52aa, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0007, 0x8410, 
+	0x0001, 0x6b4d, 0x0001, 0x4a69, 0x0002, 0x4a49, 0x0003, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0002, 0x39c7, 0x0003, 0x39e7, 0x0002, 0x4208, 0x0002, 0x4228, 
+	0x0001, 0x4a49, 0x0001, 0x5aeb, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x52aa, 0x0005, 0x528a, 0x0001, 0x8410, 
+	0x0001, 0x7bef, 0x0007, 0x8410, 0x0001, 0x6b4d, 0x0002, 0x4a49, 
+	0x0003, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 
+	0x0003, 0x31a6, 0x0001, 0x3186, 0x0003, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0002, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 0x0003, 0x39e7, 
+	0x0002, 0x4208, 0x0002, 0x4228, 0x0001, 0x5aeb, 0x0007, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x8410, 0x0006, 0x528a, 0x0002, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x632c, 0x0001, 0x4a49, 0x0003, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0003, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0001, 0x0020, 0x0002, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0002, 0x39c7, 0x0003, 0x39e7, 0x0003, 0x4208, 0x0001, 0x5aeb, 
+	0x0007, 0x8410, 0x0001, 0x7bef, 0x0001, 0x8410, 0x0001, 0x528a, 
+	0x0005, 0x4a69, 0x0002, 0x7bef, 0x0007, 0x8410, 0x0001, 0x632c, 
+	0x0002, 0x4228, 0x0003, 0x4208, 0x0002, 0x39e7, 0x0003, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0003, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 0x0003, 0x39e7, 
+	0x0001, 0x4208, 0x0001, 0x5aeb, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x4a69, 0x0005, 0x4a49, 0x0002, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x632c, 0x0001, 0x4228, 0x0003, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0003, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0001, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0003, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 
+	0x0003, 0x39e7, 0x0001, 0x5acb, 0x0007, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x4a69, 0x0005, 0x4a49, 0x0002, 0x7bef, 
+	0x0007, 0x8410, 0x0001, 0x632c, 0x0002, 0x4208, 0x0003, 0x39e7, 
+	0x0002, 0x39c7, 0x0003, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0003, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0004, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0003, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0004, 0x39c7, 
+	0x0001, 0x39e7, 0x0001, 0x5acb, 0x0001, 0x7bef, 0x0006, 0x8410, 
+	0x0002, 0x7bef, 0x0006, 0x4228, 0x0001, 0x7bcf, 0x0001, 0x7bef, 
+	0x0006, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b4d, 0x0003, 0x39e7, 
+	0x0003, 0x39c7, 0x0003, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0001, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0003, 0x2965, 0x0003, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 
+	0x0001, 0x39e7, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0005, 0x8410, 
+	0x0001, 0x7bcf, 0x0001, 0x6b4d, 0x0001, 0x4208, 0x0005, 0x4228, 
+	0x0001, 0x5aeb, 0x0001, 0x7bef, 0x0005, 0x8410, 0x0001, 0x7bef, 
+	0x0001, 0x8410, 0x0001, 0x4228, 0x0001, 0x39e7, 0x0003, 0x39c7, 
+	0x0003, 0x31a6, 0x0003, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0005, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0003, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x4a49, 
+	0x0001, 0x7bcf, 0x0005, 0x7bef, 0x0001, 0x7bcf, 0x0008, 0x4208, 
+	0x0001, 0x6b6d, 0x0006, 0x7bef, 0x0001, 0x5acb, 0x0004, 0x39c7, 
+	0x0003, 0x31a6, 0x0002, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0005, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 0x0002, 0x2965, 
+	0x0004, 0x3186, 0x0003, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x4208, 
+	0x0001, 0x6b4d, 0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x5aeb, 0x000a, 0x39e7, 0x0001, 0x52aa, 0x0001, 0x7bcf, 
+	0x0002, 0x7bef, 0x0001, 0x6b6d, 0x0001, 0x4a49, 0x0003, 0x39c7, 
+	0x0003, 0x31a6, 0x0003, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10c2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0006, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 0x0003, 0x2965, 
+	0x0004, 0x3186, 0x0003, 0x31a6, 0x0009, 0x39c7, 0x0003, 0x39e7, 
+	0x0009, 0x39c7, 0x0004, 0x31a6, 0x0003, 0x3186, 0x0004, 0x2965, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0006, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0007, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0004, 0x2965, 0x0004, 0x3186, 0x0005, 0x31a6, 0x000e, 0x39c7, 
+	0x0005, 0x31a6, 0x0004, 0x3186, 0x0003, 0x2965, 0x0004, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0004, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0007, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10c2, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0008, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 
+	0x0003, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 0x0004, 0x2965, 
+	0x0005, 0x3186, 0x0012, 0x31a6, 0x0005, 0x3186, 0x0003, 0x2965, 
+	0x0004, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0004, 0x2945, 
+	0x0005, 0x2965, 0x0006, 0x3186, 0x000a, 0x31a6, 0x0006, 0x3186, 
+	0x0004, 0x2965, 0x0005, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0009, 0x0000, 0x0003, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 0x0004, 0x2124, 
+	0x0004, 0x2945, 0x0005, 0x2965, 0x0011, 0x3186, 0x0005, 0x2965, 
+	0x0005, 0x2945, 0x0004, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000a, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0005, 0x10a2, 0x0003, 0x18c3, 
+	0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x4a49, 0x0004, 0x2104, 
+	0x0004, 0x2124, 0x0005, 0x2945, 0x0001, 0x4228, 0x0001, 0x52aa, 
+	0x000a, 0x2965, 0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x31a6, 
+	0x0004, 0x2965, 0x0001, 0x52aa, 0x0001, 0x4228, 0x0005, 0x2945, 
+	0x0001, 0x4a69, 0x0003, 0x632c, 0x0001, 0x5acb, 0x0001, 0x31a6, 
+	0x0002, 0x2104, 0x0001, 0x39c7, 0x0001, 0x630c, 0x0002, 0x632c, 
+	0x0001, 0x4a69, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0002, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x000a, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000b, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0001, 0x39e7, 0x0002, 0x630c, 0x0001, 0x2104, 
+	0x0001, 0x18e3, 0x0004, 0x2104, 0x0004, 0x2124, 0x0003, 0x2945, 
+	0x0001, 0x4228, 0x0001, 0x52aa, 0x0002, 0x2945, 0x000d, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x52aa, 0x0001, 0x4228, 0x0004, 0x2945, 
+	0x0002, 0x5acb, 0x0001, 0x3186, 0x0001, 0x2124, 0x0001, 0x2104, 
+	0x0001, 0x4a49, 0x0001, 0x632c, 0x0001, 0x2965, 0x0001, 0x2945, 
+	0x0001, 0x632c, 0x0001, 0x3186, 0x0001, 0x18c3, 0x0001, 0x2124, 
+	0x0001, 0x52aa, 0x0001, 0x4228, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0002, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x000b, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10c2, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000c, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 
+	0x0001, 0x18c3, 0x0001, 0x52aa, 0x0001, 0x39e7, 0x0001, 0x5aeb, 
+	0x0001, 0x39c7, 0x0002, 0x18e3, 0x0001, 0x632c, 0x0001, 0x52aa, 
+	0x0002, 0x632c, 0x0001, 0x4a49, 0x0002, 0x2124, 0x0001, 0x52aa, 
+	0x0002, 0x632c, 0x0002, 0x52aa, 0x0001, 0x2945, 0x0001, 0x632c, 
+	0x0001, 0x5aeb, 0x0001, 0x4a69, 0x0001, 0x2945, 0x0001, 0x528a, 
+	0x0002, 0x632c, 0x0001, 0x52aa, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0002, 0x3186, 0x0001, 0x5acb, 0x0001, 0x632c, 
+	0x0002, 0x5aeb, 0x0001, 0x4228, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0001, 0x39c7, 0x0001, 0x630c, 0x0001, 0x2945, 0x0004, 0x2104, 
+	0x0001, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x3186, 0x0001, 0x630c, 
+	0x0003, 0x18c3, 0x0001, 0x31a6, 0x0001, 0x5acb, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x000c, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x10c2, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000d, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0001, 0x2124, 0x0001, 0x632c, 0x0001, 0x2104, 
+	0x0001, 0x39e7, 0x0001, 0x528a, 0x0002, 0x18e3, 0x0001, 0x632c, 
+	0x0001, 0x5acb, 0x0001, 0x2124, 0x0001, 0x4208, 0x0001, 0x632c, 
+	0x0001, 0x2124, 0x0001, 0x4208, 0x0001, 0x5aeb, 0x0002, 0x2965, 
+	0x0001, 0x5aeb, 0x0001, 0x52aa, 0x0001, 0x2124, 0x0001, 0x632c, 
+	0x0001, 0x528a, 0x0001, 0x2945, 0x0001, 0x4228, 0x0001, 0x5aeb, 
+	0x0001, 0x3186, 0x0001, 0x2945, 0x0001, 0x52aa, 0x0001, 0x4a69, 
+	0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x3186, 0x0002, 0x52aa, 
+	0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x632c, 0x0001, 0x4228, 
+	0x0003, 0x2124, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0003, 0x2104, 
+	0x0002, 0x18e3, 0x0001, 0x31a6, 0x0001, 0x52aa, 0x0001, 0x2104, 
+	0x0001, 0x5aeb, 0x0001, 0x632c, 0x0002, 0x4228, 0x0001, 0x2965, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x000d, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x10c2, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000e, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0002, 0x10a2, 0x0001, 0x4208, 0x0001, 0x528a, 
+	0x0001, 0x10a2, 0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x2124, 
+	0x0001, 0x18c3, 0x0001, 0x632c, 0x0001, 0x39e7, 0x0001, 0x18e3, 
+	0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x52aa, 
+	0x0001, 0x4208, 0x0002, 0x2104, 0x0001, 0x4228, 0x0001, 0x52aa, 
+	0x0001, 0x2124, 0x0001, 0x632c, 0x0001, 0x39e7, 0x0001, 0x2124, 
+	0x0001, 0x52aa, 0x0001, 0x4228, 0x0002, 0x2124, 0x0001, 0x39c7, 
+	0x0001, 0x5aeb, 0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0001, 0x632c, 0x0001, 0x31a6, 0x0002, 0x2124, 0x0001, 0x5acb, 
+	0x0001, 0x4208, 0x0001, 0x2124, 0x0002, 0x2104, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x2104, 0x0004, 0x18e3, 0x0001, 0x39c7, 
+	0x0001, 0x52aa, 0x0002, 0x18c3, 0x0001, 0x2965, 0x0001, 0x4228, 
+	0x0001, 0x4a69, 0x0001, 0x632c, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x000e, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x18e3, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000f, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 
+	0x0001, 0x630c, 0x0004, 0x632c, 0x0001, 0x39e7, 0x0001, 0x18c3, 
+	0x0001, 0x632c, 0x0001, 0x39c7, 0x0001, 0x18e3, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x528a, 0x0001, 0x4208, 
+	0x0002, 0x2104, 0x0001, 0x4228, 0x0001, 0x52aa, 0x0001, 0x2104, 
+	0x0001, 0x632c, 0x0001, 0x39e7, 0x0001, 0x2124, 0x0001, 0x52aa, 
+	0x0001, 0x4208, 0x0002, 0x2124, 0x0001, 0x39c7, 0x0001, 0x5aeb, 
+	0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x2965, 0x0001, 0x632c, 
+	0x0001, 0x31a6, 0x0002, 0x2104, 0x0001, 0x5acb, 0x0001, 0x4208, 
+	0x0003, 0x2104, 0x0001, 0x31a6, 0x0001, 0x5aeb, 0x0004, 0x18e3, 
+	0x0001, 0x18c3, 0x0001, 0x4a69, 0x0001, 0x4208, 0x0001, 0x39e7, 
+	0x0001, 0x52aa, 0x0003, 0x10a2, 0x0001, 0x2124, 0x0001, 0x632c, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x000f, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x18e3, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0010, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 0x0001, 0x2965, 
+	0x0001, 0x630c, 0x0003, 0x10a2, 0x0001, 0x39e7, 0x0001, 0x52aa, 
+	0x0001, 0x18c3, 0x0001, 0x632c, 0x0001, 0x39c7, 0x0001, 0x18c3, 
+	0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x2124, 0x0001, 0x39e7, 
+	0x0001, 0x5aeb, 0x0002, 0x2945, 0x0001, 0x5aeb, 0x0001, 0x528a, 
+	0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x39e7, 0x0001, 0x2104, 
+	0x0001, 0x4208, 0x0001, 0x5aeb, 0x0001, 0x2124, 0x0001, 0x2104, 
+	0x0001, 0x5acb, 0x0001, 0x4a49, 0x0001, 0x2945, 0x0001, 0x632c, 
+	0x0001, 0x2945, 0x0002, 0x52aa, 0x0001, 0x2104, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x4208, 0x0004, 0x18e3, 0x0002, 0x52aa, 
+	0x0001, 0x2124, 0x0002, 0x18c3, 0x0001, 0x4a69, 0x0001, 0x630c, 
+	0x0002, 0x2104, 0x0001, 0x632c, 0x0001, 0x39c7, 0x0002, 0x10a2, 
+	0x0001, 0x4228, 0x0001, 0x630c, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0010, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x18c3, 
+	0x0011, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x1082, 0x0002, 0x10a2, 0x0001, 0x18c3, 
+	0x0001, 0x632c, 0x0001, 0x2124, 0x0001, 0x632c, 0x0001, 0x31a6, 
+	0x0001, 0x18c3, 0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x2124, 
+	0x0001, 0x18e3, 0x0001, 0x528a, 0x0001, 0x632c, 0x0001, 0x630c, 
+	0x0002, 0x528a, 0x0001, 0x18e3, 0x0001, 0x632c, 0x0001, 0x39c7, 
+	0x0001, 0x18e3, 0x0001, 0x2104, 0x0001, 0x528a, 0x0002, 0x632c, 
+	0x0001, 0x528a, 0x0001, 0x2124, 0x0001, 0x2945, 0x0001, 0x632c, 
+	0x0002, 0x2945, 0x0001, 0x5acb, 0x0001, 0x632c, 0x0001, 0x5acb, 
+	0x0001, 0x5aeb, 0x0001, 0x4208, 0x0004, 0x18e3, 0x0001, 0x2104, 
+	0x0001, 0x4a49, 0x0003, 0x632c, 0x0001, 0x528a, 0x0001, 0x2104, 
+	0x0002, 0x10a2, 0x0001, 0x31a6, 0x0001, 0x5acb, 0x0002, 0x632c, 
+	0x0001, 0x52aa, 0x0001, 0x18e3, 0x0001, 0x0841, 0x0003, 0x0020, 
+	0x0011, 0x0000, 0x0002, 0x4a49, 0x0001, 0x18c3, 0x0001, 0x2965, 
+	0x0001, 0x4a49, 0x0001, 0x2124, 0x0013, 0x0000, 0x0003, 0x0020, 
+	0x0001, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 0x0006, 0x10a2, 
+	0x0007, 0x18c3, 0x0017, 0x18e3, 0x0007, 0x18c3, 0x0006, 0x10a2, 
+	0x0001, 0x1082, 0x0002, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x0012, 0x0000, 0x0001, 0x1082, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x18c3, 0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0014, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0002, 0x0861, 
+	0x0001, 0x1082, 0x0007, 0x10a2, 0x000a, 0x18c3, 0x000b, 0x18e3, 
+	0x000a, 0x18c3, 0x0007, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0013, 0x0000, 0x0001, 0x2124, 
+	0x0001, 0x4a49, 0x0001, 0x3186, 0x0002, 0x18c3, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0014, 0x0000, 0x0003, 0x0020, 
+	0x0003, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 0x0008, 0x10a2, 
+	0x0019, 0x18c3, 0x0008, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0003, 0x0841, 0x0003, 0x0020, 0x0014, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x2124, 0x0002, 0x18c3, 0x0001, 0x3186, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0016, 0x0000, 0x0003, 0x0020, 
+	0x0003, 0x0841, 0x0002, 0x0861, 0x0002, 0x1082, 0x0009, 0x10a2, 
+	0x0011, 0x18c3, 0x0009, 0x10a2, 0x0002, 0x1082, 0x0002, 0x0861, 
+	0x0003, 0x0841, 0x0003, 0x0020, 0x0015, 0x0000, 0x0001, 0x2124, 
+	0x0001, 0x4a49, 0x0001, 0x39c7, 0x0004, 0x18c3, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x2945, 0x0017, 0x0000, 0x0003, 0x0020, 
+	0x0003, 0x0841, 0x0002, 0x0861, 0x0003, 0x1082, 0x001d, 0x10a2, 
+	0x0003, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 
+	0x0016, 0x0000, 0x0001, 0x1082, 0x0002, 0x4a49, 0x0001, 0x2124, 
+	0x0004, 0x18c3, 0x0001, 0x2104, 0x0002, 0x4a49, 0x0001, 0x2104, 
+	0x0018, 0x0000, 0x0004, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 
+	0x0003, 0x1082, 0x0017, 0x10a2, 0x0003, 0x1082, 0x0003, 0x0861, 
+	0x0002, 0x0841, 0x0004, 0x0020, 0x0017, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x31a6, 0x0006, 0x18c3, 
+	0x0001, 0x2945, 0x0002, 0x4a49, 0x0001, 0x2945, 0x0019, 0x0000, 
+	0x0004, 0x0020, 0x0004, 0x0841, 0x0003, 0x0861, 0x0006, 0x1082, 
+	0x0009, 0x10a2, 0x0006, 0x1082, 0x0003, 0x0861, 0x0004, 0x0841, 
+	0x0004, 0x0020, 0x0018, 0x0000, 0x0001, 0x18c3, 0x0001, 0x4228, 
+	0x0001, 0x4a49, 0x0001, 0x39c7, 0x0004, 0x18c3, 0x0004, 0x18e3, 
+	0x0001, 0x2945, 0x0002, 0x4a49, 0x0001, 0x4208, 0x0001, 0x18e3, 
+	0x0001, 0x0020, 0x0018, 0x0000, 0x0005, 0x0020, 0x0005, 0x0841, 
+	0x0007, 0x0861, 0x0005, 0x1082, 0x0007, 0x0861, 0x0005, 0x0841, 
+	0x0005, 0x0020, 0x0018, 0x0000, 0x0001, 0x10a2, 0x0001, 0x39c7, 
+	0x0002, 0x4a49, 0x0001, 0x31c6, 0x000a, 0x18e3, 0x0001, 0x2124, 
+	0x0001, 0x39e7, 0x0003, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x2965, 
+	0x0001, 0x2124, 0x0018, 0x18e3, 0x000b, 0x2104, 0x000b, 0x2124, 
+	0x000b, 0x2104, 0x0017, 0x18e3, 0x0001, 0x2104, 0x0001, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x4228, 0x0002, 0x4a49, 0x0001, 0x4208, 
+	0x0001, 0x2965, 0x000d, 0x18e3, 0x0001, 0x2965, 0x0001, 0x39c7, 
+	0x0001, 0x4228, 0x0057, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x3186, 
+	0x0012, 0x18e3, 0x0001, 0x2144, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0051, 0x31a6, 0x0001, 0x2965, 0x0001, 0x2945, 0x0001, 0x1903, 
+	0x000a, 0x18e3, 
+};
+
+const FramebufferImage rawAndroidOSSelected = {107, 107, RGB565, TRUE, dataAndroidOSSelectedRaw, 8234};
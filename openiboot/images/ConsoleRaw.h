@@ -0,0 +1,464 @@
+// generated by png2raw from Console.png
+
+const uint16_t dataConsoleRaw[] = {
+	0x031f, 0x0000, 0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x0020, 
+	0x0062, 0x0000, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x005c, 0x0000, 0x0002, 0x1082, 0x0001, 0x0000, 0x0001, 0x2124, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x31a6, 0x0001, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x39e7, 0x0002, 0x0000, 0x0001, 0x31a6, 
+	0x0001, 0x0020, 0x0001, 0x0000, 0x0002, 0x0861, 0x0056, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x10a2, 0x0001, 0x0000, 0x0001, 0x31a6, 
+	0x0001, 0x0861, 0x0001, 0x10a2, 0x0001, 0x4208, 0x0001, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x31a6, 0x0001, 0x0000, 0x0001, 0x4a49, 
+	0x0001, 0x2124, 0x0001, 0x0000, 0x0001, 0x39e7, 0x0001, 0x3186, 
+	0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0x39c7, 0x0001, 0x0020, 
+	0x0001, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 0x0051, 0x0000, 
+	0x0001, 0x18e3, 0x0001, 0x0000, 0x0001, 0x2124, 0x0001, 0x2945, 
+	0x0001, 0x0020, 0x0001, 0x52aa, 0x0001, 0x0000, 0x0001, 0x4228, 
+	0x0001, 0x39e7, 0x0001, 0x0861, 0x0001, 0x632c, 0x0001, 0x1082, 
+	0x0001, 0x2945, 0x0001, 0x630c, 0x0001, 0x0000, 0x0001, 0x2945, 
+	0x0001, 0x630c, 0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x5acb, 
+	0x0001, 0x18c3, 0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0x39e7, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x0020, 0x004b, 0x0000, 
+	0x0002, 0x0841, 0x0001, 0x0000, 0x0001, 0x4208, 0x0001, 0x0000, 
+	0x0001, 0x4a49, 0x0002, 0x2945, 0x0001, 0x5acb, 0x0001, 0x10a2, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x4a49, 0x0001, 0x5aeb, 
+	0x0001, 0x10a2, 0x0001, 0x632c, 0x0001, 0x39c7, 0x0001, 0x10a2, 
+	0x0001, 0x6b4d, 0x0001, 0x39c7, 0x0001, 0x0020, 0x0001, 0x5acb, 
+	0x0001, 0x4a49, 0x0001, 0x0000, 0x0001, 0x10a2, 0x0001, 0x5acb, 
+	0x0001, 0x10a2, 0x0002, 0x0000, 0x0001, 0x2124, 0x0001, 0x1082, 
+	0x0049, 0x0000, 0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x18e3, 0x0001, 0x0841, 0x0001, 0x5acb, 0x0001, 0x0861, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0002, 0x528a, 0x0001, 0x4208, 
+	0x0001, 0x6b4d, 0x0001, 0x39e7, 0x0001, 0x6b4d, 0x0002, 0x4a49, 
+	0x0001, 0x6b4d, 0x0001, 0x2965, 0x0001, 0x5aeb, 0x0001, 0x632c, 
+	0x0001, 0x10a2, 0x0001, 0x528a, 0x0001, 0x6b4d, 0x0001, 0x0841, 
+	0x0001, 0x10a2, 0x0001, 0x632c, 0x0001, 0x39c7, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x3186, 0x004a, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x0000, 0x0001, 0x39c7, 0x0001, 0x31a6, 
+	0x0001, 0x2104, 0x0001, 0x6b4d, 0x0001, 0x3186, 0x0001, 0x6b6d, 
+	0x0001, 0x4a69, 0x0001, 0x6b6d, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0x6b4d, 0x0001, 0x632c, 0x0001, 0x6b6d, 0x0001, 0x632c, 
+	0x0001, 0x6b6d, 0x0001, 0x632c, 0x0001, 0x5acb, 0x0001, 0x6b6d, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x0001, 0x6b6d, 0x0001, 0x39c7, 
+	0x0001, 0x18e3, 0x0001, 0x6b4d, 0x0001, 0x5aeb, 0x0001, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x5acb, 0x0001, 0x4a69, 0x0003, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x0861, 0x0044, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x0000, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x4a69, 
+	0x0001, 0x528a, 0x0001, 0x4228, 0x0001, 0x738e, 0x0001, 0x630c, 
+	0x000d, 0x738e, 0x0001, 0x6b4d, 0x0001, 0x738e, 0x0001, 0x630c, 
+	0x0001, 0x3186, 0x0002, 0x6b6d, 0x0001, 0x10a2, 0x0001, 0x2104, 
+	0x0001, 0x6b4d, 0x0001, 0x630c, 0x0001, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x528a, 0x0001, 0x2124, 0x0045, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x0020, 0x0001, 0x5aeb, 0x0001, 0x39e7, 
+	0x0001, 0x5aeb, 0x0001, 0x6b6d, 0x0001, 0x6b4d, 0x0011, 0x738e, 
+	0x0001, 0x6b4d, 0x0002, 0x738e, 0x0001, 0x4228, 0x0001, 0x39c7, 
+	0x0001, 0x738e, 0x0001, 0x6b6d, 0x0001, 0x0861, 0x0001, 0x0020, 
+	0x0001, 0x39c7, 0x0001, 0x6b6d, 0x0001, 0x2965, 0x0003, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x0020, 0x003f, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x0000, 0x0001, 0x5aeb, 0x0001, 0x2945, 0x0001, 0x630c, 
+	0x0001, 0x6b4d, 0x0001, 0x6b6d, 0x0006, 0x73ae, 0x0001, 0x738e, 
+	0x0001, 0x6b6d, 0x0001, 0x6b4d, 0x0001, 0x6b6d, 0x0001, 0x738e, 
+	0x000a, 0x73ae, 0x0001, 0x738e, 0x0001, 0x630c, 0x0002, 0x73ae, 
+	0x0001, 0x2124, 0x0001, 0x18c3, 0x0001, 0x5aeb, 0x0001, 0x73ae, 
+	0x0001, 0x3186, 0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x2104, 0x0040, 0x0000, 0x0001, 0x528a, 0x0001, 0x1082, 
+	0x0001, 0x630c, 0x0001, 0x632c, 0x0001, 0x6b6d, 0x0004, 0x73ae, 
+	0x0001, 0x632c, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0001, 0x18c3, 
+	0x0001, 0x0861, 0x0003, 0x0841, 0x0001, 0x0861, 0x0001, 0x18e3, 
+	0x0001, 0x31a6, 0x0001, 0x52aa, 0x0001, 0x738e, 0x0009, 0x73ae, 
+	0x0001, 0x4a69, 0x0001, 0x4208, 0x0002, 0x73ae, 0x0001, 0x39c7, 
+	0x0001, 0x0000, 0x0001, 0x0841, 0x0001, 0x4228, 0x0001, 0x6b4d, 
+	0x0001, 0x2124, 0x003f, 0x0000, 0x0001, 0x2124, 0x0001, 0x0000, 
+	0x0001, 0x5acb, 0x0001, 0x528a, 0x0001, 0x630c, 0x0003, 0x7bcf, 
+	0x0001, 0x738e, 0x0001, 0x4a49, 0x0001, 0x18e3, 0x0001, 0x0020, 
+	0x000b, 0x0000, 0x0001, 0x1082, 0x0001, 0x39e7, 0x0001, 0x738e, 
+	0x0006, 0x7bcf, 0x0001, 0x73ae, 0x0001, 0x6b6d, 0x0002, 0x7bcf, 
+	0x0001, 0x39e7, 0x0001, 0x0020, 0x0001, 0x39e7, 0x0002, 0x738e, 
+	0x0001, 0x18c3, 0x0003, 0x0000, 0x0002, 0x0841, 0x003b, 0x0000, 
+	0x0001, 0x4a69, 0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x7bcf, 
+	0x0001, 0x73ae, 0x0002, 0x7bcf, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0004, 0x0000, 0x0001, 0x0020, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0001, 0x18e3, 0x0002, 0x1082, 0x0001, 0x0020, 0x0005, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x52aa, 0x0008, 0x7bcf, 0x0001, 0x4a69, 
+	0x0001, 0x31a6, 0x0001, 0x6b6d, 0x0001, 0x7bcf, 0x0001, 0x6b4d, 
+	0x0001, 0x1082, 0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x4228, 
+	0x0001, 0x31a6, 0x0001, 0x0841, 0x0039, 0x0000, 0x0001, 0x2124, 
+	0x0001, 0x0861, 0x0001, 0x39c7, 0x0001, 0x73ae, 0x0001, 0x632c, 
+	0x0002, 0x7bef, 0x0001, 0x6b4d, 0x0001, 0x2124, 0x0003, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x2104, 0x0001, 0x31a6, 0x0001, 0x52aa, 
+	0x0001, 0x5aeb, 0x0003, 0x632c, 0x0001, 0x4a69, 0x0001, 0x528a, 
+	0x0001, 0x2104, 0x0001, 0x2965, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0003, 0x0000, 0x0001, 0x39e7, 0x0006, 0x7bef, 0x0001, 0x7bcf, 
+	0x0001, 0x6b6d, 0x0002, 0x7bef, 0x0001, 0x630c, 0x0001, 0x0841, 
+	0x0001, 0x0000, 0x0001, 0x2945, 0x0001, 0x52aa, 0x0001, 0x738e, 
+	0x0001, 0x39c7, 0x003b, 0x0000, 0x0001, 0x3186, 0x0001, 0x630c, 
+	0x0001, 0x31a6, 0x0003, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x0841, 
+	0x0002, 0x0000, 0x0001, 0x0020, 0x0001, 0x2965, 0x0001, 0x632c, 
+	0x0001, 0x73ae, 0x0007, 0x7bef, 0x0002, 0x7bcf, 0x0001, 0x52aa, 
+	0x0001, 0x4a69, 0x0001, 0x1082, 0x0001, 0x0020, 0x0003, 0x0000, 
+	0x0001, 0x3186, 0x0008, 0x7bef, 0x0001, 0x5aeb, 0x0001, 0x18e3, 
+	0x0001, 0x39c7, 0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0001, 0x738e, 
+	0x0001, 0x2104, 0x003a, 0x0000, 0x0001, 0x10a2, 0x0001, 0x2965, 
+	0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x73ae, 0x0002, 0x8410, 
+	0x0001, 0x4208, 0x0003, 0x0000, 0x0001, 0x2124, 0x0001, 0x5aeb, 
+	0x000d, 0x8410, 0x0001, 0x73ae, 0x0001, 0x4a49, 0x0001, 0x4208, 
+	0x0004, 0x0000, 0x0001, 0x31a6, 0x0006, 0x8410, 0x0001, 0x7bcf, 
+	0x0001, 0x5aeb, 0x0001, 0x7bcf, 0x0002, 0x8410, 0x0001, 0x5acb, 
+	0x0001, 0x0841, 0x0003, 0x0000, 0x0001, 0x10a2, 0x0001, 0x2945, 
+	0x0001, 0x1082, 0x0036, 0x0000, 0x0001, 0x738e, 0x0001, 0x4a49, 
+	0x0001, 0x738e, 0x0002, 0x8410, 0x0001, 0x39c7, 0x0002, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x528a, 0x0001, 0x7bcf, 0x0010, 0x8410, 
+	0x0002, 0x4a69, 0x0001, 0x10a2, 0x0003, 0x0000, 0x0001, 0x4a49, 
+	0x0008, 0x8410, 0x0001, 0x7bef, 0x0001, 0x39e7, 0x0002, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x39c7, 0x0002, 0x630c, 0x0001, 0x2124, 
+	0x0035, 0x0000, 0x0001, 0x3186, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0003, 0x8430, 0x0001, 0x39c7, 0x0002, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x6b6d, 0x0013, 0x8430, 0x0001, 0x738e, 0x0001, 0x18e3, 
+	0x0001, 0x2104, 0x0003, 0x0000, 0x0001, 0x6b6d, 0x0006, 0x8430, 
+	0x0001, 0x738e, 0x0001, 0x3186, 0x0001, 0x2104, 0x0001, 0x4a49, 
+	0x0001, 0x738e, 0x0001, 0x8430, 0x0001, 0x8410, 0x0001, 0x4208, 
+	0x0001, 0x0020, 0x0036, 0x0000, 0x0001, 0x39c7, 0x0001, 0x7bef, 
+	0x0001, 0x52aa, 0x0001, 0x8430, 0x0001, 0x8c51, 0x0001, 0x4228, 
+	0x0002, 0x0000, 0x0001, 0x10a2, 0x0001, 0x7bcf, 0x0014, 0x8c51, 
+	0x0001, 0x8410, 0x0001, 0x8430, 0x0001, 0x2124, 0x0003, 0x0000, 
+	0x0001, 0x18e3, 0x0001, 0x8430, 0x0004, 0x8c51, 0x0001, 0x8430, 
+	0x0001, 0x738e, 0x0001, 0x7bcf, 0x0003, 0x8c51, 0x0001, 0x630c, 
+	0x0001, 0x1082, 0x0036, 0x0000, 0x0001, 0x0861, 0x0001, 0x3186, 
+	0x0001, 0x0020, 0x0001, 0x73ae, 0x0002, 0x8c51, 0x0001, 0x630c, 
+	0x0002, 0x0000, 0x0001, 0x0861, 0x0001, 0x73ae, 0x0016, 0x8c51, 
+	0x0001, 0x7bcf, 0x0001, 0x4228, 0x0001, 0x4a69, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x630c, 0x0008, 0x8c51, 0x0001, 0x7bcf, 
+	0x0001, 0x2945, 0x0004, 0x0000, 0x0001, 0x0861, 0x0002, 0x2124, 
+	0x0001, 0x0020, 0x0031, 0x0000, 0x0001, 0x630c, 0x0001, 0x6b6d, 
+	0x0001, 0x738e, 0x0001, 0x8c71, 0x0001, 0x7bef, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x6b6d, 0x0019, 0x8c71, 
+	0x0001, 0x2124, 0x0003, 0x0000, 0x0001, 0x18e3, 0x0001, 0x8c51, 
+	0x0005, 0x8c71, 0x0001, 0x8430, 0x0001, 0x4a69, 0x0002, 0x10a2, 
+	0x0001, 0x3186, 0x0001, 0x4a69, 0x0001, 0x630c, 0x0001, 0x73ae, 
+	0x0001, 0x738e, 0x0001, 0x4208, 0x0001, 0x1082, 0x0030, 0x0000, 
+	0x0002, 0x18c3, 0x0001, 0x10a2, 0x0001, 0x8c51, 0x0002, 0x8c71, 
+	0x0001, 0x2965, 0x0002, 0x0000, 0x0001, 0x52aa, 0x0019, 0x8c71, 
+	0x0001, 0x8410, 0x0001, 0x5acb, 0x0001, 0x52aa, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x738e, 0x0005, 0x8c71, 0x0001, 0x7bef, 
+	0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0003, 0x8c71, 0x0001, 0x8430, 
+	0x0001, 0x4228, 0x0001, 0x0861, 0x0032, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x7bef, 0x0001, 0x632c, 0x0001, 0x7bef, 0x0001, 0x9492, 
+	0x0001, 0x630c, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0x8c71, 
+	0x001a, 0x9492, 0x0001, 0x8c71, 0x0001, 0x2945, 0x0003, 0x0000, 
+	0x0001, 0x4208, 0x0009, 0x9492, 0x0001, 0x8410, 0x0001, 0x4228, 
+	0x0001, 0x0861, 0x0033, 0x0000, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0001, 0x2965, 0x0002, 0x9492, 0x0001, 0x8c51, 0x0001, 0x10a2, 
+	0x0001, 0x0000, 0x0001, 0x10a2, 0x0001, 0x7bef, 0x001b, 0x9492, 
+	0x0001, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x31a6, 0x0002, 0x0000, 
+	0x0001, 0x10a2, 0x0001, 0x8c71, 0x0006, 0x9492, 0x0001, 0x7bef, 
+	0x0001, 0x4228, 0x0001, 0x0020, 0x0004, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x0861, 0x0001, 0x10a2, 0x0001, 0x0020, 0x002d, 0x0000, 
+	0x0001, 0x2945, 0x0001, 0x7bcf, 0x0001, 0x630c, 0x0001, 0x8430, 
+	0x0001, 0x94b2, 0x0001, 0x4a49, 0x0002, 0x0000, 0x0001, 0x4a69, 
+	0x001d, 0x94b2, 0x0001, 0x8430, 0x0001, 0x2104, 0x0003, 0x0000, 
+	0x0001, 0x7bef, 0x0005, 0x94b2, 0x0001, 0x7bcf, 0x0001, 0x4208, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x5acb, 0x0001, 0x630c, 
+	0x0001, 0x738e, 0x0001, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x5aeb, 
+	0x0001, 0x2965, 0x0001, 0x0020, 0x002e, 0x0000, 0x0001, 0x31a6, 
+	0x0002, 0x94b2, 0x0001, 0x8c71, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x8430, 0x001d, 0x94b2, 0x0001, 0x4a69, 
+	0x0001, 0x18c3, 0x0001, 0x0861, 0x0002, 0x0000, 0x0001, 0x632c, 
+	0x000b, 0x94b2, 0x0001, 0x8430, 0x0001, 0x528a, 0x0001, 0x18c3, 
+	0x002f, 0x0000, 0x0001, 0x2945, 0x0001, 0x6b4d, 0x0001, 0x5aeb, 
+	0x0001, 0x8430, 0x0001, 0x9cd3, 0x0001, 0x528a, 0x0002, 0x0000, 
+	0x0001, 0x4a69, 0x001f, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x2104, 
+	0x0002, 0x0000, 0x0001, 0x4a49, 0x0008, 0x9cd3, 0x0001, 0x8c71, 
+	0x0001, 0x630c, 0x0001, 0x2124, 0x0001, 0x0020, 0x0032, 0x0000, 
+	0x0001, 0x4208, 0x0002, 0x9cf3, 0x0001, 0x9cd3, 0x0001, 0x18e3, 
+	0x0001, 0x0000, 0x0001, 0x0841, 0x0001, 0x8c51, 0x001e, 0x9cf3, 
+	0x0001, 0x8c51, 0x0001, 0x10a2, 0x0003, 0x0000, 0x0001, 0x3186, 
+	0x0005, 0x9cf3, 0x0001, 0x9cd3, 0x0001, 0x73ae, 0x0001, 0x31a6, 
+	0x0001, 0x0020, 0x0033, 0x0000, 0x0001, 0x18c3, 0x0001, 0x4a49, 
+	0x0001, 0x4228, 0x0001, 0x8410, 0x0001, 0x9cf3, 0x0001, 0x738e, 
+	0x0002, 0x0000, 0x0001, 0x39c7, 0x0001, 0x9cd3, 0x001e, 0x9cf3, 
+	0x0001, 0x94b2, 0x0001, 0x7bcf, 0x0001, 0x4228, 0x0002, 0x0000, 
+	0x0001, 0x2104, 0x0005, 0x9cf3, 0x0001, 0x94b2, 0x0001, 0x73ae, 
+	0x0002, 0x6b4d, 0x0001, 0x632c, 0x0001, 0x5aeb, 0x0001, 0x528a, 
+	0x0001, 0x4a69, 0x0001, 0x4a49, 0x0001, 0x4228, 0x0001, 0x31a6, 
+	0x0001, 0x10a2, 0x002b, 0x0000, 0x0001, 0x0020, 0x0001, 0x4a69, 
+	0x0001, 0x9cd3, 0x0002, 0xa514, 0x0001, 0x4208, 0x0002, 0x0000, 
+	0x0001, 0x632c, 0x001f, 0xa514, 0x0001, 0x9cf3, 0x0001, 0x73ae, 
+	0x0001, 0x2945, 0x0002, 0x0000, 0x0001, 0x18c3, 0x0001, 0x9cf3, 
+	0x000b, 0xa514, 0x0001, 0x94b2, 0x0001, 0x738e, 0x0001, 0x528a, 
+	0x0001, 0x2965, 0x0001, 0x0861, 0x002a, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x2124, 0x0001, 0x31a6, 0x0001, 0x6b6d, 0x0001, 0xa514, 
+	0x0001, 0x9cf3, 0x0001, 0x18c3, 0x0001, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x8c71, 0x001f, 0xa514, 0x0001, 0x94b2, 0x0001, 0x3186, 
+	0x0003, 0x0000, 0x0001, 0x10a2, 0x0001, 0x9cf3, 0x0006, 0xa514, 
+	0x0001, 0x9cf3, 0x0001, 0x8c51, 0x0001, 0x632c, 0x0001, 0x4228, 
+	0x0001, 0x2124, 0x0001, 0x0020, 0x002e, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x4a69, 0x0001, 0x94b2, 0x0002, 0xa534, 0x0001, 0x7bef, 
+	0x0002, 0x0000, 0x0001, 0x2965, 0x0001, 0xa514, 0x0021, 0xa534, 
+	0x0001, 0x528a, 0x0002, 0x0000, 0x0001, 0x18c3, 0x0001, 0xa514, 
+	0x0004, 0xa534, 0x0001, 0x9cf3, 0x0001, 0x6b6d, 0x0001, 0x3186, 
+	0x0001, 0x0020, 0x0032, 0x0000, 0x0001, 0x0020, 0x0001, 0x0861, 
+	0x0001, 0x39e7, 0x0001, 0x9cd3, 0x0001, 0xa534, 0x0001, 0x52aa, 
+	0x0002, 0x0000, 0x0001, 0x4a49, 0x0020, 0xa534, 0x0001, 0x9cd3, 
+	0x0001, 0x4208, 0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x2104, 
+	0x0006, 0xa534, 0x0001, 0xa514, 0x0001, 0x94b2, 0x0001, 0x8430, 
+	0x0001, 0x6b6d, 0x0001, 0x4a69, 0x0001, 0x2965, 0x0001, 0x18c3, 
+	0x0001, 0x0861, 0x002d, 0x0000, 0x0001, 0x31a6, 0x0001, 0x8410, 
+	0x0001, 0xa534, 0x0002, 0xad55, 0x0001, 0x31a6, 0x0002, 0x0000, 
+	0x0001, 0x630c, 0x0020, 0xad55, 0x0001, 0x9cf3, 0x0001, 0x4228, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 0x000d, 0xad55, 
+	0x0001, 0x94b2, 0x0001, 0x73ae, 0x0001, 0x4a69, 0x0001, 0x18e3, 
+	0x002b, 0x0000, 0x0001, 0x10a2, 0x0001, 0x738e, 0x0002, 0xad55, 
+	0x0001, 0x18e3, 0x0002, 0x0000, 0x0001, 0x738e, 0x0021, 0xad55, 
+	0x0001, 0x9cf3, 0x0001, 0x39c7, 0x0002, 0x0000, 0x0001, 0x4a69, 
+	0x0005, 0xad55, 0x0001, 0xa534, 0x0001, 0x9cf3, 0x0001, 0x94b2, 
+	0x0001, 0x8430, 0x0001, 0x738e, 0x0001, 0x52aa, 0x0001, 0x39e7, 
+	0x0001, 0x2945, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0029, 0x0000, 0x0001, 0x0861, 0x0001, 0x630c, 
+	0x0001, 0x9cd3, 0x0002, 0xad75, 0x0001, 0x9cf3, 0x0001, 0x0841, 
+	0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x8c51, 0x0020, 0xad75, 
+	0x0001, 0x52aa, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0005, 0xad75, 
+	0x0001, 0x94b2, 0x0001, 0x52aa, 0x0001, 0x18c3, 0x0033, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x3186, 0x0001, 0x94b2, 0x0001, 0xb596, 
+	0x0001, 0x8c71, 0x0002, 0x0000, 0x0001, 0x0020, 0x0001, 0x8c71, 
+	0x0020, 0xb596, 0x0001, 0xad55, 0x0001, 0x4a49, 0x0003, 0x0000, 
+	0x0001, 0x8c71, 0x0007, 0xb596, 0x0001, 0xa514, 0x0001, 0x8430, 
+	0x0001, 0x528a, 0x0001, 0x18e3, 0x002f, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x5aeb, 0x0001, 0x9cf3, 0x0002, 0xb596, 0x0001, 0x8410, 
+	0x0002, 0x0000, 0x0001, 0x0841, 0x0001, 0x9492, 0x001f, 0xb596, 
+	0x0001, 0xa534, 0x0001, 0x8410, 0x0001, 0x52aa, 0x0001, 0x0841, 
+	0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0xad55, 0x000b, 0xb596, 
+	0x0001, 0x9492, 0x0001, 0x6b4d, 0x0001, 0x39c7, 0x0001, 0x0861, 
+	0x002b, 0x0000, 0x0001, 0x18c3, 0x0001, 0x4208, 0x0001, 0x632c, 
+	0x0001, 0xad75, 0x0001, 0xb5b6, 0x0001, 0x7bcf, 0x0002, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x8c71, 0x001f, 0xb5b6, 0x0001, 0x9492, 
+	0x0001, 0x0020, 0x0003, 0x0000, 0x0001, 0x39e7, 0x0005, 0xb5b6, 
+	0x0001, 0x9cf3, 0x0004, 0x8410, 0x0002, 0x7bef, 0x0002, 0x8410, 
+	0x0001, 0x7bcf, 0x0001, 0x5acb, 0x0001, 0x2124, 0x002b, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x9cd3, 0x0002, 0xb5b6, 0x0001, 0x7bcf, 
+	0x0003, 0x0000, 0x0001, 0x7bef, 0x0020, 0xb5b6, 0x0001, 0x8410, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x7bef, 0x0005, 0xb5b6, 
+	0x0001, 0xa534, 0x0001, 0x630c, 0x0001, 0x18c3, 0x0033, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x73ae, 0x0001, 0x7bcf, 0x0001, 0xad75, 
+	0x0001, 0xbdd7, 0x0001, 0x8410, 0x0003, 0x0000, 0x0001, 0x73ae, 
+	0x001e, 0xbdd7, 0x0001, 0x9cf3, 0x0001, 0x4a69, 0x0001, 0x31a6, 
+	0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x0861, 0x0001, 0xad55, 
+	0x0007, 0xbdd7, 0x0001, 0xb5b6, 0x0001, 0x7bcf, 0x0001, 0x2945, 
+	0x0032, 0x0000, 0x0001, 0x0841, 0x0001, 0x7bef, 0x0002, 0xbdd7, 
+	0x0001, 0x9492, 0x0003, 0x0000, 0x0001, 0x5acb, 0x001e, 0xbdd7, 
+	0x0001, 0xb596, 0x0001, 0x2104, 0x0003, 0x0000, 0x0001, 0x4a49, 
+	0x000b, 0xbdd7, 0x0001, 0x8c71, 0x0001, 0x31a6, 0x002f, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x94b2, 0x0001, 0xa514, 0x0001, 0xad75, 
+	0x0001, 0xbdf7, 0x0001, 0xad55, 0x0001, 0x0841, 0x0002, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0xb5b6, 0x001c, 0xbdf7, 0x0001, 0xb596, 
+	0x0001, 0xad75, 0x0001, 0x8c71, 0x0001, 0x0841, 0x0002, 0x0000, 
+	0x0001, 0x9cd3, 0x0005, 0xbdf7, 0x0001, 0x9492, 0x0001, 0x6b4d, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0xad55, 0x0001, 0xb596, 
+	0x0002, 0xbdf7, 0x0001, 0x9cf3, 0x0001, 0x52aa, 0x0001, 0x1082, 
+	0x002c, 0x0000, 0x0001, 0x18c3, 0x0001, 0x0861, 0x0001, 0x4a69, 
+	0x0001, 0xb5b6, 0x0002, 0xbdf7, 0x0001, 0x2104, 0x0002, 0x0000, 
+	0x0001, 0x18c3, 0x0001, 0xad75, 0x001c, 0xbdf7, 0x0001, 0x8c51, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x31a6, 
+	0x0006, 0xbdf7, 0x0001, 0xb5b6, 0x0001, 0x738e, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x1082, 0x0001, 0x18e3, 
+	0x0001, 0x2945, 0x0001, 0x4228, 0x0001, 0x5aeb, 0x0001, 0x52aa, 
+	0x0001, 0x2104, 0x002c, 0x0000, 0x0001, 0x630c, 0x0001, 0xbdf7, 
+	0x0001, 0xb5b6, 0x0002, 0xc618, 0x0001, 0x4208, 0x0002, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x7bcf, 0x001d, 0xc618, 0x0001, 0x3186, 
+	0x0003, 0x0000, 0x0001, 0x94b2, 0x0008, 0xc618, 0x0001, 0xad55, 
+	0x0001, 0x4a49, 0x0033, 0x0000, 0x0001, 0x2124, 0x0001, 0x528a, 
+	0x0001, 0x3186, 0x0001, 0x9cf3, 0x0002, 0xc618, 0x0001, 0x6b6d, 
+	0x0003, 0x0000, 0x0001, 0x39e7, 0x001b, 0xc618, 0x0001, 0x4a69, 
+	0x0001, 0x39e7, 0x0001, 0x2945, 0x0002, 0x0000, 0x0001, 0x4228, 
+	0x0005, 0xc618, 0x0001, 0xbdd7, 0x0005, 0xc618, 0x0001, 0x8c71, 
+	0x0001, 0x2124, 0x0033, 0x0000, 0x0001, 0x9492, 0x0001, 0xc638, 
+	0x0001, 0xc618, 0x0001, 0xc638, 0x0001, 0xad55, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x10a2, 0x0001, 0x8c71, 0x001a, 0xc638, 
+	0x0001, 0x738e, 0x0003, 0x0000, 0x0001, 0x0861, 0x0001, 0xb596, 
+	0x0005, 0xc638, 0x0001, 0xad75, 0x0001, 0x5acb, 0x0001, 0x52aa, 
+	0x0001, 0x8430, 0x0001, 0xad75, 0x0003, 0xc638, 0x0001, 0x632c, 
+	0x0001, 0x0841, 0x002f, 0x0000, 0x0001, 0x0861, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0001, 0x632c, 0x0001, 0xc618, 0x0002, 0xce59, 
+	0x0001, 0x31a6, 0x0003, 0x0000, 0x0001, 0x39e7, 0x0001, 0xbdd7, 
+	0x0017, 0xce59, 0x0001, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x632c, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x7bcf, 0x0007, 0xce59, 
+	0x0001, 0xb5b6, 0x0001, 0x31a6, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x2945, 0x0001, 0x5acb, 0x0001, 0x8c51, 0x0001, 0xb596, 
+	0x0001, 0x9cd3, 0x0001, 0x39c7, 0x0001, 0x0020, 0x002d, 0x0000, 
+	0x0002, 0x0861, 0x0001, 0x10a2, 0x0001, 0xbdd7, 0x0003, 0xce59, 
+	0x0001, 0x7bef, 0x0004, 0x0000, 0x0001, 0x8430, 0x0001, 0xc638, 
+	0x0014, 0xce59, 0x0001, 0xbdf7, 0x0001, 0xc618, 0x0001, 0xad55, 
+	0x0004, 0x0000, 0x0001, 0x4208, 0x000a, 0xce59, 0x0001, 0x630c, 
+	0x0005, 0x0000, 0x0001, 0x2124, 0x0001, 0x528a, 0x0001, 0x2945, 
+	0x002e, 0x0000, 0x0001, 0x1082, 0x0001, 0xa514, 0x0001, 0x8410, 
+	0x0001, 0x94b2, 0x0002, 0xce79, 0x0001, 0xc638, 0x0001, 0x2104, 
+	0x0003, 0x0000, 0x0001, 0x1082, 0x0001, 0xad55, 0x0001, 0xce59, 
+	0x0013, 0xce79, 0x0001, 0x9cf3, 0x0001, 0x18e3, 0x0001, 0x632c, 
+	0x0001, 0x18c3, 0x0002, 0x0000, 0x0001, 0x18e3, 0x0001, 0xc618, 
+	0x0005, 0xce79, 0x0001, 0xc618, 0x0001, 0x9cf3, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0001, 0x0841, 0x0034, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x2124, 0x0001, 0x31a6, 0x0004, 0xce79, 
+	0x0001, 0x8410, 0x0004, 0x0000, 0x0001, 0x2965, 0x0001, 0xb5b6, 
+	0x0001, 0xce59, 0x0010, 0xce79, 0x0001, 0xbdd7, 0x0001, 0x9492, 
+	0x0001, 0xbdf7, 0x0001, 0x0861, 0x0003, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0xad55, 0x0007, 0xce79, 0x0001, 0x8410, 0x0001, 0x18c3, 
+	0x0001, 0x5aeb, 0x0001, 0xad55, 0x0002, 0xce79, 0x0001, 0xad55, 
+	0x0001, 0x2104, 0x0034, 0x0000, 0x0001, 0x1082, 0x0001, 0xc618, 
+	0x0001, 0x8c51, 0x0001, 0xb596, 0x0003, 0xd69a, 0x0001, 0x39c7, 
+	0x0004, 0x0000, 0x0001, 0x2945, 0x0001, 0x9cf3, 0x0001, 0xc638, 
+	0x000d, 0xd69a, 0x0001, 0xce59, 0x0001, 0xb5b6, 0x0001, 0xce59, 
+	0x0001, 0x0861, 0x0001, 0x2965, 0x0001, 0x1082, 0x0002, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x9cd3, 0x0009, 0xd69a, 0x0001, 0x7bcf, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0x738e, 0x0001, 0xbdf7, 
+	0x0001, 0xc638, 0x0001, 0x4a49, 0x0032, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x6b6d, 0x0001, 0x39e7, 0x0001, 0x528a, 0x0004, 0xd69a, 
+	0x0001, 0xbdd7, 0x0001, 0x10a2, 0x0004, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x738e, 0x0001, 0xa534, 0x000a, 0xd69a, 0x0001, 0xce79, 
+	0x0001, 0xb5b6, 0x0001, 0xd69a, 0x0001, 0x2104, 0x0001, 0x630c, 
+	0x0001, 0x2104, 0x0003, 0x0000, 0x0001, 0x1082, 0x0001, 0x9cf3, 
+	0x0006, 0xd69a, 0x0001, 0xbdd7, 0x0001, 0xc638, 0x0003, 0xd69a, 
+	0x0001, 0x73ae, 0x0003, 0x0000, 0x0001, 0x0861, 0x0001, 0x39e7, 
+	0x0001, 0x8430, 0x0001, 0x5acb, 0x0001, 0x0020, 0x0030, 0x0000, 
+	0x0001, 0x0841, 0x0002, 0x0861, 0x0001, 0xce79, 0x0001, 0x94b2, 
+	0x0001, 0xb5b6, 0x0003, 0xd6ba, 0x0001, 0x9cf3, 0x0001, 0x0841, 
+	0x0004, 0x0000, 0x0001, 0x1082, 0x0001, 0x39c7, 0x0001, 0x8410, 
+	0x0001, 0xb5b6, 0x0001, 0xad75, 0x0001, 0xd6ba, 0x0002, 0xd69a, 
+	0x0001, 0xd6ba, 0x0001, 0xbdf7, 0x0001, 0xd6ba, 0x0001, 0x8c71, 
+	0x0001, 0xce59, 0x0001, 0x2945, 0x0001, 0x7bcf, 0x0001, 0x18e3, 
+	0x0004, 0x0000, 0x0001, 0x2104, 0x0001, 0xad55, 0x0007, 0xd6ba, 
+	0x0001, 0xbdf7, 0x0001, 0x4228, 0x0001, 0x7bcf, 0x0001, 0xd69a, 
+	0x0002, 0xd6ba, 0x0001, 0x6b4d, 0x0005, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x0861, 0x0032, 0x0000, 0x0001, 0x8430, 0x0001, 0x630c, 
+	0x0001, 0x4228, 0x0005, 0xd6ba, 0x0001, 0x94b2, 0x0001, 0x0841, 
+	0x0004, 0x0000, 0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x7bcf, 0x0001, 0x7bef, 0x0001, 0x6b4d, 
+	0x0001, 0xa514, 0x0001, 0x4208, 0x0001, 0x9cd3, 0x0001, 0x18e3, 
+	0x0001, 0x4a69, 0x0001, 0x10a2, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0003, 0x0000, 0x0001, 0x4228, 0x0001, 0xc618, 0x0009, 0xd6ba, 
+	0x0001, 0xa534, 0x0001, 0x0000, 0x0001, 0x2945, 0x0001, 0x8430, 
+	0x0002, 0xd6ba, 0x0001, 0x630c, 0x0037, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x31a6, 0x0001, 0x0000, 0x0001, 0xbdd7, 0x0001, 0x9cf3, 
+	0x0001, 0xad55, 0x0004, 0xdedb, 0x0001, 0x9cf3, 0x0001, 0x18c3, 
+	0x0006, 0x0000, 0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x2124, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0005, 0x0000, 0x0001, 0x1082, 0x0001, 0x7bcf, 0x0007, 0xdedb, 
+	0x0001, 0xd69a, 0x0001, 0xad55, 0x0003, 0xdedb, 0x0001, 0x7bcf, 
+	0x0002, 0x0000, 0x0001, 0x2965, 0x0001, 0x94b2, 0x0001, 0xdedb, 
+	0x0001, 0x5aeb, 0x0038, 0x0000, 0x0001, 0x632c, 0x0001, 0x94b2, 
+	0x0001, 0x2945, 0x0002, 0xd6ba, 0x0004, 0xdedb, 0x0001, 0xc618, 
+	0x0001, 0x4228, 0x0010, 0x0000, 0x0001, 0x0020, 0x0001, 0x4a49, 
+	0x0001, 0xbdf7, 0x0009, 0xdedb, 0x0001, 0x73ae, 0x0001, 0x52aa, 
+	0x0001, 0xd69a, 0x0002, 0xdedb, 0x0001, 0x4208, 0x0003, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0xa534, 0x0001, 0x4a49, 0x0036, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x5aeb, 0x0001, 0x0000, 0x0001, 0x8c51, 
+	0x0001, 0xc618, 0x0001, 0x9492, 0x0006, 0xdefb, 0x0001, 0x9cf3, 
+	0x0001, 0x31a6, 0x0001, 0x0020, 0x000b, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x5aeb, 0x0001, 0xbdd7, 0x0008, 0xdefb, 0x0001, 0xdedb, 
+	0x0002, 0xdefb, 0x0001, 0xdedb, 0x0001, 0x18c3, 0x0001, 0x2124, 
+	0x0001, 0xad75, 0x0001, 0xdefb, 0x0001, 0xce79, 0x0001, 0x18e3, 
+	0x0004, 0x0000, 0x0001, 0x31a6, 0x0001, 0x10a2, 0x0035, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x18c3, 0x0001, 0xbdf7, 
+	0x0001, 0x2124, 0x0001, 0xad75, 0x0001, 0xd6ba, 0x0001, 0xce59, 
+	0x0006, 0xe71c, 0x0001, 0xbdf7, 0x0001, 0x7bef, 0x0001, 0x4228, 
+	0x0001, 0x2124, 0x0001, 0x1082, 0x0002, 0x0841, 0x0001, 0x10a2, 
+	0x0001, 0x2124, 0x0001, 0x4228, 0x0001, 0x738e, 0x0001, 0xad55, 
+	0x0001, 0xd6ba, 0x000a, 0xe71c, 0x0001, 0x9cf3, 0x0001, 0xad75, 
+	0x0002, 0xe71c, 0x0001, 0xa514, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x73ae, 0x0001, 0xe71c, 0x0001, 0xad55, 0x003d, 0x0000, 
+	0x0001, 0x5aeb, 0x0001, 0x31a6, 0x0001, 0x2124, 0x0001, 0xe71c, 
+	0x0001, 0x6b4d, 0x0001, 0xce59, 0x0001, 0xe71c, 0x0001, 0xdefb, 
+	0x0007, 0xe71c, 0x0001, 0xdefb, 0x0001, 0xd6ba, 0x0002, 0xce79, 
+	0x0001, 0xd6ba, 0x000c, 0xe71c, 0x0001, 0xdefb, 0x0002, 0xe71c, 
+	0x0001, 0xc638, 0x0001, 0x18c3, 0x0001, 0xa514, 0x0002, 0xe71c, 
+	0x0001, 0x39e7, 0x0002, 0x0000, 0x0001, 0x39c7, 0x0001, 0xce59, 
+	0x0001, 0x7bcf, 0x003c, 0x0000, 0x0001, 0x18c3, 0x0001, 0x0000, 
+	0x0002, 0x8430, 0x0001, 0x4228, 0x0001, 0xe73c, 0x0001, 0x9cf3, 
+	0x0001, 0xdefb, 0x0002, 0xe71c, 0x0016, 0xe73c, 0x0001, 0x9cd3, 
+	0x0001, 0xb5b6, 0x0002, 0xe73c, 0x0001, 0x5acb, 0x0001, 0x0020, 
+	0x0001, 0x94b2, 0x0001, 0xe73c, 0x0001, 0xbdd7, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x10a2, 0x0001, 0x8c51, 0x0001, 0x39e7, 
+	0x003c, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bef, 0x0001, 0x0020, 
+	0x0001, 0x9492, 0x0001, 0xb596, 0x0001, 0x528a, 0x0001, 0xe73c, 
+	0x0001, 0xa534, 0x0001, 0xe71c, 0x0013, 0xe73c, 0x0001, 0xd69a, 
+	0x0002, 0xe73c, 0x0001, 0xb5b6, 0x0001, 0x2104, 0x0001, 0xce79, 
+	0x0001, 0xe73c, 0x0001, 0xc618, 0x0002, 0x0000, 0x0001, 0x7bef, 
+	0x0001, 0xe73c, 0x0001, 0x5aeb, 0x0004, 0x0000, 0x0001, 0x2945, 
+	0x0001, 0x0020, 0x003b, 0x0000, 0x0001, 0x18c3, 0x0001, 0x18e3, 
+	0x0001, 0x0000, 0x0001, 0xb5b6, 0x0001, 0x2965, 0x0001, 0x73ae, 
+	0x0001, 0xce79, 0x0001, 0x5acb, 0x0001, 0xef5d, 0x0001, 0xd69a, 
+	0x0001, 0xdefb, 0x000e, 0xef5d, 0x0001, 0xe71c, 0x0002, 0xef5d, 
+	0x0001, 0xa514, 0x0001, 0x9492, 0x0002, 0xef5d, 0x0001, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0xdefb, 0x0001, 0xef5d, 0x0001, 0x39e7, 
+	0x0002, 0x0000, 0x0001, 0x738e, 0x0001, 0xdedb, 0x0001, 0x10a2, 
+	0x0042, 0x0000, 0x0001, 0x31a6, 0x0001, 0x6b6d, 0x0001, 0x0000, 
+	0x0001, 0xb5b6, 0x0001, 0x632c, 0x0001, 0x52aa, 0x0001, 0xef5d, 
+	0x0001, 0x6b6d, 0x0001, 0xe71c, 0x0001, 0xd6ba, 0x0001, 0xd69a, 
+	0x0001, 0xef5d, 0x0001, 0xe73c, 0x0007, 0xef5d, 0x0001, 0xd6ba, 
+	0x0001, 0xe71c, 0x0001, 0xef5d, 0x0001, 0xad55, 0x0001, 0xb5b6, 
+	0x0001, 0xef5d, 0x0001, 0xce79, 0x0001, 0x18e3, 0x0001, 0xce59, 
+	0x0001, 0xef5d, 0x0001, 0x8c51, 0x0001, 0x0000, 0x0001, 0x4228, 
+	0x0001, 0xef5d, 0x0001, 0xad55, 0x0003, 0x0000, 0x0001, 0x632c, 
+	0x0001, 0x7bcf, 0x0001, 0x0020, 0x0041, 0x0000, 0x0001, 0x3186, 
+	0x0002, 0x0861, 0x0001, 0xad75, 0x0001, 0x0020, 0x0001, 0x7bef, 
+	0x0001, 0xc618, 0x0001, 0x2965, 0x0001, 0xef7d, 0x0001, 0x9492, 
+	0x0001, 0xb5b6, 0x0001, 0xef7d, 0x0001, 0x94b2, 0x0001, 0xef7d, 
+	0x0001, 0xe71c, 0x0001, 0xd69a, 0x0001, 0xef7d, 0x0002, 0xce79, 
+	0x0001, 0xef7d, 0x0001, 0xa514, 0x0001, 0xa534, 0x0001, 0xef7d, 
+	0x0001, 0xad75, 0x0001, 0x4a49, 0x0002, 0xef7d, 0x0001, 0x2104, 
+	0x0001, 0x39c7, 0x0001, 0xef7d, 0x0001, 0xce59, 0x0002, 0x0000, 
+	0x0001, 0x630c, 0x0001, 0xef7d, 0x0001, 0x2104, 0x0003, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x10a2, 0x0043, 0x0000, 0x0001, 0x31a6, 
+	0x0001, 0x630c, 0x0001, 0x0000, 0x0001, 0xa534, 0x0001, 0x632c, 
+	0x0001, 0x2945, 0x0001, 0xef7d, 0x0001, 0x3186, 0x0001, 0xb5b6, 
+	0x0001, 0xe71c, 0x0001, 0x4228, 0x0001, 0xef7d, 0x0001, 0xce59, 
+	0x0001, 0x8410, 0x0001, 0xef7d, 0x0001, 0xad75, 0x0001, 0x8430, 
+	0x0001, 0xef7d, 0x0001, 0xa514, 0x0001, 0x4a49, 0x0001, 0xef7d, 
+	0x0001, 0xce79, 0x0001, 0x0000, 0x0001, 0xad75, 0x0001, 0xef7d, 
+	0x0001, 0x632c, 0x0001, 0x0000, 0x0001, 0x8c51, 0x0001, 0xef7d, 
+	0x0001, 0x2945, 0x0002, 0x0000, 0x0001, 0x8410, 0x0001, 0x94b2, 
+	0x0048, 0x0000, 0x0001, 0x2104, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0001, 0x9cd3, 0x0001, 0x0861, 0x0001, 0x39e7, 0x0001, 0xd69a, 
+	0x0001, 0x0000, 0x0001, 0xbdd7, 0x0001, 0xc638, 0x0001, 0x18c3, 
+	0x0001, 0xf79e, 0x0001, 0xad55, 0x0001, 0x31a6, 0x0001, 0xf79e, 
+	0x0001, 0xa514, 0x0001, 0x2965, 0x0001, 0xf79e, 0x0001, 0xb596, 
+	0x0001, 0x0000, 0x0001, 0xd69a, 0x0001, 0xef5d, 0x0001, 0x0841, 
+	0x0001, 0x3186, 0x0001, 0xf79e, 0x0001, 0x9492, 0x0001, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0xd69a, 0x0001, 0x8410, 0x0003, 0x0000, 
+	0x0001, 0x7bef, 0x0001, 0x2104, 0x0049, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x5aeb, 0x0001, 0x0000, 0x0001, 0x528a, 0x0001, 0x9492, 
+	0x0001, 0x0000, 0x0001, 0xbdd7, 0x0001, 0x8c71, 0x0001, 0x0000, 
+	0x0001, 0xef5d, 0x0001, 0x8c51, 0x0001, 0x0020, 0x0001, 0xef7d, 
+	0x0001, 0x9cf3, 0x0001, 0x0000, 0x0001, 0xd69a, 0x0001, 0xc618, 
+	0x0001, 0x0000, 0x0001, 0x7bcf, 0x0001, 0xf7be, 0x0001, 0x2945, 
+	0x0001, 0x0000, 0x0001, 0xa514, 0x0001, 0xc638, 0x0002, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0xbdf7, 0x0003, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x10a2, 0x0049, 0x0000, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0001, 0x0000, 0x0001, 0x4a69, 0x0001, 0x39c7, 0x0001, 0x0000, 
+	0x0001, 0xad55, 0x0001, 0x4a49, 0x0001, 0x0000, 0x0001, 0xce79, 
+	0x0001, 0x632c, 0x0001, 0x0000, 0x0001, 0xd6ba, 0x0001, 0x9492, 
+	0x0001, 0x0000, 0x0001, 0x9cd3, 0x0001, 0xce79, 0x0001, 0x0000, 
+	0x0001, 0x18c3, 0x0001, 0xef7d, 0x0001, 0x4228, 0x0001, 0x0000, 
+	0x0001, 0x2945, 0x0001, 0xd6ba, 0x0001, 0x1082, 0x0002, 0x0000, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0050, 0x0000, 0x0001, 0x2945, 
+	0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x7bef, 0x0001, 0x18e3, 
+	0x0001, 0x0000, 0x0001, 0xa534, 0x0001, 0x4228, 0x0001, 0x0000, 
+	0x0001, 0xa534, 0x0001, 0x8410, 0x0001, 0x0000, 0x0001, 0x4a69, 
+	0x0001, 0xce79, 0x0002, 0x0000, 0x0001, 0xad55, 0x0001, 0x6b4d, 
+	0x0002, 0x0000, 0x0001, 0x8430, 0x0001, 0x4a49, 0x0002, 0x0000, 
+	0x0001, 0x0841, 0x0001, 0x2124, 0x0053, 0x0000, 0x0001, 0x4a49, 
+	0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x73ae, 0x0001, 0x3186, 
+	0x0001, 0x0000, 0x0001, 0x632c, 0x0001, 0x6b4d, 0x0001, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0xa514, 0x0001, 0x0841, 0x0001, 0x0000, 
+	0x0001, 0x4a69, 0x0001, 0x7bef, 0x0002, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x528a, 0x0057, 0x0000, 0x0001, 0x0020, 0x0002, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x10a2, 0x0001, 0x0000, 0x0001, 0x2965, 
+	0x0001, 0x4208, 0x0002, 0x0000, 0x0001, 0x6b4d, 0x0001, 0x1082, 
+	0x0001, 0x0000, 0x0001, 0x0841, 0x0001, 0x4a49, 0x0003, 0x0000, 
+	0x0001, 0x0841, 0x005d, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 
+	0x0002, 0x0000, 0x0001, 0x2104, 0x0001, 0x0861, 0x0002, 0x0000, 
+	0x0001, 0x0020, 0x0af8, 0x0000, 
+};
+
+const FramebufferImage rawConsole = {106, 107, RGB565, TRUE, dataConsoleRaw, 3660};
@@ -0,0 +1,1212 @@
+// generated by png2raw from ConsoleSelected.png
+
+const uint16_t dataConsoleSelectedRaw[] = {
+	0x000a, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 0x0052, 0x18e3, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0011, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x2965, 0x0001, 0x4208, 0x0056, 0x4a49, 0x0001, 0x4228, 
+	0x0001, 0x31a6, 0x0001, 0x18e3, 0x000c, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x3186, 0x0003, 0x4a49, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0021, 0x2965, 0x0011, 0x3186, 0x0020, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x39e7, 0x0003, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x10a2, 
+	0x0009, 0x0000, 0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x4228, 0x0001, 0x2945, 0x0001, 0x0841, 0x0019, 0x0000, 
+	0x0006, 0x0020, 0x0005, 0x0841, 0x000f, 0x0861, 0x0005, 0x0841, 
+	0x0007, 0x0020, 0x0017, 0x0000, 0x0001, 0x0020, 0x0001, 0x18e3, 
+	0x0001, 0x4208, 0x0002, 0x4a49, 0x0001, 0x2965, 0x0007, 0x0000, 
+	0x0001, 0x1082, 0x0002, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x0841, 
+	0x0019, 0x0000, 0x0004, 0x0020, 0x0004, 0x0841, 0x0004, 0x0861, 
+	0x0012, 0x1082, 0x0003, 0x0861, 0x0004, 0x0841, 0x0005, 0x0020, 
+	0x0018, 0x0000, 0x0001, 0x2124, 0x0002, 0x4a49, 0x0001, 0x2965, 
+	0x0005, 0x0000, 0x0001, 0x0861, 0x0002, 0x4a49, 0x0001, 0x2945, 
+	0x0019, 0x0000, 0x0003, 0x0020, 0x0004, 0x0841, 0x0002, 0x0861, 
+	0x0007, 0x1082, 0x000d, 0x10a2, 0x0007, 0x1082, 0x0002, 0x0861, 
+	0x0004, 0x0841, 0x0004, 0x0020, 0x0017, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x2104, 0x0004, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0018, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0005, 0x1082, 
+	0x0017, 0x10a2, 0x0005, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 
+	0x0004, 0x0020, 0x0016, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0001, 0x18e3, 0x0001, 0x4a49, 
+	0x0001, 0x4208, 0x0017, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 
+	0x0001, 0x0861, 0x0004, 0x1082, 0x0010, 0x10a2, 0x0001, 0x18c3, 
+	0x0001, 0x10a2, 0x0002, 0x18c3, 0x0001, 0x10a2, 0x0002, 0x18c3, 
+	0x0008, 0x10a2, 0x0004, 0x1082, 0x0001, 0x0861, 0x0003, 0x0841, 
+	0x0004, 0x0020, 0x0015, 0x0000, 0x0001, 0x2965, 0x0001, 0x4a49, 
+	0x0001, 0x3186, 0x0002, 0x0000, 0x0001, 0x39c7, 0x0001, 0x4a49, 
+	0x0001, 0x18c3, 0x0015, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 
+	0x0002, 0x0861, 0x0004, 0x1082, 0x000c, 0x10a2, 0x0005, 0x18c3, 
+	0x0002, 0x18e3, 0x0001, 0x18c3, 0x0001, 0x2124, 0x0001, 0x18e3, 
+	0x0001, 0x18c3, 0x0001, 0x2945, 0x0001, 0x18e3, 0x0001, 0x10a2, 
+	0x0002, 0x18e3, 0x0007, 0x10a2, 0x0004, 0x1082, 0x0002, 0x0861, 
+	0x0002, 0x0841, 0x0004, 0x0020, 0x0013, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0002, 0x1082, 0x0001, 0x4a49, 
+	0x0001, 0x4208, 0x0015, 0x0000, 0x0002, 0x0020, 0x0003, 0x0841, 
+	0x0001, 0x0861, 0x0003, 0x1082, 0x0009, 0x10a2, 0x0008, 0x18c3, 
+	0x0002, 0x2124, 0x0001, 0x18c3, 0x0001, 0x31a6, 0x0001, 0x18e3, 
+	0x0001, 0x2104, 0x0001, 0x4208, 0x0001, 0x18c3, 0x0001, 0x2124, 
+	0x0001, 0x4228, 0x0002, 0x18c3, 0x0001, 0x39e7, 0x0001, 0x18e3, 
+	0x0001, 0x18c3, 0x0001, 0x2124, 0x0001, 0x2104, 0x0007, 0x10a2, 
+	0x0003, 0x1082, 0x0001, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 
+	0x0013, 0x0000, 0x0001, 0x2945, 0x0001, 0x4a49, 0x0001, 0x2124, 
+	0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x2945, 0x0013, 0x0000, 
+	0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 
+	0x0008, 0x10a2, 0x0008, 0x18c3, 0x0001, 0x2104, 0x0001, 0x2965, 
+	0x0001, 0x18c3, 0x0001, 0x4208, 0x0001, 0x2124, 0x0001, 0x2945, 
+	0x0001, 0x4a69, 0x0001, 0x18e3, 0x0001, 0x4228, 0x0001, 0x4208, 
+	0x0001, 0x18c3, 0x0001, 0x528a, 0x0001, 0x31a6, 0x0001, 0x18c3, 
+	0x0001, 0x4228, 0x0001, 0x39e7, 0x0001, 0x18c3, 0x0001, 0x2124, 
+	0x0001, 0x4228, 0x0002, 0x18c3, 0x0002, 0x2104, 0x0006, 0x10a2, 
+	0x0003, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 
+	0x0012, 0x0000, 0x0001, 0x1082, 0x0001, 0x4a49, 0x0001, 0x39c7, 
+	0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x18c3, 0x0012, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x0861, 0x0002, 0x1082, 
+	0x0007, 0x10a2, 0x0008, 0x18c3, 0x0001, 0x18e3, 0x0001, 0x3186, 
+	0x0001, 0x18e3, 0x0001, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x2104, 
+	0x0001, 0x5acb, 0x0001, 0x18e3, 0x0001, 0x4a69, 0x0001, 0x4a49, 
+	0x0001, 0x2124, 0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x39c7, 
+	0x0001, 0x630c, 0x0001, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x632c, 
+	0x0001, 0x18e3, 0x0001, 0x2104, 0x0001, 0x5aeb, 0x0001, 0x2965, 
+	0x0001, 0x18c3, 0x0001, 0x2124, 0x0001, 0x4228, 0x0001, 0x18e3, 
+	0x0003, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0011, 0x0000, 0x0002, 0x4a49, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0011, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 
+	0x0006, 0x10a2, 0x0006, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x18e3, 0x0001, 0x4a69, 0x0001, 0x2104, 0x0001, 0x52aa, 
+	0x0001, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x5aeb, 0x0001, 0x2965, 
+	0x0001, 0x6b4d, 0x0001, 0x39e7, 0x0001, 0x528a, 0x0001, 0x630c, 
+	0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x4a49, 0x0001, 0x2965, 
+	0x0001, 0x6b4d, 0x0001, 0x4a49, 0x0001, 0x2104, 0x0001, 0x5aeb, 
+	0x0001, 0x528a, 0x0001, 0x18e3, 0x0001, 0x2945, 0x0001, 0x5aeb, 
+	0x0001, 0x2945, 0x0002, 0x18c3, 0x0001, 0x31a6, 0x0001, 0x2124, 
+	0x0001, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0010, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000f, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0006, 0x10a2, 0x0005, 0x18c3, 0x0003, 0x18e3, 
+	0x0001, 0x2104, 0x0001, 0x18e3, 0x0002, 0x31a6, 0x0001, 0x2124, 
+	0x0001, 0x5aeb, 0x0001, 0x2945, 0x0001, 0x632c, 0x0001, 0x39e7, 
+	0x0002, 0x5acb, 0x0001, 0x4a69, 0x0001, 0x6b4d, 0x0001, 0x4a69, 
+	0x0001, 0x6b4d, 0x0001, 0x528a, 0x0001, 0x52aa, 0x0001, 0x6b4d, 
+	0x0001, 0x4208, 0x0001, 0x630c, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0001, 0x5acb, 0x0001, 0x6b4d, 0x0001, 0x2124, 0x0001, 0x2965, 
+	0x0001, 0x632c, 0x0001, 0x4228, 0x0002, 0x18e3, 0x0001, 0x4a69, 
+	0x0001, 0x4208, 0x0004, 0x18c3, 0x0005, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 0x000f, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000e, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0002, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0005, 0x18c3, 
+	0x0005, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x2104, 0x0001, 0x4a49, 
+	0x0001, 0x4228, 0x0001, 0x39c7, 0x0001, 0x6b4d, 0x0001, 0x4228, 
+	0x0001, 0x6b6d, 0x0001, 0x52aa, 0x0001, 0x6b6d, 0x0001, 0x632c, 
+	0x0001, 0x6b4d, 0x0001, 0x6b6d, 0x0001, 0x6b4d, 0x0001, 0x6b6d, 
+	0x0001, 0x632c, 0x0001, 0x6b6d, 0x0001, 0x632c, 0x0001, 0x630c, 
+	0x0001, 0x6b6d, 0x0002, 0x5acb, 0x0001, 0x6b6d, 0x0001, 0x4a49, 
+	0x0001, 0x31a6, 0x0001, 0x6b4d, 0x0001, 0x630c, 0x0001, 0x18e3, 
+	0x0001, 0x2965, 0x0001, 0x630c, 0x0001, 0x52aa, 0x0001, 0x18e3, 
+	0x0001, 0x18c3, 0x0001, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x2104, 
+	0x0001, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x000e, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000d, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0003, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 0x0004, 0x18e3, 
+	0x0001, 0x2104, 0x0001, 0x2945, 0x0001, 0x2104, 0x0001, 0x52aa, 
+	0x0001, 0x2965, 0x0001, 0x5acb, 0x0001, 0x5aeb, 0x0001, 0x528a, 
+	0x0001, 0x738e, 0x0001, 0x632c, 0x000d, 0x738e, 0x0001, 0x6b4d, 
+	0x0001, 0x738e, 0x0001, 0x632c, 0x0001, 0x4228, 0x0002, 0x6b6d, 
+	0x0001, 0x3186, 0x0001, 0x39c7, 0x0001, 0x6b6d, 0x0001, 0x632c, 
+	0x0001, 0x2104, 0x0001, 0x18e3, 0x0001, 0x2965, 0x0001, 0x5acb, 
+	0x0001, 0x39c7, 0x0004, 0x18c3, 0x0004, 0x10a2, 0x0003, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0003, 0x0020, 0x000d, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000c, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 
+	0x0005, 0x18e3, 0x0002, 0x2104, 0x0001, 0x528a, 0x0001, 0x2124, 
+	0x0001, 0x632c, 0x0001, 0x4a69, 0x0001, 0x630c, 0x0002, 0x6b6d, 
+	0x0011, 0x738e, 0x0001, 0x6b4d, 0x0002, 0x738e, 0x0001, 0x528a, 
+	0x0001, 0x4a69, 0x0001, 0x738e, 0x0001, 0x6b6d, 0x0001, 0x2965, 
+	0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x6b6d, 0x0001, 0x39e7, 
+	0x0002, 0x18e3, 0x0001, 0x18c3, 0x0001, 0x2124, 0x0001, 0x18e3, 
+	0x0001, 0x18c3, 0x0005, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x000c, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000b, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 0x0004, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x31a6, 0x0001, 0x2104, 0x0001, 0x632c, 
+	0x0001, 0x4208, 0x0001, 0x6b4d, 0x0002, 0x6b6d, 0x0006, 0x73ae, 
+	0x0001, 0x738e, 0x0003, 0x6b6d, 0x0001, 0x738e, 0x000a, 0x73ae, 
+	0x0001, 0x738e, 0x0001, 0x6b4d, 0x0002, 0x73ae, 0x0001, 0x39e7, 
+	0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x73ae, 0x0001, 0x4228, 
+	0x0002, 0x18e3, 0x0001, 0x2965, 0x0001, 0x4a69, 0x0001, 0x31a6, 
+	0x0001, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x000b, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000a, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0004, 0x2104, 0x0001, 0x5aeb, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x6b4d, 0x0001, 0x738e, 0x0004, 0x73ae, 
+	0x0001, 0x6b6d, 0x0001, 0x5acb, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x31a6, 0x0003, 0x3186, 0x0001, 0x31a6, 0x0001, 0x39e7, 
+	0x0001, 0x4a69, 0x0001, 0x630c, 0x000a, 0x73ae, 0x0001, 0x5acb, 
+	0x0001, 0x528a, 0x0002, 0x73ae, 0x0001, 0x4a49, 0x0001, 0x2104, 
+	0x0001, 0x2945, 0x0001, 0x528a, 0x0001, 0x6b6d, 0x0001, 0x39c7, 
+	0x0002, 0x18e3, 0x0004, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0003, 0x0020, 0x000a, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000a, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0004, 0x18c3, 
+	0x0004, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 0x0001, 0x39e7, 
+	0x0001, 0x2124, 0x0001, 0x630c, 0x0001, 0x5aeb, 0x0001, 0x6b4d, 
+	0x0003, 0x7bcf, 0x0001, 0x73ae, 0x0001, 0x5acb, 0x0001, 0x39e7, 
+	0x000c, 0x2965, 0x0001, 0x39c7, 0x0001, 0x52aa, 0x0001, 0x73ae, 
+	0x0006, 0x7bcf, 0x0001, 0x73ae, 0x0001, 0x738e, 0x0002, 0x7bcf, 
+	0x0001, 0x528a, 0x0001, 0x2945, 0x0001, 0x4a69, 0x0002, 0x738e, 
+	0x0001, 0x3186, 0x0001, 0x2104, 0x0002, 0x18e3, 0x0002, 0x2124, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0003, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0009, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0004, 0x10a2, 0x0004, 0x18c3, 0x0003, 0x18e3, 
+	0x0004, 0x2104, 0x0001, 0x2124, 0x0001, 0x5acb, 0x0001, 0x4a49, 
+	0x0001, 0x5acb, 0x0004, 0x7bcf, 0x0001, 0x5acb, 0x0001, 0x31a6, 
+	0x0004, 0x2965, 0x0001, 0x3186, 0x0002, 0x39c7, 0x0001, 0x4208, 
+	0x0001, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x31a6, 0x0005, 0x3186, 
+	0x0001, 0x39c7, 0x0001, 0x632c, 0x0008, 0x7bcf, 0x0001, 0x5aeb, 
+	0x0001, 0x4a69, 0x0001, 0x738e, 0x0001, 0x7bcf, 0x0001, 0x738e, 
+	0x0001, 0x3186, 0x0002, 0x2104, 0x0001, 0x2965, 0x0001, 0x52aa, 
+	0x0001, 0x4a49, 0x0001, 0x2124, 0x0001, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0008, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0008, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0004, 0x18c3, 0x0003, 0x18e3, 0x0003, 0x2104, 
+	0x0001, 0x2124, 0x0001, 0x4208, 0x0001, 0x2965, 0x0001, 0x4a69, 
+	0x0001, 0x7bcf, 0x0001, 0x6b6d, 0x0002, 0x7bef, 0x0001, 0x738e, 
+	0x0001, 0x4228, 0x0003, 0x2965, 0x0001, 0x31a6, 0x0001, 0x4228, 
+	0x0001, 0x528a, 0x0001, 0x632c, 0x0001, 0x6b4d, 0x0001, 0x6b6d, 
+	0x0001, 0x738e, 0x0001, 0x6b6d, 0x0002, 0x630c, 0x0001, 0x4a49, 
+	0x0001, 0x4a69, 0x0001, 0x3186, 0x0001, 0x31a6, 0x0003, 0x3186, 
+	0x0001, 0x52aa, 0x0006, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x738e, 
+	0x0002, 0x7bef, 0x0001, 0x6b4d, 0x0001, 0x2965, 0x0001, 0x2124, 
+	0x0001, 0x4208, 0x0001, 0x630c, 0x0001, 0x73ae, 0x0001, 0x4a49, 
+	0x0001, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0008, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0007, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0001, 0x4a49, 0x0001, 0x6b4d, 0x0001, 0x4a69, 0x0003, 0x7bef, 
+	0x0001, 0x632c, 0x0001, 0x31a6, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x31a6, 0x0001, 0x4a69, 0x0001, 0x738e, 0x0001, 0x7bcf, 
+	0x0009, 0x7bef, 0x0001, 0x632c, 0x0001, 0x630c, 0x0001, 0x39e7, 
+	0x0001, 0x39c7, 0x0003, 0x31a6, 0x0001, 0x528a, 0x0008, 0x7bef, 
+	0x0001, 0x6b4d, 0x0001, 0x39e7, 0x0001, 0x4a69, 0x0001, 0x738e, 
+	0x0001, 0x7bef, 0x0001, 0x73ae, 0x0001, 0x39e7, 0x0002, 0x2104, 
+	0x0004, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0006, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0001, 0x2124, 0x0001, 0x31a6, 
+	0x0001, 0x4228, 0x0001, 0x31a6, 0x0001, 0x8410, 0x0001, 0x7bcf, 
+	0x0002, 0x8410, 0x0001, 0x5acb, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x6b4d, 0x000d, 0x8410, 
+	0x0001, 0x7bcf, 0x0001, 0x630c, 0x0001, 0x5aeb, 0x0001, 0x31a6, 
+	0x0001, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x52aa, 0x0006, 0x8410, 
+	0x0001, 0x7bef, 0x0001, 0x6b4d, 0x0001, 0x7bef, 0x0002, 0x8410, 
+	0x0001, 0x632c, 0x0001, 0x2965, 0x0002, 0x2124, 0x0001, 0x2104, 
+	0x0001, 0x3186, 0x0001, 0x4208, 0x0001, 0x2965, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0006, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0005, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0001, 0x2945, 0x0001, 0x73ae, 
+	0x0001, 0x5acb, 0x0001, 0x73ae, 0x0002, 0x8410, 0x0001, 0x52aa, 
+	0x0002, 0x3186, 0x0001, 0x39c7, 0x0001, 0x632c, 0x0001, 0x7bef, 
+	0x0010, 0x8410, 0x0002, 0x632c, 0x0001, 0x4228, 0x0001, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x630c, 0x0009, 0x8410, 0x0001, 0x528a, 
+	0x0002, 0x2945, 0x0001, 0x31a6, 0x0001, 0x4a69, 0x0002, 0x6b4d, 
+	0x0001, 0x39e7, 0x0001, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0005, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0001, 0x2945, 0x0001, 0x4a49, 0x0001, 0x3186, 
+	0x0001, 0x52aa, 0x0003, 0x8430, 0x0001, 0x52aa, 0x0002, 0x3186, 
+	0x0001, 0x4208, 0x0001, 0x73ae, 0x0013, 0x8430, 0x0001, 0x7bcf, 
+	0x0001, 0x4a49, 0x0001, 0x4a69, 0x0003, 0x39c7, 0x0001, 0x73ae, 
+	0x0006, 0x8430, 0x0001, 0x7bcf, 0x0001, 0x4a69, 0x0001, 0x4208, 
+	0x0001, 0x5aeb, 0x0001, 0x7bcf, 0x0002, 0x8430, 0x0001, 0x52aa, 
+	0x0001, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0004, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0001, 0x2945, 0x0001, 0x528a, 0x0001, 0x8410, 
+	0x0001, 0x632c, 0x0002, 0x8c51, 0x0001, 0x5aeb, 0x0002, 0x3186, 
+	0x0001, 0x4208, 0x0001, 0x8410, 0x0014, 0x8c51, 0x0002, 0x8430, 
+	0x0001, 0x528a, 0x0002, 0x39e7, 0x0001, 0x39c7, 0x0001, 0x4a69, 
+	0x0001, 0x8430, 0x0004, 0x8c51, 0x0001, 0x8430, 0x0001, 0x7bcf, 
+	0x0001, 0x7bef, 0x0003, 0x8c51, 0x0001, 0x6b6d, 0x0001, 0x31a6, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0001, 0x3186, 0x0001, 0x4a49, 
+	0x0001, 0x2965, 0x0001, 0x7bcf, 0x0002, 0x8c51, 0x0001, 0x6b6d, 
+	0x0001, 0x3186, 0x0001, 0x31a6, 0x0001, 0x39e7, 0x0001, 0x7bef, 
+	0x0016, 0x8c51, 0x0001, 0x8410, 0x0001, 0x632c, 0x0001, 0x6b4d, 
+	0x0001, 0x4208, 0x0002, 0x39e7, 0x0001, 0x738e, 0x0008, 0x8c51, 
+	0x0001, 0x7bef, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0003, 0x2945, 
+	0x0001, 0x2965, 0x0002, 0x39e7, 0x0001, 0x2124, 0x0001, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0002, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x738e, 
+	0x0002, 0x7bcf, 0x0001, 0x8c71, 0x0001, 0x8410, 0x0001, 0x39e7, 
+	0x0001, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x7bcf, 0x0019, 0x8c71, 
+	0x0001, 0x52aa, 0x0002, 0x4208, 0x0001, 0x39e7, 0x0001, 0x4a69, 
+	0x0006, 0x8c71, 0x0001, 0x8c51, 0x0001, 0x632c, 0x0002, 0x39e7, 
+	0x0001, 0x4a69, 0x0001, 0x630c, 0x0001, 0x6b6d, 0x0001, 0x7bef, 
+	0x0001, 0x7bcf, 0x0001, 0x52aa, 0x0001, 0x3186, 0x0003, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0003, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0001, 0x2945, 
+	0x0003, 0x39e7, 0x0001, 0x8c51, 0x0002, 0x8c71, 0x0001, 0x528a, 
+	0x0002, 0x31a6, 0x0001, 0x6b6d, 0x0019, 0x8c71, 0x0001, 0x8c51, 
+	0x0002, 0x738e, 0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x7bef, 
+	0x0005, 0x8c71, 0x0001, 0x8430, 0x0001, 0x73ae, 0x0001, 0x8430, 
+	0x0003, 0x8c71, 0x0001, 0x8c51, 0x0001, 0x5acb, 0x0001, 0x3186, 
+	0x0003, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x8410, 
+	0x0001, 0x738e, 0x0001, 0x8430, 0x0001, 0x9492, 0x0001, 0x738e, 
+	0x0002, 0x31a6, 0x0001, 0x52aa, 0x0001, 0x8c71, 0x001a, 0x9492, 
+	0x0001, 0x8c71, 0x0001, 0x5acb, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x632c, 0x0009, 0x9492, 0x0001, 0x8430, 0x0001, 0x5aeb, 
+	0x0001, 0x31a6, 0x0001, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0001, 0x2945, 0x0001, 0x31a6, 0x0001, 0x2965, 0x0001, 0x4a69, 
+	0x0002, 0x9492, 0x0001, 0x8c71, 0x0001, 0x4208, 0x0001, 0x31a6, 
+	0x0001, 0x4228, 0x0001, 0x8430, 0x001b, 0x9492, 0x0001, 0x8c51, 
+	0x0001, 0x6b6d, 0x0001, 0x630c, 0x0002, 0x4228, 0x0001, 0x4a69, 
+	0x0007, 0x9492, 0x0001, 0x8430, 0x0001, 0x630c, 0x0001, 0x31a6, 
+	0x0001, 0x3186, 0x0004, 0x2965, 0x0002, 0x31a6, 0x0001, 0x2945, 
+	0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x4a49, 0x0001, 0x8410, 0x0001, 0x738e, 0x0001, 0x8c71, 
+	0x0001, 0x94b2, 0x0001, 0x632c, 0x0001, 0x31a6, 0x0001, 0x39c7, 
+	0x0001, 0x6b4d, 0x001d, 0x94b2, 0x0001, 0x8c71, 0x0001, 0x5acb, 
+	0x0001, 0x4a49, 0x0002, 0x4228, 0x0001, 0x8c51, 0x0005, 0x94b2, 
+	0x0001, 0x8430, 0x0001, 0x630c, 0x0001, 0x5aeb, 0x0001, 0x632c, 
+	0x0001, 0x6b6d, 0x0001, 0x73ae, 0x0001, 0x7bef, 0x0001, 0x8430, 
+	0x0001, 0x8410, 0x0001, 0x6b6d, 0x0001, 0x4a49, 0x0001, 0x2945, 
+	0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0001, 0x2945, 0x0002, 0x2965, 0x0001, 0x52aa, 
+	0x0002, 0x94b2, 0x0001, 0x9492, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0001, 0x4228, 0x0001, 0x8c71, 0x001d, 0x94b2, 0x0001, 0x738e, 
+	0x0001, 0x5acb, 0x0001, 0x528a, 0x0002, 0x4a49, 0x0001, 0x7bef, 
+	0x000b, 0x94b2, 0x0001, 0x8c71, 0x0001, 0x6b4d, 0x0001, 0x39e7, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0001, 0x4a49, 0x0001, 0x7bcf, 0x0001, 0x738e, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x0001, 0x39c7, 
+	0x0001, 0x39e7, 0x0001, 0x6b4d, 0x001f, 0x9cd3, 0x0001, 0x9492, 
+	0x0001, 0x5aeb, 0x0002, 0x4a49, 0x0001, 0x6b6d, 0x0008, 0x9cd3, 
+	0x0001, 0x9492, 0x0001, 0x73ae, 0x0001, 0x4a69, 0x0001, 0x31a6, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0003, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x5aeb, 0x0002, 0x9cf3, 0x0001, 0x9cd3, 0x0001, 0x4a49, 
+	0x0001, 0x39c7, 0x0001, 0x4208, 0x0001, 0x9492, 0x001e, 0x9cf3, 
+	0x0001, 0x9492, 0x0001, 0x5acb, 0x0003, 0x4a69, 0x0001, 0x632c, 
+	0x0005, 0x9cf3, 0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x5aeb, 
+	0x0001, 0x39e7, 0x0001, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 
+	0x0003, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0001, 0x2945, 0x0001, 0x2965, 0x0001, 0x39e7, 
+	0x0002, 0x630c, 0x0001, 0x8c51, 0x0001, 0x9cf3, 0x0001, 0x8410, 
+	0x0002, 0x39c7, 0x0001, 0x630c, 0x001f, 0x9cf3, 0x0001, 0x9cd3, 
+	0x0001, 0x8c71, 0x0001, 0x738e, 0x0001, 0x528a, 0x0001, 0x4a69, 
+	0x0001, 0x5aeb, 0x0005, 0x9cf3, 0x0001, 0x9cd3, 0x0001, 0x8430, 
+	0x0002, 0x7bef, 0x0001, 0x7bcf, 0x0001, 0x73ae, 0x0001, 0x6b6d, 
+	0x0002, 0x632c, 0x0001, 0x5aeb, 0x0001, 0x528a, 0x0001, 0x39e7, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0001, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x9cf3, 
+	0x0002, 0xa514, 0x0001, 0x630c, 0x0001, 0x39c7, 0x0001, 0x39e7, 
+	0x0001, 0x7bef, 0x0020, 0xa514, 0x0001, 0x8c71, 0x0001, 0x632c, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x0001, 0x5acb, 0x0001, 0x9cf3, 
+	0x000b, 0xa514, 0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x6b4d, 
+	0x0001, 0x4a69, 0x0001, 0x31a6, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0001, 0x2945, 0x0001, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x52aa, 0x0001, 0x7bef, 
+	0x0001, 0xa514, 0x0001, 0x9cf3, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x94b2, 0x001f, 0xa514, 0x0001, 0x9cf3, 
+	0x0001, 0x6b6d, 0x0001, 0x52aa, 0x0002, 0x528a, 0x0001, 0x5acb, 
+	0x0001, 0x9cf3, 0x0007, 0xa514, 0x0001, 0x9492, 0x0001, 0x7bef, 
+	0x0001, 0x632c, 0x0001, 0x528a, 0x0001, 0x39c7, 0x0003, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x9cd3, 0x0002, 0xa534, 0x0001, 0x8c71, 
+	0x0002, 0x39e7, 0x0001, 0x5acb, 0x0001, 0xa514, 0x0021, 0xa534, 
+	0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x528a, 0x0001, 0x5aeb, 
+	0x0001, 0xa514, 0x0004, 0xa534, 0x0001, 0xa514, 0x0001, 0x8430, 
+	0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0841, 0x0001, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0001, 0x31a6, 
+	0x0001, 0x39e7, 0x0001, 0x5aeb, 0x0001, 0x9cf3, 0x0001, 0xa534, 
+	0x0001, 0x738e, 0x0002, 0x39e7, 0x0001, 0x6b6d, 0x0020, 0xa534, 
+	0x0001, 0xa514, 0x0001, 0x73ae, 0x0001, 0x5aeb, 0x0002, 0x52aa, 
+	0x0001, 0x632c, 0x0006, 0xa534, 0x0001, 0xa514, 0x0001, 0x9cf3, 
+	0x0001, 0x9492, 0x0001, 0x8410, 0x0001, 0x6b6d, 0x0001, 0x5acb, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x52aa, 0x0001, 0x8c71, 0x0001, 0xa534, 
+	0x0002, 0xad55, 0x0001, 0x630c, 0x0001, 0x39e7, 0x0001, 0x4208, 
+	0x0001, 0x7bef, 0x0020, 0xad55, 0x0001, 0xa534, 0x0001, 0x7bcf, 
+	0x0001, 0x5aeb, 0x0001, 0x5acb, 0x0001, 0x52aa, 0x0001, 0x6b6d, 
+	0x000d, 0xad55, 0x0001, 0x9cf3, 0x0001, 0x8430, 0x0001, 0x6b4d, 
+	0x0001, 0x4228, 0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x4228, 
+	0x0001, 0x8430, 0x0002, 0xad55, 0x0001, 0x528a, 0x0001, 0x39e7, 
+	0x0001, 0x4208, 0x0001, 0x8c51, 0x0021, 0xad55, 0x0001, 0xa534, 
+	0x0001, 0x73ae, 0x0002, 0x5acb, 0x0001, 0x7bef, 0x0006, 0xad55, 
+	0x0001, 0xa514, 0x0001, 0x9cf3, 0x0001, 0x94b2, 0x0001, 0x8430, 
+	0x0001, 0x73ae, 0x0001, 0x632c, 0x0001, 0x52aa, 0x0001, 0x4228, 
+	0x0001, 0x39e7, 0x0001, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0003, 0x2945, 0x0001, 0x2965, 
+	0x0001, 0x39c7, 0x0001, 0x7bcf, 0x0001, 0xa514, 0x0002, 0xad75, 
+	0x0001, 0xa514, 0x0001, 0x4228, 0x0001, 0x4208, 0x0001, 0x4228, 
+	0x0001, 0x94b2, 0x0020, 0xad75, 0x0001, 0x8430, 0x0001, 0x630c, 
+	0x0001, 0x5aeb, 0x0002, 0x5acb, 0x0001, 0x8c71, 0x0005, 0xad75, 
+	0x0001, 0xa514, 0x0001, 0x7bcf, 0x0001, 0x52aa, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 
+	0x0003, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x39c7, 0x0001, 0x52aa, 0x0001, 0x9cf3, 
+	0x0001, 0xb596, 0x0001, 0x9cd3, 0x0001, 0x39e7, 0x0001, 0x4208, 
+	0x0001, 0x4228, 0x0001, 0x9cd3, 0x0020, 0xb596, 0x0001, 0xad75, 
+	0x0001, 0x8410, 0x0001, 0x630c, 0x0001, 0x5aeb, 0x0001, 0x5acb, 
+	0x0001, 0x9cf3, 0x0007, 0xb596, 0x0001, 0xad55, 0x0001, 0x94b2, 
+	0x0001, 0x73ae, 0x0001, 0x52aa, 0x0001, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0002, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0841, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x4208, 0x0001, 0x73ae, 0x0001, 0xa514, 
+	0x0002, 0xb596, 0x0001, 0x9492, 0x0002, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0xa514, 0x001f, 0xb596, 0x0001, 0xad75, 0x0001, 0x9cf3, 
+	0x0001, 0x8c51, 0x0001, 0x632c, 0x0001, 0x5aeb, 0x0001, 0x632c, 
+	0x0001, 0xad75, 0x000b, 0xb596, 0x0001, 0x9cf3, 0x0001, 0x8410, 
+	0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x4228, 0x0001, 0x630c, 0x0001, 0x7bef, 0x0001, 0xad75, 
+	0x0001, 0xb5b6, 0x0001, 0x8c71, 0x0002, 0x4208, 0x0001, 0x4a69, 
+	0x0001, 0x9cf3, 0x001f, 0xb5b6, 0x0001, 0xa534, 0x0001, 0x632c, 
+	0x0003, 0x630c, 0x0001, 0x7bef, 0x0005, 0xb5b6, 0x0001, 0xad55, 
+	0x0004, 0x94b2, 0x0002, 0x9492, 0x0002, 0x94b2, 0x0001, 0x8c71, 
+	0x0001, 0x73ae, 0x0001, 0x4a69, 0x0001, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0001, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x31a6, 0x0001, 0x630c, 0x0001, 0xa514, 0x0002, 0xb5b6, 
+	0x0001, 0x8c71, 0x0002, 0x4208, 0x0001, 0x4228, 0x0001, 0x94b2, 
+	0x0020, 0xb5b6, 0x0001, 0x9cf3, 0x0001, 0x6b4d, 0x0002, 0x630c, 
+	0x0001, 0x9cd3, 0x0005, 0xb5b6, 0x0001, 0xad75, 0x0001, 0x8430, 
+	0x0001, 0x5aeb, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x5aeb, 0x0001, 0x8c51, 0x0001, 0x8c71, 0x0001, 0xb596, 
+	0x0001, 0xbdd7, 0x0001, 0x94b2, 0x0001, 0x4208, 0x0002, 0x4228, 
+	0x0001, 0x8c71, 0x001e, 0xbdd7, 0x0001, 0xad75, 0x0001, 0x8c51, 
+	0x0001, 0x7bef, 0x0001, 0x6b4d, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0xb596, 0x0007, 0xbdd7, 0x0001, 0xb5b6, 0x0001, 0x9492, 
+	0x0001, 0x630c, 0x0001, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0001, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x39c7, 
+	0x0001, 0x9492, 0x0002, 0xbdd7, 0x0001, 0xa514, 0x0001, 0x4208, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x8410, 0x001e, 0xbdd7, 
+	0x0001, 0xb5b6, 0x0001, 0x7bcf, 0x0001, 0x6b4d, 0x0002, 0x632c, 
+	0x0001, 0x8430, 0x000b, 0xbdd7, 0x0001, 0x9cf3, 0x0001, 0x632c, 
+	0x0001, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x528a, 0x0001, 0xa514, 0x0001, 0xad55, 0x0001, 0xb596, 
+	0x0001, 0xbdf7, 0x0001, 0xb596, 0x0001, 0x4a49, 0x0001, 0x4228, 
+	0x0001, 0x4a49, 0x0001, 0x6b6d, 0x0001, 0xbdd7, 0x001c, 0xbdf7, 
+	0x0001, 0xbdd7, 0x0001, 0xb5b6, 0x0001, 0xad55, 0x0001, 0x6b6d, 
+	0x0002, 0x632c, 0x0001, 0xad55, 0x0005, 0xbdf7, 0x0001, 0xa534, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0xa534, 0x0001, 0xb596, 
+	0x0001, 0xb5b6, 0x0002, 0xbdf7, 0x0001, 0xad55, 0x0001, 0x7bcf, 
+	0x0001, 0x4a49, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x4228, 
+	0x0001, 0x4208, 0x0001, 0x6b6d, 0x0001, 0xbdd7, 0x0002, 0xbdf7, 
+	0x0001, 0x5acb, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x5acb, 
+	0x0001, 0xb5b6, 0x001c, 0xbdf7, 0x0001, 0xad55, 0x0001, 0x6b6d, 
+	0x0001, 0x738e, 0x0001, 0x6b4d, 0x0001, 0x632c, 0x0001, 0x7bef, 
+	0x0006, 0xbdf7, 0x0001, 0xbdd7, 0x0001, 0x94b2, 0x0001, 0x5acb, 
+	0x0001, 0x4a69, 0x0001, 0x528a, 0x0001, 0x52aa, 0x0001, 0x5acb, 
+	0x0001, 0x630c, 0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0001, 0x73ae, 
+	0x0001, 0x528a, 0x0001, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x7bcf, 0x0001, 0xbdf7, 0x0001, 0xbdd7, 0x0002, 0xc618, 
+	0x0001, 0x6b6d, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x4a69, 
+	0x0001, 0x94b2, 0x001d, 0xc618, 0x0001, 0x8410, 0x0002, 0x6b4d, 
+	0x0001, 0x632c, 0x0001, 0xad75, 0x0008, 0xc618, 0x0001, 0xb5b6, 
+	0x0001, 0x7bef, 0x0001, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x528a, 0x0001, 0x738e, 0x0001, 0x5aeb, 0x0001, 0xad55, 
+	0x0002, 0xc618, 0x0001, 0x8c51, 0x0001, 0x4228, 0x0002, 0x4a49, 
+	0x0001, 0x738e, 0x001b, 0xc618, 0x0001, 0x9492, 0x0001, 0x8c51, 
+	0x0001, 0x8410, 0x0001, 0x6b6d, 0x0001, 0x6b4d, 0x0001, 0x8c51, 
+	0x0005, 0xc618, 0x0001, 0xbdf7, 0x0005, 0xc618, 0x0001, 0xa534, 
+	0x0001, 0x630c, 0x0001, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0xa514, 0x0001, 0xc638, 0x0001, 0xc618, 0x0001, 0xc638, 
+	0x0001, 0xb596, 0x0003, 0x4a49, 0x0001, 0x5acb, 0x0001, 0xa534, 
+	0x001a, 0xc638, 0x0001, 0xa514, 0x0002, 0x6b6d, 0x0001, 0x6b4d, 
+	0x0001, 0x738e, 0x0001, 0xbdf7, 0x0005, 0xc638, 0x0001, 0xbdd7, 
+	0x0002, 0x8c51, 0x0001, 0xa514, 0x0001, 0xb5b6, 0x0003, 0xc638, 
+	0x0001, 0x8c51, 0x0001, 0x4a69, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x39e7, 0x0001, 0x8c51, 
+	0x0001, 0x9492, 0x0001, 0x8410, 0x0001, 0xc618, 0x0002, 0xce59, 
+	0x0001, 0x6b4d, 0x0002, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x73ae, 
+	0x0001, 0xc618, 0x0017, 0xce59, 0x0001, 0xad55, 0x0001, 0x9492, 
+	0x0001, 0x9cf3, 0x0001, 0x738e, 0x0001, 0x6b6d, 0x0001, 0x6b4d, 
+	0x0001, 0xa514, 0x0007, 0xce59, 0x0001, 0xbdf7, 0x0001, 0x73ae, 
+	0x0002, 0x52aa, 0x0001, 0x6b4d, 0x0001, 0x8410, 0x0001, 0xa514, 
+	0x0001, 0xbdd7, 0x0001, 0xad55, 0x0001, 0x6b4d, 0x0001, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x39e7, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0xbdf7, 0x0003, 0xce59, 
+	0x0001, 0x9cd3, 0x0002, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x528a, 
+	0x0001, 0xa514, 0x0001, 0xc638, 0x0014, 0xce59, 0x0002, 0xc638, 
+	0x0001, 0xbdd7, 0x0001, 0x738e, 0x0003, 0x6b6d, 0x0001, 0x8c51, 
+	0x000a, 0xce59, 0x0001, 0x8c71, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x630c, 0x0001, 0x7bcf, 0x0001, 0x5aeb, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x4208, 0x0001, 0xad75, 0x0001, 0x94b2, 0x0001, 0xa534, 
+	0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x5aeb, 0x0001, 0x4a49, 
+	0x0002, 0x4a69, 0x0001, 0x5aeb, 0x0001, 0xb5b6, 0x0001, 0xce59, 
+	0x0013, 0xce79, 0x0001, 0xb5b6, 0x0001, 0x7bef, 0x0001, 0x9cf3, 
+	0x0001, 0x7bef, 0x0002, 0x6b6d, 0x0001, 0x7bcf, 0x0001, 0xc638, 
+	0x0005, 0xce79, 0x0001, 0xc638, 0x0001, 0xb596, 0x0001, 0xc638, 
+	0x0003, 0xce79, 0x0001, 0xa514, 0x0001, 0x52aa, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 0x0001, 0x632c, 
+	0x0001, 0x528a, 0x0001, 0x630c, 0x0004, 0xce79, 0x0001, 0x9cf3, 
+	0x0001, 0x4a49, 0x0002, 0x4a69, 0x0001, 0x52aa, 0x0001, 0x6b6d, 
+	0x0001, 0xc618, 0x0011, 0xce79, 0x0001, 0xc638, 0x0001, 0xb596, 
+	0x0001, 0xc638, 0x0001, 0x73ae, 0x0001, 0x738e, 0x0002, 0x6b6d, 
+	0x0001, 0x738e, 0x0001, 0xbdf7, 0x0007, 0xce79, 0x0001, 0xa534, 
+	0x0001, 0x6b4d, 0x0001, 0x8c71, 0x0001, 0xbdd7, 0x0002, 0xce79, 
+	0x0001, 0xbdd7, 0x0001, 0x630c, 0x0001, 0x4a49, 0x0002, 0x4228, 
+	0x0001, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0002, 0x31a6, 0x0001, 0x4228, 0x0001, 0xc638, 
+	0x0001, 0x9cf3, 0x0001, 0xbdd7, 0x0003, 0xd69a, 0x0001, 0x6b6d, 
+	0x0002, 0x4a69, 0x0001, 0x528a, 0x0001, 0x52aa, 0x0001, 0x6b6d, 
+	0x0001, 0xb5b6, 0x0001, 0xce59, 0x000d, 0xd69a, 0x0001, 0xce79, 
+	0x0001, 0xc638, 0x0001, 0xce79, 0x0001, 0x73ae, 0x0001, 0x8430, 
+	0x0001, 0x7bcf, 0x0002, 0x6b6d, 0x0001, 0x738e, 0x0001, 0xb5b6, 
+	0x0009, 0xd69a, 0x0001, 0x9cf3, 0x0001, 0x5acb, 0x0001, 0x52aa, 
+	0x0001, 0x738e, 0x0001, 0x94b2, 0x0001, 0xc638, 0x0001, 0xce59, 
+	0x0001, 0x7bcf, 0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0001, 0x2965, 0x0002, 0x3186, 0x0001, 0x39c7, 
+	0x0001, 0x8c51, 0x0001, 0x6b4d, 0x0001, 0x73ae, 0x0004, 0xd69a, 
+	0x0001, 0xc618, 0x0001, 0x5acb, 0x0001, 0x4a69, 0x0002, 0x528a, 
+	0x0001, 0x52aa, 0x0001, 0x6b4d, 0x0001, 0x9cd3, 0x0001, 0xbdd7, 
+	0x000b, 0xd69a, 0x0001, 0xc638, 0x0001, 0xd69a, 0x0001, 0x7bef, 
+	0x0001, 0x9cf3, 0x0001, 0x7bef, 0x0003, 0x6b6d, 0x0001, 0x73ae, 
+	0x0001, 0xbdd7, 0x0006, 0xd69a, 0x0001, 0xc638, 0x0001, 0xce59, 
+	0x0003, 0xd69a, 0x0001, 0x9cf3, 0x0001, 0x52aa, 0x0002, 0x528a, 
+	0x0001, 0x52aa, 0x0001, 0x73ae, 0x0001, 0x9cf3, 0x0001, 0x8410, 
+	0x0001, 0x4a49, 0x0001, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0841, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0002, 0x3186, 0x0001, 0x39c7, 0x0002, 0x4208, 
+	0x0001, 0xd69a, 0x0001, 0xa534, 0x0001, 0xbdf7, 0x0003, 0xd6ba, 
+	0x0001, 0xb596, 0x0001, 0x528a, 0x0001, 0x4a69, 0x0001, 0x528a, 
+	0x0002, 0x52aa, 0x0001, 0x632c, 0x0001, 0x7bcf, 0x0001, 0xa534, 
+	0x0001, 0xc638, 0x0001, 0xc618, 0x0002, 0xd6ba, 0x0001, 0xd69a, 
+	0x0001, 0xd6ba, 0x0001, 0xce59, 0x0001, 0xd6ba, 0x0001, 0xb596, 
+	0x0001, 0xce79, 0x0001, 0x8410, 0x0001, 0xa534, 0x0001, 0x7bcf, 
+	0x0004, 0x6b6d, 0x0001, 0x7bef, 0x0001, 0xbdf7, 0x0007, 0xd6ba, 
+	0x0001, 0xce59, 0x0001, 0x8430, 0x0001, 0xa514, 0x0001, 0xd69a, 
+	0x0002, 0xd6ba, 0x0001, 0x94b2, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x5acb, 0x0001, 0x4a69, 0x0001, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x6b6d, 
+	0x0005, 0xd6ba, 0x0001, 0xad75, 0x0001, 0x52aa, 0x0002, 0x528a, 
+	0x0002, 0x52aa, 0x0002, 0x5aeb, 0x0001, 0x8430, 0x0001, 0x8410, 
+	0x0002, 0xa534, 0x0001, 0x9cf3, 0x0001, 0xbdd7, 0x0001, 0x8c51, 
+	0x0001, 0xb5b6, 0x0001, 0x7bcf, 0x0001, 0x9492, 0x0001, 0x73ae, 
+	0x0005, 0x6b6d, 0x0001, 0x8c71, 0x0001, 0xce79, 0x0009, 0xd6ba, 
+	0x0001, 0xbdd7, 0x0001, 0x5acb, 0x0001, 0x738e, 0x0001, 0xa534, 
+	0x0002, 0xd6ba, 0x0001, 0x8c71, 0x0001, 0x4a69, 0x0002, 0x4a49, 
+	0x0002, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 
+	0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x4a49, 0x0001, 0x5aeb, 0x0001, 0x39c7, 0x0001, 0xc618, 
+	0x0001, 0xad75, 0x0001, 0xbdd7, 0x0004, 0xdedb, 0x0001, 0xb5b6, 
+	0x0001, 0x630c, 0x0001, 0x528a, 0x0002, 0x52aa, 0x0002, 0x5acb, 
+	0x0001, 0x5aeb, 0x0001, 0x630c, 0x0001, 0x632c, 0x0002, 0x6b4d, 
+	0x0001, 0x7bcf, 0x0002, 0x6b6d, 0x0006, 0x6b4d, 0x0001, 0x738e, 
+	0x0001, 0xa534, 0x0007, 0xdedb, 0x0001, 0xd6ba, 0x0001, 0xbdf7, 
+	0x0003, 0xdedb, 0x0001, 0xa514, 0x0001, 0x5acb, 0x0001, 0x52aa, 
+	0x0001, 0x738e, 0x0001, 0xad75, 0x0001, 0xdedb, 0x0001, 0x8c51, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0002, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x8410, 0x0001, 0xad55, 0x0001, 0x5aeb, 
+	0x0002, 0xd6ba, 0x0004, 0xdedb, 0x0001, 0xce79, 0x0001, 0x7bef, 
+	0x0001, 0x528a, 0x0002, 0x52aa, 0x0002, 0x5acb, 0x0002, 0x5aeb, 
+	0x0003, 0x630c, 0x0004, 0x632c, 0x0003, 0x6b4d, 0x0001, 0x9492, 
+	0x0001, 0xce59, 0x0009, 0xdedb, 0x0001, 0xa514, 0x0001, 0x8c71, 
+	0x0001, 0xd6ba, 0x0002, 0xdedb, 0x0001, 0x7bef, 0x0001, 0x52aa, 
+	0x0002, 0x528a, 0x0001, 0x738e, 0x0001, 0xbdd7, 0x0001, 0x7bcf, 
+	0x0001, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x31a6, 0x0001, 0x4208, 0x0001, 0x7bef, 0x0001, 0x39c7, 
+	0x0001, 0xa514, 0x0001, 0xce59, 0x0001, 0xad55, 0x0006, 0xdefb, 
+	0x0001, 0xb5b6, 0x0001, 0x73ae, 0x0001, 0x5acb, 0x0001, 0x52aa, 
+	0x0002, 0x5acb, 0x0002, 0x5aeb, 0x0004, 0x630c, 0x0002, 0x632c, 
+	0x0001, 0x73ae, 0x0001, 0x9cd3, 0x0001, 0xce59, 0x0008, 0xdefb, 
+	0x0001, 0xdedb, 0x0002, 0xdefb, 0x0001, 0xdedb, 0x0001, 0x6b4d, 
+	0x0001, 0x738e, 0x0001, 0xc618, 0x0001, 0xdefb, 0x0001, 0xd69a, 
+	0x0001, 0x632c, 0x0002, 0x528a, 0x0002, 0x4a69, 0x0001, 0x6b6d, 
+	0x0001, 0x52aa, 0x0001, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x39c7, 0x0001, 0x4a69, 0x0001, 0xc638, 
+	0x0001, 0x5acb, 0x0001, 0xbdd7, 0x0001, 0xdedb, 0x0001, 0xd69a, 
+	0x0006, 0xe71c, 0x0001, 0xce59, 0x0001, 0xa514, 0x0001, 0x8410, 
+	0x0001, 0x738e, 0x0001, 0x632c, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0x6b4d, 0x0001, 0x73ae, 0x0001, 0x8c51, 0x0001, 0xa514, 
+	0x0001, 0xc618, 0x0001, 0xdedb, 0x000a, 0xe71c, 0x0001, 0xbdd7, 
+	0x0001, 0xc638, 0x0002, 0xe71c, 0x0001, 0xbdd7, 0x0002, 0x5acb, 
+	0x0001, 0x9cf3, 0x0001, 0xe71c, 0x0001, 0xbdf7, 0x0001, 0x528a, 
+	0x0002, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0003, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x8410, 0x0001, 0x632c, 0x0001, 0x5acb, 0x0001, 0xe71c, 
+	0x0001, 0x8c71, 0x0001, 0xd69a, 0x000a, 0xe71c, 0x0001, 0xdedb, 
+	0x0002, 0xd6ba, 0x0001, 0xdedb, 0x000c, 0xe71c, 0x0001, 0xdefb, 
+	0x0002, 0xe71c, 0x0001, 0xd69a, 0x0001, 0x6b6d, 0x0001, 0xbdf7, 
+	0x0002, 0xe71c, 0x0001, 0x7bef, 0x0002, 0x52aa, 0x0001, 0x73ae, 
+	0x0001, 0xd69a, 0x0001, 0x9cf3, 0x0001, 0x4a69, 0x0002, 0x4a49, 
+	0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x39c7, 0x0001, 0xa514, 
+	0x0001, 0x9cf3, 0x0001, 0x738e, 0x0001, 0xe73c, 0x0001, 0xb5b6, 
+	0x0001, 0xdefb, 0x0002, 0xe71c, 0x0016, 0xe73c, 0x0001, 0xbdd7, 
+	0x0001, 0xce59, 0x0002, 0xe73c, 0x0001, 0x9492, 0x0001, 0x5aeb, 
+	0x0001, 0xb596, 0x0001, 0xe73c, 0x0001, 0xce59, 0x0001, 0x52aa, 
+	0x0002, 0x528a, 0x0001, 0x5aeb, 0x0001, 0xad55, 0x0001, 0x73ae, 
+	0x0001, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0003, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x4208, 0x0001, 0x9cd3, 0x0001, 0x4208, 0x0001, 0xad55, 
+	0x0001, 0xc618, 0x0001, 0x7bef, 0x0001, 0xe73c, 0x0001, 0xbdd7, 
+	0x0001, 0xe71c, 0x0013, 0xe73c, 0x0001, 0xdedb, 0x0002, 0xe73c, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x0001, 0xdedb, 0x0001, 0xe73c, 
+	0x0001, 0xd69a, 0x0001, 0x5acb, 0x0001, 0x52aa, 0x0001, 0xa514, 
+	0x0001, 0xe73c, 0x0001, 0x8c71, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0001, 0x4a49, 0x0001, 0x632c, 0x0001, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0001, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x528a, 
+	0x0001, 0x39e7, 0x0001, 0xc638, 0x0001, 0x630c, 0x0001, 0x94b2, 
+	0x0001, 0xd6ba, 0x0001, 0x8430, 0x0001, 0xef5d, 0x0001, 0xdedb, 
+	0x0001, 0xe71c, 0x000e, 0xef5d, 0x0001, 0xe71c, 0x0002, 0xef5d, 
+	0x0001, 0xbdf7, 0x0001, 0xb596, 0x0002, 0xef5d, 0x0001, 0x738e, 
+	0x0001, 0x73ae, 0x0001, 0xe71c, 0x0001, 0xef5d, 0x0001, 0x7bef, 
+	0x0001, 0x52aa, 0x0001, 0x528a, 0x0001, 0x9cf3, 0x0001, 0xdefb, 
+	0x0001, 0x5aeb, 0x0001, 0x4a69, 0x0003, 0x4a49, 0x0002, 0x4228, 
+	0x0001, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x630c, 
+	0x0001, 0x8c71, 0x0001, 0x39e7, 0x0001, 0xc638, 0x0001, 0x8c51, 
+	0x0001, 0x8410, 0x0001, 0xef5d, 0x0001, 0x94b2, 0x0001, 0xe73c, 
+	0x0001, 0xdefb, 0x0001, 0xdedb, 0x0001, 0xef5d, 0x0001, 0xe73c, 
+	0x0007, 0xef5d, 0x0001, 0xdefb, 0x0001, 0xe73c, 0x0001, 0xef5d, 
+	0x0001, 0xc618, 0x0001, 0xce59, 0x0001, 0xef5d, 0x0001, 0xdedb, 
+	0x0001, 0x6b4d, 0x0001, 0xd6ba, 0x0001, 0xef5d, 0x0001, 0xad75, 
+	0x0001, 0x52aa, 0x0001, 0x8410, 0x0001, 0xef5d, 0x0001, 0xc618, 
+	0x0003, 0x528a, 0x0001, 0x9492, 0x0001, 0x9cf3, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x630c, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0xbdf7, 
+	0x0001, 0x4208, 0x0001, 0x9cf3, 0x0001, 0xce79, 0x0001, 0x632c, 
+	0x0001, 0xef7d, 0x0001, 0xad75, 0x0001, 0xce59, 0x0001, 0xef7d, 
+	0x0001, 0xb596, 0x0001, 0xef7d, 0x0001, 0xe73c, 0x0001, 0xdedb, 
+	0x0001, 0xef7d, 0x0001, 0xd6ba, 0x0001, 0xdedb, 0x0001, 0xef7d, 
+	0x0002, 0xbdf7, 0x0001, 0xef7d, 0x0001, 0xc638, 0x0001, 0x8430, 
+	0x0002, 0xef7d, 0x0001, 0x6b6d, 0x0001, 0x7bef, 0x0001, 0xef7d, 
+	0x0001, 0xd6ba, 0x0002, 0x52aa, 0x0001, 0x9492, 0x0001, 0xef7d, 
+	0x0001, 0x632c, 0x0001, 0x528a, 0x0002, 0x4a69, 0x0001, 0x73ae, 
+	0x0001, 0x5acb, 0x0001, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0003, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x632c, 
+	0x0001, 0x8430, 0x0001, 0x39e7, 0x0001, 0xbdd7, 0x0001, 0x8c71, 
+	0x0001, 0x630c, 0x0001, 0xef7d, 0x0001, 0x6b4d, 0x0001, 0xce59, 
+	0x0001, 0xe73c, 0x0001, 0x7bef, 0x0001, 0xef7d, 0x0001, 0xd6ba, 
+	0x0001, 0xa534, 0x0001, 0xef7d, 0x0001, 0xc638, 0x0001, 0xad55, 
+	0x0001, 0xef7d, 0x0001, 0xbdf7, 0x0001, 0x8430, 0x0001, 0xef7d, 
+	0x0001, 0xdedb, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0001, 0xef7d, 
+	0x0001, 0x94b2, 0x0001, 0x52aa, 0x0001, 0xad75, 0x0001, 0xef7d, 
+	0x0001, 0x6b6d, 0x0002, 0x528a, 0x0001, 0xa534, 0x0001, 0xb596, 
+	0x0002, 0x4a69, 0x0003, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x528a, 
+	0x0001, 0x4228, 0x0001, 0x39e7, 0x0001, 0xad75, 0x0001, 0x4a49, 
+	0x0001, 0x738e, 0x0001, 0xdedb, 0x0001, 0x4228, 0x0001, 0xce59, 
+	0x0001, 0xd69a, 0x0001, 0x5aeb, 0x0001, 0xf79e, 0x0001, 0xc618, 
+	0x0001, 0x738e, 0x0001, 0xf79e, 0x0001, 0xbdf7, 0x0001, 0x6b6d, 
+	0x0001, 0xf79e, 0x0001, 0xc638, 0x0001, 0x52aa, 0x0001, 0xdedb, 
+	0x0001, 0xef7d, 0x0001, 0x5acb, 0x0001, 0x738e, 0x0001, 0xf79e, 
+	0x0001, 0xb596, 0x0001, 0x528a, 0x0001, 0x5acb, 0x0001, 0xdefb, 
+	0x0001, 0xa534, 0x0001, 0x528a, 0x0002, 0x4a69, 0x0001, 0xa514, 
+	0x0001, 0x630c, 0x0002, 0x4a49, 0x0003, 0x4228, 0x0002, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0003, 0x31a6, 0x0001, 0x3186, 
+	0x0003, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x4a49, 0x0001, 0x8410, 0x0001, 0x39e7, 0x0001, 0x7bef, 
+	0x0001, 0xad55, 0x0001, 0x4228, 0x0001, 0xce59, 0x0001, 0xad75, 
+	0x0001, 0x4a49, 0x0001, 0xef7d, 0x0001, 0xad55, 0x0001, 0x4a69, 
+	0x0001, 0xf79e, 0x0001, 0xbdd7, 0x0001, 0x4a69, 0x0001, 0xdefb, 
+	0x0001, 0xd69a, 0x0001, 0x4a69, 0x0001, 0xa514, 0x0001, 0xf7be, 
+	0x0001, 0x6b6d, 0x0001, 0x528a, 0x0001, 0xbdf7, 0x0001, 0xd6ba, 
+	0x0002, 0x528a, 0x0001, 0x73ae, 0x0001, 0xd69a, 0x0002, 0x4a69, 
+	0x0001, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x5acb, 0x0001, 0x4a49, 
+	0x0003, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 0x0003, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x0861, 0x0002, 0x0841, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x39c7, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x7bcf, 0x0001, 0x6b6d, 0x0001, 0x4208, 0x0001, 0xbdf7, 
+	0x0001, 0x7bcf, 0x0001, 0x4228, 0x0001, 0xdedb, 0x0001, 0x9492, 
+	0x0001, 0x4a49, 0x0001, 0xdefb, 0x0001, 0xb596, 0x0001, 0x4a49, 
+	0x0001, 0xb5b6, 0x0001, 0xdedb, 0x0001, 0x4a69, 0x0001, 0x630c, 
+	0x0001, 0xf79e, 0x0001, 0x7bef, 0x0001, 0x4a69, 0x0001, 0x6b4d, 
+	0x0001, 0xe71c, 0x0001, 0x5acb, 0x0002, 0x4a69, 0x0001, 0x9492, 
+	0x0001, 0x6b4d, 0x0003, 0x4a49, 0x0003, 0x4228, 0x0003, 0x4208, 
+	0x0002, 0x39e7, 0x0003, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0002, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x5aeb, 0x0001, 0x4228, 0x0001, 0x39e7, 0x0001, 0x9cf3, 
+	0x0001, 0x5acb, 0x0001, 0x4208, 0x0001, 0xbdf7, 0x0001, 0x7bcf, 
+	0x0001, 0x4228, 0x0001, 0xbdf7, 0x0001, 0xa534, 0x0001, 0x4a49, 
+	0x0001, 0x8410, 0x0001, 0xdedb, 0x0002, 0x4a49, 0x0001, 0xc618, 
+	0x0001, 0x94b2, 0x0002, 0x4a49, 0x0001, 0xad55, 0x0001, 0x7bef, 
+	0x0002, 0x4a49, 0x0001, 0x528a, 0x0001, 0x630c, 0x0005, 0x4228, 
+	0x0003, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0003, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0001, 0x0020, 0x0003, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0003, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0003, 0x31a6, 0x0001, 0x39c7, 
+	0x0003, 0x39e7, 0x0001, 0x73ae, 0x0001, 0x4228, 0x0001, 0x4208, 
+	0x0001, 0x9cd3, 0x0001, 0x632c, 0x0001, 0x4228, 0x0001, 0x8c71, 
+	0x0001, 0x9492, 0x0001, 0x4228, 0x0001, 0x528a, 0x0001, 0xbdf7, 
+	0x0001, 0x4a69, 0x0001, 0x4a49, 0x0001, 0x7bef, 0x0001, 0xa514, 
+	0x0002, 0x4a49, 0x0001, 0x630c, 0x0001, 0x8410, 0x0001, 0x4a49, 
+	0x0006, 0x4228, 0x0003, 0x4208, 0x0003, 0x39e7, 0x0002, 0x39c7, 
+	0x0003, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0004, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0004, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0002, 0x3186, 
+	0x0002, 0x31a6, 0x0004, 0x39c7, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0001, 0x6b6d, 0x0001, 0x528a, 0x0001, 0x4208, 0x0001, 0x632c, 
+	0x0001, 0x738e, 0x0002, 0x4228, 0x0001, 0x9492, 0x0001, 0x528a, 
+	0x0001, 0x4228, 0x0001, 0x4a69, 0x0001, 0x7bef, 0x0003, 0x4228, 
+	0x0001, 0x4a69, 0x0004, 0x4228, 0x0004, 0x4208, 0x0003, 0x39e7, 
+	0x0003, 0x39c7, 0x0003, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0001, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0003, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 0x0002, 0x39e7, 
+	0x0003, 0x4208, 0x0001, 0x4a49, 0x0001, 0x4a69, 0x0002, 0x4208, 
+	0x0001, 0x5acb, 0x0001, 0x4a69, 0x0005, 0x4228, 0x0008, 0x4208, 
+	0x0003, 0x39e7, 0x0003, 0x39c7, 0x0003, 0x31a6, 0x0003, 0x3186, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0005, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0003, 0x2965, 0x0003, 0x3186, 0x0003, 0x31a6, 0x0004, 0x39c7, 
+	0x0005, 0x39e7, 0x000d, 0x4208, 0x0004, 0x39e7, 0x0004, 0x39c7, 
+	0x0003, 0x31a6, 0x0002, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0005, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0002, 0x2965, 0x0004, 0x3186, 
+	0x0003, 0x31a6, 0x0005, 0x39c7, 0x0010, 0x39e7, 0x0005, 0x39c7, 
+	0x0003, 0x31a6, 0x0003, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0006, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0003, 0x2965, 0x0004, 0x3186, 
+	0x0003, 0x31a6, 0x0009, 0x39c7, 0x0003, 0x39e7, 0x0009, 0x39c7, 
+	0x0004, 0x31a6, 0x0003, 0x3186, 0x0004, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0006, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0007, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 
+	0x0003, 0x2124, 0x0002, 0x2945, 0x0004, 0x2965, 0x0004, 0x3186, 
+	0x0005, 0x31a6, 0x000e, 0x39c7, 0x0005, 0x31a6, 0x0004, 0x3186, 
+	0x0003, 0x2965, 0x0004, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 
+	0x0004, 0x2965, 0x0005, 0x3186, 0x0012, 0x31a6, 0x0005, 0x3186, 
+	0x0003, 0x2965, 0x0004, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0004, 0x2945, 
+	0x0005, 0x2965, 0x0006, 0x3186, 0x000a, 0x31a6, 0x0006, 0x3186, 
+	0x0004, 0x2965, 0x0005, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0009, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0004, 0x2124, 0x0004, 0x2945, 
+	0x0005, 0x2965, 0x0011, 0x3186, 0x0005, 0x2965, 0x0005, 0x2945, 
+	0x0004, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0004, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000a, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0005, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0004, 0x2104, 
+	0x0001, 0x4a69, 0x0003, 0x632c, 0x0001, 0x4a49, 0x0004, 0x2945, 
+	0x0015, 0x2965, 0x0001, 0x2945, 0x0002, 0x4a69, 0x0003, 0x2945, 
+	0x0004, 0x2124, 0x0003, 0x2104, 0x0004, 0x18e3, 0x0004, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x000a, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000b, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 0x0001, 0x2104, 
+	0x0001, 0x4a69, 0x0001, 0x5acb, 0x0001, 0x2965, 0x0001, 0x2124, 
+	0x0001, 0x3186, 0x0001, 0x5aeb, 0x0001, 0x4a49, 0x0007, 0x2945, 
+	0x000d, 0x2965, 0x0005, 0x2945, 0x0002, 0x4a69, 0x0001, 0x2945, 
+	0x0004, 0x2124, 0x0004, 0x2104, 0x0003, 0x18e3, 0x0004, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x000b, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000c, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0004, 0x18c3, 0x0002, 0x18e3, 0x0001, 0x2965, 
+	0x0001, 0x630c, 0x0001, 0x2124, 0x0003, 0x2104, 0x0001, 0x31a6, 
+	0x0001, 0x630c, 0x0001, 0x2124, 0x0001, 0x4228, 0x0002, 0x632c, 
+	0x0001, 0x5acb, 0x0001, 0x31a6, 0x0001, 0x2945, 0x0001, 0x632c, 
+	0x0001, 0x52aa, 0x0002, 0x632c, 0x0001, 0x4a69, 0x0001, 0x2945, 
+	0x0001, 0x3186, 0x0001, 0x5acb, 0x0002, 0x632c, 0x0001, 0x4228, 
+	0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x5aeb, 0x0001, 0x632c, 
+	0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x2945, 0x0002, 0x4a69, 
+	0x0001, 0x2124, 0x0001, 0x2965, 0x0001, 0x5acb, 0x0002, 0x632c, 
+	0x0001, 0x4228, 0x0001, 0x2104, 0x0004, 0x18e3, 0x0004, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x000c, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000d, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0004, 0x18c3, 0x0001, 0x18e3, 0x0001, 0x39c7, 
+	0x0001, 0x528a, 0x0002, 0x18e3, 0x0004, 0x2104, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0001, 0x31a6, 0x0001, 0x2124, 0x0001, 0x4228, 
+	0x0001, 0x5aeb, 0x0001, 0x2124, 0x0001, 0x632c, 0x0001, 0x5acb, 
+	0x0001, 0x2965, 0x0001, 0x4228, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0001, 0x4a49, 0x0001, 0x4a69, 0x0001, 0x2945, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0001, 0x31a6, 0x0001, 0x630c, 0x0001, 0x4228, 
+	0x0001, 0x2124, 0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0002, 0x4a69, 0x0001, 0x2124, 0x0001, 0x5acb, 0x0001, 0x39e7, 
+	0x0001, 0x2104, 0x0001, 0x2945, 0x0001, 0x630c, 0x0001, 0x3186, 
+	0x0002, 0x18e3, 0x0005, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x000d, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000e, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0003, 0x18c3, 
+	0x0001, 0x39c7, 0x0001, 0x528a, 0x0004, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x4208, 0x0001, 0x52aa, 0x0002, 0x2104, 0x0001, 0x2124, 
+	0x0001, 0x632c, 0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x4228, 
+	0x0001, 0x2124, 0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0001, 0x39c7, 0x0001, 0x632c, 0x0002, 0x4a69, 0x0001, 0x2945, 
+	0x0001, 0x31a6, 0x0001, 0x632c, 0x0003, 0x2124, 0x0001, 0x5acb, 
+	0x0001, 0x39e7, 0x0002, 0x4a49, 0x0001, 0x2945, 0x0005, 0x632c, 
+	0x0001, 0x39c7, 0x0001, 0x18e3, 0x0004, 0x18c3, 0x0005, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x000e, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000f, 0x0000, 0x0003, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 0x0005, 0x10a2, 
+	0x0001, 0x18c3, 0x0001, 0x2945, 0x0001, 0x630c, 0x0001, 0x2104, 
+	0x0003, 0x18e3, 0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x4208, 
+	0x0001, 0x4a69, 0x0002, 0x2104, 0x0001, 0x2124, 0x0001, 0x632c, 
+	0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x39e7, 0x0001, 0x2124, 
+	0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x2965, 0x0002, 0x2124, 
+	0x0001, 0x4208, 0x0001, 0x4a69, 0x0001, 0x632c, 0x0001, 0x4208, 
+	0x0001, 0x630c, 0x0003, 0x2104, 0x0001, 0x5acb, 0x0001, 0x39e7, 
+	0x0002, 0x4a49, 0x0001, 0x2945, 0x0001, 0x632c, 0x0001, 0x2104, 
+	0x0003, 0x18e3, 0x0005, 0x18c3, 0x0005, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x000f, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0010, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0002, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 0x0001, 0x18c3, 
+	0x0001, 0x528a, 0x0001, 0x52aa, 0x0001, 0x2124, 0x0001, 0x18c3, 
+	0x0001, 0x2945, 0x0001, 0x52aa, 0x0001, 0x4228, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x2965, 0x0001, 0x2104, 0x0001, 0x4228, 
+	0x0001, 0x5aeb, 0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x39e7, 
+	0x0001, 0x2104, 0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x2945, 
+	0x0002, 0x4a69, 0x0001, 0x2104, 0x0001, 0x2124, 0x0001, 0x5aeb, 
+	0x0001, 0x39c7, 0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x2104, 
+	0x0001, 0x31a6, 0x0001, 0x632c, 0x0001, 0x2945, 0x0002, 0x4a49, 
+	0x0001, 0x18e3, 0x0001, 0x5aeb, 0x0001, 0x39e7, 0x0001, 0x18e3, 
+	0x0001, 0x2965, 0x0001, 0x632c, 0x0001, 0x2124, 0x0002, 0x18c3, 
+	0x0005, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0010, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x3186, 0x0001, 0x4a49, 0x0001, 0x18c3, 0x0011, 0x0000, 
+	0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0005, 0x10a2, 0x0001, 0x18e3, 0x0001, 0x4a69, 0x0003, 0x632c, 
+	0x0001, 0x39e7, 0x0002, 0x18e3, 0x0001, 0x39e7, 0x0002, 0x632c, 
+	0x0001, 0x5acb, 0x0001, 0x2965, 0x0001, 0x18e3, 0x0001, 0x632c, 
+	0x0001, 0x39c7, 0x0001, 0x2104, 0x0001, 0x3186, 0x0001, 0x632c, 
+	0x0002, 0x2945, 0x0001, 0x5aeb, 0x0002, 0x632c, 0x0001, 0x4a69, 
+	0x0001, 0x18e3, 0x0001, 0x3186, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0x630c, 0x0001, 0x39c7, 0x0001, 0x18e3, 0x0002, 0x4a49, 
+	0x0001, 0x18e3, 0x0001, 0x2945, 0x0001, 0x52aa, 0x0002, 0x632c, 
+	0x0001, 0x39e7, 0x0001, 0x18c3, 0x0006, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 0x0011, 0x0000, 
+	0x0002, 0x4a49, 0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x2124, 
+	0x0013, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 
+	0x0001, 0x1082, 0x0006, 0x10a2, 0x0007, 0x18c3, 0x0017, 0x18e3, 
+	0x0007, 0x18c3, 0x0006, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x0012, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x4a49, 0x0001, 0x39c7, 0x0001, 0x1082, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0014, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 
+	0x0002, 0x0861, 0x0001, 0x1082, 0x0007, 0x10a2, 0x000a, 0x18c3, 
+	0x000b, 0x18e3, 0x000a, 0x18c3, 0x0007, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 0x0013, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x2945, 0x0001, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0014, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 
+	0x0008, 0x10a2, 0x0019, 0x18c3, 0x0008, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 0x0014, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0016, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0002, 0x1082, 
+	0x0009, 0x10a2, 0x0011, 0x18c3, 0x0009, 0x10a2, 0x0002, 0x1082, 
+	0x0002, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 0x0015, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x31a6, 0x0003, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x2945, 0x0017, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0003, 0x1082, 
+	0x001d, 0x10a2, 0x0003, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 
+	0x0003, 0x0020, 0x0016, 0x0000, 0x0001, 0x1082, 0x0002, 0x4a49, 
+	0x0001, 0x1082, 0x0003, 0x0000, 0x0001, 0x1082, 0x0002, 0x4a49, 
+	0x0001, 0x2104, 0x0018, 0x0000, 0x0004, 0x0020, 0x0003, 0x0841, 
+	0x0002, 0x0861, 0x0003, 0x1082, 0x0017, 0x10a2, 0x0003, 0x1082, 
+	0x0003, 0x0861, 0x0002, 0x0841, 0x0004, 0x0020, 0x0017, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x2965, 
+	0x0005, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 0x0001, 0x2945, 
+	0x0019, 0x0000, 0x0004, 0x0020, 0x0004, 0x0841, 0x0003, 0x0861, 
+	0x0006, 0x1082, 0x0009, 0x10a2, 0x0006, 0x1082, 0x0003, 0x0861, 
+	0x0004, 0x0841, 0x0004, 0x0020, 0x0018, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x3186, 0x0007, 0x0000, 
+	0x0001, 0x18c3, 0x0002, 0x4a49, 0x0001, 0x4208, 0x0001, 0x18e3, 
+	0x0001, 0x0020, 0x0018, 0x0000, 0x0005, 0x0020, 0x0005, 0x0841, 
+	0x0007, 0x0861, 0x0005, 0x1082, 0x0007, 0x0861, 0x0005, 0x0841, 
+	0x0005, 0x0020, 0x0018, 0x0000, 0x0001, 0x10a2, 0x0001, 0x39c7, 
+	0x0002, 0x4a49, 0x0001, 0x2965, 0x0009, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x31a6, 0x0003, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x2965, 
+	0x0001, 0x2124, 0x0018, 0x18e3, 0x000b, 0x2104, 0x000b, 0x2124, 
+	0x000b, 0x2104, 0x0017, 0x18e3, 0x0001, 0x2104, 0x0001, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x4228, 0x0002, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x18e3, 0x000c, 0x0000, 0x0001, 0x18c3, 0x0001, 0x3186, 
+	0x0001, 0x4228, 0x0057, 0x4a49, 0x0001, 0x39c7, 0x0001, 0x2124, 
+	0x0011, 0x0000, 0x0001, 0x10a2, 0x0001, 0x18e3, 0x0001, 0x2124, 
+	0x0050, 0x2965, 0x0001, 0x2945, 0x0001, 0x18e3, 0x0001, 0x18c3, 
+	0x0001, 0x0841, 0x0009, 0x0000, 
+};
+
+const FramebufferImage rawConsoleSelected = {106, 107, RGB565, TRUE, dataConsoleSelectedRaw, 9644};
@@ -0,0 +1,710 @@
+// generated by png2raw from Header.png
+
+const uint16_t dataHeaderRaw[] = {
+	0x00d5, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 0x0001, 0x18c3, 
+	0x0002, 0x18e3, 0x0001, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x00d9, 0x0000, 0x0001, 0x0861, 0x0001, 0x2945, 0x0001, 0x4208, 
+	0x0001, 0x4a69, 0x0001, 0x52aa, 0x0001, 0x528a, 0x0001, 0x4a69, 
+	0x0001, 0x4208, 0x0001, 0x31a6, 0x0001, 0x2124, 0x0001, 0x18c3, 
+	0x0001, 0x0841, 0x00d5, 0x0000, 0x0001, 0x0841, 0x0001, 0x2945, 
+	0x0001, 0x52aa, 0x0006, 0x738e, 0x0001, 0x6b4d, 0x0001, 0x5aeb, 
+	0x0001, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x2104, 0x0001, 0x0861, 
+	0x0001, 0x0020, 0x00d2, 0x0000, 0x0001, 0x0861, 0x0001, 0x4a49, 
+	0x0001, 0x738e, 0x0001, 0x5aeb, 0x0001, 0x31a6, 0x0001, 0x2124, 
+	0x0002, 0x18e3, 0x0001, 0x2965, 0x0001, 0x5aeb, 0x0001, 0x73ae, 
+	0x0001, 0x7bcf, 0x0001, 0x6b6d, 0x0001, 0x52aa, 0x0001, 0x39e7, 
+	0x0001, 0x2104, 0x0001, 0x1082, 0x0001, 0x0020, 0x00d0, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x52aa, 0x0001, 0x738e, 0x0001, 0x3186, 
+	0x0001, 0x2104, 0x0001, 0x4208, 0x0001, 0x52aa, 0x0001, 0x5acb, 
+	0x0001, 0x4a69, 0x0001, 0x2104, 0x0001, 0x0841, 0x0001, 0x4208, 
+	0x0002, 0x7bef, 0x0001, 0x738e, 0x0001, 0x52aa, 0x0001, 0x39e7, 
+	0x0001, 0x18e3, 0x0001, 0x0020, 0x00cf, 0x0000, 0x0001, 0x0841, 
+	0x0001, 0x5acb, 0x0001, 0x738e, 0x0001, 0x2104, 0x0001, 0x4208, 
+	0x0001, 0x7bcf, 0x0001, 0x8410, 0x0003, 0x8430, 0x0001, 0x7bef, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0001, 0x4a49, 0x0001, 0x8430, 
+	0x0001, 0x8410, 0x0001, 0x6b6d, 0x0001, 0x4a49, 0x0001, 0x39c7, 
+	0x0001, 0x18c3, 0x0009, 0x0000, 0x0001, 0x0020, 0x0001, 0x18e3, 
+	0x0001, 0x39e7, 0x0001, 0x5acb, 0x0001, 0x6b6d, 0x0002, 0x73ae, 
+	0x0001, 0x738e, 0x0001, 0x630c, 0x0001, 0x4228, 0x0001, 0x2124, 
+	0x0001, 0x0841, 0x004e, 0x0000, 0x0001, 0x0841, 0x0003, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x18e3, 0x0004, 0x0000, 0x0001, 0x18c3, 
+	0x000f, 0x2965, 0x0001, 0x2124, 0x0001, 0x10a2, 0x0001, 0x0841, 
+	0x004f, 0x0000, 0x0001, 0x4a49, 0x0001, 0x7bef, 0x0001, 0x2104, 
+	0x0001, 0x52aa, 0x0008, 0x8c51, 0x0001, 0x4208, 0x0001, 0x0841, 
+	0x0001, 0x73ae, 0x0001, 0x8c51, 0x0001, 0x8410, 0x0001, 0x630c, 
+	0x0001, 0x39c7, 0x0001, 0x2124, 0x0001, 0x0861, 0x0006, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x2945, 0x0001, 0x6b4d, 0x0001, 0x94b2, 
+	0x0009, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x39c7, 0x0001, 0x0861, 
+	0x004c, 0x0000, 0x0001, 0x3186, 0x0001, 0xc638, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0010, 0xce79, 
+	0x0001, 0xbdf7, 0x0001, 0xa514, 0x0001, 0x5aeb, 0x0001, 0x18e3, 
+	0x004c, 0x0000, 0x0001, 0x2104, 0x0001, 0x8430, 0x0001, 0x31a6, 
+	0x0001, 0x4228, 0x0001, 0x8c71, 0x0008, 0x9492, 0x0001, 0x8410, 
+	0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x9492, 0x0001, 0x8c71, 
+	0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x2104, 0x0001, 0x0841, 
+	0x0005, 0x0000, 0x0001, 0x10a2, 0x0001, 0x5acb, 0x0003, 0x9cd3, 
+	0x0001, 0x9492, 0x0001, 0x8410, 0x0001, 0x7bcf, 0x0002, 0x738e, 
+	0x0001, 0x7bcf, 0x0001, 0x8410, 0x0001, 0x8c71, 0x0003, 0x9cd3, 
+	0x0001, 0x738e, 0x0001, 0x2945, 0x004b, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0012, 0xce79, 0x0001, 0xbdd7, 
+	0x0001, 0x5acb, 0x0001, 0x0841, 0x0037, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x39e7, 0x0001, 0x4208, 0x0002, 0x39e7, 0x0001, 0x2104, 
+	0x000d, 0x0000, 0x0001, 0x5aeb, 0x0001, 0x6b6d, 0x0001, 0x2124, 
+	0x0001, 0x8430, 0x000a, 0x94b2, 0x0001, 0x3186, 0x0001, 0x18e3, 
+	0x0002, 0x94b2, 0x0001, 0x7bef, 0x0001, 0x52aa, 0x0001, 0x39e7, 
+	0x0001, 0x18c3, 0x0004, 0x0000, 0x0001, 0x2124, 0x0001, 0x7bef, 
+	0x0002, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x632c, 0x0001, 0x39c7, 
+	0x0001, 0x18c3, 0x0001, 0x0020, 0x0003, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x2965, 0x0001, 0x52aa, 0x0001, 0x8410, 0x0002, 0x9cd3, 
+	0x0001, 0x9492, 0x0001, 0x39e7, 0x004a, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0014, 0xce79, 0x0001, 0x738e, 
+	0x0037, 0x0000, 0x0001, 0x5acb, 0x0004, 0xce79, 0x0001, 0x738e, 
+	0x000c, 0x0000, 0x0001, 0x2104, 0x0001, 0x8c51, 0x0001, 0x31a6, 
+	0x0001, 0x52aa, 0x000b, 0x9cf3, 0x0001, 0x4a69, 0x0001, 0x0861, 
+	0x0001, 0x9492, 0x0001, 0x9cf3, 0x0001, 0x8c51, 0x0001, 0x5acb, 
+	0x0001, 0x2965, 0x0001, 0x1082, 0x0003, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x8430, 0x0002, 0x9cd3, 0x0001, 0x73ae, 0x0001, 0x2965, 
+	0x000a, 0x0000, 0x0001, 0x18e3, 0x0001, 0x5aeb, 0x0001, 0x94b2, 
+	0x0001, 0x9cd3, 0x0001, 0x94b2, 0x0001, 0x4208, 0x0049, 0x0000, 
+	0x0001, 0x31a6, 0x0004, 0xce79, 0x0001, 0x8c71, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0xce59, 
+	0x0009, 0xc618, 0x0001, 0xce59, 0x0007, 0xce79, 0x0001, 0x4228, 
+	0x0036, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x000c, 0x0000, 0x0001, 0x4a49, 
+	0x0001, 0x8c51, 0x0001, 0x2124, 0x0001, 0x7bef, 0x000b, 0xa534, 
+	0x0001, 0x52aa, 0x0001, 0x0861, 0x0001, 0x9492, 0x0001, 0xa534, 
+	0x0001, 0x94b2, 0x0001, 0x6b6d, 0x0001, 0x4a49, 0x0001, 0x18e3, 
+	0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x7bef, 0x0002, 0x9cd3, 
+	0x0001, 0x632c, 0x0001, 0x1082, 0x000d, 0x0000, 0x0001, 0x4228, 
+	0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x2965, 
+	0x0048, 0x0000, 0x0001, 0x10a2, 0x0001, 0x5aeb, 0x0002, 0x630c, 
+	0x0001, 0x632c, 0x0001, 0x39e7, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0xa534, 0x0001, 0x4208, 
+	0x0008, 0x39e7, 0x0001, 0x4228, 0x0001, 0x630c, 0x0001, 0xad55, 
+	0x0005, 0xce79, 0x0001, 0x9cf3, 0x0036, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 
+	0x000b, 0x0000, 0x0001, 0x0020, 0x0001, 0x738e, 0x0001, 0x6b6d, 
+	0x0001, 0x2945, 0x0001, 0x9492, 0x000b, 0xad55, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0xa534, 0x0001, 0xad55, 0x0001, 0x9492, 
+	0x0001, 0x5acb, 0x0001, 0x3186, 0x0001, 0x1082, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x5acb, 0x0002, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x0841, 0x000f, 0x0000, 0x0001, 0x4a69, 0x0002, 0x9cd3, 
+	0x0001, 0x7bcf, 0x0001, 0x1082, 0x0051, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x94b2, 0x000b, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0xa514, 0x0004, 0xce79, 0x0001, 0xbdd7, 
+	0x0001, 0x2104, 0x0035, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 
+	0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 0x000b, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x8c51, 0x0001, 0x630c, 0x0001, 0x2945, 
+	0x0001, 0x9cf3, 0x000a, 0xb596, 0x0001, 0xad55, 0x0001, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0xb596, 0x0001, 0xad75, 0x0001, 0x8c51, 
+	0x0001, 0x632c, 0x0001, 0x4228, 0x0001, 0x18c3, 0x0001, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x8410, 
+	0x0001, 0x18e3, 0x0010, 0x0000, 0x0001, 0x0841, 0x0001, 0x6b4d, 
+	0x0002, 0x9cd3, 0x0001, 0x4a49, 0x0051, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 
+	0x000b, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0003, 0xce79, 
+	0x0001, 0xbdf7, 0x0001, 0x39e7, 0x0035, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 
+	0x000b, 0x0000, 0x0001, 0x18c3, 0x0001, 0x9cd3, 0x0001, 0x630c, 
+	0x0001, 0x18e3, 0x0001, 0x9cf3, 0x000a, 0xb5b6, 0x0001, 0x9492, 
+	0x0001, 0x0861, 0x0001, 0x738e, 0x0001, 0xb5b6, 0x0001, 0xb596, 
+	0x0001, 0x9492, 0x0001, 0x52aa, 0x0001, 0x2104, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0001, 0x630c, 0x0002, 0x9cd3, 0x0001, 0x4a49, 
+	0x0012, 0x0000, 0x0001, 0x2945, 0x0001, 0x8c71, 0x0001, 0x9cd3, 
+	0x0001, 0x8410, 0x0001, 0x10a2, 0x000b, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x31a6, 0x0001, 0x4208, 0x0001, 0x39e7, 0x0001, 0x2965, 
+	0x0001, 0x0841, 0x0010, 0x0000, 0x0001, 0x1082, 0x0001, 0x2965, 
+	0x0001, 0x39e7, 0x0001, 0x4208, 0x0001, 0x39c7, 0x0001, 0x18e3, 
+	0x0011, 0x0000, 0x0001, 0x1082, 0x0001, 0x31a6, 0x0001, 0x4208, 
+	0x0001, 0x39e7, 0x0001, 0x31a6, 0x0001, 0x18e3, 0x0012, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x9cd3, 
+	0x0001, 0x0841, 0x000b, 0x0000, 0x0001, 0x2965, 0x0001, 0xb5b6, 
+	0x0003, 0xce79, 0x0001, 0xc618, 0x0001, 0x4228, 0x000a, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x2965, 0x0001, 0x4a49, 0x0002, 0x52aa, 
+	0x0001, 0x4a49, 0x0001, 0x2965, 0x0001, 0x0020, 0x0011, 0x0000, 
+	0x0001, 0x2945, 0x0001, 0x4228, 0x0001, 0x52aa, 0x0001, 0x5acb, 
+	0x0001, 0x4a69, 0x0001, 0x3186, 0x0001, 0x0841, 0x000b, 0x0000, 
+	0x0001, 0x528a, 0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 
+	0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x18c3, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x0841, 0x0001, 0x94b2, 0x000a, 0xbdf7, 
+	0x0001, 0x4228, 0x0001, 0x18c3, 0x0001, 0xb5b6, 0x0001, 0xbdf7, 
+	0x0001, 0xad55, 0x0001, 0x5acb, 0x0001, 0x4228, 0x0001, 0x31a6, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0001, 0x9492, 0x0001, 0x9cd3, 
+	0x0001, 0x8410, 0x0001, 0x18c3, 0x0012, 0x0000, 0x0001, 0x0841, 
+	0x0001, 0x632c, 0x0002, 0x9cd3, 0x0001, 0x31a6, 0x0002, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x6b6d, 0x0001, 0x4a49, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x31a6, 0x0001, 0x738e, 
+	0x0001, 0x9492, 0x0003, 0x94b2, 0x0001, 0x9492, 0x0001, 0x8c51, 
+	0x0001, 0x5acb, 0x0001, 0x18c3, 0x000c, 0x0000, 0x0001, 0x2104, 
+	0x0001, 0x5aeb, 0x0001, 0x8c51, 0x0004, 0x94b2, 0x0001, 0x9492, 
+	0x0001, 0x73ae, 0x0001, 0x39c7, 0x0001, 0x0020, 0x0006, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x52aa, 0x0001, 0x6b4d, 0x0001, 0x4228, 
+	0x0002, 0x0000, 0x0001, 0x10a2, 0x0001, 0x5aeb, 0x0001, 0x8c51, 
+	0x0004, 0x94b2, 0x0001, 0x9492, 0x0001, 0x6b6d, 0x0001, 0x3186, 
+	0x0006, 0x0000, 0x0001, 0x2104, 0x0001, 0x8410, 0x0002, 0x8c51, 
+	0x0001, 0x8c71, 0x0001, 0x5acb, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 
+	0x000b, 0x0000, 0x0001, 0x2124, 0x0001, 0xb596, 0x0003, 0xce79, 
+	0x0001, 0xbdf7, 0x0001, 0x39c7, 0x0008, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x6b4d, 0x0001, 0xa534, 0x0001, 0xc618, 0x0004, 0xc638, 
+	0x0001, 0xc618, 0x0001, 0xa534, 0x0001, 0x6b4d, 0x0001, 0x18e3, 
+	0x000c, 0x0000, 0x0001, 0x10a2, 0x0001, 0x5aeb, 0x0001, 0x9cf3, 
+	0x0001, 0xbdf7, 0x0004, 0xc638, 0x0001, 0xc618, 0x0001, 0xad75, 
+	0x0001, 0x73ae, 0x0001, 0x2124, 0x0005, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x73ae, 0x0001, 0x8c71, 0x0001, 0x8430, 0x0001, 0xa534, 
+	0x0001, 0xce59, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0xad75, 
+	0x0001, 0x8430, 0x0001, 0x8c51, 0x0001, 0x9492, 0x0001, 0x632c, 
+	0x0001, 0x1082, 0x0006, 0x0000, 0x0001, 0x1082, 0x0001, 0x8c71, 
+	0x0001, 0xa534, 0x0001, 0x1082, 0x0001, 0x6b4d, 0x0009, 0xc638, 
+	0x0001, 0x8430, 0x0001, 0x0841, 0x0001, 0x73ae, 0x0001, 0xc638, 
+	0x0001, 0xbdd7, 0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x39c7, 
+	0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x39c7, 0x0002, 0x9cd3, 
+	0x0001, 0x630c, 0x0014, 0x0000, 0x0001, 0x39e7, 0x0002, 0x9cd3, 
+	0x0001, 0x5aeb, 0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x632c, 0x0001, 0x9cd3, 0x0001, 0x738e, 0x0001, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x6b4d, 0x0002, 0x9cd3, 0x0001, 0x9492, 
+	0x0001, 0x8c71, 0x0001, 0x8c51, 0x0001, 0x8c71, 0x0001, 0x9492, 
+	0x0002, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x4228, 0x0001, 0x0020, 
+	0x0008, 0x0000, 0x0001, 0x0020, 0x0001, 0x4a69, 0x0001, 0x94b2, 
+	0x0002, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x8c71, 0x0001, 0x8c51, 
+	0x0001, 0x8c71, 0x0001, 0x94b2, 0x0002, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x10a2, 0x0005, 0x0000, 0x0001, 0x10a2, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0000, 0x0001, 0x39c7, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x94b2, 0x0001, 0x8c71, 
+	0x0001, 0x8c51, 0x0001, 0x8c71, 0x0001, 0x9492, 0x0002, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x5acb, 0x0001, 0x0020, 0x0004, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8c51, 
+	0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 
+	0x0001, 0x9cd3, 0x0001, 0x0841, 0x000b, 0x0000, 0x0001, 0x39c7, 
+	0x0001, 0xbdd7, 0x0003, 0xce79, 0x0001, 0xb596, 0x0001, 0x10a2, 
+	0x0006, 0x0000, 0x0001, 0x0841, 0x0001, 0x630c, 0x0001, 0xbdf7, 
+	0x0001, 0xce59, 0x0008, 0xce79, 0x0001, 0xce59, 0x0001, 0xbdf7, 
+	0x0001, 0x630c, 0x0001, 0x0841, 0x0008, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x4a69, 0x0001, 0xb5b6, 0x0001, 0xce59, 0x0008, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0xc638, 0x0001, 0x73ae, 0x0001, 0x1082, 
+	0x0003, 0x0000, 0x0001, 0x2104, 0x0001, 0xb5b6, 0x000b, 0xce79, 
+	0x0001, 0x9cf3, 0x0001, 0x18c3, 0x0006, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0001, 0x4a49, 0x0001, 0x0841, 
+	0x0001, 0xa514, 0x0007, 0xce59, 0x0001, 0x9492, 0x0001, 0x1082, 
+	0x0001, 0x4228, 0x0001, 0xc618, 0x0001, 0xce59, 0x0001, 0xbdd7, 
+	0x0001, 0x8430, 0x0001, 0x39c7, 0x0001, 0x3186, 0x0001, 0x18e3, 
+	0x0001, 0x0000, 0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x9492, 
+	0x0001, 0x39e7, 0x0014, 0x0000, 0x0001, 0x2104, 0x0001, 0x8430, 
+	0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x1082, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 
+	0x0001, 0x1082, 0x0001, 0x738e, 0x0001, 0x9cd3, 0x0001, 0x8430, 
+	0x0001, 0x528a, 0x0001, 0x2945, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x1082, 0x0001, 0x2945, 0x0001, 0x5acb, 0x0001, 0x8c71, 
+	0x0002, 0x9cd3, 0x0001, 0x528a, 0x0007, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x5aeb, 0x0002, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x52aa, 
+	0x0001, 0x2124, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x10a2, 
+	0x0001, 0x39e7, 0x0001, 0x7bcf, 0x0001, 0x94b2, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x10a2, 0x0004, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x630c, 0x0001, 0x3186, 
+	0x0001, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x632c, 0x0001, 0x2965, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x1082, 0x0001, 0x2945, 
+	0x0001, 0x5aeb, 0x0001, 0x9492, 0x0002, 0x9cd3, 0x0001, 0x528a, 
+	0x0004, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 0x000b, 0x0000, 
+	0x0001, 0x73ae, 0x0004, 0xce79, 0x0001, 0x8410, 0x0006, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x8410, 0x000e, 0xce79, 0x0001, 0x8c51, 
+	0x0001, 0x1082, 0x0006, 0x0000, 0x0001, 0x0841, 0x0001, 0x738e, 
+	0x000e, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x18c3, 0x0002, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0xb5b6, 0x000b, 0xce79, 0x0001, 0xa514, 
+	0x0001, 0x18c3, 0x0007, 0x0000, 0x0001, 0x4a49, 0x0001, 0xc638, 
+	0x0001, 0xad75, 0x0001, 0x2104, 0x0001, 0x18e3, 0x0001, 0x9cd3, 
+	0x0001, 0xc638, 0x0001, 0xce79, 0x0001, 0xd69a, 0x0001, 0xce59, 
+	0x0001, 0xbdd7, 0x0001, 0x6b6d, 0x0001, 0x0861, 0x0001, 0x39e7, 
+	0x0001, 0xc618, 0x0001, 0xd69a, 0x0001, 0xc638, 0x0001, 0x94b2, 
+	0x0001, 0x5aeb, 0x0001, 0x630c, 0x0001, 0x18c3, 0x0002, 0x0000, 
+	0x0001, 0x7bef, 0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x2104, 
+	0x0014, 0x0000, 0x0001, 0x0841, 0x0001, 0x6b6d, 0x0001, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x18e3, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x738e, 0x0001, 0x630c, 
+	0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x0001, 0x10a2, 0x0007, 0x0000, 
+	0x0001, 0x2945, 0x0001, 0x8410, 0x0002, 0x9cd3, 0x0001, 0x39c7, 
+	0x0006, 0x0000, 0x0001, 0x4a49, 0x0002, 0x9cd3, 0x0001, 0x7bef, 
+	0x0001, 0x2104, 0x0006, 0x0000, 0x0001, 0x0020, 0x0001, 0x52aa, 
+	0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0020, 
+	0x0003, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x73ae, 0x0002, 0x8c51, 0x0001, 0x31a6, 0x0007, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x8430, 
+	0x0001, 0x18e3, 0x0003, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x94b2, 0x000a, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x5acb, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0xad75, 0x0001, 0x18e3, 0x0005, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x7bef, 0x0005, 0xce79, 0x0001, 0xb596, 0x0001, 0x8c71, 
+	0x0001, 0x73ae, 0x0001, 0x738e, 0x0001, 0x8c71, 0x0001, 0xb596, 
+	0x0005, 0xce79, 0x0001, 0x8430, 0x0001, 0x0841, 0x0005, 0x0000, 
+	0x0001, 0x6b4d, 0x0005, 0xce79, 0x0001, 0xb5b6, 0x0001, 0x9492, 
+	0x0001, 0x73ae, 0x0001, 0x738e, 0x0001, 0x8c51, 0x0001, 0xad75, 
+	0x0005, 0xce79, 0x0001, 0x94b2, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0001, 0x18c3, 0x0001, 0x9492, 0x0001, 0xa534, 0x0001, 0xa514, 
+	0x0001, 0xb5b6, 0x0001, 0xce59, 0x0002, 0xce79, 0x0001, 0xce59, 
+	0x0001, 0xbdd7, 0x0002, 0xa534, 0x0001, 0xad55, 0x0001, 0x7bef, 
+	0x0001, 0x1082, 0x0007, 0x0000, 0x0001, 0x2104, 0x0001, 0x9492, 
+	0x0001, 0xdedb, 0x0001, 0x9cf3, 0x0001, 0x2124, 0x0001, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x6b4d, 0x0001, 0x738e, 0x0001, 0x528a, 
+	0x0001, 0x18c3, 0x0001, 0x0861, 0x0001, 0x630c, 0x0001, 0xd69a, 
+	0x0001, 0xdedb, 0x0001, 0xce59, 0x0001, 0xa534, 0x0001, 0x73ae, 
+	0x0001, 0x5aeb, 0x0002, 0x0861, 0x0002, 0x0000, 0x0001, 0x8c51, 
+	0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x0861, 0x0015, 0x0000, 
+	0x0001, 0x5aeb, 0x0002, 0x9cd3, 0x0001, 0x2965, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x632c, 0x0001, 0x9cd3, 0x0001, 0x9492, 
+	0x0001, 0x9cd3, 0x0001, 0x738e, 0x0001, 0x0861, 0x0009, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0x8c51, 0x0001, 0x9cd3, 0x0001, 0x8c51, 
+	0x0001, 0x0861, 0x0004, 0x0000, 0x0001, 0x2104, 0x0001, 0x8c51, 
+	0x0001, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x18c3, 0x0009, 0x0000, 
+	0x0001, 0x5acb, 0x0001, 0x9cd3, 0x0001, 0x94b2, 0x0001, 0x4208, 
+	0x0003, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0002, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x3186, 0x0009, 0x0000, 0x0001, 0x630c, 
+	0x0002, 0x9cd3, 0x0001, 0x4228, 0x0003, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0xad75, 
+	0x0001, 0x5acb, 0x0007, 0x528a, 0x0001, 0x52aa, 0x0001, 0x630c, 
+	0x0001, 0x9492, 0x0003, 0xce79, 0x0001, 0xce59, 0x0001, 0xa534, 
+	0x0001, 0x31a6, 0x0006, 0x0000, 0x0001, 0x528a, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0xce59, 0x0001, 0x8430, 0x0001, 0x2945, 
+	0x0004, 0x0000, 0x0001, 0x2124, 0x0001, 0x7bef, 0x0001, 0xce59, 
+	0x0004, 0xce79, 0x0001, 0x528a, 0x0004, 0x0000, 0x0001, 0x31a6, 
+	0x0001, 0xce59, 0x0004, 0xce79, 0x0001, 0x9492, 0x0001, 0x3186, 
+	0x0004, 0x0000, 0x0001, 0x18e3, 0x0001, 0x73ae, 0x0001, 0xc638, 
+	0x0004, 0xce79, 0x0001, 0x6b6d, 0x0002, 0x0000, 0x0002, 0x0861, 
+	0x0001, 0x0020, 0x0001, 0x5aeb, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x738e, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0008, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x4a49, 0x0001, 0xbdd7, 0x0001, 0xdefb, 0x0001, 0xc618, 
+	0x0001, 0x630c, 0x0001, 0x2965, 0x0002, 0x18c3, 0x0001, 0x2965, 
+	0x0001, 0x52aa, 0x0001, 0xad75, 0x0002, 0xdefb, 0x0001, 0xce79, 
+	0x0001, 0xad75, 0x0001, 0x8410, 0x0001, 0x52aa, 0x0001, 0x2124, 
+	0x0001, 0x2104, 0x0003, 0x0000, 0x0001, 0x8c71, 0x0001, 0x9cd3, 
+	0x0001, 0x73ae, 0x0016, 0x0000, 0x0001, 0x528a, 0x0002, 0x9cd3, 
+	0x0001, 0x39c7, 0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 
+	0x0002, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x2945, 0x000b, 0x0000, 
+	0x0001, 0x4a69, 0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x4a49, 
+	0x0004, 0x0000, 0x0001, 0x5acb, 0x0002, 0x9cd3, 0x0001, 0x31a6, 
+	0x000a, 0x0000, 0x0001, 0x0841, 0x0001, 0x8430, 0x0001, 0x9cd3, 
+	0x0001, 0x73ae, 0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0002, 0x9cd3, 0x0001, 0x630c, 0x000a, 0x0000, 
+	0x0001, 0x2124, 0x0002, 0x9cd3, 0x0001, 0x5aeb, 0x0003, 0x0000, 
+	0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 
+	0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 0x0011, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x8c51, 0x0001, 0x10a2, 0x0006, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0xa534, 0x0003, 0xce79, 0x0001, 0xce59, 
+	0x0001, 0x8410, 0x0001, 0x0020, 0x0007, 0x0000, 0x0001, 0x73ae, 
+	0x0004, 0xce79, 0x0001, 0xad55, 0x0001, 0x18c3, 0x0002, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x94b2, 0x0004, 0xce79, 0x0001, 0x9492, 
+	0x0001, 0x0861, 0x0007, 0x0000, 0x0001, 0x6b4d, 0x0001, 0xc638, 
+	0x0003, 0xce79, 0x0001, 0xbdf7, 0x0001, 0x18e3, 0x0004, 0x0000, 
+	0x0001, 0x528a, 0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 
+	0x0001, 0x6b4d, 0x000d, 0x0000, 0x0001, 0x1082, 0x0001, 0x632c, 
+	0x0001, 0xbdf7, 0x0001, 0xe71c, 0x0001, 0xe73c, 0x0001, 0xdefb, 
+	0x0002, 0xc638, 0x0001, 0xdefb, 0x0003, 0xe73c, 0x0001, 0xce59, 
+	0x0001, 0xa534, 0x0001, 0x8410, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x10a2, 0x0004, 0x0000, 0x0001, 0x8c71, 0x0001, 0x9cd3, 
+	0x0001, 0x738e, 0x0016, 0x0000, 0x0001, 0x4a69, 0x0002, 0x9cd3, 
+	0x0001, 0x39e7, 0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 
+	0x0002, 0x9cd3, 0x0001, 0x632c, 0x0001, 0x0020, 0x000b, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x8430, 0x0001, 0x9cd3, 0x0001, 0x7bef, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x10a2, 0x0001, 0x7bef, 
+	0x0001, 0x9cd3, 0x0001, 0x7bcf, 0x0001, 0x0841, 0x000b, 0x0000, 
+	0x0001, 0x4228, 0x0001, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x2965, 
+	0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x2104, 0x000a, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x0001, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0011, 0xce79, 0x0001, 0xce59, 0x0001, 0x9cf3, 0x0001, 0x632c, 
+	0x0001, 0x2124, 0x0005, 0x0000, 0x0001, 0x4a69, 0x0001, 0xc638, 
+	0x0003, 0xce79, 0x0001, 0xad55, 0x0001, 0x10a2, 0x0008, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0xa534, 0x0004, 0xce79, 0x0001, 0x4228, 
+	0x0002, 0x0000, 0x0001, 0x2945, 0x0001, 0xce59, 0x0003, 0xce79, 
+	0x0001, 0xb596, 0x0001, 0x2124, 0x0008, 0x0000, 0x0001, 0x0841, 
+	0x0001, 0x9492, 0x0003, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b4d, 
+	0x0004, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x000e, 0x0000, 0x0001, 0x18e3, 
+	0x0001, 0x5aeb, 0x0001, 0x9cf3, 0x0001, 0xce79, 0x0001, 0xe71c, 
+	0x0003, 0xef5d, 0x0001, 0xdedb, 0x0001, 0xce79, 0x0001, 0xb5b6, 
+	0x0001, 0x8410, 0x0001, 0x7bef, 0x0001, 0x39c7, 0x0001, 0x4208, 
+	0x0001, 0x0000, 0x0001, 0x0841, 0x0004, 0x0000, 0x0001, 0x8c71, 
+	0x0001, 0x9cd3, 0x0001, 0x738e, 0x0016, 0x0000, 0x0001, 0x4a69, 
+	0x0002, 0x9cd3, 0x0001, 0x4208, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0002, 0x9cd3, 0x0001, 0x4228, 0x000d, 0x0000, 
+	0x0001, 0x6b4d, 0x0001, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x18c3, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0x94b2, 0x0001, 0x9cd3, 
+	0x0001, 0x4228, 0x000c, 0x0000, 0x0001, 0x18e3, 0x0001, 0x94b2, 
+	0x0001, 0x9cd3, 0x0001, 0x4a69, 0x0002, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x0020, 
+	0x000a, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bef, 0x0001, 0x9cd3, 
+	0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0014, 0xce79, 0x0001, 0xad55, 
+	0x0001, 0x31a6, 0x0004, 0x0000, 0x0001, 0x7bef, 0x0003, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b4d, 0x000a, 0x0000, 0x0001, 0x528a, 
+	0x0004, 0xce79, 0x0001, 0x7bcf, 0x0001, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x630c, 0x0004, 0xce79, 0x0001, 0x738e, 0x000a, 0x0000, 
+	0x0001, 0x4a69, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x9cf3, 
+	0x0004, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x000f, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x4a49, 0x0001, 0x73ae, 0x0001, 0x94b2, 0x0001, 0xa534, 
+	0x0001, 0xb5b6, 0x0001, 0xad55, 0x0001, 0x94b2, 0x0001, 0x9492, 
+	0x0001, 0x630c, 0x0001, 0x6b4d, 0x0002, 0x2945, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0005, 0x0000, 0x0001, 0x8c71, 0x0001, 0x9cd3, 
+	0x0001, 0x73ae, 0x0016, 0x0000, 0x0001, 0x528a, 0x0002, 0x9cd3, 
+	0x0001, 0x39c7, 0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 
+	0x0001, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x3186, 0x000d, 0x0000, 
+	0x0001, 0x4a49, 0x0002, 0x94b2, 0x0001, 0x31a6, 0x0002, 0x0000, 
+	0x0001, 0x4228, 0x0002, 0x9cd3, 0x0001, 0x2104, 0x000c, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x630c, 
+	0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x738e, 0x000b, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bcf, 
+	0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 
+	0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 
+	0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 
+	0x0001, 0xb596, 0x0001, 0x630c, 0x0001, 0x5acb, 0x0008, 0x5aeb, 
+	0x0001, 0x738e, 0x0001, 0xa514, 0x0005, 0xce79, 0x0001, 0xad55, 
+	0x0001, 0x2104, 0x0002, 0x0000, 0x0001, 0x0841, 0x0001, 0x9cd3, 
+	0x0003, 0xce79, 0x0001, 0xc618, 0x0001, 0x2965, 0x000a, 0x0000, 
+	0x0001, 0x2124, 0x0001, 0xbdf7, 0x0003, 0xce79, 0x0001, 0xa514, 
+	0x0001, 0x1082, 0x0001, 0x0000, 0x0001, 0x8c51, 0x0003, 0xce79, 
+	0x0001, 0xc638, 0x0001, 0x4228, 0x000a, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0xad75, 0x0003, 0xce79, 0x0001, 0xb596, 0x0001, 0x10a2, 
+	0x0003, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x0010, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x2104, 0x0001, 0x4208, 0x0001, 0x52aa, 0x0001, 0x630c, 
+	0x0001, 0x5aeb, 0x0001, 0x5acb, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0001, 0x2124, 0x0001, 0x0841, 0x0001, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x0841, 
+	0x0015, 0x0000, 0x0001, 0x5aeb, 0x0002, 0x9cd3, 0x0001, 0x2965, 
+	0x0001, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 
+	0x0001, 0x8430, 0x0001, 0x2104, 0x000d, 0x0000, 0x0001, 0x3186, 
+	0x0002, 0x94b2, 0x0001, 0x4a49, 0x0002, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x39c7, 0x0001, 0x2124, 
+	0x000b, 0x2945, 0x0001, 0x2965, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x738e, 0x0001, 0x0020, 0x0001, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 
+	0x0009, 0x0000, 0x0001, 0x0020, 0x0001, 0x1082, 0x0001, 0x4a69, 
+	0x0001, 0xbdf7, 0x0004, 0xce79, 0x0001, 0x8430, 0x0002, 0x0000, 
+	0x0001, 0x18e3, 0x0001, 0xa534, 0x0003, 0xce79, 0x0001, 0xb596, 
+	0x0001, 0x0841, 0x000a, 0x0000, 0x0001, 0x10a2, 0x0001, 0x9cf3, 
+	0x0003, 0xce79, 0x0001, 0xbdd7, 0x0001, 0x18c3, 0x0001, 0x0000, 
+	0x0001, 0xa514, 0x0003, 0xce79, 0x0001, 0xb596, 0x0001, 0x2945, 
+	0x000b, 0x0000, 0x0001, 0x94b2, 0x0003, 0xce79, 0x0001, 0xbdd7, 
+	0x0001, 0x2965, 0x0003, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 
+	0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 0x0012, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x0841, 
+	0x000a, 0x0000, 0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x8430, 
+	0x0001, 0x18e3, 0x0014, 0x0000, 0x0001, 0x0841, 0x0001, 0x6b6d, 
+	0x0002, 0x9cd3, 0x0001, 0x18e3, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x18c3, 
+	0x000d, 0x0000, 0x0001, 0x2124, 0x0001, 0x9492, 0x0001, 0x9cd3, 
+	0x0001, 0x52aa, 0x0002, 0x0000, 0x0001, 0x5aeb, 0x0002, 0x9cd3, 
+	0x0001, 0x94b2, 0x000d, 0x9492, 0x0002, 0x9cd3, 0x0001, 0x73ae, 
+	0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 0x000c, 0x0000, 
+	0x0001, 0x5aeb, 0x0001, 0xc638, 0x0003, 0xce79, 0x0001, 0xb5b6, 
+	0x0001, 0x2965, 0x0001, 0x0000, 0x0001, 0x2945, 0x0001, 0xad75, 
+	0x0003, 0xce79, 0x0001, 0xa514, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x8c51, 0x0003, 0xce79, 0x0001, 0xc618, 0x0001, 0x18e3, 
+	0x0001, 0x0020, 0x0001, 0xb596, 0x0003, 0xce79, 0x0001, 0xa514, 
+	0x0001, 0x18e3, 0x000b, 0x0000, 0x0001, 0x8410, 0x0003, 0xce79, 
+	0x0001, 0xbdf7, 0x0001, 0x39e7, 0x0003, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 
+	0x0023, 0x0000, 0x0001, 0x632c, 0x0001, 0x9cd3, 0x0001, 0x9492, 
+	0x0001, 0x39c7, 0x0014, 0x0000, 0x0001, 0x18e3, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x1082, 0x0001, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 
+	0x0001, 0x18c3, 0x000d, 0x0000, 0x0001, 0x2104, 0x0001, 0x9492, 
+	0x0001, 0x9cd3, 0x0001, 0x52aa, 0x0002, 0x0000, 0x0001, 0x5aeb, 
+	0x0001, 0x9cd3, 0x0001, 0x94b2, 0x0010, 0x8c71, 0x0001, 0x6b6d, 
+	0x0001, 0x0861, 0x0001, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 0x000c, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0xad75, 0x0003, 0xce79, 0x0001, 0xc638, 
+	0x0001, 0x5aeb, 0x0001, 0x0000, 0x0001, 0x2945, 0x0001, 0xb596, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x8430, 0x0003, 0xce79, 0x0001, 0xc638, 0x0001, 0x2104, 
+	0x0001, 0x0020, 0x0001, 0xb596, 0x0003, 0xce79, 0x0001, 0x9cf3, 
+	0x0001, 0x18c3, 0x000b, 0x0000, 0x0001, 0x7bef, 0x0003, 0xce79, 
+	0x0001, 0xbdf7, 0x0001, 0x4208, 0x0003, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 
+	0x0023, 0x0000, 0x0001, 0x4208, 0x0002, 0x9cd3, 0x0001, 0x5acb, 
+	0x0014, 0x0000, 0x0001, 0x31a6, 0x0001, 0x94b2, 0x0001, 0x9cd3, 
+	0x0001, 0x630c, 0x0001, 0x0841, 0x0001, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x18e3, 
+	0x000d, 0x0000, 0x0001, 0x2945, 0x0001, 0x9492, 0x0001, 0x9cd3, 
+	0x0001, 0x528a, 0x0002, 0x0000, 0x0001, 0x5acb, 0x0001, 0x9cd3, 
+	0x0001, 0x8c71, 0x0001, 0x2124, 0x0001, 0x0841, 0x000e, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 0x000d, 0x0000, 
+	0x0001, 0x94b2, 0x0004, 0xce79, 0x0001, 0x73ae, 0x0001, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0xad55, 0x0003, 0xce79, 0x0001, 0xa534, 
+	0x000b, 0x0000, 0x0001, 0x1082, 0x0001, 0x9492, 0x0003, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x18c3, 0x0001, 0x0000, 0x0001, 0xad55, 
+	0x0003, 0xce79, 0x0001, 0xa534, 0x0001, 0x2104, 0x000b, 0x0000, 
+	0x0001, 0x8c51, 0x0003, 0xce79, 0x0001, 0xbdf7, 0x0001, 0x39c7, 
+	0x0003, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b6d, 0x0023, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x1082, 
+	0x0012, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0002, 0x9cd3, 
+	0x0001, 0x39c7, 0x0002, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 
+	0x0001, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x2965, 0x000d, 0x0000, 
+	0x0001, 0x39c7, 0x0002, 0x94b2, 0x0001, 0x4208, 0x0002, 0x0000, 
+	0x0001, 0x528a, 0x0001, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x18e3, 
+	0x0012, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bcf, 
+	0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 
+	0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 
+	0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 
+	0x0001, 0x9cd3, 0x0001, 0x0841, 0x000d, 0x0000, 0x0001, 0x9492, 
+	0x0004, 0xce79, 0x0001, 0x8410, 0x0001, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0xa514, 0x0003, 0xce79, 0x0001, 0xbdd7, 0x0001, 0x10a2, 
+	0x000a, 0x0000, 0x0001, 0x18e3, 0x0001, 0xad75, 0x0003, 0xce79, 
+	0x0001, 0xad75, 0x0001, 0x10a2, 0x0001, 0x0000, 0x0001, 0x9cd3, 
+	0x0003, 0xce79, 0x0001, 0xbdf7, 0x0001, 0x31a6, 0x000a, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0xa514, 0x0003, 0xce79, 0x0001, 0xbdd7, 
+	0x0001, 0x2124, 0x0003, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 
+	0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 0x0023, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x632c, 0x0001, 0x9cd3, 0x0001, 0x94b2, 
+	0x0001, 0x4228, 0x0012, 0x0000, 0x0001, 0x2124, 0x0001, 0x8c71, 
+	0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x10a2, 0x0002, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x94b2, 
+	0x0001, 0x4208, 0x000d, 0x0000, 0x0001, 0x52aa, 0x0001, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x2945, 0x0002, 0x0000, 0x0001, 0x39e7, 
+	0x0002, 0x9cd3, 0x0001, 0x3186, 0x000d, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x2104, 0x0001, 0x10a2, 0x0002, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 
+	0x000d, 0x0000, 0x0001, 0xa534, 0x0004, 0xce79, 0x0001, 0x7bef, 
+	0x0002, 0x0000, 0x0001, 0x8c71, 0x0003, 0xce79, 0x0001, 0xc638, 
+	0x0001, 0x4228, 0x000a, 0x0000, 0x0001, 0x31a6, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x8c71, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0001, 0x73ae, 0x0004, 0xce79, 0x0001, 0x52aa, 0x000a, 0x0000, 
+	0x0001, 0x2965, 0x0001, 0xb5b6, 0x0003, 0xce79, 0x0001, 0xad75, 
+	0x0001, 0x0841, 0x0003, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 
+	0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 0x0024, 0x0000, 
+	0x0001, 0x2945, 0x0002, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x1082, 
+	0x0011, 0x0000, 0x0001, 0x630c, 0x0002, 0x9cd3, 0x0001, 0x4a69, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 
+	0x0002, 0x9cd3, 0x0001, 0x5aeb, 0x000d, 0x0000, 0x0001, 0x73ae, 
+	0x0001, 0x9cd3, 0x0001, 0x8c71, 0x0001, 0x0861, 0x0002, 0x0000, 
+	0x0001, 0x2945, 0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x52aa, 
+	0x000c, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bef, 0x0001, 0x8c51, 
+	0x0001, 0x5aeb, 0x0002, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 
+	0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 
+	0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 
+	0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 
+	0x0003, 0xce79, 0x0001, 0x9cd3, 0x0001, 0x0841, 0x000c, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0xc618, 0x0004, 0xce79, 0x0001, 0x6b4d, 
+	0x0002, 0x0000, 0x0001, 0x6b4d, 0x0001, 0xce59, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x8c51, 0x000a, 0x0000, 0x0001, 0x7bcf, 
+	0x0004, 0xce79, 0x0001, 0x630c, 0x0002, 0x0000, 0x0001, 0x4228, 
+	0x0004, 0xce79, 0x0001, 0x9492, 0x0001, 0x0841, 0x0009, 0x0000, 
+	0x0001, 0x6b4d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x8c51, 
+	0x0004, 0x0000, 0x0001, 0x52aa, 0x0001, 0xc638, 0x0002, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x6b4d, 0x0024, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x6b4d, 0x0002, 0x9cd3, 0x0001, 0x5aeb, 0x0001, 0x0020, 
+	0x000f, 0x0000, 0x0001, 0x39e7, 0x0001, 0x94b2, 0x0001, 0x9cd3, 
+	0x0001, 0x8430, 0x0001, 0x18c3, 0x0003, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0002, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x18c3, 
+	0x000b, 0x0000, 0x0001, 0x2124, 0x0001, 0x8c71, 0x0001, 0x9cd3, 
+	0x0001, 0x6b6d, 0x0003, 0x0000, 0x0001, 0x0861, 0x0001, 0x73ae, 
+	0x0001, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x1082, 0x000b, 0x0000, 
+	0x0001, 0x39e7, 0x0002, 0x9cd3, 0x0001, 0x4a69, 0x0002, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 
+	0x000b, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 
+	0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0x94b2, 
+	0x000c, 0x0000, 0x0001, 0x2104, 0x0001, 0x9cf3, 0x0004, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x4208, 0x0002, 0x0000, 0x0001, 0x2965, 
+	0x0001, 0xbdd7, 0x0003, 0xce79, 0x0001, 0xc618, 0x0001, 0x39c7, 
+	0x0008, 0x0000, 0x0001, 0x3186, 0x0001, 0xbdf7, 0x0003, 0xce79, 
+	0x0001, 0xc638, 0x0001, 0x3186, 0x0002, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0xbdf7, 0x0003, 0xce79, 0x0001, 0xc638, 0x0001, 0x4a69, 
+	0x0008, 0x0000, 0x0001, 0x2104, 0x0001, 0xb596, 0x0003, 0xce79, 
+	0x0001, 0xce59, 0x0001, 0x4228, 0x0004, 0x0000, 0x0001, 0x52aa, 
+	0x0001, 0xc638, 0x0002, 0xce79, 0x0001, 0xce59, 0x0001, 0x6b6d, 
+	0x0025, 0x0000, 0x0001, 0x18e3, 0x0001, 0x8430, 0x0001, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x528a, 0x000e, 0x0000, 0x0001, 0x31a6, 
+	0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x94b2, 0x0001, 0x39c7, 
+	0x0004, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0003, 0x9cd3, 
+	0x0001, 0x5acb, 0x000b, 0x0000, 0x0001, 0x6b4d, 0x0002, 0x9cd3, 
+	0x0001, 0x2965, 0x0004, 0x0000, 0x0001, 0x4a69, 0x0002, 0x9cd3, 
+	0x0001, 0x4a69, 0x000a, 0x0000, 0x0001, 0x0841, 0x0001, 0x8410, 
+	0x0001, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x10a2, 0x0002, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 
+	0x000b, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 
+	0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 
+	0x0001, 0x6b6d, 0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0xa514, 
+	0x0001, 0x2945, 0x0001, 0x2104, 0x0008, 0x2124, 0x0001, 0x31a6, 
+	0x0001, 0x630c, 0x0001, 0xa534, 0x0005, 0xce79, 0x0001, 0x9cf3, 
+	0x0001, 0x0841, 0x0003, 0x0000, 0x0001, 0x8c51, 0x0004, 0xce79, 
+	0x0001, 0xad75, 0x0001, 0x3186, 0x0006, 0x0000, 0x0001, 0x2965, 
+	0x0001, 0xad55, 0x0004, 0xce79, 0x0001, 0x8430, 0x0001, 0x0841, 
+	0x0003, 0x0000, 0x0001, 0x6b4d, 0x0004, 0xce79, 0x0001, 0xb5b6, 
+	0x0001, 0x4208, 0x0006, 0x0000, 0x0001, 0x2104, 0x0001, 0x9cf3, 
+	0x0004, 0xce79, 0x0001, 0xa534, 0x0001, 0x0841, 0x0004, 0x0000, 
+	0x0001, 0x528a, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x9492, 
+	0x0026, 0x0000, 0x0001, 0x3186, 0x0001, 0x9492, 0x0001, 0x9cd3, 
+	0x0001, 0x94b2, 0x0001, 0x630c, 0x0001, 0x10a2, 0x000a, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x4a69, 0x0001, 0x8c71, 0x0002, 0x9cd3, 
+	0x0001, 0x528a, 0x0001, 0x0020, 0x0004, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x8430, 
+	0x0001, 0x94b2, 0x0001, 0x4208, 0x0009, 0x0000, 0x0001, 0x4a49, 
+	0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0020, 
+	0x0004, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x9492, 0x0001, 0x31a6, 0x0009, 0x0000, 0x0001, 0x5aeb, 
+	0x0002, 0x9cd3, 0x0001, 0x52aa, 0x0003, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0003, 0xce79, 0x0001, 0xc638, 0x0001, 0xb596, 
+	0x0001, 0xad75, 0x0008, 0xb596, 0x0001, 0xbdd7, 0x0001, 0xce59, 
+	0x0005, 0xce79, 0x0001, 0xc638, 0x0001, 0x39e7, 0x0004, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0xbdd7, 0x0004, 0xce79, 0x0001, 0xb5b6, 
+	0x0001, 0x6b6d, 0x0001, 0x3186, 0x0002, 0x1082, 0x0001, 0x2965, 
+	0x0001, 0x6b4d, 0x0001, 0xb5b6, 0x0004, 0xce79, 0x0001, 0xb5b6, 
+	0x0001, 0x2965, 0x0004, 0x0000, 0x0001, 0x18c3, 0x0001, 0xa534, 
+	0x0004, 0xce79, 0x0001, 0xbdd7, 0x0001, 0x73ae, 0x0001, 0x39c7, 
+	0x0001, 0x10a2, 0x0001, 0x1082, 0x0001, 0x2945, 0x0001, 0x632c, 
+	0x0001, 0xad75, 0x0004, 0xce79, 0x0001, 0xce59, 0x0001, 0x39c7, 
+	0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0xbdf7, 0x0003, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x8410, 0x0001, 0x52aa, 0x0001, 0x5aeb, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0022, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0x8c71, 0x0002, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x528a, 
+	0x0001, 0x18e3, 0x0006, 0x0000, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x7bcf, 0x0001, 0x94b2, 0x0001, 0x9cd3, 0x0001, 0x94b2, 
+	0x0001, 0x528a, 0x0001, 0x0020, 0x0005, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x73ae, 0x0001, 0x4208, 
+	0x0001, 0x8c51, 0x0001, 0x9492, 0x0001, 0x5acb, 0x0001, 0x1082, 
+	0x0005, 0x0000, 0x0001, 0x0861, 0x0001, 0x5acb, 0x0001, 0x94b2, 
+	0x0001, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x18c3, 0x0006, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0x8c71, 0x0001, 0x9cd3, 0x0001, 0x8c71, 
+	0x0001, 0x4a49, 0x0001, 0x0841, 0x0005, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x632c, 0x0002, 0x9cd3, 0x0001, 0x7bcf, 0x0001, 0x0841, 
+	0x0003, 0x0000, 0x0001, 0x1082, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0001, 0x6b4d, 0x000b, 0x0000, 0x0001, 0x0861, 0x0001, 0x7bcf, 
+	0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0x0841, 0x0002, 0x0000, 
+	0x0001, 0x3186, 0x0001, 0xc618, 0x0003, 0xce79, 0x0001, 0x8430, 
+	0x0004, 0x0000, 0x0001, 0x6b6d, 0x0001, 0xce59, 0x0014, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x528a, 0x0006, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0xc618, 0x0004, 0xce79, 0x0001, 0xce59, 0x0001, 0xbdd7, 
+	0x0002, 0xb596, 0x0001, 0xbdd7, 0x0001, 0xce59, 0x0004, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x4a49, 0x0006, 0x0000, 0x0001, 0x3186, 
+	0x0001, 0xb5b6, 0x0005, 0xce79, 0x0001, 0xbdf7, 0x0001, 0xb5b6, 
+	0x0001, 0xb596, 0x0001, 0xbdd7, 0x0001, 0xce59, 0x0005, 0xce79, 
+	0x0001, 0x5acb, 0x0006, 0x0000, 0x0001, 0x18e3, 0x0001, 0xad75, 
+	0x0005, 0xce79, 0x0002, 0xc638, 0x0001, 0x9cd3, 0x0001, 0x18c3, 
+	0x0023, 0x0000, 0x0001, 0x2104, 0x0001, 0x73ae, 0x0003, 0x9cd3, 
+	0x0001, 0x9492, 0x0001, 0x7bef, 0x0001, 0x6b4d, 0x0002, 0x5aeb, 
+	0x0001, 0x632c, 0x0001, 0x7bcf, 0x0001, 0x8c71, 0x0001, 0x94b2, 
+	0x0002, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x39c7, 0x0001, 0x0020, 
+	0x0006, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x1082, 0x0001, 0x39c7, 0x0001, 0x94b2, 
+	0x0001, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x632c, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4228, 0x0001, 0x630c, 0x0001, 0x8430, 
+	0x0002, 0x9cd3, 0x0001, 0x8430, 0x0001, 0x2124, 0x0008, 0x0000, 
+	0x0001, 0x39e7, 0x0001, 0x9492, 0x0001, 0x9cd3, 0x0001, 0x94b2, 
+	0x0001, 0x8410, 0x0001, 0x5acb, 0x0001, 0x4208, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x6b4d, 0x0001, 0x8c71, 0x0002, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x18c3, 0x0004, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x8410, 0x0001, 0x9cd3, 0x0001, 0x6b4d, 0x000b, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x7bcf, 0x0001, 0x9cd3, 0x0001, 0x6b6d, 
+	0x0001, 0x0841, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xc618, 
+	0x0003, 0xce79, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xce59, 0x0012, 0xce79, 0x0001, 0xce59, 0x0001, 0x9cd3, 
+	0x0001, 0x31a6, 0x0008, 0x0000, 0x0001, 0x4208, 0x0001, 0xb5b6, 
+	0x000c, 0xce79, 0x0001, 0xb5b6, 0x0001, 0x4228, 0x0008, 0x0000, 
+	0x0001, 0x3186, 0x0001, 0xad55, 0x0001, 0xce59, 0x000b, 0xce79, 
+	0x0001, 0xc618, 0x0001, 0x52aa, 0x0001, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x738e, 0x0001, 0xce59, 0x0006, 0xce79, 0x0001, 0x9cf3, 
+	0x0001, 0x18c3, 0x0024, 0x0000, 0x0001, 0x0020, 0x0001, 0x39e7, 
+	0x0001, 0x7bcf, 0x0001, 0x9492, 0x0008, 0x9cd3, 0x0001, 0x94b2, 
+	0x0001, 0x8430, 0x0001, 0x528a, 0x0001, 0x10a2, 0x0008, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 
+	0x0001, 0x18c3, 0x0001, 0x0000, 0x0001, 0x3186, 0x0001, 0x7bef, 
+	0x0001, 0x94b2, 0x0006, 0x9cd3, 0x0001, 0x9492, 0x0001, 0x6b4d, 
+	0x0001, 0x10a2, 0x000a, 0x0000, 0x0001, 0x2945, 0x0001, 0x73ae, 
+	0x0001, 0x9492, 0x0006, 0x9cd3, 0x0001, 0x94b2, 0x0001, 0x9492, 
+	0x0001, 0x5aeb, 0x0001, 0x1082, 0x0005, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x7bef, 0x0001, 0x9492, 0x0001, 0x6b4d, 0x000b, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x73ae, 0x0001, 0x9492, 0x0001, 0x6b4d, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0001, 0x3186, 0x0001, 0xbdd7, 
+	0x0003, 0xc618, 0x0001, 0x8430, 0x0004, 0x0000, 0x0001, 0x6b6d, 
+	0x0001, 0xc618, 0x000c, 0xc638, 0x0003, 0xc618, 0x0001, 0xbdf7, 
+	0x0001, 0xad55, 0x0001, 0x7bef, 0x0001, 0x39e7, 0x0001, 0x0020, 
+	0x000a, 0x0000, 0x0001, 0x18e3, 0x0001, 0x7bef, 0x0001, 0xbdf7, 
+	0x0001, 0xc638, 0x0006, 0xce79, 0x0001, 0xc638, 0x0001, 0xbdf7, 
+	0x0001, 0x8410, 0x0001, 0x2104, 0x000a, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x738e, 0x0001, 0xbdd7, 0x0001, 0xc638, 0x0001, 0xce59, 
+	0x0005, 0xce79, 0x0001, 0xce59, 0x0001, 0xc618, 0x0001, 0x8c71, 
+	0x0001, 0x2945, 0x0009, 0x0000, 0x0001, 0x0841, 0x0001, 0x738e, 
+	0x0001, 0xbdf7, 0x0002, 0xc638, 0x0001, 0xce59, 0x0002, 0xc638, 
+	0x0001, 0x94b2, 0x0001, 0x18c3, 0x0026, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x2124, 0x0001, 0x4a69, 0x0001, 0x632c, 0x0001, 0x73ae, 
+	0x0002, 0x8410, 0x0001, 0x7bcf, 0x0001, 0x6b6d, 0x0001, 0x52aa, 
+	0x0001, 0x3186, 0x0001, 0x0861, 0x000a, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x18c3, 
+	0x0002, 0x0000, 0x0001, 0x0841, 0x0001, 0x31a6, 0x0001, 0x5aeb, 
+	0x0001, 0x73ae, 0x0001, 0x8410, 0x0001, 0x7bef, 0x0001, 0x6b6d, 
+	0x0001, 0x528a, 0x0001, 0x2104, 0x000e, 0x0000, 0x0001, 0x2965, 
+	0x0001, 0x5acb, 0x0001, 0x738e, 0x0002, 0x8410, 0x0001, 0x7bcf, 
+	0x0001, 0x6b4d, 0x0001, 0x4a69, 0x0001, 0x18e3, 0x0007, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x2124, 0x0001, 0x2965, 0x0001, 0x18e3, 
+	0x000b, 0x0000, 0x0001, 0x0020, 0x0001, 0x2104, 0x0001, 0x3186, 
+	0x0001, 0x2104, 0x0003, 0x0000, 0x0001, 0x0861, 0x0001, 0x31a6, 
+	0x0002, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x2124, 0x0004, 0x0000, 
+	0x0001, 0x2104, 0x0001, 0x39e7, 0x000c, 0x4208, 0x0001, 0x39e7, 
+	0x0001, 0x39c7, 0x0001, 0x2965, 0x0001, 0x18c3, 0x0010, 0x0000, 
+	0x0001, 0x18e3, 0x0001, 0x5acb, 0x0001, 0x8410, 0x0001, 0x9cd3, 
+	0x0002, 0xa534, 0x0001, 0x9cd3, 0x0001, 0x8410, 0x0001, 0x5acb, 
+	0x0001, 0x2104, 0x000e, 0x0000, 0x0001, 0x10a2, 0x0001, 0x528a, 
+	0x0001, 0x7bef, 0x0001, 0x94b2, 0x0001, 0xa534, 0x0001, 0xad55, 
+	0x0001, 0x9cf3, 0x0001, 0x8430, 0x0001, 0x630c, 0x0001, 0x2124, 
+	0x000d, 0x0000, 0x0001, 0x18c3, 0x0001, 0x4208, 0x0001, 0x5acb, 
+	0x0001, 0x630c, 0x0001, 0x5aeb, 0x0001, 0x528a, 0x0001, 0x2965, 
+	0x0001, 0x0020, 0x002b, 0x0000, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x000f, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x18c3, 0x0006, 0x0000, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0014, 0x0000, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x006a, 0x0000, 0x0001, 0x0020, 0x0055, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x18c3, 
+	0x00de, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x18c3, 0x00de, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x18c3, 
+	0x00de, 0x0000, 0x0001, 0x0020, 0x0001, 0x630c, 0x0001, 0x9cd3, 
+	0x0001, 0x7bef, 0x0001, 0x18c3, 0x00de, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x630c, 0x0001, 0x9cd3, 0x0001, 0x7bef, 0x0001, 0x18c3, 
+	0x00de, 0x0000, 0x0001, 0x0020, 0x0001, 0x632c, 0x0001, 0x9cd3, 
+	0x0001, 0x8410, 0x0001, 0x18c3, 0x00de, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x39c7, 0x0001, 0x630c, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x00c0, 0x0000, 
+};
+
+const FramebufferImage rawHeader = {227, 46, RGB565, TRUE, dataHeaderRaw, 5626};
@@ -0,0 +1,1152 @@
+// generated by png2raw from iPhoneOSSelected.png
+
+const uint16_t dataiPhoneOSSelectedRaw[] = {
+	0x000a, 0x0000, 0x0001, 0x0841, 0x0001, 0x1082, 0x0052, 0x18e3, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0011, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x2965, 0x0001, 0x4208, 0x0056, 0x4a49, 0x0001, 0x4228, 
+	0x0001, 0x31a6, 0x0001, 0x18e3, 0x000c, 0x0000, 0x0001, 0x0020, 
+	0x0001, 0x3186, 0x0003, 0x4a49, 0x0001, 0x4208, 0x0001, 0x39c7, 
+	0x0021, 0x2965, 0x0011, 0x3186, 0x0020, 0x2965, 0x0001, 0x3186, 
+	0x0001, 0x39e7, 0x0003, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x10a2, 
+	0x0009, 0x0000, 0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x4228, 0x0001, 0x2945, 0x0001, 0x0841, 0x0019, 0x0000, 
+	0x0006, 0x0020, 0x0005, 0x0841, 0x000f, 0x0861, 0x0005, 0x0841, 
+	0x0007, 0x0020, 0x0017, 0x0000, 0x0001, 0x0020, 0x0001, 0x18e3, 
+	0x0001, 0x4208, 0x0002, 0x4a49, 0x0001, 0x2965, 0x0007, 0x0000, 
+	0x0001, 0x1082, 0x0002, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x0841, 
+	0x0019, 0x0000, 0x0004, 0x0020, 0x0004, 0x0841, 0x0004, 0x0861, 
+	0x0012, 0x1082, 0x0003, 0x0861, 0x0004, 0x0841, 0x0005, 0x0020, 
+	0x0018, 0x0000, 0x0001, 0x2124, 0x0002, 0x4a49, 0x0001, 0x2965, 
+	0x0005, 0x0000, 0x0001, 0x0861, 0x0002, 0x4a49, 0x0001, 0x2945, 
+	0x0019, 0x0000, 0x0003, 0x0020, 0x0004, 0x0841, 0x0002, 0x0861, 
+	0x0007, 0x1082, 0x000d, 0x10a2, 0x0007, 0x1082, 0x0002, 0x0861, 
+	0x0004, 0x0841, 0x0004, 0x0020, 0x0017, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x2104, 0x0004, 0x0000, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0018, 0x0000, 
+	0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 0x0005, 0x1082, 
+	0x0017, 0x10a2, 0x0005, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 
+	0x0004, 0x0020, 0x0016, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0001, 0x18e3, 0x0001, 0x4a49, 
+	0x0001, 0x4208, 0x0017, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 
+	0x0001, 0x0861, 0x0004, 0x1082, 0x001f, 0x10a2, 0x0004, 0x1082, 
+	0x0001, 0x0861, 0x0003, 0x0841, 0x0004, 0x0020, 0x0015, 0x0000, 
+	0x0001, 0x2965, 0x0001, 0x4a49, 0x0001, 0x3186, 0x0002, 0x0000, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x18c3, 0x0015, 0x0000, 
+	0x0003, 0x0020, 0x0002, 0x0841, 0x0002, 0x0861, 0x0004, 0x1082, 
+	0x000c, 0x10a2, 0x000b, 0x18c3, 0x000c, 0x10a2, 0x0004, 0x1082, 
+	0x0002, 0x0861, 0x0002, 0x0841, 0x0004, 0x0020, 0x0013, 0x0000, 
+	0x0001, 0x0020, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0002, 0x1082, 
+	0x0001, 0x4a49, 0x0001, 0x4208, 0x0015, 0x0000, 0x0002, 0x0020, 
+	0x0003, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 0x0009, 0x10a2, 
+	0x0015, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x2104, 0x0001, 0x18c3, 
+	0x0007, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 0x0003, 0x0841, 
+	0x0003, 0x0020, 0x0013, 0x0000, 0x0001, 0x2945, 0x0001, 0x4a49, 
+	0x0001, 0x2124, 0x0001, 0x2104, 0x0001, 0x4a49, 0x0001, 0x2945, 
+	0x0013, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0003, 0x1082, 0x0008, 0x10a2, 0x000b, 0x18c3, 0x0007, 0x18e3, 
+	0x0004, 0x18c3, 0x0001, 0x10a2, 0x0001, 0x2945, 0x0001, 0x8410, 
+	0x0001, 0xdedb, 0x0001, 0xffdf, 0x0001, 0xb5b6, 0x0001, 0x10a2, 
+	0x0001, 0x18c3, 0x0007, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0012, 0x0000, 0x0001, 0x1082, 
+	0x0001, 0x4a49, 0x0001, 0x39c7, 0x0001, 0x3186, 0x0001, 0x4a49, 
+	0x0001, 0x18c3, 0x0012, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 
+	0x0002, 0x0861, 0x0002, 0x1082, 0x0007, 0x10a2, 0x0008, 0x18c3, 
+	0x000f, 0x18e3, 0x0001, 0x18c3, 0x0001, 0x2945, 0x0001, 0xa514, 
+	0x0002, 0xffff, 0x0002, 0xffdf, 0x0001, 0xb596, 0x0001, 0x10a2, 
+	0x0004, 0x18c3, 0x0006, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0011, 0x0000, 0x0002, 0x4a49, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0011, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 
+	0x0006, 0x10a2, 0x0006, 0x18c3, 0x0012, 0x18e3, 0x0001, 0x18c3, 
+	0x0001, 0x6b6d, 0x0001, 0xffdf, 0x0001, 0xffff, 0x0001, 0xf7be, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0001, 0xf79e, 0x0001, 0x8410, 
+	0x0007, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0003, 0x0020, 0x0010, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000f, 0x0000, 0x0003, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0006, 0x10a2, 0x0005, 0x18c3, 0x0008, 0x18e3, 
+	0x000c, 0x2104, 0x0001, 0x18e3, 0x0001, 0xa534, 0x0001, 0xffff, 
+	0x0001, 0xf7be, 0x0001, 0xef7d, 0x0002, 0xef5d, 0x0001, 0xe73c, 
+	0x0001, 0xf7be, 0x0001, 0x528a, 0x0003, 0x18e3, 0x0006, 0x18c3, 
+	0x0005, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0003, 0x0020, 0x000f, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000e, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 0x0002, 0x1082, 
+	0x0005, 0x10a2, 0x0005, 0x18c3, 0x0006, 0x18e3, 0x000f, 0x2104, 
+	0x0001, 0x18e3, 0x0001, 0xb5b6, 0x0001, 0xffff, 0x0001, 0xef7d, 
+	0x0004, 0xef5d, 0x0001, 0xe73c, 0x0001, 0xef5d, 0x0001, 0x2945, 
+	0x0005, 0x18e3, 0x0005, 0x18c3, 0x0005, 0x10a2, 0x0003, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0003, 0x0020, 0x000e, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x000d, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0003, 0x1082, 0x0005, 0x10a2, 0x0004, 0x18c3, 
+	0x0006, 0x18e3, 0x0006, 0x2104, 0x000a, 0x2124, 0x0001, 0x2104, 
+	0x0001, 0x9cf3, 0x0001, 0xffff, 0x0002, 0xef7d, 0x0003, 0xef5d, 
+	0x0001, 0xe73c, 0x0001, 0xef7d, 0x0001, 0xbdf7, 0x0001, 0x18c3, 
+	0x0002, 0x2104, 0x0005, 0x18e3, 0x0005, 0x18c3, 0x0004, 0x10a2, 
+	0x0003, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0003, 0x0020, 
+	0x000d, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000c, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 
+	0x0004, 0x18c3, 0x0005, 0x18e3, 0x0005, 0x2104, 0x000e, 0x2124, 
+	0x0001, 0x630c, 0x0001, 0xffff, 0x0001, 0xf79e, 0x0001, 0xef7d, 
+	0x0002, 0xef5d, 0x0003, 0xe73c, 0x0001, 0xf7be, 0x0001, 0x5acb, 
+	0x0005, 0x2104, 0x0005, 0x18e3, 0x0004, 0x18c3, 0x0005, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x000c, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000b, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0005, 0x10a2, 
+	0x0004, 0x18c3, 0x0004, 0x18e3, 0x0005, 0x2104, 0x0006, 0x2124, 
+	0x000a, 0x2945, 0x0001, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xef7d, 
+	0x0002, 0xef5d, 0x0003, 0xe73c, 0x0001, 0xef5d, 0x0001, 0xce79, 
+	0x0001, 0x2104, 0x0002, 0x2124, 0x0005, 0x2104, 0x0004, 0x18e3, 
+	0x0005, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x000b, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000a, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0005, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 
+	0x0004, 0x2104, 0x0006, 0x2124, 0x0006, 0x2945, 0x0005, 0x2965, 
+	0x0001, 0x2945, 0x0001, 0x94b2, 0x0001, 0xffff, 0x0001, 0xf79e, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0004, 0xe73c, 0x0001, 0xef7d, 
+	0x0001, 0x4a49, 0x0001, 0x2124, 0x0001, 0x2945, 0x0004, 0x2124, 
+	0x0004, 0x2104, 0x0004, 0x18e3, 0x0004, 0x18c3, 0x0004, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0003, 0x0020, 
+	0x000a, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000a, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 
+	0x0004, 0x18c3, 0x0004, 0x18e3, 0x0004, 0x2104, 0x0004, 0x2124, 
+	0x0005, 0x2945, 0x000a, 0x2965, 0x0001, 0xf7be, 0x0001, 0xffdf, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0003, 0xe73c, 0x0001, 0xe71c, 
+	0x0001, 0xe73c, 0x0001, 0x7bcf, 0x0001, 0x2104, 0x0004, 0x2945, 
+	0x0003, 0x2124, 0x0005, 0x2104, 0x0003, 0x18e3, 0x0004, 0x18c3, 
+	0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0009, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0004, 0x18c3, 0x0003, 0x18e3, 0x0004, 0x2104, 
+	0x0004, 0x2124, 0x0004, 0x2945, 0x0007, 0x2965, 0x0005, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0xffff, 0x0001, 0xf79e, 0x0003, 0xe73c, 
+	0x0001, 0xe71c, 0x0001, 0xdedb, 0x0001, 0xd69a, 0x0001, 0x9492, 
+	0x0001, 0x2124, 0x0001, 0x2945, 0x0002, 0x2965, 0x0004, 0x2945, 
+	0x0004, 0x2124, 0x0003, 0x2104, 0x0004, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0008, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0008, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0004, 0x18c3, 0x0003, 0x18e3, 0x0003, 0x2104, 
+	0x0004, 0x2124, 0x0003, 0x2945, 0x0006, 0x2965, 0x0008, 0x3186, 
+	0x0001, 0x2965, 0x0001, 0xbdd7, 0x0001, 0xffff, 0x0001, 0xef7d, 
+	0x0001, 0xe73c, 0x0001, 0xdefb, 0x0001, 0xd6ba, 0x0001, 0xc618, 
+	0x0001, 0xbdf7, 0x0001, 0x94b2, 0x0001, 0x2945, 0x0006, 0x2965, 
+	0x0004, 0x2945, 0x0004, 0x2124, 0x0002, 0x2104, 0x0004, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0007, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 
+	0x0003, 0x2104, 0x0004, 0x2124, 0x0002, 0x2945, 0x0005, 0x2965, 
+	0x0005, 0x3186, 0x0006, 0x31a6, 0x0001, 0x2965, 0x0001, 0xe73c, 
+	0x0001, 0xf79e, 0x0001, 0xd6ba, 0x0001, 0xc638, 0x0001, 0xb596, 
+	0x0001, 0xa534, 0x0001, 0xbdd7, 0x0001, 0x8430, 0x0001, 0x2945, 
+	0x0005, 0x3186, 0x0004, 0x2965, 0x0003, 0x2945, 0x0004, 0x2124, 
+	0x0002, 0x2104, 0x0004, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0007, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0006, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 
+	0x0003, 0x2945, 0x0004, 0x2965, 0x0004, 0x3186, 0x0006, 0x31a6, 
+	0x0004, 0x39c7, 0x0001, 0xad75, 0x0001, 0xa514, 0x0001, 0x9492, 
+	0x0001, 0x9cd3, 0x0001, 0xb5b6, 0x0001, 0xbdd7, 0x0001, 0x5acb, 
+	0x0001, 0x2945, 0x0001, 0x3186, 0x0003, 0x31a6, 0x0004, 0x3186, 
+	0x0004, 0x2965, 0x0003, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0002, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0006, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0005, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0004, 0x2965, 0x0003, 0x3186, 0x0005, 0x31a6, 0x0007, 0x39c7, 
+	0x0001, 0x4a49, 0x0001, 0xb5b6, 0x0001, 0xa534, 0x0001, 0xbdf7, 
+	0x0001, 0xb596, 0x0001, 0x6b4d, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0007, 0x31a6, 0x0004, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0003, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0005, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0003, 0x2965, 0x0003, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0004, 0x39c7, 
+	0x0004, 0x39e7, 0x0001, 0x31a6, 0x0001, 0x8c51, 0x0001, 0x6b6d, 
+	0x0001, 0x4208, 0x0001, 0x2965, 0x0001, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x39e7, 0x0003, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0005, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0004, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0003, 0x2965, 0x0003, 0x3186, 
+	0x0001, 0x2965, 0x0001, 0x4208, 0x0001, 0x6b4d, 0x0001, 0x8c51, 
+	0x0002, 0x9cd3, 0x0001, 0x8c51, 0x0001, 0x6b4d, 0x0001, 0x4a49, 
+	0x0001, 0x3186, 0x0001, 0x39c7, 0x0005, 0x39e7, 0x0002, 0x31a6, 
+	0x0001, 0x39c7, 0x0004, 0x39e7, 0x0001, 0x39c7, 0x0001, 0x3186, 
+	0x0001, 0x39e7, 0x0001, 0x630c, 0x0001, 0x8430, 0x0001, 0xa514, 
+	0x0001, 0xb596, 0x0001, 0xad75, 0x0001, 0x9492, 0x0001, 0x6b6d, 
+	0x0001, 0x4208, 0x0001, 0x2945, 0x0002, 0x3186, 0x0003, 0x2965, 
+	0x0003, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0004, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0002, 0x3186, 0x0001, 0x2965, 0x0001, 0x31a6, 0x0001, 0x8430, 
+	0x0001, 0xe71c, 0x0008, 0xffff, 0x0001, 0xe73c, 0x0001, 0x9492, 
+	0x0001, 0x4208, 0x0001, 0x39c7, 0x0007, 0x4208, 0x0001, 0x39e7, 
+	0x0001, 0x31a6, 0x0001, 0x4a49, 0x0001, 0x8c71, 0x0001, 0xd6ba, 
+	0x0006, 0xffff, 0x0001, 0xffdf, 0x0001, 0xffff, 0x0001, 0xf7be, 
+	0x0001, 0xd6ba, 0x0001, 0x7bcf, 0x0001, 0x3186, 0x0004, 0x2965, 
+	0x0003, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0003, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0001, 0x9492, 0x0005, 0xffff, 0x0007, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0001, 0xad55, 0x0001, 0x528a, 
+	0x0001, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x4208, 0x0001, 0x39e7, 
+	0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x8c71, 0x0001, 0xe71c, 
+	0x0003, 0xffff, 0x0001, 0xffdf, 0x0001, 0xf7be, 0x0007, 0xf79e, 
+	0x0001, 0xf7be, 0x0001, 0xffff, 0x0001, 0xe71c, 0x0001, 0x632c, 
+	0x0001, 0x2945, 0x0001, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0003, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x4a49, 0x0001, 0xef5d, 0x0003, 0xffff, 0x000b, 0xffdf, 
+	0x0001, 0xf7be, 0x0002, 0xffff, 0x0001, 0xdedb, 0x0001, 0xad75, 
+	0x0001, 0x9492, 0x0001, 0x9cf3, 0x0001, 0xdedb, 0x0003, 0xffff, 
+	0x0001, 0xffdf, 0x0001, 0xf7be, 0x0006, 0xf79e, 0x0002, 0xf7be, 
+	0x0001, 0xf79e, 0x0001, 0xe73c, 0x0001, 0xdedb, 0x0002, 0xd69a, 
+	0x0001, 0xe71c, 0x0001, 0xb596, 0x0001, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0002, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0003, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x2965, 0x0001, 0x6b6d, 
+	0x0003, 0xffff, 0x000d, 0xffdf, 0x0003, 0xf7be, 0x0002, 0xffdf, 
+	0x0002, 0xffff, 0x0001, 0xffdf, 0x0001, 0xf7be, 0x0006, 0xf79e, 
+	0x0003, 0xf7be, 0x0001, 0xf79e, 0x0001, 0xe73c, 0x0001, 0xdedb, 
+	0x0002, 0xd69a, 0x0001, 0xd6ba, 0x0001, 0xdedb, 0x0002, 0xdefb, 
+	0x0001, 0xef5d, 0x0001, 0xd69a, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0002, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0002, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0001, 0x2965, 0x0001, 0x73ae, 0x0003, 0xffff, 
+	0x000e, 0xffdf, 0x0006, 0xf7be, 0x0007, 0xf79e, 0x0001, 0xf7be, 
+	0x0001, 0xffdf, 0x0001, 0xf7be, 0x0001, 0xef5d, 0x0001, 0xdefb, 
+	0x0002, 0xd6ba, 0x0001, 0xdedb, 0x0007, 0xdefb, 0x0001, 0xe73c, 
+	0x0001, 0xce59, 0x0001, 0x2945, 0x0003, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0002, 0x0020, 0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x630c, 
+	0x0002, 0xffff, 0x0002, 0xffdf, 0x0001, 0xf7be, 0x000b, 0xffdf, 
+	0x000e, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xf7be, 0x0001, 0xe73c, 
+	0x0001, 0xd6ba, 0x0001, 0xd69a, 0x0001, 0xdedb, 0x000a, 0xdefb, 
+	0x0001, 0xdedb, 0x0001, 0xef5d, 0x0001, 0x9cf3, 0x0001, 0x2945, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0001, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0001, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x39e7, 0x0001, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0005, 0xf7be, 0x000a, 0xffdf, 
+	0x000b, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xf79e, 0x0001, 0xdefb, 
+	0x0001, 0xd69a, 0x0001, 0xd6ba, 0x0001, 0xdefb, 0x0002, 0xe71c, 
+	0x0008, 0xdefb, 0x0003, 0xdedb, 0x0001, 0xf79e, 0x0001, 0xbdd7, 
+	0x0001, 0x2965, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x2945, 0x0001, 0xd6ba, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0007, 0xf7be, 0x0006, 0xffdf, 
+	0x0001, 0xf7be, 0x0003, 0xffdf, 0x0007, 0xf7be, 0x0002, 0xffdf, 
+	0x0001, 0xf79e, 0x0001, 0xdefb, 0x0001, 0xd69a, 0x0001, 0xdedb, 
+	0x0001, 0xe71c, 0x0001, 0xe73c, 0x0003, 0xe71c, 0x0005, 0xdefb, 
+	0x0003, 0xdedb, 0x0001, 0xd6ba, 0x0001, 0xdedb, 0x0001, 0xf79e, 
+	0x0001, 0x9492, 0x0001, 0x2945, 0x0003, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x73ae, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0007, 0xf7be, 0x0001, 0xffdf, 
+	0x0001, 0xf7be, 0x0001, 0xffdf, 0x0002, 0xf7be, 0x0006, 0xffdf, 
+	0x0005, 0xf7be, 0x0002, 0xffdf, 0x0001, 0xf7be, 0x0001, 0xdefb, 
+	0x0001, 0xd69a, 0x0001, 0xdedb, 0x0003, 0xe73c, 0x0004, 0xe71c, 
+	0x0003, 0xdefb, 0x0004, 0xdedb, 0x0002, 0xd6ba, 0x0001, 0xef7d, 
+	0x0001, 0x7bcf, 0x0001, 0x2965, 0x0003, 0x31a6, 0x0001, 0x3186, 
+	0x0003, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0001, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0001, 0xf79e, 0x0001, 0xffff, 0x0001, 0xf7be, 
+	0x0001, 0xf79e, 0x000b, 0xf7be, 0x0002, 0xffdf, 0x0001, 0xf7be, 
+	0x0002, 0xffdf, 0x0004, 0xf7be, 0x0003, 0xffdf, 0x0001, 0xe71c, 
+	0x0001, 0xd69a, 0x0001, 0xdedb, 0x0001, 0xe73c, 0x0001, 0xef5d, 
+	0x0003, 0xe73c, 0x0002, 0xe71c, 0x0003, 0xdefb, 0x0003, 0xdedb, 
+	0x0004, 0xd6ba, 0x0001, 0xef5d, 0x0001, 0x8430, 0x0001, 0x2965, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0001, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x73ae, 0x0001, 0xffff, 
+	0x0001, 0xf7be, 0x0002, 0xf79e, 0x000a, 0xf7be, 0x0002, 0xffdf, 
+	0x0001, 0xf7be, 0x0001, 0xffdf, 0x0003, 0xf7be, 0x0003, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xef7d, 0x0002, 0xd6ba, 0x0001, 0xe73c, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0002, 0xe73c, 0x0003, 0xe71c, 
+	0x0004, 0xdefb, 0x0002, 0xdedb, 0x0004, 0xd6ba, 0x0001, 0xe71c, 
+	0x0001, 0xad75, 0x0001, 0x3186, 0x0002, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0001, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x2945, 0x0001, 0xdefb, 
+	0x0001, 0xffff, 0x0003, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xf79e, 
+	0x000a, 0xf7be, 0x0003, 0xffdf, 0x0001, 0xf7be, 0x0002, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0001, 0xdefb, 0x0001, 0xce79, 
+	0x0001, 0xe71c, 0x0001, 0xef7d, 0x0002, 0xef5d, 0x0002, 0xe73c, 
+	0x0003, 0xe71c, 0x0004, 0xdefb, 0x0002, 0xdedb, 0x0005, 0xd6ba, 
+	0x0001, 0xdedb, 0x0001, 0x39c7, 0x0004, 0x39e7, 0x0002, 0x39c7, 
+	0x0001, 0x31a6, 0x0003, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x4208, 0x0001, 0xffff, 
+	0x0001, 0xf7be, 0x0005, 0xf79e, 0x000b, 0xf7be, 0x0004, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xef7d, 0x0001, 0xd69a, 0x0001, 0xd6ba, 
+	0x0001, 0xef5d, 0x0001, 0xef7d, 0x0003, 0xef5d, 0x0002, 0xe73c, 
+	0x0003, 0xe71c, 0x0003, 0xdefb, 0x0002, 0xdedb, 0x0004, 0xd6ba, 
+	0x0001, 0xd69a, 0x0001, 0xe73c, 0x0001, 0x73ae, 0x0001, 0x39e7, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0003, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0001, 0x2965, 0x0003, 0x3186, 0x0001, 0x8410, 
+	0x0001, 0xffff, 0x0005, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xf79e, 
+	0x0008, 0xf7be, 0x0001, 0xffdf, 0x0002, 0xf7be, 0x0001, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xffdf, 0x0001, 0xdefb, 0x0001, 0xce79, 
+	0x0001, 0xe71c, 0x0001, 0xf79e, 0x0002, 0xef7d, 0x0002, 0xef5d, 
+	0x0002, 0xe73c, 0x0003, 0xe71c, 0x0002, 0xdefb, 0x0002, 0xdedb, 
+	0x0004, 0xd6ba, 0x0002, 0xd69a, 0x0002, 0xd6ba, 0x0001, 0x39c7, 
+	0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0020, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0001, 0xc638, 0x0001, 0xffff, 0x0002, 0xef7d, 
+	0x0003, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xf79e, 0x0009, 0xf7be, 
+	0x0002, 0xffdf, 0x0001, 0xffff, 0x0001, 0xf79e, 0x0001, 0xd69a, 
+	0x0001, 0xce79, 0x0001, 0xef5d, 0x0001, 0xf79e, 0x0002, 0xef7d, 
+	0x0003, 0xef5d, 0x0001, 0xe73c, 0x0003, 0xe71c, 0x0003, 0xdefb, 
+	0x0002, 0xdedb, 0x0004, 0xd6ba, 0x0002, 0xd69a, 0x0001, 0xdefb, 
+	0x0001, 0x9492, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0002, 0x4228, 
+	0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x2965, 0x0001, 0xf79e, 0x0001, 0xffdf, 0x0003, 0xef7d, 
+	0x0004, 0xf79e, 0x0008, 0xf7be, 0x0002, 0xffdf, 0x0001, 0xffff, 
+	0x0001, 0xef5d, 0x0001, 0xc638, 0x0001, 0xd6ba, 0x0002, 0xf79e, 
+	0x0002, 0xef7d, 0x0002, 0xef5d, 0x0002, 0xe73c, 0x0004, 0xe71c, 
+	0x0001, 0xdefb, 0x0002, 0xdedb, 0x0003, 0xd6ba, 0x0005, 0xd69a, 
+	0x0001, 0xe73c, 0x0001, 0x5acb, 0x0003, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 
+	0x0003, 0x2945, 0x0001, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x39c7, 0x0001, 0xffff, 0x0001, 0xf79e, 0x0001, 0xef5d, 
+	0x0002, 0xef7d, 0x0004, 0xf79e, 0x0008, 0xf7be, 0x0001, 0xffdf, 
+	0x0001, 0xffff, 0x0001, 0xdefb, 0x0001, 0xc618, 0x0001, 0xdefb, 
+	0x0002, 0xf79e, 0x0002, 0xef7d, 0x0002, 0xef5d, 0x0002, 0xe73c, 
+	0x0003, 0xe71c, 0x0002, 0xdefb, 0x0003, 0xdedb, 0x0003, 0xd6ba, 
+	0x0005, 0xd69a, 0x0001, 0xe71c, 0x0001, 0x4208, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0002, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0002, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0001, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 
+	0x0001, 0x4a69, 0x0001, 0xffff, 0x0001, 0xef7d, 0x0001, 0xef5d, 
+	0x0002, 0xef7d, 0x0005, 0xf79e, 0x0006, 0xf7be, 0x0002, 0xffdf, 
+	0x0001, 0xd6ba, 0x0001, 0xc618, 0x0001, 0xe71c, 0x0002, 0xf79e, 
+	0x0002, 0xef7d, 0x0003, 0xef5d, 0x0002, 0xe73c, 0x0002, 0xe71c, 
+	0x0003, 0xdefb, 0x0002, 0xdedb, 0x0003, 0xd6ba, 0x0004, 0xd69a, 
+	0x0001, 0xce79, 0x0001, 0xdedb, 0x0001, 0xdefb, 0x0001, 0x39e7, 
+	0x0002, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0002, 0x10a2, 0x0002, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0841, 0x0002, 0x1082, 
+	0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x5aeb, 0x0001, 0xffff, 0x0002, 0xef5d, 
+	0x0003, 0xef7d, 0x0005, 0xf79e, 0x0004, 0xf7be, 0x0002, 0xffdf, 
+	0x0001, 0xce79, 0x0001, 0xbdf7, 0x0001, 0xe73c, 0x0002, 0xf79e, 
+	0x0003, 0xef7d, 0x0002, 0xef5d, 0x0003, 0xe73c, 0x0002, 0xe71c, 
+	0x0002, 0xdefb, 0x0002, 0xdedb, 0x0002, 0xd6ba, 0x0005, 0xd69a, 
+	0x0002, 0xce79, 0x0001, 0xe71c, 0x0001, 0xd6ba, 0x0001, 0x4208, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x0002, 0x4a49, 0x0002, 0x4228, 
+	0x0001, 0x4208, 0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x6b4d, 0x0001, 0xffff, 
+	0x0003, 0xef5d, 0x0002, 0xef7d, 0x0005, 0xf79e, 0x0003, 0xf7be, 
+	0x0001, 0xffdf, 0x0001, 0xf7be, 0x0001, 0xce59, 0x0001, 0xbdd7, 
+	0x0001, 0xe73c, 0x0001, 0xf79e, 0x0004, 0xef7d, 0x0003, 0xef5d, 
+	0x0001, 0xe73c, 0x0003, 0xe71c, 0x0002, 0xdefb, 0x0002, 0xdedb, 
+	0x0003, 0xd6ba, 0x0003, 0xd69a, 0x0004, 0xce79, 0x0001, 0xe73c, 
+	0x0001, 0xd6ba, 0x0001, 0x4208, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0001, 0x4a49, 0x0002, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 
+	0x0001, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0001, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x6b6d, 0x0001, 0xffff, 0x0003, 0xef5d, 0x0002, 0xef7d, 
+	0x0005, 0xf79e, 0x0002, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xf7be, 
+	0x0001, 0xc638, 0x0001, 0xbdd7, 0x0001, 0xe73c, 0x0001, 0xf79e, 
+	0x0004, 0xef7d, 0x0003, 0xef5d, 0x0002, 0xe73c, 0x0003, 0xe71c, 
+	0x0001, 0xdefb, 0x0002, 0xdedb, 0x0002, 0xd6ba, 0x0004, 0xd69a, 
+	0x0003, 0xce79, 0x0002, 0xce59, 0x0001, 0xef5d, 0x0001, 0xdefb, 
+	0x0001, 0x4208, 0x0001, 0x528a, 0x0002, 0x4a69, 0x0002, 0x4a49, 
+	0x0001, 0x4228, 0x0002, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x6b6d, 
+	0x0001, 0xffff, 0x0001, 0xe73c, 0x0002, 0xef5d, 0x0003, 0xef7d, 
+	0x0004, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xf7be, 
+	0x0001, 0xc618, 0x0001, 0xb5b6, 0x0001, 0xe71c, 0x0005, 0xef7d, 
+	0x0003, 0xef5d, 0x0002, 0xe73c, 0x0003, 0xe71c, 0x0001, 0xdefb, 
+	0x0003, 0xdedb, 0x0002, 0xd6ba, 0x0003, 0xd69a, 0x0003, 0xce79, 
+	0x0003, 0xce59, 0x0001, 0xef5d, 0x0001, 0xef7d, 0x0001, 0x4208, 
+	0x0002, 0x528a, 0x0001, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x6b4d, 0x0001, 0xffff, 
+	0x0001, 0xe73c, 0x0003, 0xef5d, 0x0002, 0xef7d, 0x0004, 0xf79e, 
+	0x0002, 0xf7be, 0x0001, 0xc618, 0x0001, 0xad75, 0x0001, 0xdefb, 
+	0x0004, 0xef7d, 0x0004, 0xef5d, 0x0002, 0xe73c, 0x0003, 0xe71c, 
+	0x0002, 0xdefb, 0x0002, 0xdedb, 0x0002, 0xd6ba, 0x0003, 0xd69a, 
+	0x0003, 0xce79, 0x0004, 0xce59, 0x0001, 0xe71c, 0x0001, 0xffff, 
+	0x0001, 0x4a49, 0x0002, 0x528a, 0x0002, 0x4a69, 0x0001, 0x4a49, 
+	0x0002, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 0x0001, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x5acb, 0x0001, 0xffdf, 
+	0x0001, 0xe73c, 0x0002, 0xef5d, 0x0003, 0xef7d, 0x0003, 0xf79e, 
+	0x0001, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xc638, 0x0001, 0xad55, 
+	0x0001, 0xdedb, 0x0004, 0xef7d, 0x0004, 0xef5d, 0x0003, 0xe73c, 
+	0x0002, 0xe71c, 0x0002, 0xdefb, 0x0002, 0xdedb, 0x0002, 0xd6ba, 
+	0x0003, 0xd69a, 0x0002, 0xce79, 0x0004, 0xce59, 0x0002, 0xc638, 
+	0x0001, 0xd6ba, 0x0001, 0xffff, 0x0001, 0x630c, 0x0001, 0x52aa, 
+	0x0001, 0x528a, 0x0002, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0002, 0x18c3, 0x0004, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0xffdf, 
+	0x0002, 0xe73c, 0x0001, 0xef5d, 0x0003, 0xef7d, 0x0002, 0xf79e, 
+	0x0001, 0xf7be, 0x0001, 0xffdf, 0x0001, 0xce59, 0x0001, 0xa514, 
+	0x0001, 0xd69a, 0x0003, 0xef7d, 0x0005, 0xef5d, 0x0002, 0xe73c, 
+	0x0003, 0xe71c, 0x0003, 0xdefb, 0x0001, 0xdedb, 0x0002, 0xd6ba, 
+	0x0003, 0xd69a, 0x0002, 0xce79, 0x0003, 0xce59, 0x0003, 0xc638, 
+	0x0001, 0xc618, 0x0001, 0xce59, 0x0001, 0xffff, 0x0001, 0x9cf3, 
+	0x0001, 0x4a69, 0x0001, 0x528a, 0x0002, 0x4a69, 0x0002, 0x4a49, 
+	0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 
+	0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 0x0001, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0001, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0xf7be, 
+	0x0002, 0xe73c, 0x0002, 0xef5d, 0x0001, 0xef7d, 0x0003, 0xf79e, 
+	0x0001, 0xffdf, 0x0001, 0xd6ba, 0x0001, 0x9cf3, 0x0001, 0xc618, 
+	0x0007, 0xef5d, 0x0003, 0xe73c, 0x0003, 0xe71c, 0x0002, 0xdefb, 
+	0x0002, 0xdedb, 0x0003, 0xd6ba, 0x0002, 0xd69a, 0x0002, 0xce79, 
+	0x0003, 0xce59, 0x0003, 0xc638, 0x0002, 0xc618, 0x0001, 0xc638, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0001, 0x4208, 0x0001, 0x528a, 
+	0x0002, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0001, 0x39c7, 0x0001, 0x3186, 0x0002, 0xef5d, 0x0001, 0xe73c, 
+	0x0001, 0xef5d, 0x0002, 0xef7d, 0x0002, 0xf79e, 0x0001, 0xffdf, 
+	0x0001, 0xe71c, 0x0001, 0x9cf3, 0x0001, 0xb596, 0x0001, 0xe73c, 
+	0x0006, 0xef5d, 0x0003, 0xe73c, 0x0004, 0xe71c, 0x0002, 0xdefb, 
+	0x0001, 0xdedb, 0x0003, 0xd6ba, 0x0002, 0xd69a, 0x0002, 0xce79, 
+	0x0003, 0xce59, 0x0003, 0xc638, 0x0004, 0xc618, 0x0001, 0xd69a, 
+	0x0001, 0xffff, 0x0001, 0x6b4d, 0x0001, 0x528a, 0x0002, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 
+	0x0001, 0x3186, 0x0001, 0xce59, 0x0001, 0xef7d, 0x0001, 0xe73c, 
+	0x0001, 0xef5d, 0x0002, 0xef7d, 0x0001, 0xf79e, 0x0001, 0xf7be, 
+	0x0001, 0xef7d, 0x0001, 0xa534, 0x0001, 0xa514, 0x0001, 0xdedb, 
+	0x0001, 0xe73c, 0x0004, 0xef5d, 0x0004, 0xe73c, 0x0003, 0xe71c, 
+	0x0003, 0xdefb, 0x0001, 0xdedb, 0x0003, 0xd6ba, 0x0002, 0xd69a, 
+	0x0003, 0xce79, 0x0003, 0xce59, 0x0001, 0xc638, 0x0006, 0xc618, 
+	0x0001, 0xc638, 0x0001, 0xf79e, 0x0001, 0xdefb, 0x0001, 0x4208, 
+	0x0001, 0x528a, 0x0001, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 
+	0x0002, 0x4208, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x31a6, 0x0001, 0x94b2, 
+	0x0001, 0xf7be, 0x0001, 0xe73c, 0x0001, 0xef5d, 0x0002, 0xef7d, 
+	0x0001, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xb5b6, 0x0001, 0x94b2, 
+	0x0001, 0xce79, 0x0008, 0xe73c, 0x0004, 0xe71c, 0x0003, 0xdefb, 
+	0x0001, 0xdedb, 0x0003, 0xd6ba, 0x0003, 0xd69a, 0x0002, 0xce79, 
+	0x0003, 0xce59, 0x0002, 0xc638, 0x0007, 0xc618, 0x0001, 0xd69a, 
+	0x0001, 0xffff, 0x0001, 0x8430, 0x0001, 0x4a49, 0x0001, 0x4a69, 
+	0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x630c, 0x0001, 0xffdf, 0x0001, 0xe73c, 0x0001, 0xef5d, 
+	0x0001, 0xef7d, 0x0001, 0xf79e, 0x0001, 0xffdf, 0x0001, 0xce79, 
+	0x0001, 0x8c71, 0x0001, 0xb5b6, 0x0001, 0xe71c, 0x0006, 0xe73c, 
+	0x0005, 0xe71c, 0x0002, 0xdefb, 0x0002, 0xdedb, 0x0003, 0xd6ba, 
+	0x0003, 0xd69a, 0x0002, 0xce79, 0x0003, 0xce59, 0x0002, 0xc638, 
+	0x0009, 0xc618, 0x0001, 0xdefb, 0x0001, 0xffff, 0x0001, 0x528a, 
+	0x0001, 0x4a69, 0x0002, 0x4a49, 0x0001, 0x4228, 0x0002, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 
+	0x0002, 0x39c7, 0x0001, 0x39e7, 0x0001, 0xf79e, 0x0002, 0xef5d, 
+	0x0001, 0xef7d, 0x0001, 0xf7be, 0x0001, 0xe71c, 0x0001, 0x9492, 
+	0x0001, 0x9cf3, 0x0001, 0xd6ba, 0x0001, 0xe71c, 0x0004, 0xe73c, 
+	0x0006, 0xe71c, 0x0003, 0xdefb, 0x0001, 0xdedb, 0x0003, 0xd6ba, 
+	0x0003, 0xd69a, 0x0002, 0xce79, 0x0003, 0xce59, 0x0002, 0xc638, 
+	0x000b, 0xc618, 0x0001, 0xef5d, 0x0001, 0xf79e, 0x0001, 0x4228, 
+	0x0002, 0x4a49, 0x0001, 0x4228, 0x0001, 0x4208, 0x0002, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0001, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x3186, 0x0001, 0xce79, 0x0001, 0xf79e, 0x0001, 0xef5d, 
+	0x0001, 0xf79e, 0x0001, 0xf7be, 0x0001, 0xa534, 0x0001, 0x8c51, 
+	0x0001, 0xc638, 0x0001, 0xdefb, 0x0009, 0xe71c, 0x0003, 0xdefb, 
+	0x0003, 0xdedb, 0x0002, 0xd6ba, 0x0003, 0xd69a, 0x0002, 0xce79, 
+	0x0003, 0xce59, 0x0002, 0xc638, 0x000c, 0xc618, 0x0001, 0xc638, 
+	0x0001, 0xef7d, 0x0001, 0xef5d, 0x0003, 0x4228, 0x0001, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0002, 0x2104, 
+	0x0001, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0001, 0x8410, 
+	0x0001, 0xffdf, 0x0001, 0xef5d, 0x0001, 0xf7be, 0x0001, 0xce59, 
+	0x0001, 0x8410, 0x0001, 0xad55, 0x0001, 0xdedb, 0x0001, 0xdefb, 
+	0x0007, 0xe71c, 0x0004, 0xdefb, 0x0002, 0xdedb, 0x0003, 0xd6ba, 
+	0x0003, 0xd69a, 0x0003, 0xce79, 0x0003, 0xce59, 0x0002, 0xc638, 
+	0x000c, 0xc618, 0x0001, 0xbdf7, 0x0001, 0xc638, 0x0001, 0xe73c, 
+	0x0001, 0xef7d, 0x0001, 0x5acb, 0x0001, 0x39e7, 0x0001, 0x4208, 
+	0x0002, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0001, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x10a2, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0002, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0002, 0x3186, 
+	0x0002, 0x31a6, 0x0001, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x4228, 
+	0x0001, 0xf7be, 0x0001, 0xef7d, 0x0001, 0xe73c, 0x0001, 0x8c71, 
+	0x0001, 0x8c51, 0x0001, 0xce79, 0x0001, 0xdedb, 0x0005, 0xe71c, 
+	0x0006, 0xdefb, 0x0002, 0xdedb, 0x0003, 0xd6ba, 0x0003, 0xd69a, 
+	0x0002, 0xce79, 0x0004, 0xce59, 0x0003, 0xc638, 0x000c, 0xc618, 
+	0x0002, 0xbdf7, 0x0001, 0xc618, 0x0001, 0xd6ba, 0x0001, 0xf79e, 
+	0x0001, 0x9cd3, 0x0001, 0x39c7, 0x0002, 0x39e7, 0x0001, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0001, 0x0841, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 
+	0x0001, 0x39e7, 0x0001, 0x3186, 0x0001, 0xce59, 0x0001, 0xffdf, 
+	0x0001, 0xad75, 0x0001, 0x73ae, 0x0001, 0xb596, 0x0001, 0xd6ba, 
+	0x000b, 0xdefb, 0x0002, 0xdedb, 0x0004, 0xd6ba, 0x0002, 0xd69a, 
+	0x0003, 0xce79, 0x0003, 0xce59, 0x0004, 0xc638, 0x000b, 0xc618, 
+	0x0005, 0xbdf7, 0x0001, 0xc638, 0x0001, 0xf7be, 0x0001, 0x8c71, 
+	0x0001, 0x39e7, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0003, 0x39c7, 0x0001, 0x738e, 0x0001, 0xe73c, 
+	0x0001, 0x7bcf, 0x0001, 0x8c51, 0x0001, 0xce79, 0x0001, 0xd6ba, 
+	0x0008, 0xdefb, 0x0004, 0xdedb, 0x0003, 0xd6ba, 0x0004, 0xd69a, 
+	0x0002, 0xce79, 0x0004, 0xce59, 0x0003, 0xc638, 0x0009, 0xc618, 
+	0x0009, 0xbdf7, 0x0001, 0xe73c, 0x0001, 0x52aa, 0x0001, 0x39e7, 
+	0x0002, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 0x0001, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x31a6, 
+	0x0001, 0x9cd3, 0x0001, 0x6b6d, 0x0001, 0xb596, 0x0001, 0xd69a, 
+	0x0001, 0xd6ba, 0x000b, 0xdedb, 0x0004, 0xd6ba, 0x0003, 0xd69a, 
+	0x0002, 0xce79, 0x0005, 0xce59, 0x0004, 0xc638, 0x0008, 0xc618, 
+	0x0007, 0xbdf7, 0x0001, 0xbdd7, 0x0001, 0xc638, 0x0001, 0xe71c, 
+	0x0001, 0x31a6, 0x0001, 0x39e7, 0x0002, 0x39c7, 0x0001, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 0x0001, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0001, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 
+	0x0001, 0x31a6, 0x0001, 0x4a69, 0x0001, 0x8c71, 0x0001, 0xce59, 
+	0x0001, 0xd69a, 0x0001, 0xd6ba, 0x0009, 0xdedb, 0x0005, 0xd6ba, 
+	0x0003, 0xd69a, 0x0003, 0xce79, 0x0005, 0xce59, 0x0004, 0xc638, 
+	0x0007, 0xc618, 0x0008, 0xbdf7, 0x0001, 0xbdd7, 0x0001, 0xdedb, 
+	0x0001, 0xad55, 0x0001, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0003, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 
+	0x0001, 0x2965, 0x0001, 0xc638, 0x0001, 0xce79, 0x0001, 0xd69a, 
+	0x000e, 0xd6ba, 0x0004, 0xd69a, 0x0002, 0xce79, 0x0006, 0xce59, 
+	0x0004, 0xc638, 0x0007, 0xc618, 0x0004, 0xbdf7, 0x0002, 0xbdd7, 
+	0x0001, 0xbdf7, 0x0001, 0xbdd7, 0x0001, 0xbdf7, 0x0001, 0xf79e, 
+	0x0001, 0x52aa, 0x0003, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0001, 0x31a6, 0x0003, 0x39c7, 
+	0x0001, 0x31a6, 0x0001, 0xa514, 0x0001, 0xdefb, 0x0001, 0xd69a, 
+	0x000d, 0xd6ba, 0x0004, 0xd69a, 0x0003, 0xce79, 0x0006, 0xce59, 
+	0x0004, 0xc638, 0x0007, 0xc618, 0x0003, 0xbdf7, 0x0004, 0xbdd7, 
+	0x0001, 0xb5b6, 0x0001, 0xd69a, 0x0001, 0xdefb, 0x0001, 0x3186, 
+	0x0003, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0001, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0001, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0001, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 
+	0x0001, 0x39e7, 0x0001, 0xef5d, 0x0001, 0xd69a, 0x000c, 0xd6ba, 
+	0x0005, 0xd69a, 0x0004, 0xce79, 0x0005, 0xce59, 0x0005, 0xc638, 
+	0x0006, 0xc618, 0x0003, 0xbdf7, 0x0003, 0xbdd7, 0x0001, 0xb5b6, 
+	0x0001, 0xbdd7, 0x0001, 0xf7be, 0x0001, 0x6b6d, 0x0003, 0x39c7, 
+	0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 0x0002, 0x2945, 
+	0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0841, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0001, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x39e7, 0x0001, 0x31a6, 
+	0x0001, 0x8c51, 0x0001, 0xef5d, 0x0003, 0xd69a, 0x0001, 0xd6ba, 
+	0x0001, 0xd69a, 0x0001, 0xd6ba, 0x000a, 0xd69a, 0x0006, 0xce79, 
+	0x0007, 0xce59, 0x0003, 0xc638, 0x0004, 0xc618, 0x0003, 0xbdf7, 
+	0x0003, 0xbdd7, 0x0002, 0xb5b6, 0x0001, 0xd6ba, 0x0001, 0xe71c, 
+	0x0001, 0x3186, 0x0003, 0x39c7, 0x0001, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0002, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0002, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 0x0001, 0x3186, 
+	0x0002, 0x31a6, 0x0003, 0x39c7, 0x0001, 0x3186, 0x0001, 0xdedb, 
+	0x0001, 0xd6ba, 0x0002, 0xd69a, 0x0001, 0xd6ba, 0x0001, 0xd69a, 
+	0x0001, 0xd6ba, 0x000a, 0xd69a, 0x0006, 0xce79, 0x0008, 0xce59, 
+	0x0002, 0xc638, 0x0004, 0xc618, 0x0003, 0xbdf7, 0x0003, 0xbdd7, 
+	0x0001, 0xb5b6, 0x0001, 0xc618, 0x0001, 0xffff, 0x0001, 0x5aeb, 
+	0x0003, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0001, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0001, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0003, 0x39c7, 0x0001, 0x5acb, 0x0001, 0xf79e, 0x0001, 0xce79, 
+	0x000e, 0xd69a, 0x0008, 0xce79, 0x0006, 0xce59, 0x0002, 0xc638, 
+	0x0004, 0xc618, 0x0002, 0xbdf7, 0x0003, 0xbdd7, 0x0001, 0xb5b6, 
+	0x0001, 0xbdd7, 0x0001, 0xef7d, 0x0001, 0xbdf7, 0x0001, 0x3186, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0001, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0002, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0003, 0x39c7, 0x0001, 0x3186, 0x0001, 0xa534, 0x0001, 0xe73c, 
+	0x0001, 0xce79, 0x0010, 0xd69a, 0x0007, 0xce79, 0x0005, 0xce59, 
+	0x0002, 0xc638, 0x0003, 0xc618, 0x0002, 0xbdf7, 0x0002, 0xbdd7, 
+	0x0002, 0xb5b6, 0x0001, 0xd6ba, 0x0001, 0xffdf, 0x0004, 0x39c7, 
+	0x0002, 0x31a6, 0x0001, 0x3186, 0x0002, 0x2965, 0x0002, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 
+	0x0002, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x1082, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0002, 0x18c3, 
+	0x0002, 0x18e3, 0x0003, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 
+	0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 
+	0x0001, 0x31a6, 0x0001, 0xe71c, 0x0001, 0xdedb, 0x0001, 0xce79, 
+	0x0012, 0xd69a, 0x0005, 0xce79, 0x0005, 0xce59, 0x0001, 0xc638, 
+	0x0003, 0xc618, 0x0002, 0xbdf7, 0x0002, 0xbdd7, 0x0001, 0xb5b6, 
+	0x0001, 0xce59, 0x0001, 0xffff, 0x0001, 0x6b4d, 0x0001, 0x31a6, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 
+	0x0002, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0001, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0002, 0x2945, 0x0001, 0x2965, 0x0002, 0x3186, 
+	0x0003, 0x31a6, 0x0003, 0x39c7, 0x0001, 0x4a69, 0x0001, 0xf7be, 
+	0x0001, 0xd69a, 0x0001, 0xce79, 0x0014, 0xd69a, 0x0003, 0xce79, 
+	0x0004, 0xce59, 0x0002, 0xc638, 0x0002, 0xc618, 0x0002, 0xbdf7, 
+	0x0002, 0xbdd7, 0x0001, 0xc638, 0x0001, 0xffdf, 0x0001, 0xad75, 
+	0x0001, 0x2965, 0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0001, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0001, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0004, 0x10a2, 0x0002, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0002, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0003, 0x39c7, 0x0001, 0x3186, 
+	0x0001, 0x73ae, 0x0001, 0xffdf, 0x0001, 0xce59, 0x0001, 0xce79, 
+	0x000f, 0xd69a, 0x0004, 0xce79, 0x0001, 0xd69a, 0x0003, 0xce79, 
+	0x0003, 0xce59, 0x0002, 0xc638, 0x0002, 0xc618, 0x0001, 0xbdf7, 
+	0x0001, 0xbdd7, 0x0001, 0xbdf7, 0x0001, 0xce59, 0x0001, 0xf79e, 
+	0x0001, 0xe71c, 0x0001, 0x3186, 0x0002, 0x39c7, 0x0003, 0x31a6, 
+	0x0001, 0x3186, 0x0003, 0x2965, 0x0002, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0001, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0002, 0x31a6, 
+	0x0003, 0x39c7, 0x0001, 0x3186, 0x0001, 0x8c71, 0x0001, 0xffdf, 
+	0x0001, 0xce79, 0x0001, 0xce59, 0x000a, 0xd69a, 0x0005, 0xce79, 
+	0x0002, 0xd69a, 0x0003, 0xce79, 0x0002, 0xd69a, 0x0001, 0xce79, 
+	0x0002, 0xce59, 0x0001, 0xc638, 0x0005, 0xc618, 0x0001, 0xd69a, 
+	0x0001, 0xf79e, 0x0001, 0xf7be, 0x0001, 0x39e7, 0x0001, 0x31a6, 
+	0x0002, 0x39c7, 0x0002, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0002, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0001, 0x0020, 0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0002, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 
+	0x0002, 0x31a6, 0x0003, 0x39c7, 0x0001, 0x2965, 0x0001, 0x9cd3, 
+	0x0001, 0xffff, 0x0001, 0xd69a, 0x0001, 0xce59, 0x0001, 0xce79, 
+	0x0006, 0xd69a, 0x0002, 0xce79, 0x0001, 0xd69a, 0x0001, 0xdefb, 
+	0x0001, 0xe73c, 0x0001, 0xef5d, 0x0001, 0xe71c, 0x0002, 0xdefb, 
+	0x0002, 0xe73c, 0x0001, 0xdefb, 0x0001, 0xd6ba, 0x0002, 0xd69a, 
+	0x0001, 0xd6ba, 0x0001, 0xd69a, 0x0001, 0xce79, 0x0003, 0xce59, 
+	0x0001, 0xd69a, 0x0001, 0xe71c, 0x0001, 0xffff, 0x0001, 0xf7be, 
+	0x0001, 0x4228, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0002, 0x3186, 0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 
+	0x0002, 0x2104, 0x0002, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x0002, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x0003, 0x0000, 0x0002, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 0x0003, 0x10a2, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 
+	0x0002, 0x2945, 0x0002, 0x2965, 0x0002, 0x3186, 0x0003, 0x31a6, 
+	0x0002, 0x39c7, 0x0001, 0x2965, 0x0001, 0x8c71, 0x0001, 0xffff, 
+	0x0001, 0xef5d, 0x0001, 0xd6ba, 0x0004, 0xce79, 0x0001, 0xd69a, 
+	0x0001, 0xd6ba, 0x0001, 0xdefb, 0x0001, 0xe73c, 0x0001, 0xe71c, 
+	0x0001, 0xad75, 0x0001, 0x73ae, 0x0001, 0x52aa, 0x0001, 0x4228, 
+	0x0002, 0x39e7, 0x0001, 0x4228, 0x0001, 0x632c, 0x0001, 0x9cf3, 
+	0x0001, 0xd6ba, 0x0001, 0xe73c, 0x0001, 0xe71c, 0x0001, 0xdefb, 
+	0x0004, 0xe71c, 0x0001, 0xe73c, 0x0001, 0xf7be, 0x0001, 0xffff, 
+	0x0001, 0xdefb, 0x0001, 0x4208, 0x0005, 0x31a6, 0x0002, 0x3186, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0002, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0001, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0003, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 
+	0x0003, 0x2104, 0x0002, 0x2124, 0x0003, 0x2945, 0x0002, 0x2965, 
+	0x0002, 0x3186, 0x0003, 0x31a6, 0x0002, 0x39c7, 0x0001, 0x2965, 
+	0x0001, 0x5acb, 0x0001, 0xdedb, 0x0002, 0xffff, 0x0002, 0xf7be, 
+	0x0001, 0xffdf, 0x0002, 0xffff, 0x0001, 0xd6ba, 0x0001, 0x8410, 
+	0x0001, 0x4208, 0x0001, 0x31a6, 0x0001, 0x39e7, 0x0005, 0x4208, 
+	0x0001, 0x39e7, 0x0002, 0x31a6, 0x0001, 0x5acb, 0x0001, 0xa534, 
+	0x0001, 0xe71c, 0x0005, 0xffff, 0x0001, 0xffdf, 0x0001, 0x8c51, 
+	0x0001, 0x3186, 0x0005, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0003, 0x2945, 0x0002, 0x2124, 0x0003, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x0003, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0001, 0x1082, 0x0003, 0x10a2, 0x0004, 0x18c3, 0x0002, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0002, 0x3186, 0x0002, 0x31a6, 0x0001, 0x39c7, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0001, 0x2965, 0x0001, 0x52aa, 0x0001, 0x9cd3, 
+	0x0001, 0xc638, 0x0001, 0xce79, 0x0001, 0xc618, 0x0001, 0x9492, 
+	0x0001, 0x52aa, 0x0002, 0x31a6, 0x0001, 0x39e7, 0x0001, 0x4208, 
+	0x0007, 0x4228, 0x0001, 0x4208, 0x0001, 0x39e7, 0x0001, 0x39c7, 
+	0x0001, 0x3186, 0x0001, 0x39c7, 0x0001, 0x6b4d, 0x0001, 0x9cd3, 
+	0x0001, 0xa534, 0x0001, 0x9492, 0x0001, 0x630c, 0x0001, 0x31a6, 
+	0x0001, 0x2965, 0x0005, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2965, 
+	0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 0x0002, 0x18e3, 
+	0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0001, 0x0020, 0x0004, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x0004, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 0x0003, 0x18e3, 
+	0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 0x0003, 0x2965, 
+	0x0003, 0x3186, 0x0002, 0x31a6, 0x0002, 0x39c7, 0x0002, 0x31a6, 
+	0x0001, 0x3186, 0x0003, 0x2965, 0x0001, 0x31a6, 0x0001, 0x39c7, 
+	0x0001, 0x39e7, 0x0003, 0x4208, 0x0005, 0x4228, 0x0005, 0x4208, 
+	0x0001, 0x39e7, 0x0001, 0x39c7, 0x0001, 0x31a6, 0x0001, 0x3186, 
+	0x0001, 0x2965, 0x0002, 0x3186, 0x0005, 0x31a6, 0x0003, 0x3186, 
+	0x0002, 0x2965, 0x0003, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0003, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0004, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0005, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0003, 0x18e3, 0x0002, 0x2104, 0x0003, 0x2124, 0x0002, 0x2945, 
+	0x0003, 0x2965, 0x0003, 0x3186, 0x0003, 0x31a6, 0x0006, 0x39c7, 
+	0x0003, 0x39e7, 0x000d, 0x4208, 0x0003, 0x39e7, 0x0005, 0x39c7, 
+	0x0003, 0x31a6, 0x0002, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0005, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0002, 0x2965, 0x0004, 0x3186, 
+	0x0003, 0x31a6, 0x0005, 0x39c7, 0x0010, 0x39e7, 0x0005, 0x39c7, 
+	0x0003, 0x31a6, 0x0003, 0x3186, 0x0003, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x0005, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0006, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0004, 0x18e3, 0x0002, 0x2104, 
+	0x0003, 0x2124, 0x0003, 0x2945, 0x0003, 0x2965, 0x0004, 0x3186, 
+	0x0003, 0x31a6, 0x0009, 0x39c7, 0x0003, 0x39e7, 0x0009, 0x39c7, 
+	0x0004, 0x31a6, 0x0003, 0x3186, 0x0004, 0x2965, 0x0003, 0x2945, 
+	0x0003, 0x2124, 0x0002, 0x2104, 0x0003, 0x18e3, 0x0003, 0x18c3, 
+	0x0004, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x0006, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x0007, 0x0000, 
+	0x0002, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0003, 0x10a2, 0x0003, 0x18c3, 0x0004, 0x18e3, 0x0003, 0x2104, 
+	0x0003, 0x2124, 0x0002, 0x2945, 0x0004, 0x2965, 0x0004, 0x3186, 
+	0x0005, 0x31a6, 0x000e, 0x39c7, 0x0005, 0x31a6, 0x0004, 0x3186, 
+	0x0003, 0x2965, 0x0004, 0x2945, 0x0003, 0x2124, 0x0002, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0007, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0002, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0003, 0x2945, 
+	0x0004, 0x2965, 0x0005, 0x3186, 0x0012, 0x31a6, 0x0005, 0x3186, 
+	0x0003, 0x2965, 0x0004, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0008, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0002, 0x1082, 0x0003, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0003, 0x2124, 0x0004, 0x2945, 
+	0x0005, 0x2965, 0x0006, 0x3186, 0x000a, 0x31a6, 0x0006, 0x3186, 
+	0x0004, 0x2965, 0x0005, 0x2945, 0x0003, 0x2124, 0x0003, 0x2104, 
+	0x0003, 0x18e3, 0x0004, 0x18c3, 0x0003, 0x10a2, 0x0001, 0x1082, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x0008, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 
+	0x0001, 0x0861, 0x0009, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0001, 0x0861, 0x0001, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 
+	0x0004, 0x18e3, 0x0003, 0x2104, 0x0004, 0x2124, 0x0004, 0x2945, 
+	0x0005, 0x2965, 0x0011, 0x3186, 0x0005, 0x2965, 0x0005, 0x2945, 
+	0x0004, 0x2124, 0x0003, 0x2104, 0x0003, 0x18e3, 0x0004, 0x18c3, 
+	0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 
+	0x0002, 0x0020, 0x0009, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000a, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0001, 0x1082, 
+	0x0005, 0x10a2, 0x0003, 0x18c3, 0x0002, 0x18e3, 0x0001, 0x2945, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x39e7, 0x0004, 0x632c, 
+	0x0001, 0x5aeb, 0x0001, 0x3186, 0x0001, 0x39c7, 0x0001, 0x632c, 
+	0x0001, 0x3186, 0x0001, 0x2945, 0x0015, 0x2965, 0x0005, 0x2945, 
+	0x0001, 0x39c7, 0x0001, 0x5acb, 0x0003, 0x632c, 0x0001, 0x4228, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0001, 0x528a, 0x0002, 0x632c, 
+	0x0001, 0x5aeb, 0x0001, 0x2965, 0x0002, 0x18c3, 0x0003, 0x10a2, 
+	0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 0x0002, 0x0020, 
+	0x000a, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000b, 0x0000, 0x0002, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0004, 0x10a2, 
+	0x0003, 0x18c3, 0x0004, 0x18e3, 0x0001, 0x39e7, 0x0001, 0x5aeb, 
+	0x0002, 0x2104, 0x0001, 0x2124, 0x0001, 0x52aa, 0x0001, 0x528a, 
+	0x0001, 0x39c7, 0x0001, 0x632c, 0x0001, 0x3186, 0x0005, 0x2945, 
+	0x000d, 0x2965, 0x0008, 0x2945, 0x0001, 0x39c7, 0x0001, 0x632c, 
+	0x0001, 0x4208, 0x0001, 0x2124, 0x0001, 0x2104, 0x0001, 0x31a6, 
+	0x0001, 0x5acb, 0x0001, 0x4a69, 0x0001, 0x18e3, 0x0001, 0x4a49, 
+	0x0001, 0x528a, 0x0002, 0x18c3, 0x0001, 0x39e7, 0x0001, 0x632c, 
+	0x0001, 0x2104, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 
+	0x0001, 0x0841, 0x0002, 0x0020, 0x000b, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000c, 0x0000, 0x0002, 0x0020, 0x0002, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0004, 0x10a2, 0x0003, 0x18c3, 0x0001, 0x2124, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x5aeb, 
+	0x0003, 0x2104, 0x0001, 0x39e7, 0x0001, 0x5aeb, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0001, 0x52aa, 0x0002, 0x632c, 0x0001, 0x4208, 
+	0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x5aeb, 0x0001, 0x632c, 
+	0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x2945, 0x0001, 0x4228, 
+	0x0001, 0x630c, 0x0001, 0x5acb, 0x0001, 0x632c, 0x0001, 0x630c, 
+	0x0001, 0x31a6, 0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x630c, 
+	0x0001, 0x632c, 0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x2945, 
+	0x0003, 0x2124, 0x0001, 0x5acb, 0x0001, 0x4208, 0x0004, 0x2104, 
+	0x0001, 0x2945, 0x0001, 0x632c, 0x0001, 0x2965, 0x0001, 0x528a, 
+	0x0001, 0x39e7, 0x0003, 0x18c3, 0x0001, 0x5acb, 0x0001, 0x31a6, 
+	0x0002, 0x10a2, 0x0001, 0x1082, 0x0002, 0x0861, 0x0001, 0x0841, 
+	0x0002, 0x0020, 0x000c, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 0x000d, 0x0000, 
+	0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 
+	0x0004, 0x10a2, 0x0002, 0x18c3, 0x0001, 0x2124, 0x0001, 0x632c, 
+	0x0001, 0x2124, 0x0001, 0x39c7, 0x0001, 0x5aeb, 0x0002, 0x18e3, 
+	0x0001, 0x2104, 0x0001, 0x52aa, 0x0001, 0x4a69, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0001, 0x4a69, 0x0001, 0x2124, 0x0001, 0x4a69, 
+	0x0001, 0x5acb, 0x0001, 0x2945, 0x0001, 0x630c, 0x0001, 0x4228, 
+	0x0001, 0x2945, 0x0001, 0x39c7, 0x0001, 0x632c, 0x0001, 0x3186, 
+	0x0001, 0x4228, 0x0001, 0x632c, 0x0001, 0x4208, 0x0001, 0x2965, 
+	0x0001, 0x5aeb, 0x0001, 0x4a49, 0x0001, 0x2965, 0x0001, 0x5aeb, 
+	0x0001, 0x31a6, 0x0001, 0x2124, 0x0001, 0x39c7, 0x0001, 0x630c, 
+	0x0001, 0x2945, 0x0003, 0x2124, 0x0001, 0x632c, 0x0001, 0x2945, 
+	0x0002, 0x2104, 0x0003, 0x18e3, 0x0001, 0x52aa, 0x0001, 0x31a6, 
+	0x0001, 0x39e7, 0x0001, 0x632c, 0x0001, 0x52aa, 0x0001, 0x4228, 
+	0x0001, 0x4208, 0x0003, 0x10a2, 0x0001, 0x1082, 0x0001, 0x0861, 
+	0x0002, 0x0841, 0x0002, 0x0020, 0x000d, 0x0000, 0x0001, 0x4208, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0001, 0x4a49, 0x0001, 0x0861, 
+	0x000e, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 0x0001, 0x0861, 
+	0x0002, 0x1082, 0x0005, 0x10a2, 0x0001, 0x2104, 0x0001, 0x632c, 
+	0x0001, 0x2124, 0x0001, 0x39c7, 0x0004, 0x632c, 0x0001, 0x5aeb, 
+	0x0001, 0x2945, 0x0001, 0x3186, 0x0001, 0x632c, 0x0001, 0x3186, 
+	0x0001, 0x2104, 0x0001, 0x4208, 0x0001, 0x5aeb, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0003, 0x2124, 0x0001, 0x5acb, 0x0001, 0x4208, 
+	0x0001, 0x4228, 0x0001, 0x630c, 0x0002, 0x2124, 0x0001, 0x52aa, 
+	0x0001, 0x4a69, 0x0001, 0x4208, 0x0005, 0x632c, 0x0001, 0x2965, 
+	0x0003, 0x2104, 0x0001, 0x632c, 0x0001, 0x2945, 0x0005, 0x18e3, 
+	0x0001, 0x5aeb, 0x0001, 0x31a6, 0x0002, 0x18c3, 0x0001, 0x4208, 
+	0x0001, 0x4228, 0x0001, 0x5acb, 0x0001, 0x632c, 0x0001, 0x2124, 
+	0x0001, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 
+	0x000e, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0001, 0x4a49, 0x0001, 0x0861, 0x000f, 0x0000, 0x0003, 0x0020, 
+	0x0001, 0x0841, 0x0001, 0x0861, 0x0003, 0x1082, 0x0003, 0x10a2, 
+	0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x2104, 0x0001, 0x39c7, 
+	0x0001, 0x5aeb, 0x0001, 0x18c3, 0x0004, 0x18e3, 0x0001, 0x3186, 
+	0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x2104, 0x0001, 0x4208, 
+	0x0001, 0x5aeb, 0x0001, 0x31a6, 0x0001, 0x630c, 0x0001, 0x2104, 
+	0x0002, 0x2124, 0x0001, 0x5acb, 0x0001, 0x39e7, 0x0001, 0x4208, 
+	0x0001, 0x5aeb, 0x0002, 0x2124, 0x0001, 0x52aa, 0x0001, 0x4a69, 
+	0x0001, 0x39e7, 0x0001, 0x5acb, 0x0007, 0x2104, 0x0001, 0x18e3, 
+	0x0001, 0x5acb, 0x0001, 0x39c7, 0x0003, 0x18e3, 0x0001, 0x18c3, 
+	0x0001, 0x2945, 0x0001, 0x632c, 0x0001, 0x18e3, 0x0001, 0x630c, 
+	0x0001, 0x3186, 0x0003, 0x10a2, 0x0001, 0x4a49, 0x0001, 0x39c7, 
+	0x0001, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x000f, 0x0000, 
+	0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x31a6, 0x0001, 0x4a49, 
+	0x0001, 0x1082, 0x0010, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0002, 0x0861, 0x0002, 0x1082, 0x0002, 0x10a2, 0x0001, 0x2104, 
+	0x0001, 0x632c, 0x0001, 0x2104, 0x0001, 0x31a6, 0x0001, 0x5aeb, 
+	0x0003, 0x18c3, 0x0002, 0x18e3, 0x0001, 0x3186, 0x0001, 0x632c, 
+	0x0001, 0x2945, 0x0001, 0x18e3, 0x0001, 0x4208, 0x0001, 0x5aeb, 
+	0x0001, 0x2124, 0x0001, 0x630c, 0x0001, 0x4208, 0x0001, 0x2104, 
+	0x0001, 0x39c7, 0x0001, 0x632c, 0x0001, 0x2945, 0x0001, 0x4208, 
+	0x0001, 0x5aeb, 0x0002, 0x2104, 0x0001, 0x52aa, 0x0001, 0x4a49, 
+	0x0001, 0x2945, 0x0001, 0x632c, 0x0001, 0x3186, 0x0001, 0x2104, 
+	0x0001, 0x4208, 0x0001, 0x5aeb, 0x0004, 0x18e3, 0x0001, 0x31a6, 
+	0x0001, 0x632c, 0x0001, 0x39e7, 0x0002, 0x18c3, 0x0001, 0x2965, 
+	0x0001, 0x5aeb, 0x0001, 0x4208, 0x0001, 0x10a2, 0x0001, 0x4228, 
+	0x0001, 0x52aa, 0x0001, 0x2104, 0x0001, 0x10a2, 0x0001, 0x2124, 
+	0x0001, 0x5acb, 0x0001, 0x31a6, 0x0001, 0x0841, 0x0003, 0x0020, 
+	0x0010, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x3186, 
+	0x0001, 0x4a49, 0x0001, 0x18c3, 0x0011, 0x0000, 0x0003, 0x0020, 
+	0x0002, 0x0841, 0x0001, 0x0861, 0x0002, 0x1082, 0x0001, 0x10a2, 
+	0x0001, 0x2104, 0x0001, 0x632c, 0x0001, 0x2104, 0x0001, 0x31a6, 
+	0x0001, 0x5aeb, 0x0005, 0x18c3, 0x0001, 0x3186, 0x0001, 0x632c, 
+	0x0001, 0x2124, 0x0001, 0x18e3, 0x0001, 0x39e7, 0x0001, 0x5aeb, 
+	0x0001, 0x18e3, 0x0001, 0x3186, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0x630c, 0x0001, 0x39e7, 0x0001, 0x2104, 0x0001, 0x4208, 
+	0x0001, 0x5aeb, 0x0002, 0x2104, 0x0001, 0x528a, 0x0001, 0x4a49, 
+	0x0001, 0x18e3, 0x0001, 0x39c7, 0x0001, 0x630c, 0x0001, 0x632c, 
+	0x0001, 0x5aeb, 0x0001, 0x3186, 0x0004, 0x18e3, 0x0001, 0x18c3, 
+	0x0001, 0x39c7, 0x0001, 0x52aa, 0x0002, 0x632c, 0x0001, 0x630c, 
+	0x0001, 0x39e7, 0x0002, 0x10a2, 0x0001, 0x18c3, 0x0001, 0x4a49, 
+	0x0003, 0x632c, 0x0001, 0x31a6, 0x0001, 0x0841, 0x0003, 0x0020, 
+	0x0011, 0x0000, 0x0002, 0x4a49, 0x0001, 0x2104, 0x0001, 0x4a49, 
+	0x0001, 0x2124, 0x0013, 0x0000, 0x0003, 0x0020, 0x0001, 0x0841, 
+	0x0002, 0x0861, 0x0001, 0x1082, 0x0006, 0x10a2, 0x0007, 0x18c3, 
+	0x0017, 0x18e3, 0x0007, 0x18c3, 0x0006, 0x10a2, 0x0001, 0x1082, 
+	0x0002, 0x0861, 0x0002, 0x0841, 0x0002, 0x0020, 0x0012, 0x0000, 
+	0x0001, 0x1082, 0x0001, 0x4a49, 0x0001, 0x39c7, 0x0001, 0x1082, 
+	0x0001, 0x4a49, 0x0001, 0x39e7, 0x0014, 0x0000, 0x0003, 0x0020, 
+	0x0002, 0x0841, 0x0002, 0x0861, 0x0001, 0x1082, 0x0007, 0x10a2, 
+	0x000a, 0x18c3, 0x000b, 0x18e3, 0x000a, 0x18c3, 0x0007, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0002, 0x0841, 0x0003, 0x0020, 
+	0x0013, 0x0000, 0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x2945, 
+	0x0001, 0x0000, 0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x10a2, 
+	0x0014, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 
+	0x0001, 0x1082, 0x0008, 0x10a2, 0x0019, 0x18c3, 0x0008, 0x10a2, 
+	0x0002, 0x1082, 0x0001, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 
+	0x0014, 0x0000, 0x0001, 0x4208, 0x0001, 0x4a49, 0x0001, 0x1082, 
+	0x0001, 0x0000, 0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x39e7, 
+	0x0016, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 
+	0x0002, 0x1082, 0x0009, 0x10a2, 0x0011, 0x18c3, 0x0009, 0x10a2, 
+	0x0002, 0x1082, 0x0002, 0x0861, 0x0003, 0x0841, 0x0003, 0x0020, 
+	0x0015, 0x0000, 0x0001, 0x2124, 0x0001, 0x4a49, 0x0001, 0x31a6, 
+	0x0003, 0x0000, 0x0001, 0x39c7, 0x0001, 0x4a49, 0x0001, 0x2945, 
+	0x0017, 0x0000, 0x0003, 0x0020, 0x0003, 0x0841, 0x0002, 0x0861, 
+	0x0003, 0x1082, 0x001d, 0x10a2, 0x0003, 0x1082, 0x0002, 0x0861, 
+	0x0003, 0x0841, 0x0003, 0x0020, 0x0016, 0x0000, 0x0001, 0x1082, 
+	0x0002, 0x4a49, 0x0001, 0x1082, 0x0003, 0x0000, 0x0001, 0x1082, 
+	0x0002, 0x4a49, 0x0001, 0x2104, 0x0018, 0x0000, 0x0004, 0x0020, 
+	0x0003, 0x0841, 0x0002, 0x0861, 0x0003, 0x1082, 0x0017, 0x10a2, 
+	0x0003, 0x1082, 0x0003, 0x0861, 0x0002, 0x0841, 0x0004, 0x0020, 
+	0x0017, 0x0000, 0x0001, 0x0861, 0x0001, 0x4228, 0x0001, 0x4a49, 
+	0x0001, 0x2965, 0x0005, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 
+	0x0001, 0x2945, 0x0019, 0x0000, 0x0004, 0x0020, 0x0004, 0x0841, 
+	0x0003, 0x0861, 0x0006, 0x1082, 0x0009, 0x10a2, 0x0006, 0x1082, 
+	0x0003, 0x0861, 0x0004, 0x0841, 0x0004, 0x0020, 0x0018, 0x0000, 
+	0x0001, 0x18c3, 0x0001, 0x4228, 0x0001, 0x4a49, 0x0001, 0x3186, 
+	0x0007, 0x0000, 0x0001, 0x18c3, 0x0002, 0x4a49, 0x0001, 0x4208, 
+	0x0001, 0x18e3, 0x0001, 0x0020, 0x0018, 0x0000, 0x0005, 0x0020, 
+	0x0005, 0x0841, 0x0007, 0x0861, 0x0005, 0x1082, 0x0007, 0x0861, 
+	0x0005, 0x0841, 0x0005, 0x0020, 0x0018, 0x0000, 0x0001, 0x10a2, 
+	0x0001, 0x39c7, 0x0002, 0x4a49, 0x0001, 0x2965, 0x0009, 0x0000, 
+	0x0001, 0x0861, 0x0001, 0x31a6, 0x0003, 0x4a49, 0x0001, 0x31a6, 
+	0x0001, 0x2965, 0x0001, 0x2124, 0x0018, 0x18e3, 0x000b, 0x2104, 
+	0x000b, 0x2124, 0x000b, 0x2104, 0x0017, 0x18e3, 0x0001, 0x2104, 
+	0x0001, 0x2965, 0x0001, 0x3186, 0x0001, 0x4228, 0x0002, 0x4a49, 
+	0x0001, 0x39e7, 0x0001, 0x18e3, 0x000c, 0x0000, 0x0001, 0x18c3, 
+	0x0001, 0x3186, 0x0001, 0x4228, 0x0057, 0x4a49, 0x0001, 0x39c7, 
+	0x0001, 0x2124, 0x0011, 0x0000, 0x0001, 0x10a2, 0x0001, 0x18e3, 
+	0x0001, 0x2124, 0x0050, 0x2965, 0x0001, 0x2945, 0x0001, 0x18e3, 
+	0x0001, 0x18c3, 0x0001, 0x0841, 0x0009, 0x0000, 
+};
+
+const FramebufferImage rawiPhoneOSSelected = {106, 107, RGB565, TRUE, dataiPhoneOSSelectedRaw, 9166};
@@ -0,0 +1,182 @@
+/*
+ * Converts a PNG into a C include of ready-to-draw framebuffer pixels, so openiboot doesn't have to inflate and blend
+ * it at boot.
+ *
+ * usage: png2raw [-565|-888] [-rle] [-b y:top,height,from,to] <name> <file.png>
+ *
+ *   -565, -888  pixel format to emit; the panel's own format is drawn with a straight copy (default -565)
+ *   -rle        emit (count, pixel) runs instead of every pixel
+ *   -b          blend the alpha channel now, against the menu background: an image drawn at row y over a screen that
+ *               is black down to row top, then a grey ramp from level from to level to over height rows, computed
+ *               the same way framebuffer_draw_rect_hgradient does it
+ *
+ * Images without -b are drawn opaque, as framebuffer_draw_image always has.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <png.h>
+
+#define FORMAT_565 3	// same values as the ColorSpace enum in lcd.h
+#define FORMAT_888 6
+
+static int format = FORMAT_565;
+static int rle = 0;
+static int blend = 0;
+static int imageY;
+static int gradientTop;
+static int gradientHeight;
+static int gradientFrom;
+static int gradientTo;
+
+static uint32_t toPixel(int r, int g, int b) {
+	if(format == FORMAT_565)
+		return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+	else
+		return (r << 16) | (g << 8) | b;
+}
+
+// The grey the menu has already put on the screen at this row, as it reads back from the framebuffer
+static void background(int row, int* r, int* g, int* b) {
+	int level = 0;
+
+	if(row >= gradientTop) {
+		int i = row - gradientTop;
+		if(i >= gradientHeight)
+			i = gradientHeight - 1;
+
+		int step = (gradientTo - gradientFrom) * 1000 / gradientHeight;
+		level = ((gradientFrom * 1000) + (i * step)) / 1000;
+		level &= 0xFF;
+	}
+
+	*r = *g = *b = level;
+
+	if(format == FORMAT_565) {
+		*r = (*r >> 3) << 3;
+		*g = (*g >> 2) << 2;
+		*b = (*b >> 3) << 3;
+	}
+}
+
+static int blendChannel(int dst, int src, int alpha) {
+	return ((dst * (0x100 - alpha)) >> 8) + ((src * (alpha + 1)) >> 8);
+}
+
+static void emit(const char* name, const char* file, uint32_t* pixels, int count, int width, int height) {
+	const char* type = (format == FORMAT_565) ? "uint16_t" : "uint32_t";
+	int digits = (format == FORMAT_565) ? 4 : 6;
+	int length = 0;
+	int i;
+
+	printf("// generated by png2raw from %s\n\n", file);
+	printf("const %s data%sRaw[] = {", type, name);
+
+	for(i = 0; i < count; i++) {
+		int run = 1;
+		if(rle) {
+			uint32_t max = (format == FORMAT_565) ? 0xFFFF : 0xFFFFFFFF;
+			while((i + run) < count && pixels[i + run] == pixels[i] && run < max)
+				run++;
+		}
+
+		if(rle) {
+			if((length % 8) == 0)
+				printf("\n\t");
+			printf("0x%0*x, ", digits, run);
+			length++;
+		}
+
+		if((length % 8) == 0)
+			printf("\n\t");
+		printf("0x%0*x, ", digits, pixels[i]);
+		length++;
+
+		i += run - 1;
+	}
+
+	printf("\n};\n\n");
+	printf("const FramebufferImage raw%s = {%d, %d, %s, %s, data%sRaw, %d};\n",
+			name, width, height, (format == FORMAT_565) ? "RGB565" : "RGB888", rle ? "TRUE" : "FALSE", name, length);
+}
+
+static void usage(const char* self) {
+	fprintf(stderr, "usage: %s [-565|-888] [-rle] [-b y:top,height,from,to] <name> <file.png>\n", self);
+	exit(1);
+}
+
+int main(int argc, char* argv[]) {
+	int i;
+	for(i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if(strcmp(argv[i], "-565") == 0) {
+			format = FORMAT_565;
+		} else if(strcmp(argv[i], "-888") == 0) {
+			format = FORMAT_888;
+		} else if(strcmp(argv[i], "-rle") == 0) {
+			rle = 1;
+		} else if(strcmp(argv[i], "-b") == 0 && (i + 1) < argc) {
+			if(sscanf(argv[++i], "%d:%d,%d,%d,%d", &imageY, &gradientTop, &gradientHeight, &gradientFrom, &gradientTo) != 5
+					|| gradientHeight <= 0)
+				usage(argv[0]);
+			blend = 1;
+		} else {
+			usage(argv[0]);
+		}
+	}
+
+	if((argc - i) != 2)
+		usage(argv[0]);
+
+	const char* name = argv[i];
+	const char* file = argv[i + 1];
+
+	png_image image;
+	memset(&image, 0, sizeof(image));
+	image.version = PNG_IMAGE_VERSION;
+
+	if(!png_image_begin_read_from_file(&image, file)) {
+		fprintf(stderr, "%s: %s\n", file, image.message);
+		return 1;
+	}
+
+	image.format = PNG_FORMAT_RGBA;
+	uint8_t* rgba = malloc(PNG_IMAGE_SIZE(image));
+	if(!rgba || !png_image_finish_read(&image, NULL, rgba, 0, NULL)) {
+		fprintf(stderr, "%s: %s\n", file, image.message);
+		return 1;
+	}
+
+	int width = image.width;
+	int height = image.height;
+	uint32_t* pixels = malloc(width * height * sizeof(uint32_t));
+
+	int x, y;
+	for(y = 0; y < height; y++) {
+		for(x = 0; x < width; x++) {
+			uint8_t* p = &rgba[((y * width) + x) * 4];
+			int r = p[0];
+			int g = p[1];
+			int b = p[2];
+
+			if(blend) {
+				int br, bg, bb;
+				background(imageY + y, &br, &bg, &bb);
+				r = blendChannel(br, r, p[3]);
+				g = blendChannel(bg, g, p[3]);
+				b = blendChannel(bb, b, p[3]);
+			}
+
+			pixels[(y * width) + x] = toPixel(r, g, b);
+		}
+	}
+
+	emit(name, file, pixels, width * height, width, height);
+
+	free(pixels);
+	free(rgba);
+	png_image_free(&image);
+
+	return 0;
+}
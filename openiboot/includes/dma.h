@@ -1,19 +1,14 @@
 #ifndef DMA_H
 #define DMA_H
 
+#include "tasks.h"
+
 #define ERROR_DMA 0x13
 #define ERROR_BUSY 0x15
 #define ERROR_ALIGN 0x9
 
 typedef void (*DMAHandler)(int status, int controller, int channel);
 
-typedef struct DMARequest {
-	int started;
-	int done;
-	DMAHandler handler;
-	// TODO: fill this thing out
-} DMARequest;
-
 typedef struct DMALinkedList {
     uint32_t source;	
     uint32_t destination;
@@ -21,6 +16,35 @@ typedef struct DMALinkedList {
     uint32_t control;
 } DMALinkedList;
 
+typedef struct DMASegment {
+	uint32_t address;
+	uint32_t length;
+} DMASegment;
+
+typedef struct DMATransfer {
+	struct DMATransfer* next;
+	DMALinkedList* list;
+	uint32_t configuration;
+	DMAHandler handler;
+} DMATransfer;
+
+typedef struct DMARequest {
+	int started;
+	int done;
+	DMAHandler handler;
+	uint32_t control;
+	DMATransfer* current;
+	DMATransfer* queueHead;
+	DMATransfer* queueTail;
+	TaskQueue waiters;
+} DMARequest;
+
+// Descriptors are handed out of a static pool so that transfers don't need the heap.
+// Chains too long for the pool (e.g. multi-megabyte audio buffers) fall back to malloc.
+#define DMA_DESCRIPTOR_POOL_SIZE 256
+#define DMA_TRANSFER_POOL_SIZE 32
+#define DMA_LLI_MAXTRANSFERS 0xE00
+
 #define DMA_I2S0_RX 19
 #define DMA_I2S0_TX 20
 #define DMA_I2S1_RX 14
@@ -32,7 +56,11 @@ int dma_setup();
 int dma_shutdown();
 int dma_request(int Source, int SourceTransferWidth, int SourceBurstSize, int Destination, int DestinationTransferWidth, int DestinationBurstSize, int* controller, int* channel, DMAHandler handler);
 int dma_perform(uint32_t Source, uint32_t Destination, int size, int continueList, int* controller, int* channel);
+int dma_perform_sg(uint32_t Source, uint32_t Destination, const DMASegment* segments, int count, int* controller, int* channel, DMAHandler handler);
+int dma_fill(uint32_t Pattern, uint32_t Destination, int size, int* controller, int* channel);
+int dma_busy(int controller, int channel);
 int dma_finish(int controller, int channel, int timeout);
+void dma_cancel(int controller, int channel);
 uint32_t dma_dstpos(int controller, int channel);
 uint32_t dma_srcpos(int controller, int channel);
 void dma_pause(int controller, int channel);
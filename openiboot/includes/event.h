@@ -3,10 +3,17 @@
 
 #include "openiboot.h"
 
-extern Event EventList;
+#define EVENT_MAX 64
+
+// In microseconds
+#define EVENT_MIN_DELAY 10
+#define EVENT_MAX_DELAY 1000000
 
 int event_setup();
 int event_add(Event* newEvent, uint64_t timeout, EventHandler handler, void* opaque);
 int event_readd(Event* event, uint64_t new_interval);
+void event_remove(Event* event);
+
+extern int EventHasInit;
 
 #endif
@@ -2,15 +2,40 @@
 #define FRAMEBUFFER_H
 
 #include "openiboot.h"
+#include "lcd.h"
 
 #define COLOR_WHITE 0xffffff
 #define COLOR_BLACK 0x0
 
-typedef struct OpenIBootFont {
-	uint32_t width;
-	uint32_t height;
-	uint8_t data[];
-} OpenIBootFont;
+// Fonts converted at build time by pcf/pcf. Each glyph row is whole bytes, leftmost pixel in bit 0 of the first, and
+// characters find their glyph through an encoding table, so glyphs shared by several characters are stored once.
+typedef struct FramebufferFont {
+	int width;
+	int height;
+	int rowBytes;
+	int firstChar;
+	int numChars;
+	int defaultGlyph;			// for characters outside the encoding table
+	const uint16_t* encoding;	// glyph of each character from firstChar on
+	const uint8_t* glyphs;		// height * rowBytes bytes each
+} FramebufferFont;
+
+typedef struct FramebufferRect {
+	int x;
+	int y;
+	int width;
+	int height;
+} FramebufferRect;
+
+// Pixels converted at build time by images/png2raw, already in a framebuffer format
+typedef struct FramebufferImage {
+	int width;
+	int height;
+	ColorSpace colorSpace;
+	int rle;			// data is (count, pixel) runs rather than one entry per pixel
+	const void* data;
+	uint32_t length;	// entries in data
+} FramebufferImage;
 
 extern int FramebufferHasInit;
 
@@ -28,9 +53,23 @@ void framebuffer_clear();
 uint32_t* framebuffer_load_image(const char* data, int len, int* width, int* height, int alpha);
 void framebuffer_blend_image(uint32_t* dst, int dstWidth, int dstHeight, uint32_t* src, int srcWidth, int srcHeight, int x, int y);
 void framebuffer_draw_image(uint32_t* image, int x, int y, int width, int height);
+void framebuffer_draw_asset(const FramebufferImage* image, int x, int y);
 void framebuffer_capture_image(uint32_t* image, int x, int y, int width, int height);
 void framebuffer_draw_rect(uint32_t color, int x, int y, int width, int height);
 void framebuffer_draw_rect_hgradient(int starting, int ending, int x, int y, int width, int height);
 void framebuffer_setcolors(uint32_t fore, uint32_t back);
 
+// Frames: once started with some number of the window's surfaces (see lcd_window_surface), everything drawn between
+// framebuffer_frame_begin and framebuffer_frame_end lands on a hidden surface, which is shown at the next vertical
+// blank. A surface is only brought up to date where the frames it missed drew, so a frame costs what it draws.
+// Drawing outside a frame goes straight to the screen as before; framebuffer_frames_stop puts the window back on its
+// own memory.
+void framebuffer_frames_start(int surfaces);
+void framebuffer_frame_begin();
+void framebuffer_frame_end();
+void framebuffer_frames_stop();
+
+// For drawing done behind the framebuffer layer's back, e.g. through the window's hline/vline.
+void framebuffer_invalidate(int x, int y, int width, int height);
+
 #endif
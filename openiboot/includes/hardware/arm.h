@@ -20,6 +20,9 @@
 #define ARM11_Control_STRICTALIGNMENTCHECKING 0x2
 #define ARM11_Control_UNALIGNEDDATAACCESS 0x400000
 
+#define ARM11_DCACHE_LINE 32
+#define ARM11_DCACHE_SIZE 0x4000
+
 #define ARM11_AuxControl_RETURNSTACK 0x1
 #define ARM11_AuxControl_DYNAMICBRANCHPREDICTION 0x2
 #define ARM11_AuxControl_STATICBRANCHPREDICTION 0x4
@@ -45,9 +45,10 @@
 #define VIDTCON2_HOZVALMASK 0x3FF
 #define VIDTCON2_HOZVALSHIFT 16
 
-#define GET_HSTATUS(x) GET_BITS(x, 4, 2);
-#define GET_VSTATUS(x) GET_BITS(x, 6, 2);
-#define GET_LINECNT(x) GET_BITS(x, 8, 9);
+#define GET_HSTATUS(x) GET_BITS(x, 4, 2)
+#define GET_VSTATUS(x) GET_BITS(x, 6, 2)
+#define VSTATUS_ACTIVE 2
+#define GET_LINECNT(x) GET_BITS(x, 8, 9)
 #define LCD_CLOCKGATE1 0x7
 #define LCD_CLOCKGATE2 0x1D
 
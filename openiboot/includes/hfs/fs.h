@@ -14,6 +14,16 @@ typedef struct ExtentList {
 	ExtentListItem extents[16];
 } ExtentList;
 
+// A file opened for reading in pieces, for callers that don't want all of it in memory at once
+typedef struct FSFile {
+	io_func* io;
+	Volume* volume;
+	HFSPlusCatalogRecord* record;
+	io_func* fileIO;
+	uint32_t size;
+	uint32_t offset;
+} FSFile;
+
 extern int HasFSInit;
 
 uint32_t readHFSFile(HFSPlusCatalogFile* file, uint8_t** buffer, Volume* volume);
@@ -26,4 +36,8 @@ void fs_cmd_extract(int argc, char** argv);
 void fs_cmd_add(int argc, char** argv);
 int fs_extract(int partition, const char* file, void* location);
 
+FSFile* fs_open(int partition, const char* file);
+uint32_t fs_read(FSFile* f, void* buffer, uint32_t size);
+void fs_close(FSFile* f);
+
 #endif
@@ -42,11 +42,23 @@ typedef struct Framebuffer {
 	VLineFunc vline;
 } Framebuffer;
 
+// Each window gets this many screens of memory, so scrolling can mostly move the window down through it instead of
+// moving the pixels up.
+#define LCD_WINDOW_SCREENS 2
+
+// Screens a window can flip between, its own memory included
+#define LCD_WINDOW_SURFACES 3
+
 typedef struct Window {
 	int created;
 	int width;
 	int height;
 	uint32_t lineBytes;
+	uint32_t bufferBase;
+	int bufferLines;
+	int scrollLine;		// line of the window's memory currently at the top of the screen
+	uint32_t surfaces[LCD_WINDOW_SURFACES - 1];	// off-screen surfaces handed out so far
+	int numSurfaces;
 	Framebuffer framebuffer;
 	uint32_t* lcdConPtr;
 	uint32_t lcdCon[2];
@@ -77,6 +89,19 @@ void lcd_fill(uint32_t color);
 void lcd_shutdown();
 void lcd_set_backlight_level(int level);
 void lcd_window_address(int window, uint32_t framebuffer);
+void lcd_window_scroll(Window* window, int lines, uint32_t fill);
+
+// Off-screen surfaces: screens of memory laid out like the window's own, to draw into while something else is shown.
+// They're allocated on first use and kept for the life of the window, so asking again is free. index counts from 1,
+// the window's own memory being surface 0; returns NULL past LCD_WINDOW_SURFACES.
+volatile uint32_t* lcd_window_surface(Window* window, int index);
+
+// Waits until the controller is outside the visible part of the frame, where the window address can change without
+// tearing. Gives up after a couple of frames if the panel isn't running.
+void lcd_wait_vblank();
+
+// Shows buffer on the window at the next vertical blank. framebuffer.buffer is left alone; it's the caller's to point.
+void lcd_window_flip(Window* window, volatile uint32_t* buffer);
 
 #endif
 
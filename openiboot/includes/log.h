@@ -0,0 +1,49 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "openiboot.h"
+
+typedef enum LogSubsystem {
+	LOG_GENERAL = 0,
+	LOG_FTL,
+	LOG_NAND,
+	LOG_USB,
+	LOG_DMA,
+	LogSubsystemCount
+} LogSubsystem;
+
+typedef enum LogLevel {
+	LOG_ERROR = 1,
+	LOG_INFO = 2,
+	LOG_DEBUG = 3
+} LogLevel;
+
+#ifdef DEBUG
+#define LOG_MAXLEVEL LOG_DEBUG
+#else
+#define LOG_MAXLEVEL LOG_INFO
+#endif
+
+// Records are a format pointer plus up to this many 32-bit arguments. The format string (and any
+// %s arguments) must still be around when the log is drained, so stick to string literals.
+#define LOG_MAX_ARGS 8
+#define LOG_RING_LEN 4096
+
+#define LOG_NARGS(...) LOG_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(format, a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+
+// Filtered at the call site: levels above LOG_MAXLEVEL compile away, the rest cost a compare
+// and a few word stores. Formatting and output happen later in log_drain().
+#define LogPrintf(subsystem, level, ...) \
+	do { \
+		if((level) <= LOG_MAXLEVEL && (level) <= LogLevels[subsystem]) \
+			log_record(LOG_NARGS(__VA_ARGS__), __VA_ARGS__); \
+	} while(0)
+
+extern int LogLevels[LogSubsystemCount];
+
+void log_record(int nargs, const char* format, ...);
+int log_drain();
+int log_set_level(const char* subsystem, int level);
+
+#endif
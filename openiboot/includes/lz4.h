@@ -0,0 +1,29 @@
+#ifndef LZ4_H
+#define LZ4_H
+
+#include "openiboot.h"
+
+// Streaming decoder for a single unbounded LZ4 block: the usual token/literals/offset/match sequences running from
+// the first byte of the stream to the last, with no frame or block headers. Matches are copied out of the
+// destination itself, so input can be fed in arbitrarily sized pieces as it arrives.
+
+typedef struct LZ4Stream {
+	uint8_t* start;
+	uint8_t* out;
+	uint8_t* end;
+	int state;
+	uint8_t token;
+	uint32_t literalLength;
+	uint32_t matchLength;
+	uint32_t offset;
+} LZ4Stream;
+
+void lz4_stream_init(LZ4Stream* stream, void* destination, uint32_t length);
+
+// Returns 0 if the data was consumed, -1 if the stream is corrupt or would overrun the destination.
+int lz4_stream_feed(LZ4Stream* stream, const uint8_t* data, uint32_t length);
+
+// TRUE once exactly the expected number of bytes has been produced.
+int lz4_stream_done(LZ4Stream* stream);
+
+#endif
@@ -35,11 +35,14 @@ void CleanDataCacheLineMVA();
 void CleanCPUDataCache();
 void InvalidateCPUDataCache();
 void CleanAndInvalidateCPUDataCache();
+void CleanAndInvalidateCPUDataCacheRange(void* start, uint32_t length);
 void ClearCPUCaches();
 
 void CallArm(uint32_t address);
 void CallThumb(uint32_t address);
 
+void SwapTask(TaskRegisterState* save, TaskRegisterState* resume);
+
 void Reboot();
 
 #endif
@@ -85,7 +85,8 @@ typedef enum TaskState {
 #define TaskDescriptorIdentifier2 0x74736b32
 
 struct Event {
-	LinkedList	list;
+	uint32_t	heapIndex;	// 1-based slot in the event heap, 0 when not scheduled
+	uint32_t	reserved;	// keeps Event the size TaskDescriptor's layout in openiboot.S.h expects
 	uint64_t	deadline;
 	uint64_t	interval;
 	EventHandler	handler;
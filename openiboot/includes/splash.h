@@ -0,0 +1,11 @@
+#ifndef SPLASH_H
+#define SPLASH_H
+
+#include "openiboot.h"
+
+// Draws a splash screen straight from a file on an HFS partition, centred and cropped to the screen. A file exactly
+// the size of the screen in the window's own pixel format is read directly into the framebuffer; anything else is
+// decoded as a PNG a scanline at a time, so neither needs a copy of the whole image in memory.
+int splash_draw(int partition, const char* fileName);
+
+#endif
@@ -206,6 +206,16 @@ extern stbi_uc *stbi_png_load_from_file   (FILE *f,                  int *x, int
 extern int      stbi_png_info_from_file   (FILE *f,                  int *x, int *y, int *comp);
 #endif
 
+// streaming png, one RGBA scanline at a time (openiboot)
+typedef struct
+{
+   int  (*read)  (void *user, stbi_uc *data, int size);  // bytes read, 0 at end of file
+   int  (*begin) (void *user, int x, int y);             // 0 to stop before any rows are decoded
+   void (*row)   (void *user, int y, stbi_uc const *rgba, int x);
+} stbi_png_stream_callbacks;
+
+extern int      stbi_png_stream           (stbi_png_stream_callbacks const *cb, void *user);
+
 // is it a bmp?
 extern int      stbi_bmp_test_memory      (stbi_uc const *buffer, int len);
 
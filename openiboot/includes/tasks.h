@@ -3,6 +3,25 @@
 
 #include "openiboot.h"
 
+#define TASK_STACK_SIZE 0x4000
+
+#define TASK_SLEEP_THRESHOLD 1000
+
+// Tasks blocked in task_wait, chained through their linked_list_3 field. A wake with nobody
+// waiting is remembered, so checking a condition and then waiting on it can't miss the wakeup.
+typedef struct TaskQueue {
+	TaskDescriptor* head;
+	TaskDescriptor* tail;
+	int pending;
+} TaskQueue;
+
 int tasks_setup();
+int task_start(TaskDescriptor* task, const char* name, TaskRoutineFunction routine, void* opaque);
+void task_exit();
+void task_yield();
+int task_sleep(uint64_t timeout);
+int task_wait(TaskQueue* queue, uint64_t timeout);
+void task_wake(TaskQueue* queue);
+int task_can_block();
 
 #endif
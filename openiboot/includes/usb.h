@@ -24,6 +24,9 @@
 
 #define USB_LANGID_ENGLISH_US 0x0409
 
+// every endpoint but the control one, in both directions
+#define USB_MAX_INTERFACE_ENDPOINTS 10
+
 #define USBError 0xEEE
 
 typedef enum USBState {
@@ -70,7 +73,8 @@ enum USBDescriptorType {
 	USBStringDescriptorType = 3,
 	USBInterfaceDescriptorType = 4,
 	USBEndpointDescriptorType = 5,
-	USBDeviceQualifierDescriptorType = 6
+	USBDeviceQualifierDescriptorType = 6,
+	USBOtherSpeedConfigurationDescriptorType = 7
 };
 
 typedef enum USBSpeed {
@@ -177,14 +181,9 @@ typedef struct USBFirstStringDescriptor {
 
 typedef struct USBInterface {
 	USBInterfaceDescriptor descriptor;
-	USBEndpointDescriptor* endpointDescriptors;
+	USBEndpointDescriptor endpointDescriptors[USB_MAX_INTERFACE_ENDPOINTS];
 } USBInterface;
 
-typedef struct USBConfiguration {
-	USBConfigurationDescriptor descriptor;
-	USBInterface* interfaces;
-} USBConfiguration;
-
 typedef struct USBSetupPacket {
 	uint8_t bmRequestType;
 	uint8_t bRequest;
@@ -205,17 +204,45 @@ typedef struct RingBuffer {
 typedef void (*USBStartHandler)(void);
 typedef void (*USBEnumerateHandler)(USBInterface* interface);
 
+// Class-specific requests on the control endpoint. The handler fills in buffer and returns how many bytes of it to
+// send back (0 for requests without a data stage), or -1 to stall the request.
+typedef int (*USBClassRequestHandler)(USBSetupPacket* setupPacket, uint8_t* buffer);
+
 #define OPENIBOOTCMD_DUMPBUFFER 0
 #define OPENIBOOTCMD_DUMPBUFFER_LEN 1
 #define OPENIBOOTCMD_DUMPBUFFER_GOAHEAD 2
 #define OPENIBOOTCMD_SENDCOMMAND 3
 #define OPENIBOOTCMD_SENDCOMMAND_GOAHEAD 4
+#define OPENIBOOTCMD_SENDCHUNK 5
+#define OPENIBOOTCMD_SENDCHUNK_GOAHEAD 6
+#define OPENIBOOTCMD_GETCHUNK 7
+#define OPENIBOOTCMD_GETCHUNK_GOAHEAD 8
+#define OPENIBOOTCMD_VERIFYCHUNK 9
+#define OPENIBOOTCMD_CHUNK_ACK 10
+#define OPENIBOOTCMD_CHUNK_NAK 11
+#define OPENIBOOTCMD_CONSOLE_PUSH 12
+#define OPENIBOOTCMD_SENDCOMMAND_NAK 13
+
+// the most a checked transfer moves per chunk; longer chunks are turned away with OPENIBOOTCMD_CHUNK_NAK
+#define OPENIBOOT_CHUNK_MAX 0x10000
+
+// bulk IN endpoint console output is pushed on once the host sends OPENIBOOTCMD_CONSOLE_PUSH
+#define OPENIBOOT_CONSOLE_EP 5
 
 typedef struct OpenIBootCmd {
 	uint32_t command;
 	uint32_t dataLen;
 }  __attribute__ ((__packed__)) OpenIBootCmd;
 
+// Checked transfers address device memory directly and carry the CRC32 of the chunk, so any chunk can be
+// verified, resent or skipped on its own. The first two fields line up with OpenIBootCmd.
+typedef struct OpenIBootChunkCmd {
+	uint32_t command;
+	uint32_t dataLen;
+	uint32_t address;
+	uint32_t crc;
+}  __attribute__ ((__packed__)) OpenIBootChunkCmd;
+
 #define USBSetupPacketRequestTypeDirection(x) GET_BITS(x, 7, 1)
 #define USBSetupPacketRequestTypeType(x) GET_BITS(x, 5, 2)
 #define USBSetupPacketRequestTypeRecpient(x) GET_BITS(x, 0, 5)
@@ -243,7 +270,11 @@ typedef struct OpenIBootCmd {
 #define USB_SYNCH_FRAME 12
 
 int usb_setup();
+// The enumerate handler runs here rather than during enumeration, and only when the handler or the function differs
+// from the last usb_start; otherwise the descriptors built last time are reused as they are.
 int usb_start(USBEnumerateHandler hEnumerate, USBStartHandler hStart);
+// Call before usb_start to enumerate as something other than the openiboot interface. usb_shutdown resets it.
+void usb_set_function(uint8_t bInterfaceClass, uint8_t bInterfaceSubClass, uint8_t bInterfaceProtocol, USBClassRequestHandler hClassRequest);
 int usb_shutdown();
 int usb_install_ep_handler(int endpoint, USBDirection direction, USBEndpointHandler handler, uint32_t token);
 void usb_add_endpoint(USBInterface* interface, int endpoint, USBDirection direction, USBTransferType transferType);
@@ -252,11 +283,15 @@ void usb_send_bulk(uint8_t endpoint, void* buffer, int bufferLen);
 void usb_receive_bulk(uint8_t endpoint, void* buffer, int bufferLen);
 void usb_receive_interrupt(uint8_t endpoint, void* buffer, int bufferLen);
 USBSpeed usb_get_speed();
+int usb_max_bulk_transfer();
+
+// the most usb_max_bulk_transfer() can return at any speed, for buffers that outlive a re-enumeration
+int usb_largest_bulk_transfer();
 
-USBDeviceDescriptor* usb_get_device_descriptor();
-USBDeviceQualifierDescriptor* usb_get_device_qualifier_descriptor();
-USBConfigurationDescriptor* usb_get_configuration_descriptor(int index, uint8_t speed_id);
-USBStringDescriptor* usb_get_string_descriptor(int index);
+const USBDeviceDescriptor* usb_get_device_descriptor();
+const USBDeviceQualifierDescriptor* usb_get_device_qualifier_descriptor();
+const USBConfigurationDescriptor* usb_get_configuration_descriptor(int index, uint8_t speed_id);
+const USBStringDescriptor* usb_get_string_descriptor(int index);
 
 #endif
 
@@ -0,0 +1,44 @@
+#ifndef USBMSC_H
+#define USBMSC_H
+
+#include "openiboot.h"
+
+// USB mass storage, bulk-only transport, exposing the FTL's logical pages as a SCSI disk. Blocks are NAND pages, the
+// same unit the MBR and bdev use, so the host sees the partition table as it is.
+
+#define MSC_INTERFACE_CLASS 0x08
+#define MSC_INTERFACE_SUBCLASS_SCSI 0x06
+#define MSC_INTERFACE_PROTOCOL_BOT 0x50
+
+#define MSC_REQUEST_RESET 0xFF
+#define MSC_REQUEST_GET_MAX_LUN 0xFE
+
+#define MSC_CBW_SIGNATURE 0x43425355
+#define MSC_CSW_SIGNATURE 0x53425355
+
+#define MSC_CBW_DATA_IN 0x80
+
+#define MSC_CSW_PASSED 0
+#define MSC_CSW_FAILED 1
+
+typedef struct MSCCommandBlockWrapper {
+	uint32_t dCBWSignature;
+	uint32_t dCBWTag;
+	uint32_t dCBWDataTransferLength;
+	uint8_t bmCBWFlags;
+	uint8_t bCBWLUN;
+	uint8_t bCBWCBLength;
+	uint8_t CBWCB[16];
+} __attribute__ ((__packed__)) MSCCommandBlockWrapper;
+
+typedef struct MSCCommandStatusWrapper {
+	uint32_t dCSWSignature;
+	uint32_t dCSWTag;
+	uint32_t dCSWDataResidue;
+	uint8_t bCSWStatus;
+} __attribute__ ((__packed__)) MSCCommandStatusWrapper;
+
+// Hands the USB controller over to mass storage; the openiboot protocol is gone until the next reboot.
+int msc_start(int writable);
+
+#endif
@@ -39,9 +39,12 @@ void uartPrint(const char* toBuffer);
 void uartPrintf(const char* format, ...);
 void fbPrintf(const char* format, ...);
 void bufferFlush(char* destination, size_t length);
-char* getScrollback();
 size_t getScrollbackLen();
 
+// Called whenever new output lands in the scrollback, from whatever context printed it.
+typedef void (*ScrollbackListener)(void);
+void setScrollbackListener(ScrollbackListener listener);
+
 void hexToBytes(const char* hex, uint8_t** buffer, int* bytes);
 void bytesToHex(const uint8_t* buffer, int bytes);
 
@@ -12,6 +12,9 @@
 #include "timer.h"
 #include "pmu.h"
 #include "nvram.h"
+#include "dma.h"
+#include "tasks.h"
+#include "openiboot-asmhelpers.h"
 
 static int lcd_has_init = FALSE;
 static int lcd_init_attempted = FALSE;
@@ -403,8 +406,13 @@ static Window* createWindow(int zero0, int zero1, int width, int height, ColorSp
 
 	uint32_t currentFramebuffer = NextFramebuffer;
 
+	newWindow->bufferBase = currentFramebuffer;
+	newWindow->bufferLines = height * LCD_WINDOW_SCREENS;
+	newWindow->scrollLine = 0;
+	newWindow->numSurfaces = 0;
+
 	NextFramebuffer = (currentFramebuffer
-		+ (lineBytes * height)	// size we need
+		+ (lineBytes * newWindow->bufferLines)	// size we need
 		+ 0xFFF)		// round up
 		& 0xFFFFF000;		// align
 
@@ -525,6 +533,173 @@ void lcd_window_address(int window, uint32_t framebuffer) {
 	SET_REG(windowBase + 8, framebuffer);
 }
 
+volatile uint32_t* lcd_window_surface(Window* window, int index) {
+	if(index == 0)
+		return window->framebuffer.buffer;
+
+	if(index < 0 || index >= LCD_WINDOW_SURFACES)
+		return NULL;
+
+	while(window->numSurfaces < index) {
+		uint32_t surface = NextFramebuffer;
+		NextFramebuffer = (surface + (window->lineBytes * window->height) + 0xFFF) & 0xFFFFF000;
+		window->surfaces[window->numSurfaces++] = surface;
+	}
+
+	return (volatile uint32_t*) window->surfaces[index - 1];
+}
+
+void lcd_wait_vblank() {
+	LCDInfo* info = &curTimings;
+	uint64_t frameTime = 20000;
+
+	if(info->pixelsPerSecond != 0) {
+		uint64_t lineClocks = info->width + info->horizontalBackPorch + info->horizontalFrontPorch + info->horizontalSyncPulseWidth;
+		uint64_t frameLines = info->height + info->verticalBackPorch + info->verticalFrontPorch + info->verticalSyncPulseWidth;
+		frameTime = (lineClocks * frameLines * 1000000) / info->pixelsPerSecond;
+	}
+
+	uint64_t startTime = timer_get_system_microtime();
+	while(GET_VSTATUS(GET_REG(LCD + VIDCON1)) == VSTATUS_ACTIVE) {
+		if(has_elapsed(startTime, frameTime * 2))
+			break;
+	}
+}
+
+void lcd_window_flip(Window* window, volatile uint32_t* buffer) {
+	lcd_wait_vblank();
+	lcd_window_address(window->lcdCon[0], (uint32_t) buffer);
+}
+
+// Fills and copies smaller than this aren't worth setting the DMA controller up for
+#define LCD_DMA_THRESHOLD 0x10000
+
+static uint32_t FillPattern;
+
+// Runs a memory to memory transfer on the DMA controller and waits for it. With fill set, from is ignored and word is
+// written across the whole of to instead. Returns FALSE if the caller has to do it by hand.
+static int dmaMemory(uint32_t to, uint32_t from, uint32_t size, int fill, uint32_t word) {
+	// The DMA controller only helps if we're allowed to wait for it
+	if(!task_can_block() || size < LCD_DMA_THRESHOLD || (to & 0x3) || (from & 0x3) || (size & 0x3))
+		return FALSE;
+
+	int controller = 0;
+	int channel = 0;
+
+	if(fill)
+		FillPattern = word;
+
+	// the framebuffer is cacheable and is much bigger than the cache
+	CleanAndInvalidateCPUDataCache();
+
+	if(dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, NULL) != 0)
+		return FALSE;
+
+	int error;
+	if(fill)
+		error = dma_fill((uint32_t) &FillPattern, to, size, &controller, &channel);
+	else
+		error = dma_perform(from, to, size, FALSE, &controller, &channel);
+
+	if(error != 0) {
+		// Out of descriptors: give the channel back. Nothing is printed since that would land right back in the console.
+		dma_cancel(controller, channel);
+		return FALSE;
+	}
+
+	// spin rather than yield, so nobody else prints to the console halfway through
+	while(dma_busy(controller, channel));
+	dma_finish(controller, channel, 0);
+	return TRUE;
+}
+
+static volatile int FillLinesDone;
+
+static void fillLinesDone(int status, int controller, int channel) {
+	FillLinesDone = TRUE;
+}
+
+// Writes word across the same run of bytes in each of a block of lines as one scatter-gather transfer, a segment per
+// line, and waits for it. Returns FALSE if the caller has to do it by hand.
+static int dmaFillLines(uint32_t first, uint32_t lineBytes, uint32_t runBytes, int lines, uint32_t word) {
+	if(!task_can_block() || (runBytes * lines) < LCD_DMA_THRESHOLD || (first & 0x3) || (lineBytes & 0x3) || (runBytes & 0x3))
+		return FALSE;
+
+	DMASegment* segments = malloc(lines * sizeof(DMASegment));
+	if(!segments)
+		return FALSE;
+
+	int i;
+	for(i = 0; i < lines; i++) {
+		segments[i].address = first + (i * lineBytes);
+		segments[i].length = runBytes;
+	}
+
+	int controller = 0;
+	int channel = 0;
+
+	FillPattern = word;
+	CleanAndInvalidateCPUDataCache();
+
+	if(dma_request(DMA_MEMORY, 4, 8, DMA_MEMORY, 4, 8, &controller, &channel, NULL) != 0) {
+		free(segments);
+		return FALSE;
+	}
+
+	FillLinesDone = FALSE;
+	int error = dma_perform_sg((uint32_t) &FillPattern, DMA_MEMORY, segments, lines, &controller, &channel, fillLinesDone);
+
+	// the descriptors are filled in by now, so the list isn't needed any more
+	free(segments);
+
+	if(error != 0) {
+		dma_cancel(controller, channel);
+		return FALSE;
+	}
+
+	while(!FillLinesDone);
+	dma_finish(controller, channel, 0);
+	return TRUE;
+}
+
+// Copies whole lines of a window's memory. The two ranges never overlap when called from lcd_window_scroll.
+static void moveLines(Window* window, int toLine, int fromLine, int lines) {
+	uint32_t to = window->bufferBase + (toLine * window->lineBytes);
+	uint32_t from = window->bufferBase + (fromLine * window->lineBytes);
+	uint32_t size = lines * window->lineBytes;
+
+	if(!dmaMemory(to, from, size, FALSE, 0))
+		memcpy((void*) to, (void*) from, size);
+}
+
+void lcd_window_scroll(Window* window, int lines, uint32_t fill) {
+	Framebuffer* framebuffer = &window->framebuffer;
+
+	if(lines <= 0)
+		return;
+
+	if(lines >= framebuffer->height) {
+		framebuffer_fill(framebuffer, 0, 0, framebuffer->width, framebuffer->height, fill);
+		return;
+	}
+
+	int top = window->scrollLine + lines;
+	if((top + framebuffer->height) > window->bufferLines) {
+		// out of room below, so bring what stays on screen back to the start of the memory and go on from there
+		moveLines(window, 0, top, framebuffer->height - lines);
+		top = 0;
+	}
+
+	window->scrollLine = top;
+	framebuffer->buffer = (volatile uint32_t*) (window->bufferBase + (top * window->lineBytes));
+	if(window == currentWindow)
+		CurFramebuffer = framebuffer->buffer;
+
+	// clear the lines coming into view before they're shown
+	framebuffer_fill(framebuffer, 0, framebuffer->height - lines, framebuffer->width, lines, fill);
+	lcd_window_address(window->lcdCon[0], (uint32_t) framebuffer->buffer);
+}
+
 static void setLayer(int window, int zero0, int zero1) {
 	uint32_t data = zero0 << 16 | zero1;
 	switch(window) {
@@ -1189,6 +1364,39 @@ static void syrah_quiesce() {
 	setPanelRegister(0x7B, 0x0);
 }
 
+#define RGB565(fill) ((((((fill) >> 16) & 0xFF) >> 3) << 11) | (((((fill) >> 8) & 0xFF) >> 2) << 5) | (((fill) & 0xFF) >> 3))
+
+// Spans go out a word, and for 565 two pixels, per store, eight stores to a loop so the compiler can use stm
+static void fillWords(uint32_t* to, uint32_t word, int count) {
+	while(count >= 8) {
+		to[0] = word;
+		to[1] = word;
+		to[2] = word;
+		to[3] = word;
+		to[4] = word;
+		to[5] = word;
+		to[6] = word;
+		to[7] = word;
+		to += 8;
+		count -= 8;
+	}
+
+	while(count-- > 0)
+		*(to++) = word;
+}
+
+static void fillHalfwords(uint16_t* to, uint16_t pixel, int count) {
+	if(count > 0 && ((uint32_t) to & 0x2)) {
+		*(to++) = pixel;
+		count--;
+	}
+
+	fillWords((uint32_t*) to, pixel | ((uint32_t) pixel << 16), count >> 1);
+
+	if(count & 1)
+		to[count - 1] = pixel;
+}
+
 static void framebuffer_fill(Framebuffer* framebuffer, int x, int y, int width, int height, int fill) {
 	if(x >= framebuffer->width)
 		return;
@@ -1207,63 +1415,73 @@ static void framebuffer_fill(Framebuffer* framebuffer, int x, int y, int width,
 		maxLine = y + height;
 	}
 
-	int line;
-	for(line = y; line < height; line++) {
-		framebuffer->hline(framebuffer, x, line, width, fill);
+	if(x != 0 || width != framebuffer->width) {
+		// A box narrower than the screen is a run per line, which the DMA controller can do in one go if the runs are
+		// word aligned
+		if(framebuffer->colorSpace == RGB888) {
+			if(dmaFillLines((uint32_t) &framebuffer->buffer[(y * framebuffer->lineWidth) + x], framebuffer->lineWidth * 4,
+						width * 4, maxLine - y, fill & 0xffffff))
+				return;
+		} else {
+			uint16_t fill565 = RGB565(fill);
+			if(dmaFillLines((uint32_t) &((uint16_t*)framebuffer->buffer)[(y * framebuffer->lineWidth) + x], framebuffer->lineWidth * 2,
+						width * 2, maxLine - y, fill565 | ((uint32_t) fill565 << 16)))
+				return;
+		}
+
+		int line;
+		for(line = y; line < maxLine; line++) {
+			framebuffer->hline(framebuffer, x, line, width, fill);
+		}
+		return;
+	}
+
+	// Whole lines are one run of memory, stride padding and all
+	uint32_t pixels = (maxLine - y) * framebuffer->lineWidth;
+	if(framebuffer->colorSpace == RGB888) {
+		uint32_t* to = (uint32_t*) &framebuffer->buffer[y * framebuffer->lineWidth];
+		if(!dmaMemory((uint32_t) to, 0, pixels * 4, TRUE, fill & 0xffffff))
+			fillWords(to, fill & 0xffffff, pixels);
+	} else {
+		uint16_t* to = &((uint16_t*)framebuffer->buffer)[y * framebuffer->lineWidth];
+		uint16_t fill565 = RGB565(fill);
+		if(!dmaMemory((uint32_t) to, 0, (pixels * 2) & ~0x3, TRUE, fill565 | ((uint32_t) fill565 << 16)))
+			fillHalfwords(to, fill565, pixels);
+		else if(pixels & 1)
+			to[pixels - 1] = fill565;
 	}
 }
 
 static void hline_rgb888(Framebuffer* framebuffer, int start, int line_no, int length, int fill) {
-	int i;
-	volatile uint32_t* line;
-
-	fill = fill & 0xffffff;	// no alpha
-	line = &framebuffer->buffer[line_no * framebuffer->lineWidth];
-
-	int stop = start + length;
-	for(i = start; i < stop; i++) {
-		line[i] = fill;
-	}
+	uint32_t* line = (uint32_t*) &framebuffer->buffer[line_no * framebuffer->lineWidth];
+	fillWords(line + start, fill & 0xffffff, length);	// no alpha
 }
 
 static void vline_rgb888(Framebuffer* framebuffer, int start, int line_no, int length, int fill) {
-	int i;
-	volatile uint32_t* line;
+	volatile uint32_t* pixel = &framebuffer->buffer[(start * framebuffer->lineWidth) + line_no];
+	uint32_t lineWidth = framebuffer->lineWidth;
 
 	fill = fill & 0xffffff;	// no alpha
-	line = &framebuffer->buffer[line_no];
 
-	int stop = start + length;
-	for(i = start; i < stop; i++) {
-		line[i * framebuffer->lineWidth] = fill;
+	while(length-- > 0) {
+		*pixel = fill;
+		pixel += lineWidth;
 	}
 }
 
 static void hline_rgb565(Framebuffer* framebuffer, int start, int line_no, int length, int fill) {
-	int i;
-	volatile uint16_t* line;
-	uint16_t fill565;
-
-	fill565= ((((fill >> 16) & 0xFF) >> 3) << 11) | ((((fill >> 8) & 0xFF) >> 2) << 5) | ((fill & 0xFF) >> 3);
-	line = &((uint16_t*)framebuffer->buffer)[line_no * framebuffer->lineWidth];
-
-	int stop = start + length;
-	for(i = start; i < stop; i++) {
-		line[i] = fill565;
-	}
+	uint16_t* line = &((uint16_t*)framebuffer->buffer)[line_no * framebuffer->lineWidth];
+	fillHalfwords(line + start, RGB565(fill), length);
 }
 
 static void vline_rgb565(Framebuffer* framebuffer, int start, int line_no, int length, int fill) {
-	int i;
-	volatile uint16_t* line;
-	uint16_t fill565;
-
-	fill565= ((((fill >> 16) & 0xFF) >> 3) << 11) | ((((fill >> 8) & 0xFF) >> 2) << 5) | ((fill & 0xFF) >> 3);
-	line = &((uint16_t*)framebuffer->buffer)[line_no];
+	volatile uint16_t* pixel = &((uint16_t*)framebuffer->buffer)[(start * framebuffer->lineWidth) + line_no];
+	uint32_t lineWidth = framebuffer->lineWidth;
+	uint16_t fill565 = RGB565(fill);
 
-	int stop = start + length;
-	for(i = start; i < stop; i++) {
-		line[i * framebuffer->lineWidth] = fill565;
+	while(length-- > 0) {
+		*pixel = fill565;
+		pixel += lineWidth;
 	}
 }
 
@@ -0,0 +1,107 @@
+#include "openiboot.h"
+#include "log.h"
+#include "util.h"
+#include "openiboot-asmhelpers.h"
+
+#define LOG_RING_MASK (LOG_RING_LEN - 1)
+
+int LogLevels[LogSubsystemCount] = {
+	LOG_MAXLEVEL,
+	LOG_MAXLEVEL,
+	LOG_MAXLEVEL,
+	LOG_MAXLEVEL,
+	LOG_MAXLEVEL
+};
+
+static const char* LogSubsystemNames[LogSubsystemCount] = {
+	"general",
+	"ftl",
+	"nand",
+	"usb",
+	"dma"
+};
+
+static uint32_t LogRing[LOG_RING_LEN];
+static volatile uint32_t LogHead = 0;
+static volatile uint32_t LogTail = 0;
+static volatile uint32_t LogDropped = 0;
+
+void log_record(int nargs, const char* format, ...) {
+	va_list args;
+	int i;
+
+	if(nargs > LOG_MAX_ARGS)
+		nargs = LOG_MAX_ARGS;
+
+	// Only long enough to claim the slots and copy a handful of words
+	EnterCriticalSection();
+
+	uint32_t head = LogHead;
+	if(((head + 2 + nargs) - LogTail) > LOG_RING_LEN) {
+		LogDropped++;
+		LeaveCriticalSection();
+		return;
+	}
+
+	LogRing[head++ & LOG_RING_MASK] = (uint32_t) format;
+	LogRing[head++ & LOG_RING_MASK] = nargs;
+
+	va_start(args, format);
+	for(i = 0; i < nargs; i++)
+		LogRing[head++ & LOG_RING_MASK] = va_arg(args, uint32_t);
+	va_end(args);
+
+	LogHead = head;
+
+	LeaveCriticalSection();
+}
+
+int log_drain() {
+	static char buffer[1000];
+	uint32_t a[LOG_MAX_ARGS];
+	int drained = 0;
+	int i;
+
+	while(LogTail != LogHead) {
+		uint32_t tail = LogTail;
+		const char* format = (const char*) LogRing[tail++ & LOG_RING_MASK];
+		int nargs = LogRing[tail++ & LOG_RING_MASK];
+
+		for(i = 0; i < LOG_MAX_ARGS; i++)
+			a[i] = (i < nargs) ? LogRing[tail++ & LOG_RING_MASK] : 0;
+
+		LogTail = tail;
+
+		// printf ignores surplus arguments, so always passing all of them is fine
+		sprintf(buffer, format, a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+
+		EnterCriticalSection();
+		bufferPrint(buffer);
+		LeaveCriticalSection();
+
+		drained++;
+	}
+
+	if(LogDropped) {
+		EnterCriticalSection();
+		uint32_t dropped = LogDropped;
+		LogDropped = 0;
+		LeaveCriticalSection();
+
+		bufferPrintf("log: %d records dropped\r\n", dropped);
+	}
+
+	return drained;
+}
+
+int log_set_level(const char* subsystem, int level) {
+	int i;
+	for(i = 0; i < LogSubsystemCount; i++) {
+		if(strcmp(subsystem, LogSubsystemNames[i]) == 0) {
+			LogLevels[i] = level;
+			return 0;
+		}
+	}
+
+	return -1;
+}
@@ -0,0 +1,135 @@
+#include "openiboot.h"
+#include "lz4.h"
+#include "util.h"
+
+#define LZ4_MINMATCH 4
+
+enum {
+	LZ4Token,
+	LZ4LiteralLength,
+	LZ4Literals,
+	LZ4OffsetLow,
+	LZ4OffsetHigh,
+	LZ4MatchLength,
+	LZ4Done,
+	LZ4Corrupt
+};
+
+void lz4_stream_init(LZ4Stream* stream, void* destination, uint32_t length) {
+	stream->start = (uint8_t*) destination;
+	stream->out = stream->start;
+	stream->end = stream->start + length;
+	stream->state = (length == 0) ? LZ4Done : LZ4Token;
+	stream->token = 0;
+	stream->literalLength = 0;
+	stream->matchLength = 0;
+	stream->offset = 0;
+}
+
+static int copyMatch(LZ4Stream* stream) {
+	if(stream->offset == 0 || stream->offset > (uint32_t)(stream->out - stream->start))
+		return -1;
+
+	if(stream->matchLength > (uint32_t)(stream->end - stream->out))
+		return -1;
+
+	// byte at a time: the match may overlap the bytes it produces
+	uint8_t* from = stream->out - stream->offset;
+	uint8_t* to = stream->out;
+	uint32_t left = stream->matchLength;
+	while(left-- > 0)
+		*(to++) = *(from++);
+
+	stream->out = to;
+	stream->state = (stream->out == stream->end) ? LZ4Done : LZ4Token;
+	return 0;
+}
+
+static void literalsDone(LZ4Stream* stream) {
+	stream->state = (stream->out == stream->end) ? LZ4Done : LZ4OffsetLow;
+}
+
+int lz4_stream_feed(LZ4Stream* stream, const uint8_t* data, uint32_t length) {
+	const uint8_t* in = data;
+	const uint8_t* inEnd = data + length;
+
+	while(in < inEnd) {
+		uint8_t b;
+
+		switch(stream->state) {
+			case LZ4Token:
+				stream->token = *(in++);
+				stream->literalLength = stream->token >> 4;
+				if(stream->literalLength == 15)
+					stream->state = LZ4LiteralLength;
+				else if(stream->literalLength > 0)
+					stream->state = LZ4Literals;
+				else
+					literalsDone(stream);
+				break;
+
+			case LZ4LiteralLength:
+				b = *(in++);
+				stream->literalLength += b;
+				if(b != 255)
+					stream->state = LZ4Literals;
+				break;
+
+			case LZ4Literals:
+				{
+					uint32_t toCopy = stream->literalLength;
+					if(toCopy > (uint32_t)(inEnd - in))
+						toCopy = inEnd - in;
+
+					if(toCopy > (uint32_t)(stream->end - stream->out)) {
+						stream->state = LZ4Corrupt;
+						return -1;
+					}
+
+					memcpy(stream->out, in, toCopy);
+					stream->out += toCopy;
+					in += toCopy;
+					stream->literalLength -= toCopy;
+					if(stream->literalLength == 0)
+						literalsDone(stream);
+				}
+				break;
+
+			case LZ4OffsetLow:
+				stream->offset = *(in++);
+				stream->state = LZ4OffsetHigh;
+				break;
+
+			case LZ4OffsetHigh:
+				stream->offset |= *(in++) << 8;
+				stream->matchLength = (stream->token & 0xF) + LZ4_MINMATCH;
+				if((stream->token & 0xF) == 15) {
+					stream->state = LZ4MatchLength;
+				} else if(copyMatch(stream) != 0) {
+					stream->state = LZ4Corrupt;
+					return -1;
+				}
+				break;
+
+			case LZ4MatchLength:
+				b = *(in++);
+				stream->matchLength += b;
+				if(b != 255 && copyMatch(stream) != 0) {
+					stream->state = LZ4Corrupt;
+					return -1;
+				}
+				break;
+
+			default:
+				// anything past the end, or after an error, is garbage
+				stream->state = LZ4Corrupt;
+				return -1;
+		}
+	}
+
+	return 0;
+}
+
+int lz4_stream_done(LZ4Stream* stream) {
+	return stream->state == LZ4Done;
+}
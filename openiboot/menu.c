@@ -7,13 +7,13 @@
 #include "framebuffer.h"
 #include "buttons.h"
 #include "timer.h"
-#include "images/ConsolePNG.h"
-#include "images/iPhoneOSPNG.h"
-#include "images/AndroidOSPNG.h"
-#include "images/ConsoleSelectedPNG.h"
-#include "images/iPhoneOSSelectedPNG.h"
-#include "images/AndroidOSSelectedPNG.h"
-#include "images/HeaderPNG.h"
+#include "images/ConsoleRaw.h"
+#include "images/iPhoneOSRaw.h"
+#include "images/AndroidOSRaw.h"
+#include "images/ConsoleSelectedRaw.h"
+#include "images/iPhoneOSSelectedRaw.h"
+#include "images/AndroidOSSelectedRaw.h"
+#include "images/HeaderRaw.h"
 #include "images.h"
 #include "actions.h"
 #include "stb_image.h"
@@ -30,33 +30,15 @@ static uint32_t FBWidth;
 static uint32_t FBHeight;
 
 
-static uint32_t* imgiPhoneOS;
-static int imgiPhoneOSWidth;
-static int imgiPhoneOSHeight;
 static int imgiPhoneOSX;
 static int imgiPhoneOSY;
 
-static uint32_t* imgConsole;
-static int imgConsoleWidth;
-static int imgConsoleHeight;
 static int imgConsoleX;
 static int imgConsoleY;
 
-static uint32_t* imgAndroidOS;
-static uint32_t* imgAndroidOS_unblended;
-static int imgAndroidOSWidth;
-static int imgAndroidOSHeight;
 static int imgAndroidOSX;
 static int imgAndroidOSY;
 
-static uint32_t* imgiPhoneOSSelected;
-static uint32_t* imgConsoleSelected;
-static uint32_t* imgAndroidOSSelected;
-static uint32_t* imgAndroidOSSelected_unblended;
-
-static uint32_t* imgHeader;
-static int imgHeaderWidth;
-static int imgHeaderHeight;
 static int imgHeaderX;
 static int imgHeaderY;
 
@@ -68,37 +50,37 @@ typedef enum MenuSelection {
 
 static MenuSelection Selection;
 
-volatile uint32_t* OtherFramebuffer;
-
-static void drawSelectionBox() {
-	volatile uint32_t* oldFB = CurFramebuffer;
-
-	CurFramebuffer = OtherFramebuffer;
-	currentWindow->framebuffer.buffer = CurFramebuffer;
-	OtherFramebuffer = oldFB;
+static void drawItem(MenuSelection item) {
+	int selected = (item == Selection);
 
-	if(Selection == MenuSelectioniPhoneOS) {
-		framebuffer_draw_image(imgiPhoneOSSelected, imgiPhoneOSX, imgiPhoneOSY, imgiPhoneOSWidth, imgiPhoneOSHeight);
-		framebuffer_draw_image(imgConsole, imgConsoleX, imgConsoleY, imgConsoleWidth, imgConsoleHeight);
-		framebuffer_draw_image(imgAndroidOS, imgAndroidOSX, imgAndroidOSY, imgAndroidOSWidth, imgAndroidOSHeight);
+	switch(item) {
+		case MenuSelectioniPhoneOS:
+			framebuffer_draw_asset(selected ? &rawiPhoneOSSelected : &rawiPhoneOS, imgiPhoneOSX, imgiPhoneOSY);
+			break;
+		case MenuSelectionConsole:
+			framebuffer_draw_asset(selected ? &rawConsoleSelected : &rawConsole, imgConsoleX, imgConsoleY);
+			break;
+		case MenuSelectionAndroidOS:
+			framebuffer_draw_asset(selected ? &rawAndroidOSSelected : &rawAndroidOS, imgAndroidOSX, imgAndroidOSY);
+			break;
 	}
+}
 
-	if(Selection == MenuSelectionConsole) {
-		framebuffer_draw_image(imgiPhoneOS, imgiPhoneOSX, imgiPhoneOSY, imgiPhoneOSWidth, imgiPhoneOSHeight);
-		framebuffer_draw_image(imgConsoleSelected, imgConsoleX, imgConsoleY, imgConsoleWidth, imgConsoleHeight);
-		framebuffer_draw_image(imgAndroidOS, imgAndroidOSX, imgAndroidOSY, imgAndroidOSWidth, imgAndroidOSHeight);
-	}
+// Only the item losing the selection and the one gaining it change
+static void drawSelectionBox(MenuSelection previous) {
+	framebuffer_frame_begin();
 
-	if(Selection == MenuSelectionAndroidOS) {
-		framebuffer_draw_image(imgiPhoneOS, imgiPhoneOSX, imgiPhoneOSY, imgiPhoneOSWidth, imgiPhoneOSHeight);
-		framebuffer_draw_image(imgConsole, imgConsoleX, imgConsoleY, imgConsoleWidth, imgConsoleHeight);
-		framebuffer_draw_image(imgAndroidOSSelected, imgAndroidOSX, imgAndroidOSY, imgAndroidOSWidth, imgAndroidOSHeight);
-	}
+	if(previous != Selection)
+		drawItem(previous);
 
-	lcd_window_address(2, (uint32_t) CurFramebuffer);
+	drawItem(Selection);
+
+	framebuffer_frame_end();
 }
 
 static void toggle(int forward) {
+	MenuSelection previous = Selection;
+
 	if(forward)
 	{
 		if(Selection == MenuSelectioniPhoneOS)
@@ -117,36 +99,28 @@ static void toggle(int forward) {
 			Selection = MenuSelectioniPhoneOS;
 	}
 
-	drawSelectionBox();
+	drawSelectionBox(previous);
 }
 
 int menu_setup(int timeout) {
 	FBWidth = currentWindow->framebuffer.width;
 	FBHeight = currentWindow->framebuffer.height;	
 
-	imgiPhoneOS = framebuffer_load_image(dataiPhoneOSPNG, dataiPhoneOSPNG_size, &imgiPhoneOSWidth, &imgiPhoneOSHeight, TRUE);
-	imgiPhoneOSSelected = framebuffer_load_image(dataiPhoneOSSelectedPNG, dataiPhoneOSSelectedPNG_size, &imgiPhoneOSWidth, &imgiPhoneOSHeight, TRUE);
-	imgConsole = framebuffer_load_image(dataConsolePNG, dataConsolePNG_size, &imgConsoleWidth, &imgConsoleHeight, TRUE);
-	imgConsoleSelected = framebuffer_load_image(dataConsoleSelectedPNG, dataConsoleSelectedPNG_size, &imgConsoleWidth, &imgConsoleHeight, TRUE);
-	imgAndroidOS_unblended = framebuffer_load_image(dataAndroidOSPNG, dataAndroidOSPNG_size, &imgAndroidOSWidth, &imgAndroidOSHeight, TRUE);
-	imgAndroidOSSelected_unblended = framebuffer_load_image(dataAndroidOSSelectedPNG, dataAndroidOSSelectedPNG_size, &imgAndroidOSWidth, &imgAndroidOSHeight, TRUE);
-	imgHeader = framebuffer_load_image(dataHeaderPNG, dataHeaderPNG_size, &imgHeaderWidth, &imgHeaderHeight, TRUE);
-
-	bufferPrintf("menu: images loaded\r\n");
-
-	imgiPhoneOSX = (FBWidth - imgiPhoneOSWidth) / 2;
+	imgiPhoneOSX = (FBWidth - rawiPhoneOS.width) / 2;
 	imgiPhoneOSY = 84;
 
-	imgConsoleX = (FBWidth - imgConsoleWidth) / 2;
+	imgConsoleX = (FBWidth - rawConsole.width) / 2;
 	imgConsoleY = 207;
 
-	imgAndroidOSX = (FBWidth - imgAndroidOSWidth) / 2;
+	// The Android images were blended over this spot and the gradient below at build time; images/Makefile has to
+	// follow if either moves.
+	imgAndroidOSX = (FBWidth - rawAndroidOS.width) / 2;
 	imgAndroidOSY = 330;
 
-	imgHeaderX = (FBWidth - imgHeaderWidth) / 2;
+	imgHeaderX = (FBWidth - rawHeader.width) / 2;
 	imgHeaderY = 17;
 
-	framebuffer_draw_image(imgHeader, imgHeaderX, imgHeaderY, imgHeaderWidth, imgHeaderHeight);
+	framebuffer_draw_asset(&rawHeader, imgHeaderX, imgHeaderY);
 
 	framebuffer_draw_rect_hgradient(0, 42, 0, 360, FBWidth, (FBHeight - 12) - 360);
 	framebuffer_draw_rect_hgradient(0x22, 0x22, 0, FBHeight - 12, FBWidth, 12);
@@ -157,26 +131,19 @@ int menu_setup(int timeout) {
 	framebuffer_setcolors(COLOR_WHITE, COLOR_BLACK);
 	framebuffer_setloc(0, 0);
 
-	imgAndroidOS = malloc(imgAndroidOSWidth * imgAndroidOSHeight * sizeof(uint32_t));
-	imgAndroidOSSelected = malloc(imgAndroidOSWidth * imgAndroidOSHeight * sizeof(uint32_t));
-
-	framebuffer_capture_image(imgAndroidOS, imgAndroidOSX, imgAndroidOSY, imgAndroidOSWidth, imgAndroidOSHeight);
-	framebuffer_capture_image(imgAndroidOSSelected, imgAndroidOSX, imgAndroidOSY, imgAndroidOSWidth, imgAndroidOSHeight);
-
-	framebuffer_blend_image(imgAndroidOS, imgAndroidOSWidth, imgAndroidOSHeight, imgAndroidOS_unblended, imgAndroidOSWidth, imgAndroidOSHeight, 0, 0);
-	framebuffer_blend_image(imgAndroidOSSelected, imgAndroidOSWidth, imgAndroidOSHeight, imgAndroidOSSelected_unblended, imgAndroidOSWidth, imgAndroidOSHeight, 0, 0);
-
 	Selection = MenuSelectioniPhoneOS;
 
-	OtherFramebuffer = CurFramebuffer;
-	CurFramebuffer = (volatile uint32_t*) NextFramebuffer;
+	// everything so far went straight to the screen; from here on the menu is drawn a frame at a time
+	framebuffer_frames_start(2);
 
-	drawSelectionBox();
+	framebuffer_frame_begin();
+	drawItem(MenuSelectioniPhoneOS);
+	drawItem(MenuSelectionConsole);
+	drawItem(MenuSelectionAndroidOS);
+	framebuffer_frame_end();
 
 	pmu_set_iboot_stage(0);
 
-	memcpy((void*)NextFramebuffer, (void*) CurFramebuffer, NextFramebuffer - (uint32_t)CurFramebuffer);
-
 	uint64_t startTime = timer_get_system_microtime();
 	while(TRUE) {
 		if(buttons_is_pushed(BUTTONS_HOLD)) {
@@ -216,26 +183,14 @@ int menu_setup(int timeout) {
 	}
 
 	if(Selection == MenuSelectionConsole) {
-		// Reset framebuffer back to original if necessary
-		if((uint32_t) CurFramebuffer == NextFramebuffer)
-		{
-			CurFramebuffer = OtherFramebuffer;
-			currentWindow->framebuffer.buffer = CurFramebuffer;
-			lcd_window_address(2, (uint32_t) CurFramebuffer);
-		}
+		framebuffer_frames_stop();
 
 		framebuffer_setdisplaytext(TRUE);
 		framebuffer_clear();
 	}
 
 	if(Selection == MenuSelectionAndroidOS) {
-		// Reset framebuffer back to original if necessary
-		if((uint32_t) CurFramebuffer == NextFramebuffer)
-		{
-			CurFramebuffer = OtherFramebuffer;
-			currentWindow->framebuffer.buffer = CurFramebuffer;
-			lcd_window_address(2, (uint32_t) CurFramebuffer);
-		}
+		framebuffer_frames_stop();
 
 		framebuffer_setdisplaytext(TRUE);
 		framebuffer_clear();
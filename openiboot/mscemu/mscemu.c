@@ -0,0 +1,590 @@
+/*
+ * mscemu: runs openiboot's USB mass storage function (usbmsc.c) against a host speaking bulk-only transport to it,
+ * with the FTL's logical pages kept in a temporary file, and checks that the SCSI commands a Linux host sends to
+ * mount or image a partition do what they should.
+ *
+ * usage: mscemu
+ *
+ * The msc task runs on a thread of its own. Whenever it would be waiting for the USB controller, the host side takes
+ * over, moves the data the way the cable would and calls the firmware's completion handlers itself.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+// The firmware's headers can't be mixed with the host's, so what's used from them is restated here.
+
+#define TRUE 1
+#define FALSE 0
+
+#define MSC_REQUEST_RESET 0xFF
+#define MSC_REQUEST_GET_MAX_LUN 0xFE
+
+#define MSC_CBW_SIGNATURE 0x43425355
+#define MSC_CSW_SIGNATURE 0x53425355
+#define MSC_CBW_DATA_IN 0x80
+
+#define MSC_CSW_PASSED 0
+#define MSC_CSW_FAILED 1
+
+typedef struct MSCCommandBlockWrapper {
+	uint32_t dCBWSignature;
+	uint32_t dCBWTag;
+	uint32_t dCBWDataTransferLength;
+	uint8_t bmCBWFlags;
+	uint8_t bCBWLUN;
+	uint8_t bCBWCBLength;
+	uint8_t CBWCB[16];
+} __attribute__ ((__packed__)) MSCCommandBlockWrapper;
+
+typedef struct MSCCommandStatusWrapper {
+	uint32_t dCSWSignature;
+	uint32_t dCSWTag;
+	uint32_t dCSWDataResidue;
+	uint8_t bCSWStatus;
+} __attribute__ ((__packed__)) MSCCommandStatusWrapper;
+
+typedef void (*TaskRoutineFunction)(void* opaque);
+
+int msc_start(int writable);
+void emu_set_geometry(uint32_t bytesPerPage, uint32_t userPagesTotal);
+void emu_configure();
+int emu_class_request(uint8_t request, uint8_t* buffer);
+void emu_complete(int in);
+
+#define SCSI_TEST_UNIT_READY 0x00
+#define SCSI_REQUEST_SENSE 0x03
+#define SCSI_INQUIRY 0x12
+#define SCSI_MODE_SENSE_6 0x1A
+#define SCSI_READ_CAPACITY_10 0x25
+#define SCSI_READ_10 0x28
+#define SCSI_WRITE_10 0x2A
+#define SCSI_SYNCHRONIZE_CACHE_10 0x35
+
+#define SENSE_MEDIUM_ERROR 0x03
+#define SENSE_ILLEGAL_REQUEST 0x05
+#define SENSE_DATA_PROTECT 0x07
+
+#define ASC_UNRECOVERED_READ_ERROR 0x11
+#define ASC_INVALID_COMMAND 0x20
+#define ASC_LBA_OUT_OF_RANGE 0x21
+#define ASC_WRITE_PROTECTED 0x27
+
+// a small NAND: 2K pages, 32 of them to usbmsc's 64K buffer
+#define PAGE_SIZE 2048
+#define USER_PAGES 1024
+#define BLOCKS (USER_PAGES - 1)
+#define PAGES_PER_BUFFER 32
+
+#define PACKET_SIZE 512
+#define WIRE_TIMEOUT 5
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static int Failures = 0;
+
+static pthread_mutex_t Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Changed = PTHREAD_COND_INITIALIZER;
+static pthread_t MscThread;
+
+// the transfer usbmsc.c has armed on each endpoint, [TRUE] being IN
+typedef struct Transfer {
+	uint8_t* buffer;
+	int length;
+	int armed;
+} Transfer;
+
+static Transfer Wire[2];
+static uint32_t Tag = 1;
+
+static int Disk = -1;
+static uint8_t* Contents;
+static int PagesRead[USER_PAGES];
+static int FailPage = -1;
+static int Syncs = 0;
+
+static void check(int ok, const char* what, int line) {
+	if(ok)
+		return;
+
+	fprintf(stderr, "mscemu.c:%d: check failed: %s\n", line, what);
+	++Failures;
+}
+
+static void deadline(struct timespec* when, uint32_t microseconds) {
+	clock_gettime(CLOCK_REALTIME, when);
+	when->tv_sec += microseconds / 1000000;
+	when->tv_nsec += (microseconds % 1000000) * 1000;
+	if(when->tv_nsec >= 1000000000) {
+		when->tv_sec++;
+		when->tv_nsec -= 1000000000;
+	}
+}
+
+// What stubs.c passes on. All of it is called with Lock held.
+
+static TaskRoutineFunction MscRoutine;
+
+static void* taskMain(void* opaque) {
+	pthread_mutex_lock(&Lock);
+	MscRoutine(opaque);
+	pthread_mutex_unlock(&Lock);
+	return NULL;
+}
+
+void host_task_start(TaskRoutineFunction routine, void* opaque) {
+	MscRoutine = routine;
+	pthread_create(&MscThread, NULL, taskMain, opaque);
+}
+
+int host_task_wait(volatile int* pending, uint32_t timeout) {
+	struct timespec when;
+
+	if(timeout != 0)
+		deadline(&when, timeout);
+
+	while(!*pending) {
+		if(timeout == 0)
+			pthread_cond_wait(&Changed, &Lock);
+		else if(pthread_cond_timedwait(&Changed, &Lock, &when) == ETIMEDOUT && !*pending)
+			return 1;
+	}
+
+	*pending = FALSE;
+	return 0;
+}
+
+void host_task_wake() {
+	pthread_cond_broadcast(&Changed);
+}
+
+void host_usb_arm(int in, void* buffer, int bufferLen) {
+	Wire[in].buffer = (uint8_t*) buffer;
+	Wire[in].length = bufferLen;
+	Wire[in].armed = TRUE;
+	pthread_cond_broadcast(&Changed);
+}
+
+int host_ftl_read(uint32_t page, uint32_t pages, void* buffer) {
+	uint32_t i;
+
+	if(FailPage >= 0 && (uint32_t) FailPage >= page && (uint32_t) FailPage < page + pages)
+		return FALSE;
+
+	for(i = page; i < page + pages; i++)
+		PagesRead[i]++;
+
+	return pread(Disk, buffer, pages * PAGE_SIZE, (off_t) page * PAGE_SIZE) == pages * PAGE_SIZE;
+}
+
+int host_ftl_write(uint32_t page, uint32_t pages, const void* buffer) {
+	return pwrite(Disk, buffer, pages * PAGE_SIZE, (off_t) page * PAGE_SIZE) == pages * PAGE_SIZE;
+}
+
+int host_ftl_sync() {
+	++Syncs;
+	return TRUE;
+}
+
+// The host end of the cable
+
+static int waitArmed(int in) {
+	struct timespec when;
+
+	deadline(&when, WIRE_TIMEOUT * 1000000);
+	while(!Wire[in].armed) {
+		if(pthread_cond_timedwait(&Changed, &Lock, &when) == ETIMEDOUT && !Wire[in].armed) {
+			fprintf(stderr, "mscemu: timed out waiting for the device to %s\n", in ? "send" : "receive");
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+// Sends length bytes to the bulk OUT endpoint, as many transfers as the device cares to split it into.
+static int busOut(const void* data, int length) {
+	const uint8_t* at = (const uint8_t*) data;
+	int ok = TRUE;
+
+	pthread_mutex_lock(&Lock);
+	while(length > 0) {
+		if(!waitArmed(FALSE)) {
+			ok = FALSE;
+			break;
+		}
+
+		int n = (length > Wire[FALSE].length) ? Wire[FALSE].length : length;
+		memcpy(Wire[FALSE].buffer, at, n);
+		Wire[FALSE].armed = FALSE;
+		emu_complete(FALSE);
+		at += n;
+		length -= n;
+	}
+	pthread_mutex_unlock(&Lock);
+
+	return ok;
+}
+
+// Reads up to length bytes from the bulk IN endpoint, stopping early at a short packet. Returns how many arrived, or
+// -1 if the device sent more than that or nothing at all.
+static int busIn(void* data, int length) {
+	uint8_t* at = (uint8_t*) data;
+	int got = 0;
+
+	pthread_mutex_lock(&Lock);
+	while(got < length) {
+		if(!waitArmed(TRUE)) {
+			got = -1;
+			break;
+		}
+
+		int n = Wire[TRUE].length;
+		if(n > length - got) {
+			fprintf(stderr, "mscemu: the device sent %d bytes where %d were expected\n", n, length - got);
+			got = -1;
+			break;
+		}
+
+		memcpy(at, Wire[TRUE].buffer, n);
+		Wire[TRUE].armed = FALSE;
+		emu_complete(TRUE);
+		at += n;
+		got += n;
+
+		if(n % PACKET_SIZE != 0)
+			break;
+	}
+	pthread_mutex_unlock(&Lock);
+
+	return got;
+}
+
+// Runs one command through the bulk-only transport: CBW, data phase (of length, in whichever direction), CSW.
+// Returns the CSW status, or -1 if the transport itself went wrong.
+static int command(const uint8_t* cb, int cbLength, int in, void* data, uint32_t length, uint32_t* residue) {
+	MSCCommandBlockWrapper cbw;
+	MSCCommandStatusWrapper csw;
+
+	memset(&cbw, 0, sizeof(cbw));
+	cbw.dCBWSignature = MSC_CBW_SIGNATURE;
+	cbw.dCBWTag = Tag++;
+	cbw.dCBWDataTransferLength = length;
+	cbw.bmCBWFlags = in ? MSC_CBW_DATA_IN : 0;
+	cbw.bCBWCBLength = cbLength;
+	memcpy(cbw.CBWCB, cb, cbLength);
+
+	if(!busOut(&cbw, sizeof(cbw)))
+		return -1;
+
+	if(length > 0) {
+		if(in) {
+			if(busIn(data, length) < 0)
+				return -1;
+		} else if(!busOut(data, length)) {
+			return -1;
+		}
+	}
+
+	if(busIn(&csw, sizeof(csw)) != sizeof(csw) || csw.dCSWSignature != MSC_CSW_SIGNATURE || csw.dCSWTag != cbw.dCBWTag) {
+		fprintf(stderr, "mscemu: bad CSW for tag %u\n", cbw.dCBWTag);
+		return -1;
+	}
+
+	if(residue)
+		*residue = csw.dCSWDataResidue;
+
+	return csw.bCSWStatus;
+}
+
+static int simple(uint8_t opcode) {
+	uint8_t cb[6] = {opcode};
+	return command(cb, sizeof(cb), FALSE, NULL, 0, NULL);
+}
+
+static int transfer(uint8_t opcode, uint32_t lba, uint32_t count, void* data, uint32_t* residue) {
+	uint8_t cb[10] = {opcode, 0, lba >> 24, lba >> 16, lba >> 8, lba, 0, count >> 8, count};
+	return command(cb, sizeof(cb), opcode == SCSI_READ_10, data, count * PAGE_SIZE, residue);
+}
+
+static void requestSense(uint8_t* key, uint8_t* asc) {
+	uint8_t cb[6] = {SCSI_REQUEST_SENSE, 0, 0, 0, 18};
+	uint8_t sense[18];
+
+	memset(sense, 0xFF, sizeof(sense));
+	CHECK(command(cb, sizeof(cb), TRUE, sense, sizeof(sense), NULL) == MSC_CSW_PASSED);
+	*key = sense[2];
+	*asc = sense[12];
+}
+
+static void expectSense(uint8_t key, uint8_t asc) {
+	uint8_t gotKey;
+	uint8_t gotASC;
+
+	requestSense(&gotKey, &gotASC);
+	CHECK(gotKey == key);
+	CHECK(gotASC == asc);
+}
+
+// (Re)plugs the device, as msc_start would on the phone.
+static void plug(int writable) {
+	pthread_mutex_lock(&Lock);
+	memset(Wire, 0, sizeof(Wire));
+	emu_set_geometry(PAGE_SIZE, USER_PAGES);
+	msc_start(writable);
+	emu_configure();
+	pthread_mutex_unlock(&Lock);
+}
+
+static void fillDisk() {
+	uint32_t seed = 12345;
+	int i;
+
+	for(i = 0; i < USER_PAGES * PAGE_SIZE; i++) {
+		seed = seed * 1103515245 + 12345;
+		Contents[i] = seed >> 16;
+	}
+
+	CHECK(pwrite(Disk, Contents, USER_PAGES * PAGE_SIZE, 0) == USER_PAGES * PAGE_SIZE);
+}
+
+// What a host asks before it mounts anything
+static void testIdentify() {
+	uint8_t cb[10] = {0};
+	uint8_t reply[96];
+	uint32_t residue;
+
+	pthread_mutex_lock(&Lock);
+	reply[0] = 0xFF;
+	CHECK(emu_class_request(MSC_REQUEST_GET_MAX_LUN, reply) == 1);
+	CHECK(reply[0] == 0);
+	pthread_mutex_unlock(&Lock);
+
+	CHECK(simple(SCSI_TEST_UNIT_READY) == MSC_CSW_PASSED);
+
+	cb[0] = SCSI_INQUIRY;
+	cb[4] = sizeof(reply);
+	CHECK(command(cb, 6, TRUE, reply, sizeof(reply), &residue) == MSC_CSW_PASSED);
+	CHECK(residue == sizeof(reply) - 36);
+	CHECK(reply[0] == 0x00);
+	CHECK(memcmp(reply + 8, "Apple", 5) == 0);
+
+	cb[0] = SCSI_READ_CAPACITY_10;
+	CHECK(command(cb, 10, TRUE, reply, 8, &residue) == MSC_CSW_PASSED);
+	CHECK(residue == 0);
+	CHECK(((reply[0] << 24) | (reply[1] << 16) | (reply[2] << 8) | reply[3]) == BLOCKS - 1);
+	CHECK(((reply[4] << 24) | (reply[5] << 16) | (reply[6] << 8) | reply[7]) == PAGE_SIZE);
+
+	cb[0] = SCSI_MODE_SENSE_6;
+	cb[4] = 4;
+	CHECK(command(cb, 6, TRUE, reply, 4, NULL) == MSC_CSW_PASSED);
+	CHECK((reply[2] & 0x80) == 0);
+}
+
+// Reads of every size land on the right pages, and a host reading straight through finds each piece read ahead
+static void testRead() {
+	static const uint32_t spans[][2] = {{0, 1}, {1, 31}, {32, 32}, {7, 100}, {BLOCKS - 70, 70}, {300, 256}};
+	uint8_t* data = malloc(256 * PAGE_SIZE);
+	uint32_t residue;
+	uint32_t lba;
+	int i;
+
+	for(i = 0; i < sizeof(spans) / sizeof(spans[0]); i++) {
+		memset(data, 0, spans[i][1] * PAGE_SIZE);
+		CHECK(transfer(SCSI_READ_10, spans[i][0], spans[i][1], data, &residue) == MSC_CSW_PASSED);
+		CHECK(residue == 0);
+		CHECK(memcmp(data, Contents + spans[i][0] * PAGE_SIZE, spans[i][1] * PAGE_SIZE) == 0);
+	}
+
+	// like dd with a 64K block size
+	memset(PagesRead, 0, sizeof(PagesRead));
+	for(lba = 0; lba + PAGES_PER_BUFFER <= 8 * PAGES_PER_BUFFER; lba += PAGES_PER_BUFFER) {
+		CHECK(transfer(SCSI_READ_10, lba, PAGES_PER_BUFFER, data, NULL) == MSC_CSW_PASSED);
+		CHECK(memcmp(data, Contents + lba * PAGE_SIZE, PAGES_PER_BUFFER * PAGE_SIZE) == 0);
+	}
+
+	for(lba = 0; lba < 8 * PAGES_PER_BUFFER; lba++)
+		CHECK(PagesRead[lba] == 1);
+
+	free(data);
+}
+
+// Writes reach the disk, and the FTL context is committed when asked for or once the host goes quiet
+static void testWrite() {
+	uint8_t* data = malloc(100 * PAGE_SIZE);
+	uint8_t* back = malloc(100 * PAGE_SIZE);
+	uint32_t residue;
+	int syncs;
+	int i;
+
+	for(i = 0; i < 100 * PAGE_SIZE; i++)
+		data[i] = i * 7 + (i >> 11);
+
+	CHECK(transfer(SCSI_WRITE_10, 200, 100, data, &residue) == MSC_CSW_PASSED);
+	CHECK(residue == 0);
+	CHECK(pread(Disk, back, 100 * PAGE_SIZE, 200 * PAGE_SIZE) == 100 * PAGE_SIZE);
+	CHECK(memcmp(back, data, 100 * PAGE_SIZE) == 0);
+	memcpy(Contents + 200 * PAGE_SIZE, data, 100 * PAGE_SIZE);
+
+	// the read ahead from before mustn't hand back what was there before the write
+	CHECK(transfer(SCSI_READ_10, 200, 100, back, NULL) == MSC_CSW_PASSED);
+	CHECK(memcmp(back, data, 100 * PAGE_SIZE) == 0);
+
+	pthread_mutex_lock(&Lock);
+	syncs = Syncs;
+	pthread_mutex_unlock(&Lock);
+
+	CHECK(simple(SCSI_SYNCHRONIZE_CACHE_10) == MSC_CSW_PASSED);
+	CHECK(simple(SCSI_SYNCHRONIZE_CACHE_10) == MSC_CSW_PASSED);
+
+	pthread_mutex_lock(&Lock);
+	CHECK(Syncs == syncs + 1);
+	syncs = Syncs;
+	pthread_mutex_unlock(&Lock);
+
+	CHECK(transfer(SCSI_WRITE_10, 400, 1, data, NULL) == MSC_CSW_PASSED);
+	memcpy(Contents + 400 * PAGE_SIZE, data, PAGE_SIZE);
+	usleep(1500000);
+
+	pthread_mutex_lock(&Lock);
+	CHECK(Syncs == syncs + 1);
+	pthread_mutex_unlock(&Lock);
+
+	free(back);
+	free(data);
+}
+
+// Failed commands still see their data phase through, and REQUEST SENSE says why they failed
+static void testErrors() {
+	uint8_t* data = malloc(96 * PAGE_SIZE);
+	uint8_t cb[10] = {0};
+	uint8_t garbage[31];
+	uint32_t residue;
+
+	memset(data, 0xAA, 2 * PAGE_SIZE);
+	CHECK(transfer(SCSI_READ_10, BLOCKS - 1, 2, data, &residue) == MSC_CSW_FAILED);
+	CHECK(residue == 2 * PAGE_SIZE);
+	CHECK(data[0] == 0 && data[2 * PAGE_SIZE - 1] == 0);
+	expectSense(SENSE_ILLEGAL_REQUEST, ASC_LBA_OUT_OF_RANGE);
+
+	cb[0] = 0xFF;
+	CHECK(command(cb, 6, FALSE, NULL, 0, NULL) == MSC_CSW_FAILED);
+	expectSense(SENSE_ILLEGAL_REQUEST, ASC_INVALID_COMMAND);
+
+	// the first buffer goes out before the second one fails to read
+	pthread_mutex_lock(&Lock);
+	FailPage = PAGES_PER_BUFFER + 8;
+	pthread_mutex_unlock(&Lock);
+
+	CHECK(transfer(SCSI_READ_10, 0, 96, data, &residue) == MSC_CSW_FAILED);
+	CHECK(residue == 64 * PAGE_SIZE);
+	CHECK(memcmp(data, Contents, PAGES_PER_BUFFER * PAGE_SIZE) == 0);
+	expectSense(SENSE_MEDIUM_ERROR, ASC_UNRECOVERED_READ_ERROR);
+
+	pthread_mutex_lock(&Lock);
+	FailPage = -1;
+	pthread_mutex_unlock(&Lock);
+
+	// a CBW without its signature is dropped without an answer, and the next one is taken as usual
+	memset(garbage, 0x5A, sizeof(garbage));
+	CHECK(busOut(garbage, sizeof(garbage)));
+	CHECK(simple(SCSI_TEST_UNIT_READY) == MSC_CSW_PASSED);
+	expectSense(0, 0);
+
+	free(data);
+}
+
+// A bulk-only reset partway through a read drops it, and the device goes back to waiting for a CBW
+static void testReset() {
+	MSCCommandBlockWrapper cbw;
+	uint8_t* data = malloc(96 * PAGE_SIZE);
+
+	memset(&cbw, 0, sizeof(cbw));
+	cbw.dCBWSignature = MSC_CBW_SIGNATURE;
+	cbw.dCBWTag = Tag++;
+	cbw.dCBWDataTransferLength = 96 * PAGE_SIZE;
+	cbw.bmCBWFlags = MSC_CBW_DATA_IN;
+	cbw.bCBWCBLength = 10;
+	cbw.CBWCB[0] = SCSI_READ_10;
+	cbw.CBWCB[8] = 96;
+
+	CHECK(busOut(&cbw, sizeof(cbw)));
+	CHECK(busIn(data, PAGES_PER_BUFFER * PAGE_SIZE) == PAGES_PER_BUFFER * PAGE_SIZE);
+
+	pthread_mutex_lock(&Lock);
+	memset(Wire, 0, sizeof(Wire));
+	CHECK(emu_class_request(MSC_REQUEST_RESET, data) == 0);
+	pthread_mutex_unlock(&Lock);
+
+	CHECK(simple(SCSI_TEST_UNIT_READY) == MSC_CSW_PASSED);
+	CHECK(transfer(SCSI_READ_10, 10, 96, data, NULL) == MSC_CSW_PASSED);
+	CHECK(memcmp(data, Contents + 10 * PAGE_SIZE, 96 * PAGE_SIZE) == 0);
+
+	free(data);
+}
+
+// Exported read-only, writes are refused but their data is still taken off the wire
+static void testReadOnly() {
+	uint8_t* data = malloc(40 * PAGE_SIZE);
+	uint8_t* back = malloc(40 * PAGE_SIZE);
+	uint8_t cb[6] = {SCSI_MODE_SENSE_6, 0, 0, 0, 4};
+	uint8_t reply[4];
+	uint32_t residue;
+
+	plug(FALSE);
+
+	CHECK(command(cb, sizeof(cb), TRUE, reply, sizeof(reply), NULL) == MSC_CSW_PASSED);
+	CHECK((reply[2] & 0x80) != 0);
+
+	memset(data, 0x33, 40 * PAGE_SIZE);
+	CHECK(transfer(SCSI_WRITE_10, 50, 40, data, &residue) == MSC_CSW_FAILED);
+	CHECK(residue == 40 * PAGE_SIZE);
+	expectSense(SENSE_DATA_PROTECT, ASC_WRITE_PROTECTED);
+
+	CHECK(pread(Disk, back, 40 * PAGE_SIZE, 50 * PAGE_SIZE) == 40 * PAGE_SIZE);
+	CHECK(memcmp(back, Contents + 50 * PAGE_SIZE, 40 * PAGE_SIZE) == 0);
+
+	CHECK(transfer(SCSI_READ_10, 50, 40, back, NULL) == MSC_CSW_PASSED);
+	CHECK(memcmp(back, Contents + 50 * PAGE_SIZE, 40 * PAGE_SIZE) == 0);
+
+	free(back);
+	free(data);
+}
+
+int main(int argc, char* argv[]) {
+	char path[] = "/tmp/mscemu-XXXXXX";
+
+	Disk = mkstemp(path);
+	if(Disk < 0) {
+		perror("mscemu");
+		return 1;
+	}
+
+	unlink(path);
+	Contents = malloc(USER_PAGES * PAGE_SIZE);
+	fillDisk();
+
+	plug(TRUE);
+
+	testIdentify();
+	testRead();
+	testWrite();
+	testErrors();
+	testReset();
+	testReadOnly();
+
+	if(Failures > 0) {
+		fprintf(stderr, "mscemu: %d checks failed\n", Failures);
+		return 1;
+	}
+
+	printf("mscemu: ok\n");
+	return 0;
+}
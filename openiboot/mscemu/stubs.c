@@ -0,0 +1,137 @@
+/*
+ * Everything usbmsc.c reaches for outside itself. The USB controller, the task queue and the FTL are passed on to
+ * the host side, which plays the other end of the cable and keeps the disk in a file; the rest only has to link.
+ *
+ * The host side runs the firmware under one big lock, held by whoever is "on the CPU": the msc task, except while it
+ * sleeps in task_wait, or the host while it stands in for an interrupt handler.
+ */
+
+#include "openiboot.h"
+#include "util.h"
+#include "usb.h"
+#include "nand.h"
+#include "ftl.h"
+#include "tasks.h"
+#include "log.h"
+
+// what the host side provides, in plain types
+void host_task_start(TaskRoutineFunction routine, void* opaque);
+int host_task_wait(volatile int* pending, uint32_t timeout);
+void host_task_wake();
+void host_usb_arm(int in, void* buffer, int bufferLen);
+int host_ftl_read(uint32_t page, uint32_t pages, void* buffer);
+int host_ftl_write(uint32_t page, uint32_t pages, const void* buffer);
+int host_ftl_sync();
+
+int LogLevels[LogSubsystemCount];
+
+static NANDData geometry;
+static USBEndpointHandler inHandler;
+static USBEndpointHandler outHandler;
+static uint32_t inToken;
+static uint32_t outToken;
+static USBStartHandler startHandler;
+static USBClassRequestHandler classRequestHandler;
+
+void bufferPrintf(const char* format, ...) {}
+void log_record(int nargs, const char* format, ...) {}
+void setScrollbackListener(ScrollbackListener listener) {}
+
+int task_start(TaskDescriptor* task, const char* name, TaskRoutineFunction routine, void* opaque) {
+	host_task_start(routine, opaque);
+	return 0;
+}
+
+// a wake with nobody waiting is remembered, as it is on the phone
+int task_wait(TaskQueue* queue, uint64_t timeout) {
+	if(queue->pending) {
+		queue->pending = FALSE;
+		return 0;
+	}
+
+	return host_task_wait(&queue->pending, (uint32_t) timeout);
+}
+
+void task_wake(TaskQueue* queue) {
+	queue->pending = TRUE;
+	host_task_wake();
+}
+
+int usb_setup() { return 0; }
+int usb_shutdown() { return 0; }
+USBSpeed usb_get_speed() { return USBHighSpeed; }
+void usb_add_endpoint(USBInterface* interface, int endpoint, USBDirection direction, USBTransferType transferType) {}
+
+int usb_install_ep_handler(int endpoint, USBDirection direction, USBEndpointHandler handler, uint32_t token) {
+	if(direction == USBIn) {
+		inHandler = handler;
+		inToken = token;
+	} else {
+		outHandler = handler;
+		outToken = token;
+	}
+
+	return 0;
+}
+
+void usb_set_function(uint8_t bInterfaceClass, uint8_t bInterfaceSubClass, uint8_t bInterfaceProtocol, USBClassRequestHandler hClassRequest) {
+	classRequestHandler = hClassRequest;
+}
+
+int usb_start(USBEnumerateHandler hEnumerate, USBStartHandler hStart) {
+	startHandler = hStart;
+	return 0;
+}
+
+void usb_send_bulk(uint8_t endpoint, void* buffer, int bufferLen) {
+	host_usb_arm(TRUE, buffer, bufferLen);
+}
+
+void usb_receive_bulk(uint8_t endpoint, void* buffer, int bufferLen) {
+	host_usb_arm(FALSE, buffer, bufferLen);
+}
+
+int ftl_setup() { return 0; }
+
+NANDData* nand_get_geometry() {
+	return &geometry;
+}
+
+int FTL_Read(int logicalPageNumber, int totalPagesToRead, uint8_t* pBuf) {
+	return host_ftl_read(logicalPageNumber, totalPagesToRead, pBuf) ? 0 : -1;
+}
+
+int FTL_Write(int logicalPageNumber, int totalPagesToRead, uint8_t* pBuf) {
+	return host_ftl_write(logicalPageNumber, totalPagesToRead, pBuf) ? 0 : -1;
+}
+
+int ftl_sync() {
+	return host_ftl_sync();
+}
+
+// The entry points the host side drives the firmware with, always under the big lock.
+
+void emu_set_geometry(uint32_t bytesPerPage, uint32_t userPagesTotal) {
+	geometry.bytesPerPage = bytesPerPage;
+	geometry.userPagesTotal = userPagesTotal;
+}
+
+void emu_configure() {
+	startHandler();
+}
+
+int emu_class_request(uint8_t request, uint8_t* buffer) {
+	USBSetupPacket setupPacket;
+
+	memset(&setupPacket, 0, sizeof(setupPacket));
+	setupPacket.bmRequestType = 0x21;
+	setupPacket.bRequest = request;
+	return classRequestHandler(&setupPacket, buffer);
+}
+
+void emu_complete(int in) {
+	if(in)
+		inHandler(inToken);
+	else
+		outHandler(outToken);
+}
@@ -7,6 +7,8 @@
 #include "openiboot-asmhelpers.h"
 #include "dma.h"
 #include "hardware/interrupt.h"
+#include "tasks.h"
+#include "log.h"
 
 int HasNANDInit = FALSE;
 
@@ -59,6 +61,8 @@ static int wait_for_ready(int timeout) {
 		if(has_elapsed(startTime, timeout * 1000)) {
 			return ERROR_TIMEOUT;
 		}
+
+		task_yield();
 	}
 
 	return 0;
@@ -388,7 +392,11 @@ static int transferFromFlash(void* buffer, int size) {
 	CleanCPUDataCache();
 
 	dma_request(DMA_NAND, 4, 4, DMA_MEMORY, 4, 4, &controller, &channel, NULL);
-	dma_perform(DMA_NAND, (uint32_t)buffer, size, 0, &controller, &channel);
+	if(dma_perform(DMA_NAND, (uint32_t)buffer, size, 0, &controller, &channel) != 0) {
+		bufferPrintf("nand: cannot start dma\r\n");
+		dma_cancel(controller, channel);
+		return ERROR_DMA;
+	}
 
 	if(dma_finish(controller, channel, 500) != 0) {
 		bufferPrintf("nand: dma timed out\r\n");
@@ -423,7 +431,11 @@ static int transferToFlash(void* buffer, int size) {
 	CleanCPUDataCache();
 
 	dma_request(DMA_MEMORY, 4, 4, DMA_NAND, 4, 4, &controller, &channel, NULL);
-	dma_perform((uint32_t)buffer, DMA_NAND, size, 0, &controller, &channel);
+	if(dma_perform((uint32_t)buffer, DMA_NAND, size, 0, &controller, &channel) != 0) {
+		bufferPrintf("nand: cannot start dma\r\n");
+		dma_cancel(controller, channel);
+		return ERROR_DMA;
+	}
 
 	if(dma_finish(controller, channel, 500) != 0) {
 		bufferPrintf("nand: dma timed out\r\n");
@@ -863,12 +875,12 @@ int nand_read_multiple(uint16_t* bank, uint32_t* pages, uint8_t* main, SpareData
 int nand_read_alternate_ecc(int bank, int page, uint8_t* buffer) {
 	int ret;
 	if((ret = nand_read(bank, page, buffer, aTemporarySBuf, FALSE, TRUE)) != 0) {
-		DebugPrintf("nand: Raw read failed.\r\n");
+		LogPrintf(LOG_NAND, LOG_DEBUG, "nand: Raw read failed.\r\n");
 		return ret;
 	}
 
 	if(checkECC(ECCType2, buffer, aTemporarySBuf) != 0) {
-		DebugPrintf("nand: Alternate ECC check failed, but raw read succeeded.\r\n");
+		LogPrintf(LOG_NAND, LOG_DEBUG, "nand: Alternate ECC check failed, but raw read succeeded.\r\n");
 		return ERROR_NAND;
 	}
 
@@ -41,6 +41,8 @@
 #include "wmcodec.h"
 #include "wdt.h"
 #include "als.h"
+#include "log.h"
+#include "lz4.h"
 
 int received_file_size;
 
@@ -52,13 +54,21 @@ extern uint8_t _binary_payload_bin_end;
 extern uint8_t _binary_payload_bin_size;
 
 static void processCommand(char* command);
-
-typedef struct CommandQueue {
-	struct CommandQueue* next;
-	char* command;
-} CommandQueue;
-
-CommandQueue* commandQueue = NULL;
+static void commandDone();
+static void decompressStaged();
+static void answerChunk();
+
+// Commands are received straight into a ring of preallocated buffers and run in place by the main loop, so nothing
+// is copied or allocated per command. USB fills the slot at commandHead, the main loop runs the one at commandTail.
+// When every other slot is still waiting to run, the host's next SENDCOMMAND isn't answered until one frees up.
+#define COMMAND_RING_SIZE 8
+#define COMMAND_BUFFER_LEN 512
+
+static uint8_t* commandRing[COMMAND_RING_SIZE];
+static volatile int commandHead = 0;
+static volatile int commandTail = 0;
+static volatile int commandDeferred = FALSE;
+static uint32_t commandDeferredLen = 0;
 
 static void startUSB();
 
@@ -116,20 +126,14 @@ void OpenIBootStart() {
 
 	// Process command queue
 	while(TRUE) {
-		char* command = NULL;
-		CommandQueue* cur;
-		EnterCriticalSection();
-		if(commandQueue != NULL) {
-			cur = commandQueue;
-			command = cur->command;
-			commandQueue = commandQueue->next;
-			free(cur);
-		}
-		LeaveCriticalSection();
-
-		if(command) {
-			processCommand(command);
-			free(command);
+		if(commandTail != commandHead) {
+			processCommand((char*) commandRing[commandTail]);
+			commandDone();
+		} else {
+			decompressStaged();
+			answerChunk();
+			log_drain();
+			task_yield();
 		}
 	}
 	// should not reach here
@@ -149,36 +153,81 @@ static size_t lastRxLen = 0;
 static uint8_t* sendFilePtr = NULL;
 static uint32_t sendFileBytesLeft = 0;
 
+// checked chunk in progress, see OpenIBootChunkCmd
+static OpenIBootChunkCmd chunk;
+static int chunkReceiving = FALSE;
+static uint8_t* chunkSendPtr = NULL;
+static uint32_t chunkSendLeft = 0;
+
+// A CRC over a whole chunk takes too long for the interrupt handlers, so they leave the command to answer to the main
+// loop. chunkSerial goes up with every chunk command, so an answer the host has since given up on isn't sent.
+static volatile uint32_t chunkPending = 0;
+static volatile uint32_t chunkSerial = 0;
+
 static int USB_BYTES_AT_A_TIME = 0;
 
-static void addToCommandQueue(const char* command) {
+// Console push: once the host asks for it, new scrollback goes out on its own bulk endpoint as soon as it's printed
+// instead of waiting for DUMPBUFFER. One push is in flight at a time; if the host stops reading, output just piles
+// up in the scrollback like it always has.
+#define CONSOLE_PUSH_LEN 0x1000
+
+static uint8_t* pushBuffer = NULL;
+static volatile int consolePush = FALSE;
+static volatile int pushInFlight = FALSE;
+static int USB_FILE_BYTES_AT_A_TIME = 0;
+
+// Console and command traffic goes through the small bounce buffers a packet-sized piece at a time, but file data is
+// DMAed straight to or from its final location, so arm transfers as large as the controller allows.
+static size_t nextTxChunk(size_t bytesLeft) {
+	size_t max = (chunkSendLeft > 0 || sendFileBytesLeft > 0) ? USB_FILE_BYTES_AT_A_TIME : USB_BYTES_AT_A_TIME;
+	return (bytesLeft > max) ? max : bytesLeft;
+}
+
+static size_t nextRxChunk(size_t bytesLeft) {
+	size_t max = (chunkReceiving || dataRecvBuffer != commandRecvBuffer) ? USB_FILE_BYTES_AT_A_TIME : USB_BYTES_AT_A_TIME;
+	return (bytesLeft > max) ? max : bytesLeft;
+}
+
+// Compressed sendfile: chunks are received into two bounce buffers in turn and decompressed into place from the main
+// loop while the other one is filling up. If both are full, the next receive isn't armed until one is drained.
+static LZ4Stream decompressStream;
+static int decompressing = FALSE;
+static int decompressStarted = FALSE;
+static int decompressError = FALSE;
+static uint8_t* stagingBuffers[2] = {NULL, NULL};
+static volatile size_t stagingFilled[2] = {0, 0};
+static size_t stagingArmedLength = 0;
+static int stagingArmed = 0;
+static int stagingConsumed = 0;
+static volatile int rxInFlight = FALSE;
+static volatile int rxStalled = FALSE;
+static uint64_t rxStartTime;
+
+static void reportThroughput(uint32_t bytes, uint32_t wireBytes) {
+	uint32_t elapsed = (uint32_t)((timer_get_system_microtime() - rxStartTime) / 1000);
+	if(elapsed == 0)
+		elapsed = 1;
+
+	// bytes per millisecond is close enough to KB/s
+	bufferPrintf("%d ms, %d KB/s effective, %d KB/s on the wire.\r\n", elapsed, bytes / elapsed, wireBytes / elapsed);
+}
+
+static void commandReceived() {
 	EnterCriticalSection();
 
 	if(dataRecvBuffer != commandRecvBuffer) {
 		// in file mode, but we just received the whole thing
 		dataRecvBuffer = commandRecvBuffer;
-		bufferPrintf("file received (%d bytes).\r\n", lastRxLen);
+		bufferPrintf("file received (%d bytes), ", lastRxLen);
+		reportThroughput(lastRxLen, lastRxLen);
 		received_file_size = lastRxLen;
 		LeaveCriticalSection();
 		return;
 	}
 
-	CommandQueue* toAdd = malloc(sizeof(CommandQueue));
-	toAdd->next = NULL;
-	toAdd->command = strdup(command);
-
-	CommandQueue* prev = NULL;
-	CommandQueue* cur = commandQueue;
-	while(cur != NULL) {
-		prev = cur;
-		cur = cur->next;
-	}
-
-	if(prev == NULL) {
-		commandQueue = toAdd;
-	} else {
-		prev->next = toAdd;
-	}
+	// hand the slot to the main loop and receive the next command into the one after it
+	commandHead = (commandHead + 1) % COMMAND_RING_SIZE;
+	dataRecvBuffer = commandRecvBuffer = commandRing[commandHead];
 	LeaveCriticalSection();
 }
 
@@ -199,6 +248,31 @@ static void processCommand(char* command) {
 		}
 	}
 
+	if(strcmp(argv[0], "sendfilez") == 0) {
+		if(argc >= 3) {
+			// enter compressed file mode. The buffers are kept from one file to the next, and the host may have
+			// come back at a faster speed since, so size them for the largest transfer there can be.
+			if(!stagingBuffers[0]) {
+				stagingBuffers[0] = memalign(DMA_ALIGN, usb_largest_bulk_transfer());
+				stagingBuffers[1] = memalign(DMA_ALIGN, usb_largest_bulk_transfer());
+			}
+
+			EnterCriticalSection();
+			if(dataRecvBuffer == commandRecvBuffer) {
+				dataRecvBuffer = (uint8_t*) parseNumber(argv[1]);
+				lz4_stream_init(&decompressStream, dataRecvBuffer, parseNumber(argv[2]));
+				decompressing = TRUE;
+				decompressStarted = FALSE;
+				decompressError = FALSE;
+				stagingArmed = stagingConsumed = 0;
+				stagingFilled[0] = stagingFilled[1] = 0;
+			}
+			LeaveCriticalSection();
+			free(argv);
+			return;
+		}
+	}
+
 	if(strcmp(argv[0], "getfile") == 0) {
 		if(argc >= 3) {
 			// enter file mode
@@ -232,6 +306,224 @@ static void processCommand(char* command) {
 	free(argv);
 }
 
+static void armReceive() {
+	size_t toRead = nextRxChunk(rxLeft);
+
+	rxInFlight = TRUE;
+	if(decompressing && !chunkReceiving) {
+		stagingArmedLength = toRead;
+		usb_receive_bulk(2, stagingBuffers[stagingArmed], toRead);
+	} else {
+		usb_receive_bulk(2, dataRecvPtr, toRead);
+		dataRecvPtr += toRead;
+	}
+
+	rxLeft -= toRead;
+}
+
+static int commandRingFull() {
+	return ((commandHead + 1) % COMMAND_RING_SIZE) == commandTail;
+}
+
+// commands are received into a ring slot and NUL terminated there, so anything that doesn't fit is turned away
+static int commandTooLong(uint32_t dataLen) {
+	return dataRecvBuffer == commandRecvBuffer && dataLen >= COMMAND_BUFFER_LEN;
+}
+
+static void acceptSendCommand(uint32_t dataLen) {
+	OpenIBootCmd* reply = (OpenIBootCmd*)controlSendBuffer;
+
+	if(commandTooLong(dataLen)) {
+		bufferPrintf("usb: rejecting a %d byte command, the limit is %d\r\n", dataLen, COMMAND_BUFFER_LEN - 1);
+		reply->command = OPENIBOOTCMD_SENDCOMMAND_NAK;
+		reply->dataLen = dataLen;
+		usb_send_interrupt(3, controlSendBuffer, sizeof(OpenIBootCmd));
+		return;
+	}
+
+	dataRecvPtr = dataRecvBuffer;
+	rxLeft = dataLen;
+	lastRxLen = rxLeft;
+	rxStartTime = timer_get_system_microtime();
+	if(decompressing)
+		decompressStarted = TRUE;
+
+	//uartPrintf("got sendcommand, receiving length: %d\r\n", (int)rxLeft);
+
+	reply->command = OPENIBOOTCMD_SENDCOMMAND_GOAHEAD;
+	reply->dataLen = dataLen;
+	usb_send_interrupt(3, controlSendBuffer, sizeof(OpenIBootCmd));
+
+	armReceive();
+}
+
+static void commandDone() {
+	EnterCriticalSection();
+	commandTail = (commandTail + 1) % COMMAND_RING_SIZE;
+	if(commandDeferred) {
+		commandDeferred = FALSE;
+		acceptSendCommand(commandDeferredLen);
+	}
+	LeaveCriticalSection();
+}
+
+static void decompressStaged() {
+	while(decompressing && stagingFilled[stagingConsumed] > 0) {
+		int i = stagingConsumed;
+
+		if(!decompressError && lz4_stream_feed(&decompressStream, stagingBuffers[i], stagingFilled[i]) != 0) {
+			bufferPrintf("sendfilez: corrupt stream, discarding the rest of the file.\r\n");
+			decompressError = TRUE;
+		}
+
+		EnterCriticalSection();
+		stagingFilled[i] = 0;
+		stagingConsumed ^= 1;
+		if(rxStalled) {
+			rxStalled = FALSE;
+			armReceive();
+		}
+		LeaveCriticalSection();
+	}
+
+	if(!decompressing || !decompressStarted || rxLeft > 0 || rxInFlight || stagingFilled[stagingConsumed] > 0)
+		return;
+
+	uint32_t length = decompressStream.out - decompressStream.start;
+	if(decompressError || !lz4_stream_done(&decompressStream)) {
+		bufferPrintf("sendfilez: decompression failed after %d bytes.\r\n", length);
+	} else {
+		bufferPrintf("file received (%d bytes from %d compressed), ", length, lastRxLen);
+		reportThroughput(length, lastRxLen);
+		received_file_size = length;
+	}
+
+	EnterCriticalSection();
+	decompressing = FALSE;
+	decompressStarted = FALSE;
+	dataRecvBuffer = commandRecvBuffer;
+	LeaveCriticalSection();
+}
+
+static void pushConsole() {
+	EnterCriticalSection();
+	if(!consolePush || pushInFlight) {
+		LeaveCriticalSection();
+		return;
+	}
+
+	size_t length = getScrollbackLen();
+	if(length > CONSOLE_PUSH_LEN)
+		length = CONSOLE_PUSH_LEN;
+
+	// A transfer that ends on a packet boundary doesn't look finished to the host, so hold the last byte back for
+	// the next push.
+	if(length > 1 && (length % USB_MAX_PACKETSIZE) == 0)
+		--length;
+
+	if(length == 0) {
+		LeaveCriticalSection();
+		return;
+	}
+
+	// set before sending: anything printed on the way in mustn't start a second push
+	pushInFlight = TRUE;
+	bufferFlush((char*) pushBuffer, length);
+	usb_send_bulk(OPENIBOOT_CONSOLE_EP, pushBuffer, length);
+	LeaveCriticalSection();
+}
+
+static void pushSent(uint32_t token) {
+	pushInFlight = FALSE;
+	pushConsole();
+}
+
+static void sendNext() {
+	size_t toRead = nextTxChunk(left);
+	if(chunkSendLeft > 0) {
+		usb_send_bulk(1, chunkSendPtr, toRead);
+		chunkSendPtr += toRead;
+		chunkSendLeft -= toRead;
+	} else if(sendFileBytesLeft > 0) {
+		usb_send_bulk(1, sendFilePtr, toRead);
+		sendFilePtr += toRead;
+		sendFileBytesLeft -= toRead;
+		if(sendFileBytesLeft == 0) {
+			bufferPrintf("file sent.\r\n");
+		}
+	} else {
+		bufferFlush((char*) dataSendBuffer, toRead);
+		usb_send_bulk(1, dataSendBuffer, toRead);
+	}
+	left -= toRead;
+}
+
+static void replyChunk(uint32_t command, uint32_t crc) {
+	OpenIBootChunkCmd* reply = (OpenIBootChunkCmd*)controlSendBuffer;
+
+	reply->command = command;
+	reply->dataLen = chunk.dataLen;
+	reply->address = chunk.address;
+	reply->crc = crc;
+	usb_send_interrupt(3, controlSendBuffer, sizeof(OpenIBootChunkCmd));
+}
+
+static void answerChunk() {
+	OpenIBootChunkCmd answering;
+
+	EnterCriticalSection();
+	uint32_t command = chunkPending;
+	uint32_t serial = chunkSerial;
+	memcpy(&answering, &chunk, sizeof(OpenIBootChunkCmd));
+	chunkPending = 0;
+	LeaveCriticalSection();
+
+	if(command == 0)
+		return;
+
+	uint32_t crc = 0;
+	crc32(&crc, (void*) answering.address, answering.dataLen);
+
+	EnterCriticalSection();
+	if(serial != chunkSerial) {
+		// the host asked about another chunk meanwhile, that one gets answered instead
+		LeaveCriticalSection();
+		return;
+	}
+
+	if(command == OPENIBOOTCMD_GETCHUNK) {
+		replyChunk(OPENIBOOTCMD_GETCHUNK_GOAHEAD, crc);
+		chunkSendPtr = (uint8_t*) chunk.address;
+		chunkSendLeft = chunk.dataLen;
+		left = chunk.dataLen;
+		sendNext();
+	} else if(crc == answering.crc) {
+		replyChunk(OPENIBOOTCMD_CHUNK_ACK, crc);
+	} else {
+		if(command == OPENIBOOTCMD_SENDCHUNK)
+			LogPrintf(LOG_USB, LOG_INFO, "usb: chunk at 0x%x failed its CRC check, asking for it again\r\n", chunk.address);
+		replyChunk(OPENIBOOTCMD_CHUNK_NAK, crc);
+	}
+	LeaveCriticalSection();
+}
+
+// Takes a chunk command from the host. Returns FALSE, having turned it away, if the chunk is longer than the host
+// may ask for in one go.
+static int takeChunk() {
+	memcpy(&chunk, controlRecvBuffer, sizeof(OpenIBootChunkCmd));
+	chunkSerial++;
+	chunkPending = 0;
+
+	if(chunk.dataLen > OPENIBOOT_CHUNK_MAX) {
+		LogPrintf(LOG_USB, LOG_INFO, "usb: chunk of %d bytes at 0x%x is longer than the %d allowed\r\n", chunk.dataLen, chunk.address,
+				OPENIBOOT_CHUNK_MAX);
+		replyChunk(OPENIBOOTCMD_CHUNK_NAK, 0);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
 static void controlReceived(uint32_t token) {
 	OpenIBootCmd* cmd = (OpenIBootCmd*)controlRecvBuffer;
 	OpenIBootCmd* reply = (OpenIBootCmd*)controlSendBuffer;
@@ -254,68 +546,84 @@ static void controlReceived(uint32_t token) {
 
 		//uartPrintf("got dumpbuffer goahead, writing length: %d\r\n", (int)left);
 
-		size_t toRead = (left > USB_BYTES_AT_A_TIME) ? USB_BYTES_AT_A_TIME: left;
-		if(sendFileBytesLeft > 0) {
-			usb_send_bulk(1, sendFilePtr, toRead);
-			sendFilePtr += toRead;
-			sendFileBytesLeft -= toRead;
-			if(sendFileBytesLeft == 0) {
-				bufferPrintf("file sent.\r\n");
-			}
+		sendNext();
+	} else if(cmd->command == OPENIBOOTCMD_SENDCOMMAND) {
+		if(dataRecvBuffer == commandRecvBuffer && commandRingFull() && !commandTooLong(cmd->dataLen)) {
+			// the main loop will answer this once it has run a command
+			commandDeferredLen = cmd->dataLen;
+			commandDeferred = TRUE;
 		} else {
-			bufferFlush((char*) dataSendBuffer, toRead);
-			usb_send_bulk(1, dataSendBuffer, toRead);
+			acceptSendCommand(cmd->dataLen);
 		}
-		left -= toRead;
-	} else if(cmd->command == OPENIBOOTCMD_SENDCOMMAND) {
-		dataRecvPtr = dataRecvBuffer;
-		rxLeft = cmd->dataLen;
-		lastRxLen = rxLeft;
-
-		//uartPrintf("got sendcommand, receiving length: %d\r\n", (int)rxLeft);
-
-		reply->command = OPENIBOOTCMD_SENDCOMMAND_GOAHEAD;
-		reply->dataLen = cmd->dataLen;
+	} else if(cmd->command == OPENIBOOTCMD_SENDCHUNK) {
+		if(!takeChunk()) {
+			// already turned away
+		} else if(dataRecvBuffer != commandRecvBuffer || decompressing || rxLeft > 0) {
+			// a plain file transfer is in progress
+			replyChunk(OPENIBOOTCMD_CHUNK_NAK, 0);
+		} else {
+			chunkReceiving = TRUE;
+			dataRecvPtr = (uint8_t*) chunk.address;
+			rxLeft = chunk.dataLen;
+			replyChunk(OPENIBOOTCMD_SENDCHUNK_GOAHEAD, chunk.crc);
+			armReceive();
+		}
+	} else if(cmd->command == OPENIBOOTCMD_GETCHUNK || cmd->command == OPENIBOOTCMD_VERIFYCHUNK) {
+		// the main loop works out the CRC and answers
+		if(takeChunk())
+			chunkPending = cmd->command;
+	} else if(cmd->command == OPENIBOOTCMD_CONSOLE_PUSH) {
+		consolePush = (cmd->dataLen != 0);
+
+		reply->command = OPENIBOOTCMD_CONSOLE_PUSH;
+		reply->dataLen = consolePush;
 		usb_send_interrupt(3, controlSendBuffer, sizeof(OpenIBootCmd));
 
-		size_t toRead = (rxLeft > USB_BYTES_AT_A_TIME) ? USB_BYTES_AT_A_TIME: rxLeft;
-		usb_receive_bulk(2, dataRecvPtr, toRead);
-		rxLeft -= toRead;
-		dataRecvPtr += toRead;
+		pushConsole();
 	}
 
-	usb_receive_interrupt(4, controlRecvBuffer, sizeof(OpenIBootCmd));
+	usb_receive_interrupt(4, controlRecvBuffer, sizeof(OpenIBootChunkCmd));
 }
 
 static void dataReceived(uint32_t token) {
 	//uartPrintf("receiving remainder: %d\r\n", (int)rxLeft);
+	rxInFlight = FALSE;
+
+	if(chunkReceiving) {
+		if(rxLeft > 0) {
+			armReceive();
+		} else {
+			chunkReceiving = FALSE;
+			chunkPending = OPENIBOOTCMD_SENDCHUNK;
+		}
+		return;
+	}
+
+	if(decompressing) {
+		// hand the chunk over to the main loop and keep going in the other buffer if it's free
+		stagingFilled[stagingArmed] = stagingArmedLength;
+		stagingArmed ^= 1;
+		if(rxLeft > 0) {
+			if(stagingFilled[stagingArmed] == 0)
+				armReceive();
+			else
+				rxStalled = TRUE;
+		}
+		return;
+	}
+
 	if(rxLeft > 0) {
-		size_t toRead = (rxLeft > USB_BYTES_AT_A_TIME) ? USB_BYTES_AT_A_TIME: rxLeft;
-		usb_receive_bulk(2, dataRecvPtr, toRead);
-		rxLeft -= toRead;
-		dataRecvPtr += toRead;
+		armReceive();
 	} else {
 		*dataRecvPtr = '\0';
-		addToCommandQueue((char*)dataRecvBuffer);
+		commandReceived();
 	}
 }
 
 static void dataSent(uint32_t token) {
 	//uartPrintf("sending remainder: %d\r\n", (int)left);
 	if(left > 0) {
-		size_t toRead = (left > USB_BYTES_AT_A_TIME) ? USB_BYTES_AT_A_TIME: left;
-		if(sendFileBytesLeft > 0) {
-			usb_send_bulk(1, sendFilePtr, toRead);
-			sendFilePtr += toRead;
-			sendFileBytesLeft -= toRead;
-			if(sendFileBytesLeft == 0) {
-				bufferPrintf("file sent.\r\n");
-			}
-		} else {
-			bufferFlush((char*) dataSendBuffer, toRead);
-			usb_send_bulk(1, dataSendBuffer, toRead);
-		}
-		left -= toRead;
+		sendNext();
 	}
 }
 
@@ -328,6 +636,7 @@ static void enumerateHandler(USBInterface* interface) {
 	usb_add_endpoint(interface, 2, USBOut, USBBulk);
 	usb_add_endpoint(interface, 3, USBIn, USBInterrupt);
 	usb_add_endpoint(interface, 4, USBOut, USBInterrupt);
+	usb_add_endpoint(interface, OPENIBOOT_CONSOLE_EP, USBIn, USBBulk);
 
 	if(!controlSendBuffer)
 		controlSendBuffer = memalign(DMA_ALIGN, 512);
@@ -338,8 +647,16 @@ static void enumerateHandler(USBInterface* interface) {
 	if(!dataSendBuffer)
 		dataSendBuffer = memalign(DMA_ALIGN, 512);
 
-	if(!dataRecvBuffer)
-		dataRecvBuffer = commandRecvBuffer = memalign(DMA_ALIGN, 512);
+	if(!commandRing[0]) {
+		int i;
+		for(i = 0; i < COMMAND_RING_SIZE; i++)
+			commandRing[i] = memalign(DMA_ALIGN, COMMAND_BUFFER_LEN);
+
+		dataRecvBuffer = commandRecvBuffer = commandRing[commandHead];
+	}
+
+	if(!pushBuffer)
+		pushBuffer = memalign(DMA_ALIGN, CONSOLE_PUSH_LEN);
 }
 
 static void startHandler() {
@@ -349,7 +666,15 @@ static void startHandler() {
 		USB_BYTES_AT_A_TIME = 0x80;
 	}
 
-	usb_receive_interrupt(4, controlRecvBuffer, sizeof(OpenIBootCmd));
+	USB_FILE_BYTES_AT_A_TIME = usb_max_bulk_transfer();
+
+	// a new host has to ask for pushes again
+	consolePush = FALSE;
+	pushInFlight = FALSE;
+	commandDeferred = FALSE;
+	chunkPending = 0;
+
+	usb_receive_interrupt(4, controlRecvBuffer, sizeof(OpenIBootChunkCmd));
 }
 
 static void startUSB()
@@ -359,7 +684,9 @@ static void startUSB()
 	usb_install_ep_handler(2, USBOut, dataReceived, 0);
 	usb_install_ep_handler(3, USBIn, controlSent, 0);
 	usb_install_ep_handler(1, USBIn, dataSent, 0);
+	usb_install_ep_handler(OPENIBOOT_CONSOLE_EP, USBIn, pushSent, 0);
 	usb_start(enumerateHandler, startHandler);
+	setScrollbackListener(pushConsole);
 }
 
 static int setup_devices() {
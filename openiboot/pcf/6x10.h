@@ -1,163 +0,0 @@
-static const unsigned char fontData[] = {
-0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x05, 0x44, 0x40, 
-0x04, 0x54, 0x00, 0x00, 0x00, 0x84, 0xf3, 0x39, 0x04, 0x00, 0x00, 0x95, 
-0x5a, 0xa9, 0x95, 0x5a, 0xa9, 0x95, 0x0a, 0x24, 0xc9, 0x93, 0x24, 0x1e, 
-0x82, 0x20, 0xc0, 0x11, 0x0c, 0x41, 0x47, 0x30, 0x04, 0x01, 0x38, 0x41, 
-0xe0, 0x38, 0x92, 0x23, 0x49, 0x40, 0x10, 0x04, 0x8f, 0x27, 0x38, 0x82, 
-0x00, 0x10, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x1f, 
-0x41, 0x7c, 0x00, 0x00, 0x24, 0xcb, 0xd2, 0x24, 0x82, 0x20, 0x78, 0x40, 
-0x92, 0x18, 0x82, 0x87, 0x20, 0x08, 0x42, 0x10, 0x04, 0x41, 0x1c, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x41, 0x10, 0x04, 0x01, 0x00, 0x00, 
-0x00, 0xf0, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x0f, 0x00, 0x00, 
-0x40, 0x10, 0x04, 0x41, 0xfc, 0x04, 0x41, 0x10, 0x3f, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 
-0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x4f, 0x10, 0x04, 
-0x41, 0xf0, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0xc4, 0x41, 0x10, 0x04, 
-0x41, 0x10, 0x04, 0x41, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 
-0x4f, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x00, 
-0x66, 0x04, 0x06, 0x06, 0x7c, 0x00, 0x00, 0x0c, 0x0c, 0xc4, 0x0c, 0xc0, 
-0x07, 0x00, 0x00, 0x00, 0x7c, 0x8a, 0xa2, 0x28, 0x00, 0x00, 0x40, 0xc8, 
-0x47, 0x7c, 0x42, 0x00, 0x00, 0x00, 0x23, 0x09, 0x87, 0x20, 0x35, 0x00, 
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x00, 0x01, 0x00, 0x80, 
-0xa2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xca, 0xa7, 0x7c, 0x8a, 
-0x02, 0x00, 0x00, 0xe1, 0x14, 0x0e, 0xe5, 0x10, 0x00, 0x00, 0x48, 0x95, 
-0x42, 0x28, 0x55, 0x02, 0x00, 0x80, 0x50, 0x14, 0x42, 0x95, 0x58, 0x00, 
-0x00, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x82, 
-0x40, 0x20, 0x00, 0x00, 0x08, 0x04, 0x82, 0x20, 0x84, 0x00, 0x00, 0x00, 
-0x10, 0x29, 0x9f, 0x12, 0x01, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x11, 0x04, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x02, 0x00, 0x00, 0x00, 
-0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x04, 
-0x00, 0x40, 0x10, 0x42, 0x08, 0x41, 0x00, 0x00, 0x00, 0xa1, 0x44, 0x51, 
-0xa4, 0x10, 0x00, 0x00, 0x10, 0x46, 0x41, 0x10, 0xc4, 0x07, 0x00, 0x80, 
-0x13, 0x41, 0x8c, 0x10, 0x7c, 0x00, 0x00, 0x7c, 0x10, 0xc2, 0x40, 0x91, 
-0x03, 0x00, 0x00, 0xc2, 0x28, 0xc9, 0x87, 0x20, 0x00, 0x00, 0x7c, 0x41, 
-0x33, 0x41, 0x91, 0x03, 0x00, 0x00, 0x23, 0x04, 0xcd, 0x14, 0x39, 0x00, 
-0x00, 0x7c, 0x10, 0x82, 0x10, 0x82, 0x00, 0x00, 0x80, 0x13, 0x45, 0x4e, 
-0x14, 0x39, 0x00, 0x00, 0x38, 0x51, 0x66, 0x41, 0x88, 0x01, 0x00, 0x00, 
-0x40, 0x38, 0x04, 0x40, 0x38, 0x04, 0x00, 0x00, 0x84, 0x43, 0x00, 0x0c, 
-0x21, 0x00, 0x00, 0x84, 0x10, 0x02, 0x81, 0x40, 0x00, 0x00, 0x00, 0xc0, 
-0x07, 0x7c, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x42, 0x08, 0x00, 
-0x00, 0x38, 0x11, 0x42, 0x10, 0x00, 0x01, 0x00, 0x80, 0x13, 0x65, 0x55, 
-0x13, 0x38, 0x00, 0x00, 0x10, 0x4a, 0x14, 0x7d, 0x51, 0x04, 0x00, 0xc0, 
-0x23, 0x49, 0x8e, 0x24, 0x3d, 0x00, 0x00, 0x38, 0x51, 0x10, 0x04, 0x91, 
-0x03, 0x00, 0xc0, 0x23, 0x49, 0x92, 0x24, 0x3d, 0x00, 0x00, 0x7c, 0x41, 
-0xf0, 0x04, 0xc1, 0x07, 0x00, 0xc0, 0x17, 0x04, 0x4f, 0x10, 0x04, 0x00, 
-0x00, 0x38, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00, 0x40, 0x14, 0x45, 0x5f, 
-0x14, 0x45, 0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00, 0x00, 
-0x87, 0x20, 0x08, 0x92, 0x18, 0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 
-0x04, 0x00, 0x40, 0x10, 0x04, 0x41, 0x10, 0x7c, 0x00, 0x00, 0x44, 0xd1, 
-0x56, 0x45, 0x51, 0x04, 0x00, 0x40, 0x14, 0x4d, 0x55, 0x16, 0x45, 0x00, 
-0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00, 0xc0, 0x13, 0x45, 0x4f, 
-0x10, 0x04, 0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0x95, 0x03, 0x01, 0xc0, 
-0x13, 0x45, 0x4f, 0x91, 0x44, 0x00, 0x00, 0x38, 0x51, 0xe0, 0x40, 0x91, 
-0x03, 0x00, 0xc0, 0x47, 0x10, 0x04, 0x41, 0x10, 0x00, 0x00, 0x44, 0x51, 
-0x14, 0x45, 0x91, 0x03, 0x00, 0x40, 0x14, 0x45, 0x8a, 0xa2, 0x10, 0x00, 
-0x00, 0x44, 0x51, 0x54, 0x55, 0x5b, 0x04, 0x00, 0x40, 0x14, 0x29, 0x84, 
-0x12, 0x45, 0x00, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00, 0xc0, 
-0x07, 0x21, 0x84, 0x10, 0x7c, 0x00, 0x00, 0x38, 0x82, 0x20, 0x08, 0x82, 
-0x03, 0x00, 0x40, 0x10, 0x08, 0x04, 0x02, 0x41, 0x00, 0x00, 0x38, 0x08, 
-0x82, 0x20, 0x88, 0x03, 0x00, 0x00, 0xa1, 0x44, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x04, 0x02, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00, 0x40, 
-0x10, 0x34, 0x53, 0x34, 0x35, 0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x91, 
-0x03, 0x00, 0x00, 0x04, 0x59, 0x59, 0x94, 0x59, 0x00, 0x00, 0x00, 0x80, 
-0x13, 0x7d, 0x81, 0x03, 0x00, 0x00, 0x23, 0x09, 0x8f, 0x20, 0x08, 0x00, 
-0x00, 0x00, 0x80, 0x17, 0x45, 0x1e, 0x14, 0x39, 0x40, 0x10, 0x34, 0x53, 
-0x14, 0x45, 0x00, 0x00, 0x10, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00, 0x00, 
-0x04, 0x60, 0x10, 0x04, 0x49, 0x12, 0x03, 0x04, 0x41, 0x94, 0x1c, 0x49, 
-0x04, 0x00, 0x80, 0x41, 0x10, 0x04, 0x41, 0x38, 0x00, 0x00, 0x00, 0xc0, 
-0x52, 0x55, 0x55, 0x04, 0x00, 0x00, 0x00, 0x34, 0x53, 0x14, 0x45, 0x00, 
-0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00, 0x00, 0x00, 0x34, 0x53, 
-0x34, 0x35, 0x41, 0x00, 0x00, 0x80, 0x95, 0x45, 0x99, 0x05, 0x41, 0x00, 
-0x00, 0x34, 0x53, 0x10, 0x04, 0x00, 0x00, 0x00, 0x80, 0x13, 0x38, 0xd0, 
-0x03, 0x00, 0x80, 0x20, 0x3c, 0x82, 0x20, 0x31, 0x00, 0x00, 0x00, 0x40, 
-0x14, 0x45, 0x99, 0x05, 0x00, 0x00, 0x00, 0x44, 0x91, 0xa2, 0x10, 0x00, 
-0x00, 0x00, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00, 0x00, 0x00, 0x44, 0x0a, 
-0xa1, 0x44, 0x00, 0x00, 0x00, 0x40, 0x14, 0x65, 0x16, 0x14, 0x39, 0x00, 
-0x00, 0x7c, 0x08, 0x21, 0x7c, 0x00, 0x00, 0x60, 0x04, 0x62, 0x20, 0x04, 
-0x06, 0x00, 0x00, 0x41, 0x10, 0x04, 0x41, 0x10, 0x00, 0x00, 0x18, 0x08, 
-0x81, 0x11, 0x88, 0x01, 0x00, 0x80, 0x54, 0x25, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 
-0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 
-0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 
-0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 
-0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 
-0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 
-0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 
-0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 
-0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 
-0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 
-0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 
-0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 
-0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 
-0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 
-0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 
-0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 
-0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 
-0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 
-0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 0x00, 0x54, 0x40, 
-0x04, 0x44, 0x40, 0x05, 0x00, 0x40, 0x05, 0x44, 0x40, 0x04, 0x54, 0x00, 
-0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41, 0x10, 0x04, 0x01, 0x00, 0x00, 
-0x40, 0x78, 0x45, 0x51, 0x78, 0x04, 0x00, 0x30, 0x92, 0x70, 0x08, 0x52, 
-0x03, 0x00, 0x00, 0x00, 0x44, 0x8e, 0xe2, 0x44, 0x00, 0x00, 0x44, 0x91, 
-0x42, 0x7c, 0x04, 0x41, 0x00, 0x00, 0x41, 0x10, 0x00, 0x41, 0x10, 0x00, 
-0x00, 0x38, 0xc1, 0x91, 0x48, 0x1c, 0xe4, 0x00, 0x0a, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x38, 0x51, 0x35, 0x55, 0x91, 0x03, 0x00, 0x00, 
-0x27, 0x69, 0x14, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x29, 0x25, 0x12, 
-0x09, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xe0, 0x01, 0x00, 0x00, 0x00, 0x80, 0x13, 0x5d, 0xd3, 0x14, 0x39, 0x00, 
-0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x10, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x11, 0xc4, 0x07, 0x00, 0x8c, 
-0x84, 0x10, 0x1e, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x0c, 0xe4, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
-0x14, 0x45, 0x53, 0x13, 0x00, 0x80, 0x77, 0x5d, 0x16, 0x45, 0x51, 0x00, 
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x08, 0x41, 0x18, 0x04, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x23, 0x49, 0x0c, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x40, 0x22, 0x91, 0x52, 
-0x02, 0x00, 0xc2, 0x20, 0x08, 0x27, 0x8c, 0xf2, 0x20, 0x20, 0x0c, 0x82, 
-0x70, 0xa1, 0x20, 0x84, 0x03, 0x03, 0x21, 0x10, 0x13, 0x46, 0x79, 0x10, 
-0x00, 0x10, 0x00, 0x41, 0x08, 0x91, 0x03, 0x00, 0x02, 0xe1, 0x44, 0xd1, 
-0x17, 0x45, 0x00, 0x80, 0x10, 0x4e, 0x14, 0x7d, 0x51, 0x04, 0x00, 0x84, 
-0xe2, 0x44, 0xd1, 0x17, 0x45, 0x00, 0x20, 0x35, 0x4e, 0x14, 0x7d, 0x51, 
-0x04, 0x00, 0x0a, 0xe0, 0x44, 0xd1, 0x17, 0x45, 0x00, 0x40, 0x28, 0x4e, 
-0x14, 0x7d, 0x51, 0x04, 0x00, 0x00, 0xaf, 0x24, 0xf9, 0x93, 0xe4, 0x00, 
-0x00, 0x38, 0x51, 0x10, 0x04, 0x91, 0x43, 0x08, 0xc2, 0x17, 0x04, 0x4f, 
-0x10, 0x7c, 0x00, 0x80, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00, 0xc4, 
-0x17, 0x04, 0x4f, 0x10, 0x7c, 0x00, 0xa0, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 
-0x07, 0x00, 0x02, 0xe1, 0x10, 0x04, 0x41, 0x38, 0x00, 0x80, 0x10, 0x0e, 
-0x41, 0x10, 0x84, 0x03, 0x00, 0x84, 0xe2, 0x10, 0x04, 0x41, 0x38, 0x00, 
-0xa0, 0x00, 0x0e, 0x41, 0x10, 0x84, 0x03, 0x00, 0xc0, 0x23, 0x49, 0x97, 
-0x24, 0x3d, 0x00, 0x40, 0x29, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00, 0x02, 
-0xe1, 0x44, 0x51, 0x14, 0x39, 0x00, 0x80, 0x10, 0x4e, 0x14, 0x45, 0x91, 
-0x03, 0x00, 0x84, 0xe2, 0x44, 0x51, 0x14, 0x39, 0x00, 0x40, 0x29, 0x4e, 
-0x14, 0x45, 0x91, 0x03, 0x00, 0x0a, 0xe0, 0x44, 0x51, 0x14, 0x39, 0x00, 
-0x00, 0x00, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x00, 0x80, 0x93, 0x65, 0xd5, 
-0x34, 0x39, 0x00, 0x20, 0x10, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00, 0x08, 
-0x11, 0x45, 0x51, 0x14, 0x39, 0x00, 0x40, 0x28, 0x40, 0x14, 0x45, 0x91, 
-0x03, 0x00, 0x0a, 0x10, 0x45, 0x51, 0x14, 0x39, 0x00, 0x80, 0x10, 0x51, 
-0xa4, 0x10, 0x04, 0x01, 0x00, 0x40, 0xf0, 0x44, 0x4f, 0x10, 0x04, 0x00, 
-0x00, 0x38, 0x51, 0x52, 0x24, 0x51, 0x03, 0x00, 0x02, 0x01, 0x38, 0x90, 
-0x17, 0x79, 0x00, 0x80, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00, 0x84, 
-0x02, 0x38, 0x90, 0x17, 0x79, 0x00, 0x40, 0x29, 0x80, 0x03, 0x79, 0x91, 
-0x07, 0x00, 0x80, 0x02, 0x38, 0x90, 0x17, 0x79, 0x00, 0x40, 0x28, 0x84, 
-0x03, 0x79, 0x91, 0x07, 0x00, 0x00, 0x00, 0x78, 0xa8, 0x9f, 0xf8, 0x00, 
-0x00, 0x00, 0x80, 0x13, 0x05, 0x91, 0x43, 0x08, 0x02, 0x01, 0x38, 0xd1, 
-0x17, 0x38, 0x00, 0x80, 0x10, 0x80, 0x13, 0x7d, 0x81, 0x03, 0x00, 0x84, 
-0x02, 0x38, 0xd1, 0x17, 0x38, 0x00, 0x00, 0x28, 0x80, 0x13, 0x7d, 0x81, 
-0x03, 0x00, 0x02, 0x01, 0x18, 0x04, 0x41, 0x38, 0x00, 0x40, 0x08, 0x80, 
-0x41, 0x10, 0x84, 0x03, 0x00, 0x84, 0x02, 0x18, 0x04, 0x41, 0x38, 0x00, 
-0x00, 0x28, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00, 0xc0, 0xc0, 0x38, 0x51, 
-0x14, 0x39, 0x00, 0x40, 0x29, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00, 0x02, 
-0x01, 0x38, 0x51, 0x14, 0x39, 0x00, 0x80, 0x10, 0x80, 0x13, 0x45, 0x91, 
-0x03, 0x00, 0x84, 0x02, 0x38, 0x51, 0x14, 0x39, 0x00, 0x40, 0x29, 0x80, 
-0x13, 0x45, 0x91, 0x03, 0x00, 0x80, 0x02, 0x38, 0x51, 0x14, 0x39, 0x00, 
-0x00, 0x00, 0x04, 0xf0, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x59, 
-0x35, 0x3d, 0x00, 0x20, 0x10, 0x40, 0x14, 0x45, 0x99, 0x05, 0x00, 0x08, 
-0x01, 0x44, 0x51, 0x94, 0x59, 0x00, 0x40, 0x28, 0x40, 0x14, 0x45, 0x99, 
-0x05, 0x00, 0x80, 0x02, 0x44, 0x51, 0x94, 0x59, 0x00, 0x00, 0x20, 0x44, 
-0x14, 0x65, 0x16, 0x14, 0x39, 0x00, 0x10, 0x3c, 0x51, 0x14, 0x3d, 0x41, 
-0x00, 0x28, 0x40, 0x14, 0x65, 0x16, 0x14, 0x39, 
-};
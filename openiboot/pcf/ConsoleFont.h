@@ -0,0 +1,1117 @@
+// generated by pcf from 6x10.oif
+
+static const uint16_t encodingConsole[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 
+	13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 
+	25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 
+	37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 
+	49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 
+	61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 
+	73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 
+	85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 
+	97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 
+	109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 
+	121, 122, 123, 124, 125, 126, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 32, 127, 128, 30, 129, 130, 131, 132, 133, 
+	134, 135, 136, 137, 138, 139, 140, 7, 8, 141, 142, 143, 
+	144, 145, 31, 146, 147, 148, 149, 150, 151, 152, 153, 154, 
+	155, 156, 157, 158, 156, 159, 160, 161, 162, 163, 164, 165, 
+	166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 120, 176, 
+	177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 
+	189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 
+	201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 
+	213, 214, 215, 
+};
+
+static const uint8_t glyphsConsole6x10[] = {
+	0x00, 0x15, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00, 
+	0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 
+	0x00, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x1e, 0x08, 0x08, 0x08, 
+	0x00, 0x07, 0x01, 0x03, 0x01, 0x1d, 0x04, 0x0c, 0x04, 0x04, 
+	0x00, 0x0e, 0x01, 0x01, 0x0e, 0x0e, 0x12, 0x0e, 0x12, 0x12, 
+	0x00, 0x01, 0x01, 0x01, 0x0f, 0x1e, 0x02, 0x0e, 0x02, 0x02, 
+	0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x1f, 0x00, 0x00, 
+	0x00, 0x09, 0x0b, 0x0b, 0x0d, 0x09, 0x02, 0x02, 0x02, 0x1e, 
+	0x00, 0x09, 0x09, 0x06, 0x02, 0x1e, 0x08, 0x08, 0x08, 0x08, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x04, 0x04, 0x04, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00, 0x00, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x04, 0x04, 0x04, 0x04, 
+	0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x04, 0x04, 0x04, 0x04, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x04, 0x04, 0x04, 0x04, 
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+	0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x1f, 0x00, 0x00, 
+	0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x1f, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 
+	0x00, 0x10, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x01, 0x00, 0x00, 
+	0x00, 0x0c, 0x12, 0x02, 0x07, 0x02, 0x12, 0x0d, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, 0x00, 
+	0x00, 0x04, 0x0e, 0x05, 0x0e, 0x14, 0x0e, 0x04, 0x00, 0x00, 
+	0x00, 0x12, 0x15, 0x0a, 0x04, 0x0a, 0x15, 0x09, 0x00, 0x00, 
+	0x00, 0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00, 0x00, 
+	0x00, 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 
+	0x00, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00, 
+	0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x10, 0x0c, 0x02, 0x01, 0x1f, 0x00, 0x00, 
+	0x00, 0x1f, 0x10, 0x08, 0x0c, 0x10, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x08, 0x0c, 0x0a, 0x09, 0x1f, 0x08, 0x08, 0x00, 0x00, 
+	0x00, 0x1f, 0x01, 0x0d, 0x13, 0x10, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0c, 0x02, 0x01, 0x0d, 0x13, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x1f, 0x10, 0x08, 0x08, 0x04, 0x02, 0x02, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x19, 0x16, 0x10, 0x08, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x04, 0x00, 
+	0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x0c, 0x04, 0x02, 0x00, 
+	0x00, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x08, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x19, 0x15, 0x0d, 0x01, 0x0e, 0x00, 0x00, 
+	0x00, 0x04, 0x0a, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x00, 
+	0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x1c, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00, 
+	0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x15, 0x0e, 0x10, 0x00, 
+	0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x11, 0x15, 0x15, 0x1b, 0x11, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00, 
+	0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00, 
+	0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00, 0x00, 
+	0x00, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x13, 0x0d, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x10, 0x10, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, 0x00, 
+	0x00, 0x0c, 0x12, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x11, 0x0e, 
+	0x00, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x18, 0x10, 0x10, 0x10, 0x12, 0x12, 0x0c, 
+	0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x00, 
+	0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x11, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x13, 0x0d, 0x01, 0x01, 
+	0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x10, 0x10, 
+	0x00, 0x00, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00, 
+	0x00, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x12, 0x0c, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 
+	0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00, 
+	0x00, 0x18, 0x04, 0x08, 0x06, 0x08, 0x04, 0x18, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x06, 0x08, 0x04, 0x18, 0x04, 0x08, 0x06, 0x00, 0x00, 
+	0x00, 0x12, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x1e, 0x05, 0x05, 0x05, 0x1e, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x0e, 0x0a, 0x0e, 0x11, 0x00, 0x00, 
+	0x00, 0x11, 0x11, 0x0a, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x00, 
+	0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x0e, 0x01, 0x07, 0x09, 0x12, 0x1c, 0x10, 0x0e, 0x00, 
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x15, 0x13, 0x15, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x1c, 0x12, 0x1a, 0x14, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x24, 0x12, 0x09, 0x12, 0x24, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1e, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x17, 0x13, 0x13, 0x11, 0x0e, 0x00, 0x00, 
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x12, 0x08, 0x04, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0e, 0x10, 0x0c, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d, 0x01, 0x00, 
+	0x00, 0x1e, 0x17, 0x17, 0x16, 0x14, 0x14, 0x14, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 
+	0x04, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x09, 0x12, 0x24, 0x12, 0x09, 0x00, 0x00, 
+	0x02, 0x03, 0x02, 0x02, 0x27, 0x30, 0x28, 0x3c, 0x20, 0x00, 
+	0x02, 0x03, 0x02, 0x02, 0x17, 0x28, 0x20, 0x10, 0x38, 0x00, 
+	0x03, 0x04, 0x02, 0x04, 0x13, 0x18, 0x14, 0x1e, 0x10, 0x00, 
+	0x00, 0x04, 0x00, 0x04, 0x04, 0x02, 0x11, 0x0e, 0x00, 0x00, 
+	0x02, 0x04, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x08, 0x04, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x04, 0x0a, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x12, 0x0d, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00, 
+	0x00, 0x3c, 0x0a, 0x09, 0x39, 0x0f, 0x09, 0x39, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x04, 0x02, 
+	0x02, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x08, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x04, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x0a, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00, 
+	0x02, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x0f, 0x12, 0x12, 0x17, 0x12, 0x12, 0x0f, 0x00, 0x00, 
+	0x14, 0x0a, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00, 
+	0x02, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x14, 0x0a, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0e, 0x19, 0x19, 0x15, 0x13, 0x13, 0x0e, 0x00, 0x00, 
+	0x02, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x01, 0x0f, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00, 
+	0x00, 0x0e, 0x11, 0x09, 0x05, 0x09, 0x11, 0x0d, 0x00, 0x00, 
+	0x02, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x08, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x14, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x04, 0x0a, 0x04, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1e, 0x28, 0x3e, 0x09, 0x3e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x04, 0x02, 
+	0x02, 0x04, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x0e, 0x00, 0x00, 
+	0x02, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x04, 0x02, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x03, 0x0c, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x14, 0x0a, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00, 
+	0x02, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x14, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1e, 0x19, 0x15, 0x13, 0x0f, 0x00, 0x00, 
+	0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00, 
+	0x00, 0x08, 0x04, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 
+	0x00, 0x00, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01, 
+	0x00, 0x0a, 0x00, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 
+};
+
+static const uint8_t glyphsConsole12x20[] = {
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x03, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x03, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0xff, 0x03, 0xff, 0x03, 0xfc, 0x00, 0xfc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x33, 0x03, 0x33, 0x03, 0xcc, 0x0c, 0xcc, 0x0c, 0x33, 0x03, 0x33, 0x03, 
+	0xcc, 0x0c, 0xcc, 0x0c, 0x33, 0x03, 0x33, 0x03, 0xcc, 0x0c, 0xcc, 0x0c, 
+	0x33, 0x03, 0x33, 0x03, 0xcc, 0x0c, 0xcc, 0x0c, 0x33, 0x03, 0x33, 0x03, 
+	0xcc, 0x0c, 0xcc, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 
+	0xff, 0x00, 0xff, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x0f, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x03, 0x00, 0xf3, 0x03, 0xf3, 0x03, 
+	0x30, 0x00, 0x30, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x0c, 0x03, 0x0c, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x03, 0xfc, 0x03, 
+	0x0c, 0x00, 0x0c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xcf, 0x00, 0xcf, 0x00, 
+	0xcf, 0x00, 0xcf, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xfc, 0x03, 0xfc, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x0f, 0xff, 0x0f, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0xff, 0x0f, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xff, 0x0f, 0xff, 0x0f, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x0f, 0xff, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x0f, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0x3c, 0x00, 0x3c, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xc0, 0x03, 0xc0, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x00, 
+	0x00, 0x03, 0x00, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0x0c, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x03, 0x0c, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x33, 0x00, 0x33, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x03, 0x30, 0x03, 
+	0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x0c, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x33, 0x03, 0x33, 0x03, 0xc3, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x33, 0x00, 0x33, 0x00, 
+	0x33, 0x00, 0x33, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x33, 0x03, 0x33, 0x03, 
+	0xc3, 0x00, 0xc3, 0x00, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0xff, 0x03, 0xff, 0x03, 0xcc, 0x00, 0xcc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf0, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
+	0x33, 0x00, 0x33, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x00, 0x03, 0x00, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x03, 0x00, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf0, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x33, 0x03, 0x33, 0x03, 0xf3, 0x00, 0xf3, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xc3, 0x03, 0xc3, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xc3, 0x00, 0xc3, 0x00, 
+	0x33, 0x00, 0x33, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x33, 0x00, 0x33, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xcf, 0x03, 0xcf, 0x03, 0x33, 0x03, 0x33, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0x33, 0x03, 0x33, 0x03, 0xc3, 0x03, 0xc3, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x33, 0x03, 0x33, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xff, 0x00, 0xff, 0x00, 0x33, 0x00, 0x33, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0xcf, 0x03, 0xcf, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x3c, 0x03, 0x3c, 0x03, 0xc3, 0x03, 0xc3, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x00, 0x0c, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xfc, 0x03, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xfc, 0x00, 0xfc, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x03, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x03, 0x00, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 
+	0xf0, 0x00, 0xf0, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xc3, 0x00, 0xc3, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xcf, 0x00, 0xcf, 0x00, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0x33, 0x03, 0x33, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x03, 0x3c, 0x03, 0xc3, 0x03, 0xc3, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x00, 0x03, 0x00, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0xff, 0x00, 0xff, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x03, 0x0c, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xcc, 0x00, 0xcc, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0x33, 0x03, 0x33, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xc3, 0x03, 0xc3, 0x03, 
+	0x3c, 0x03, 0x3c, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xfc, 0x00, 0xfc, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xc0, 0x03, 0xc0, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x0c, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0xc3, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 
+	0x33, 0x00, 0x33, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0xf0, 0x03, 0xf0, 0x03, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x00, 0xfc, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x33, 0x03, 0x33, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0x0c, 0x03, 0x0c, 0x03, 
+	0xcc, 0x03, 0xcc, 0x03, 0x30, 0x03, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x0c, 0x30, 0x0c, 0x0c, 0x03, 0x0c, 0x03, 0xc3, 0x00, 0xc3, 0x00, 
+	0x0c, 0x03, 0x0c, 0x03, 0x30, 0x0c, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x3f, 0x03, 0x3f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x0c, 0x03, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xf0, 0x00, 0xf0, 0x00, 
+	0x00, 0x03, 0x00, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x3f, 0x03, 0x3f, 0x03, 
+	0x3f, 0x03, 0x3f, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x30, 0x03, 0x30, 0x03, 
+	0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x0c, 0x03, 0x30, 0x0c, 0x30, 0x0c, 
+	0x0c, 0x03, 0x0c, 0x03, 0xc3, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x0c, 0x3f, 0x0c, 0x00, 0x0f, 0x00, 0x0f, 
+	0xc0, 0x0c, 0xc0, 0x0c, 0xf0, 0x0f, 0xf0, 0x0f, 0x00, 0x0c, 0x00, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x03, 0x3f, 0x03, 0xc0, 0x0c, 0xc0, 0x0c, 
+	0x00, 0x0c, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x03, 0xc0, 0x0f, 0xc0, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0f, 0x00, 0x0f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0xc0, 0x03, 0xc0, 0x03, 
+	0x30, 0x03, 0x30, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x03, 0x0c, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xcc, 0x00, 0xcc, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x0f, 0xc3, 0x0f, 0xff, 0x00, 0xff, 0x00, 
+	0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x0f, 0xc3, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0xff, 0x03, 0xff, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0x3f, 0x03, 0x3f, 0x03, 0x0c, 0x03, 0x0c, 0x03, 
+	0x0c, 0x03, 0x0c, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x03, 0x30, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0x33, 0x03, 0x33, 0x03, 0xc3, 0x03, 0xc3, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x03, 0x30, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xc3, 0x03, 0xc3, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x33, 0x03, 0x33, 0x03, 0x0f, 0x03, 0x0f, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x00, 0xc3, 0x00, 0x33, 0x00, 0x33, 0x00, 0xc3, 0x00, 0xc3, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xf3, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x03, 0x30, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x00, 0x03, 0x00, 0x03, 0xfc, 0x03, 0xfc, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0xc0, 0x0c, 0xc0, 0x0c, 0xfc, 0x0f, 0xfc, 0x0f, 
+	0xc3, 0x00, 0xc3, 0x00, 0xfc, 0x0f, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0xff, 0x03, 0xff, 0x03, 
+	0x03, 0x00, 0x03, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x03, 0x30, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf3, 0x00, 0xf3, 0x00, 0x0f, 0x03, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x03, 0x30, 0x03, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xfc, 0x03, 0xfc, 0x03, 0xc3, 0x03, 0xc3, 0x03, 0x33, 0x03, 0x33, 0x03, 
+	0x0f, 0x03, 0x0f, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x30, 0x00, 0x30, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xc3, 0x03, 0xc3, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xc3, 0x03, 0xc3, 0x03, 
+	0x3c, 0x03, 0x3c, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xfc, 0x00, 0xfc, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0xff, 0x00, 0xff, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0x03, 0x03, 0x03, 0x03, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 
+	0x03, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xc3, 0x03, 0xc3, 0x03, 
+	0x3c, 0x03, 0x3c, 0x03, 0x00, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 
+	0xfc, 0x00, 0xfc, 0x00, 
+};
+
+static const FramebufferFont fontsConsole[] = {
+	{6, 10, 1, 1, 255, 0, encodingConsole, glyphsConsole6x10},
+	{12, 20, 2, 1, 255, 0, encodingConsole, glyphsConsole12x20},
+};
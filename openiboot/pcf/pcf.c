@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 
 // For simplicity's sake, system endianness is assumed to be little-endian
 
@@ -208,71 +209,83 @@ uint8_t* copyGlyph(PCFBitmaps* bitmaps, PCFMetrics* metrics, uint16_t index) {
 	return glyph;
 }
 
-int main(int argc, char* argv[]) {
-	if(argc < 3) {
-		printf("Usage: %s <input.pcf> <output.oif>\n", argv[0]);
-		return 1;
-	}
-
-	FILE* file = fopen(argv[1], "rb");
-	if(!file) {
-		printf("Cannot open file!\n");
-		return 1;
-	}
-
-	fseek(file, 0, SEEK_END);
-	size_t fileSize = ftell(file);
-	fseek(file, 0, SEEK_SET);
-	uint8_t* data = (uint8_t*) malloc(fileSize);
-	fread(data, 1, fileSize, file);
-	fclose(file);
+typedef struct Font {
+	uint32_t width;
+	uint32_t height;
+	uint8_t* glyphs[0x100];		// a byte per pixel, row by row
+} Font;
 
+int loadPCF(uint8_t* data, Font* font) {
 	PCFHeader* header = (PCFHeader*) data;
-	if(header->sig != 0x70636601) {
-		printf("Not pcf!\n");
-		return 1;
-	}
 
-	PCFEncoding* encoding;
-	PCFBitmaps* bitmaps;
-	PCFMetrics* metrics;
+	PCFEncoding* encoding = NULL;
+	PCFBitmaps* bitmaps = NULL;
+	PCFMetrics* metrics = NULL;
 	int i;
 	for(i = 0; i < header->table_count; i++) {
 		if(header->tables[i].type == PCF_BDF_ENCODINGS) {
-			printf("encoding table at: %d\n", header->tables[i].offset);
+			fprintf(stderr, "encoding table at: %d\n", header->tables[i].offset);
 			encoding = (PCFEncoding*)(data + header->tables[i].offset);
 		}
 		if(header->tables[i].type == PCF_BITMAPS) {
-			printf("bitmaps table at: %d\n", header->tables[i].offset);
+			fprintf(stderr, "bitmaps table at: %d\n", header->tables[i].offset);
 			bitmaps = (PCFBitmaps*)(data + header->tables[i].offset);
 		}
 		if(header->tables[i].type == PCF_METRICS) {
-			printf("metrics table at: %d\n", header->tables[i].offset);
+			fprintf(stderr, "metrics table at: %d\n", header->tables[i].offset);
 			metrics = (PCFMetrics*)(data + header->tables[i].offset);
 		}
 	}
 
-	uint8_t** glyphs = malloc(sizeof(uint8_t*) * 0x100);
+	if(!encoding || !bitmaps || !metrics) {
+		fprintf(stderr, "Missing tables!\n");
+		return 0;
+	}
 
 	for(i = 0; i <= 0xff; i++) {
-		glyphs[i] = copyGlyph(bitmaps, metrics, getGlyph(encoding, i));
+		font->glyphs[i] = copyGlyph(bitmaps, metrics, getGlyph(encoding, i));
 	}
 
-	uint32_t width;
-	uint32_t height;
-	getDimensions(metrics, 0, &width, &height);
+	getDimensions(metrics, 0, &font->width, &font->height);
+	return 1;
+}
+
+// An OIF is the width and height, then a bitstream of every character's pixels from 0x00 to 0xff, row by row
+int loadOIF(uint8_t* data, size_t size, Font* font) {
+	font->width = ((uint32_t*) data)[0];
+	font->height = ((uint32_t*) data)[1];
 
-	FILE* out = fopen(argv[2], "wb");
-	fwrite(&width, 1, 4, out);
-	fwrite(&height, 1, 4, out);
+	uint32_t pixels = font->width * font->height;
+	if(size < 8 + ((pixels * 0x100) + 7) / 8) {
+		fprintf(stderr, "OIF truncated!\n");
+		return 0;
+	}
+
+	int i;
+	for(i = 0; i <= 0xff; i++) {
+		font->glyphs[i] = (uint8_t*) malloc(pixels);
+		uint32_t j;
+		for(j = 0; j < pixels; j++) {
+			uint32_t bitIndex = (pixels * i) + j;
+			font->glyphs[i][j] = (data[8 + (bitIndex / 8)] >> (bitIndex % 8)) & 0x1;
+		}
+	}
+
+	return 1;
+}
+
+void writeOIF(Font* font, FILE* out) {
+	fwrite(&font->width, 1, 4, out);
+	fwrite(&font->height, 1, 4, out);
 
 	uint8_t bitBuffer = 0;
 	int curBit = 0;
 
+	int i;
 	for(i = 0; i <= 0xff; i++) {
 		int j;
-		for(j = 0; j < (width * height); j++) {
-			bitBuffer |= (glyphs[i][j] & 0x1) << curBit;
+		for(j = 0; j < (font->width * font->height); j++) {
+			bitBuffer |= (font->glyphs[i][j] & 0x1) << curBit;
 			curBit++;
 			if(curBit == 8) {
 				fwrite(&bitBuffer, 1, 1, out);
@@ -284,7 +297,168 @@ int main(int argc, char* argv[]) {
 
 	if(curBit != 0)
 		fwrite(&bitBuffer, 1, 1, out);
+}
 
-	fclose(out);
+// Glyphs as the framebuffer draws them: each row in whole bytes, leftmost pixel in bit 0 of the first, every pixel
+// scaled up to a scale x scale block
+uint8_t* packGlyph(Font* font, int ch, int scale) {
+	uint32_t width = font->width * scale;
+	uint32_t height = font->height * scale;
+	uint32_t rowBytes = (width + 7) / 8;
+	uint8_t* packed = (uint8_t*) calloc(rowBytes * height, 1);
+
+	uint32_t x, y;
+	for(y = 0; y < height; y++) {
+		for(x = 0; x < width; x++) {
+			if(font->glyphs[ch][((y / scale) * font->width) + (x / scale)])
+				packed[(y * rowBytes) + (x / 8)] |= 1 << (x % 8);
+		}
+	}
+
+	return packed;
+}
+
+void writeBytes(FILE* out, const uint8_t* data, int length) {
+	int i;
+	for(i = 0; i < length; i++) {
+		if((i % 12) == 0)
+			fprintf(out, "\n\t");
+		fprintf(out, "0x%02x, ", data[i]);
+	}
+}
+
+// One glyph table shared by every size: identical glyphs are stored once, and characters that all fall back to
+// character 0's glyph are left off either end of the encoding table.
+void writeHeader(Font* font, const char* name, const char* source, int* scales, int numScales, FILE* out) {
+	uint16_t encoding[0x100];
+	int unique[0x100];
+	int numGlyphs = 0;
+	uint32_t pixels = font->width * font->height;
+
+	int i, j;
+	for(i = 0; i <= 0xff; i++) {
+		for(j = 0; j < numGlyphs; j++) {
+			if(memcmp(font->glyphs[unique[j]], font->glyphs[i], pixels) == 0)
+				break;
+		}
+
+		if(j == numGlyphs)
+			unique[numGlyphs++] = i;
+
+		encoding[i] = j;
+	}
+
+	int first = 0;
+	while(first < 0xff && encoding[first] == encoding[0])
+		first++;
+
+	int last = 0xff;
+	while(last > first && encoding[last] == encoding[0])
+		last--;
+
+	fprintf(out, "// generated by pcf from %s\n\n", source);
+
+	fprintf(out, "static const uint16_t encoding%s[] = {", name);
+	for(i = first; i <= last; i++) {
+		if(((i - first) % 12) == 0)
+			fprintf(out, "\n\t");
+		fprintf(out, "%d, ", encoding[i]);
+	}
+	fprintf(out, "\n};\n\n");
+
+	int s;
+	for(s = 0; s < numScales; s++) {
+		uint32_t width = font->width * scales[s];
+		uint32_t height = font->height * scales[s];
+		uint32_t glyphBytes = ((width + 7) / 8) * height;
+
+		fprintf(out, "static const uint8_t glyphs%s%dx%d[] = {", name, width, height);
+		for(i = 0; i < numGlyphs; i++) {
+			uint8_t* packed = packGlyph(font, unique[i], scales[s]);
+			writeBytes(out, packed, glyphBytes);
+			free(packed);
+		}
+		fprintf(out, "\n};\n\n");
+	}
+
+	fprintf(out, "static const FramebufferFont fonts%s[] = {\n", name);
+	for(s = 0; s < numScales; s++) {
+		uint32_t width = font->width * scales[s];
+		uint32_t height = font->height * scales[s];
+		fprintf(out, "\t{%d, %d, %d, %d, %d, 0, encoding%s, glyphs%s%dx%d},\n",
+				width, height, (width + 7) / 8, first, (last - first) + 1, name, name, width, height);
+	}
+	fprintf(out, "};\n");
+}
+
+void usage(const char* self) {
+	printf("Usage: %s <input.pcf|input.oif> <output.oif>\n", self);
+	printf("       %s -c <name> [-s scale]... <input.pcf|input.oif> <output.h>\n", self);
+	exit(1);
 }
 
+int main(int argc, char* argv[]) {
+	const char* name = NULL;
+	int scales[8];
+	int numScales = 0;
+
+	int i;
+	for(i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if(strcmp(argv[i], "-c") == 0 && (i + 1) < argc) {
+			name = argv[++i];
+		} else if(strcmp(argv[i], "-s") == 0 && (i + 1) < argc && numScales < 8) {
+			scales[numScales] = atoi(argv[++i]);
+			if(scales[numScales] <= 0)
+				usage(argv[0]);
+			numScales++;
+		} else {
+			usage(argv[0]);
+		}
+	}
+
+	if((argc - i) != 2 || (numScales > 0 && !name))
+		usage(argv[0]);
+
+	const char* input = argv[i];
+	const char* output = argv[i + 1];
+
+	FILE* file = fopen(input, "rb");
+	if(!file) {
+		printf("Cannot open file!\n");
+		return 1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size_t fileSize = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	uint8_t* data = (uint8_t*) malloc(fileSize);
+	fread(data, 1, fileSize, file);
+	fclose(file);
+
+	Font font;
+	if(fileSize >= 4 && ((PCFHeader*) data)->sig == 0x70636601) {
+		if(!loadPCF(data, &font))
+			return 1;
+	} else if(!loadOIF(data, fileSize, &font)) {
+		return 1;
+	}
+
+	FILE* out = fopen(output, "wb");
+	if(!out) {
+		printf("Cannot open output!\n");
+		return 1;
+	}
+
+	if(name) {
+		if(numScales == 0)
+			scales[numScales++] = 1;
+
+		const char* source = strrchr(input, '/');
+		writeHeader(&font, name, source ? source + 1 : input, scales, numScales, out);
+	} else {
+		writeOIF(&font, out);
+	}
+
+	fclose(out);
+	return 0;
+}
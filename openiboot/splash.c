@@ -0,0 +1,120 @@
+#ifndef NO_HFS
+#ifndef NO_STBIMAGE
+#include "openiboot.h"
+#include "splash.h"
+#include "lcd.h"
+#include "framebuffer.h"
+#include "util.h"
+#include "hfs/fs.h"
+#include "stb_image.h"
+
+typedef struct SplashPNG {
+	FSFile* file;
+	int srcX;
+	int srcY;
+	int dstX;
+	int dstY;
+	int width;
+	int height;
+} SplashPNG;
+
+static int splashRead(void* user, stbi_uc* data, int size) {
+	return fs_read(((SplashPNG*) user)->file, data, size);
+}
+
+// Centre the image, or the middle of it if it's bigger than the screen
+static int splashBegin(void* user, int width, int height) {
+	SplashPNG* splash = (SplashPNG*) user;
+	int screenWidth = currentWindow->framebuffer.width;
+	int screenHeight = currentWindow->framebuffer.height;
+
+	if(width > screenWidth) {
+		splash->srcX = (width - screenWidth) / 2;
+		splash->dstX = 0;
+		splash->width = screenWidth;
+	} else {
+		splash->srcX = 0;
+		splash->dstX = (screenWidth - width) / 2;
+		splash->width = width;
+	}
+
+	if(height > screenHeight) {
+		splash->srcY = (height - screenHeight) / 2;
+		splash->dstY = 0;
+		splash->height = screenHeight;
+	} else {
+		splash->srcY = 0;
+		splash->dstY = (screenHeight - height) / 2;
+		splash->height = height;
+	}
+
+	return TRUE;
+}
+
+static void splashRow(void* user, int y, stbi_uc const* rgba, int width) {
+	SplashPNG* splash = (SplashPNG*) user;
+	if(y < splash->srcY || y >= (splash->srcY + splash->height))
+		return;
+
+	framebuffer_draw_image((uint32_t*)(rgba + (splash->srcX * 4)), splash->dstX, splash->dstY + (y - splash->srcY), splash->width, 1);
+}
+
+static const stbi_png_stream_callbacks SplashCallbacks = {
+	splashRead,
+	splashBegin,
+	splashRow
+};
+
+// A raw image is tightly packed, one screen line after another. The window's lines can be padded out past the
+// width, in which case it has to go in a line at a time.
+static int splashReadRaw(FSFile* file, Framebuffer* framebuffer) {
+	uint32_t bytesPerPixel = (framebuffer->colorSpace == RGB888) ? 4 : 2;
+	uint32_t rowBytes = framebuffer->width * bytesPerPixel;
+	uint8_t* line = (uint8_t*) CurFramebuffer;
+	int y;
+
+	if(framebuffer->lineWidth == framebuffer->width)
+		return fs_read(file, line, rowBytes * framebuffer->height) == (rowBytes * framebuffer->height);
+
+	for(y = 0; y < framebuffer->height; y++) {
+		if(fs_read(file, line, rowBytes) != rowBytes)
+			return FALSE;
+
+		line += framebuffer->lineWidth * bytesPerPixel;
+	}
+
+	return TRUE;
+}
+
+int splash_draw(int partition, const char* fileName) {
+	Framebuffer* framebuffer = &currentWindow->framebuffer;
+	uint32_t screenBytes = framebuffer->width * framebuffer->height * ((framebuffer->colorSpace == RGB888) ? 4 : 2);
+	int ret = 0;
+
+	FSFile* file = fs_open(partition, fileName);
+	if(!file) {
+		bufferPrintf("splash: cannot open %s\r\n", fileName);
+		return -1;
+	}
+
+	if(file->size == screenBytes) {
+		framebuffer_invalidate(0, 0, framebuffer->width, framebuffer->height);
+		if(!splashReadRaw(file, framebuffer)) {
+			bufferPrintf("splash: error reading %s\r\n", fileName);
+			ret = -1;
+		}
+	} else {
+		SplashPNG splash;
+		splash.file = file;
+		if(!stbi_png_stream(&SplashCallbacks, &splash)) {
+			bufferPrintf("splash: %s: %s\r\n", fileName, stbi_failure_reason());
+			ret = -1;
+		}
+	}
+
+	fs_close(file);
+	return ret;
+}
+
+#endif
+#endif
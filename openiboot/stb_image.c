@@ -1667,7 +1667,7 @@ static int zbuild_huffman(zhuffman *z, uint8 *sizelist, int num)
 //    we require PNG read all the IDATs and combine them into a single
 //    memory buffer
 
-typedef struct
+typedef struct zbuf
 {
    uint8 *zbuffer, *zbuffer_end;
    int num_bits;
@@ -1679,11 +1679,19 @@ typedef struct
    int   z_expandable;
 
    zhuffman z_length, z_distance;
+
+   // streaming (openiboot): zrefill points zbuffer at more input, zflush
+   // hands finished output on and makes room for n more bytes, keeping
+   // the last 32K in front of zout for back references
+   int (*zrefill)(struct zbuf *z);
+   int (*zflush)(struct zbuf *z, int n);
+   void *zuser;
 } zbuf;
 
 __forceinline static int zget8(zbuf *z)
 {
-   if (z->zbuffer >= z->zbuffer_end) return 0;
+   if (z->zbuffer >= z->zbuffer_end)
+      if (!z->zrefill || !z->zrefill(z)) return 0;
    return *z->zbuffer++;
 }
 
@@ -1737,6 +1745,7 @@ static int expand(zbuf *z, int n)  // need to make room for n bytes
 {
    char *q;
    int cur, limit;
+   if (z->zflush) return z->zflush(z, n);
    if (!z->z_expandable) return e("output buffer limit","Corrupt PNG");
    cur   = (int) (z->zout     - z->zout_start);
    limit = (int) (z->zout_end - z->zout_start);
@@ -1858,6 +1867,25 @@ static int parse_uncompressed_block(zbuf *a)
    len  = header[1] * 256 + header[0];
    nlen = header[3] * 256 + header[2];
    if (nlen != (len ^ 0xffff)) return e("zlib corrupt","Corrupt PNG");
+   if (a->zrefill) {
+      // a stored block can straddle input buffers, and be bigger than
+      // the room a flush makes
+      while (len > 0) {
+         int n;
+         if (a->zbuffer >= a->zbuffer_end)
+            if (!a->zrefill(a)) return e("read past buffer","Corrupt PNG");
+         n = (int) (a->zbuffer_end - a->zbuffer);
+         if (n > len) n = len;
+         if (n > 4096) n = 4096;
+         if (a->zout + n > a->zout_end)
+            if (!expand(a, n)) return 0;
+         memcpy(a->zout, a->zbuffer, n);
+         a->zbuffer += n;
+         a->zout += n;
+         len -= n;
+      }
+      return 1;
+   }
    if (a->zbuffer + len > a->zbuffer_end) return e("read past buffer","Corrupt PNG");
    if (a->zout + len > a->zout_end)
       if (!expand(a, len)) return 0;
@@ -1931,6 +1959,8 @@ static int do_zlib(zbuf *a, char *obuf, int olen, int exp, int parse_header)
    a->zout       = obuf;
    a->zout_end   = obuf + olen;
    a->z_expandable = exp;
+   a->zrefill    = NULL;
+   a->zflush     = NULL;
 
    return parse_zlib(a, parse_header);
 }
@@ -2480,6 +2510,295 @@ extern int      stbi_png_info_from_file   (FILE *f,                  int *x, int
 #endif
 extern int      stbi_png_info_from_memory (stbi_uc const *buffer, int len, int *x, int *y, int *comp);
 
+// streaming PNG reader (openiboot)
+//    reads the file through a callback and hands out one RGBA scanline at
+//    a time, so memory use is the 32K zlib window plus a few rows rather
+//    than the whole image
+//      - non-interlaced only; interlaced images need the full buffer
+
+#define STREAM_IN_SIZE 4096
+
+typedef struct
+{
+   stbi_png_stream_callbacks const *cb;
+   void *user;
+
+   uint8 in[STREAM_IN_SIZE];
+   int in_pos, in_len;
+   uint32 idat_left;
+
+   uint32 img_x, img_y;
+   int img_n;
+   int pal_n;
+   uint8 palette[1024];
+   int has_trans;
+   uint8 tc[3];
+
+   uint32 row_bytes;    // filtered row, filter byte included
+   uint8 *cur, *prior;
+   uint8 *rgba;
+   uint32 y;
+   uint32 consumed;     // bytes at zout_start already turned into rows
+} png_stream;
+
+static int stream_get8(png_stream *p)
+{
+   if (p->in_pos >= p->in_len) {
+      p->in_len = p->cb->read(p->user, p->in, STREAM_IN_SIZE);
+      p->in_pos = 0;
+      if (p->in_len <= 0) {
+         p->in_len = 0;
+         return 0;
+      }
+   }
+   return p->in[p->in_pos++];
+}
+
+static uint32 stream_get32(png_stream *p)
+{
+   uint32 z = stream_get8(p) << 24;
+   z += stream_get8(p) << 16;
+   z += stream_get8(p) << 8;
+   return z + stream_get8(p);
+}
+
+static void stream_skip(png_stream *p, uint32 n)
+{
+   while (n--)
+      stream_get8(p);
+}
+
+// next piece of IDAT data, crossing into the following IDAT chunk if need be
+static int stream_refill(zbuf *z)
+{
+   png_stream *p = (png_stream *) z->zuser;
+   int n;
+   while (p->idat_left == 0) {
+      uint32 length;
+      stream_skip(p, 4); // crc
+      length = stream_get32(p);
+      if (stream_get32(p) != PNG_TYPE('I','D','A','T')) return 0;
+      p->idat_left = length;
+   }
+   if (p->in_pos >= p->in_len) {
+      p->in_len = p->cb->read(p->user, p->in, STREAM_IN_SIZE);
+      p->in_pos = 0;
+      if (p->in_len <= 0) {
+         p->in_len = 0;
+         return 0;
+      }
+   }
+   n = p->in_len - p->in_pos;
+   if ((uint32) n > p->idat_left) n = p->idat_left;
+   z->zbuffer = p->in + p->in_pos;
+   z->zbuffer_end = z->zbuffer + n;
+   p->in_pos += n;
+   p->idat_left -= n;
+   return 1;
+}
+
+static int stream_row(png_stream *p, uint8 *raw)
+{
+   int n = p->img_n;
+   uint32 i, bytes = p->row_bytes - 1;
+   uint8 *cur = p->cur, *prior = p->prior, *out = p->rgba;
+   int filter = *raw++;
+
+   // the row above the first is all zeroes, which is what the first row
+   // filters amount to
+   switch (filter) {
+      case F_none:
+         memcpy(cur, raw, bytes);
+         break;
+      case F_sub:
+         for (i=0; i < bytes; ++i)
+            cur[i] = raw[i] + (i >= (uint32) n ? cur[i-n] : 0);
+         break;
+      case F_up:
+         for (i=0; i < bytes; ++i)
+            cur[i] = raw[i] + prior[i];
+         break;
+      case F_avg:
+         for (i=0; i < bytes; ++i)
+            cur[i] = raw[i] + (((i >= (uint32) n ? cur[i-n] : 0) + prior[i]) >> 1);
+         break;
+      case F_paeth:
+         for (i=0; i < bytes; ++i)
+            cur[i] = (uint8) (raw[i] + (i >= (uint32) n ? paeth(cur[i-n],prior[i],prior[i-n]) : paeth(0,prior[i],0)));
+         break;
+      default:
+         return e("invalid filter","Corrupt PNG");
+   }
+
+   for (i=0; i < p->img_x; ++i, out += 4) {
+      uint8 *c = cur + i*n;
+      if (p->pal_n) {
+         uint8 *pal = p->palette + c[0]*4;
+         out[0] = pal[0]; out[1] = pal[1]; out[2] = pal[2]; out[3] = pal[3];
+      } else if (n <= 2) {
+         out[0] = out[1] = out[2] = c[0];
+         out[3] = n == 2 ? c[1] : (p->has_trans && c[0] == p->tc[0] ? 0 : 255);
+      } else {
+         out[0] = c[0]; out[1] = c[1]; out[2] = c[2];
+         out[3] = n == 4 ? c[3] : (p->has_trans && c[0] == p->tc[0] && c[1] == p->tc[1] && c[2] == p->tc[2] ? 0 : 255);
+      }
+   }
+
+   p->cb->row(p->user, p->y++, p->rgba, p->img_x);
+
+   out = p->prior;
+   p->prior = p->cur;
+   p->cur = out;
+   return 1;
+}
+
+// hand out every whole row decoded so far, then slide the window down
+static int stream_flush(zbuf *z, int n)
+{
+   png_stream *p = (png_stream *) z->zuser;
+   uint32 total, discard;
+
+   while ((uint32) (z->zout - z->zout_start) - p->consumed >= p->row_bytes && p->y < p->img_y) {
+      if (!stream_row(p, (uint8 *) z->zout_start + p->consumed)) return 0;
+      p->consumed += p->row_bytes;
+   }
+
+   total = (uint32) (z->zout - z->zout_start);
+   discard = total > 32768 ? total - 32768 : 0;
+   if (discard > p->consumed) discard = p->consumed;
+   if (discard) {
+      memmove(z->zout_start, z->zout_start + discard, total - discard);
+      z->zout -= discard;
+      p->consumed -= discard;
+   }
+
+   if (z->zout + n > z->zout_end) return e("output buffer limit","Corrupt PNG");
+   return 1;
+}
+
+int stbi_png_stream(stbi_png_stream_callbacks const *cb, void *user)
+{
+   static const uint8 png_sig[8] = { 137,80,78,71,13,10,26,10 };
+   png_stream *p;
+   zbuf *a;
+   char *window = NULL;
+   uint32 i, window_size, pal_len = 0;
+   int first = 1, ret = 0;
+
+   p = (png_stream *) malloc(sizeof(png_stream));
+   a = (zbuf *) malloc(sizeof(zbuf));
+   if (!p || !a) {
+      free(p);
+      free(a);
+      return e("outofmem", "Out of memory");
+   }
+   memset(p, 0, sizeof(png_stream));
+   p->cb = cb;
+   p->user = user;
+
+   for (i=0; i < 8; ++i)
+      if (stream_get8(p) != png_sig[i]) { e("bad png sig","Not a PNG"); goto done; }
+
+   for (;; first = 0) {
+      uint32 length = stream_get32(p);
+      uint32 type = stream_get32(p);
+      if (first && type != PNG_TYPE('I','H','D','R')) { e("first not IHDR","Corrupt PNG"); goto done; }
+      if (p->in_len == 0) { e("outofdata","Corrupt PNG"); goto done; }
+
+      if (type == PNG_TYPE('I','H','D','R')) {
+         int color;
+         if (length != 13) { e("bad IHDR len","Corrupt PNG"); goto done; }
+         p->img_x = stream_get32(p);
+         p->img_y = stream_get32(p);
+         if (!p->img_x || !p->img_y || p->img_x > (1 << 24) || p->img_y > (1 << 24)) { e("too large","Very large image (corrupt?)"); goto done; }
+         if (stream_get8(p) != 8) { e("8bit only","PNG not supported: 8-bit only"); goto done; }
+         color = stream_get8(p);
+         if (color > 6 || (color != 3 && (color & 1))) { e("bad ctype","Corrupt PNG"); goto done; }
+         if (stream_get8(p)) { e("bad comp method","Corrupt PNG"); goto done; }
+         if (stream_get8(p)) { e("bad filter method","Corrupt PNG"); goto done; }
+         if (stream_get8(p)) { e("interlaced","PNG not supported: interlaced"); goto done; }
+         if (color == 3) {
+            p->img_n = 1;
+            p->pal_n = 3;
+         } else {
+            p->img_n = (color & 2 ? 3 : 1) + (color & 4 ? 1 : 0);
+         }
+      } else if (type == PNG_TYPE('P','L','T','E')) {
+         if (length > 256*3 || (length % 3) != 0) { e("invalid PLTE","Corrupt PNG"); goto done; }
+         pal_len = length / 3;
+         for (i=0; i < pal_len; ++i) {
+            p->palette[i*4+0] = stream_get8(p);
+            p->palette[i*4+1] = stream_get8(p);
+            p->palette[i*4+2] = stream_get8(p);
+            p->palette[i*4+3] = 255;
+         }
+      } else if (type == PNG_TYPE('t','R','N','S')) {
+         if (p->pal_n) {
+            if (pal_len == 0 || length > pal_len) { e("bad tRNS len","Corrupt PNG"); goto done; }
+            for (i=0; i < length; ++i)
+               p->palette[i*4+3] = stream_get8(p);
+         } else {
+            if (!(p->img_n & 1) || length != (uint32) p->img_n*2) { e("bad tRNS len","Corrupt PNG"); goto done; }
+            p->has_trans = 1;
+            for (i=0; i < (uint32) p->img_n; ++i) {
+               stream_get8(p);
+               p->tc[i] = stream_get8(p);
+            }
+         }
+      } else if (type == PNG_TYPE('I','D','A','T')) {
+         if (p->pal_n && !pal_len) { e("no PLTE","Corrupt PNG"); goto done; }
+         p->idat_left = length;
+         break;
+      } else if (type == PNG_TYPE('I','E','N','D')) {
+         e("no IDAT","Corrupt PNG");
+         goto done;
+      } else {
+         if (type & (1 << 29)) {
+            // not critical, skip it
+            stream_skip(p, length);
+         } else {
+            e("unknown critical chunk","PNG not supported: unknown chunk type");
+            goto done;
+         }
+      }
+      stream_skip(p, 4); // crc
+   }
+
+   if (!cb->begin(user, p->img_x, p->img_y)) { e("rejected","Image rejected"); goto done; }
+
+   p->row_bytes = p->img_x * p->img_n + 1;
+   p->cur = (uint8 *) malloc(p->row_bytes);
+   p->prior = (uint8 *) malloc(p->row_bytes);
+   p->rgba = (uint8 *) malloc(p->img_x * 4);
+   window_size = 32768 + p->row_bytes + 8192;
+   window = (char *) malloc(window_size);
+   if (!p->cur || !p->prior || !p->rgba || !window) { e("outofmem", "Out of memory"); goto done; }
+   memset(p->prior, 0, p->row_bytes);
+
+   a->zbuffer = a->zbuffer_end = NULL;
+   a->zout_start = a->zout = window;
+   a->zout_end = window + window_size;
+   a->z_expandable = 0;
+   a->zrefill = stream_refill;
+   a->zflush = stream_flush;
+   a->zuser = p;
+
+   if (!parse_zlib(a, 1)) goto done;
+   if (!stream_flush(a, 0)) goto done;
+   if (p->y != p->img_y) { e("not enough pixels","Corrupt PNG"); goto done; }
+
+   ret = 1;
+
+done:
+   free(window);
+   free(p->rgba);
+   free(p->prior);
+   free(p->cur);
+   free(p);
+   free(a);
+   return ret;
+}
+
 // Microsoft/Windows BMP image
 
 static int bmp_test(stbi *s)
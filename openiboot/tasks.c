@@ -1,4 +1,7 @@
+#include "openiboot.h"
+#include "openiboot-asmhelpers.h"
 #include "tasks.h"
+#include "event.h"
 #include "util.h"
 
 const TaskDescriptor bootstrapTaskInit = {
@@ -8,7 +11,7 @@ const TaskDescriptor bootstrapTaskInit = {
 	TASK_RUNNING,
 	1,
 	{0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-	{{0, 0}, 0, 0, 0, 0},
+	{0, 0, 0, 0, 0, 0},
 	{0, 0},
 	0,
 	0,
@@ -21,9 +24,255 @@ const TaskDescriptor bootstrapTaskInit = {
 
 TaskDescriptor bootstrapTask;
 
+// Scheduling is cooperative: a task runs until it yields, sleeps, waits or exits. Tasks that are
+// ready to run sit on the run queue, chained through runqueueList.next. Interrupt handlers only
+// ever make tasks ready; the switch itself happens the next time the running task gives up the CPU.
+static TaskDescriptor* RunQueueHead = NULL;
+static TaskDescriptor* RunQueueTail = NULL;
+
+// A task can't free the stack it is running on, so the next task to run does it instead
+static TaskDescriptor* ExitedTask = NULL;
+
 int tasks_setup() {
 	memcpy(&bootstrapTask, &bootstrapTaskInit, sizeof(TaskDescriptor));
 	CurrentRunning = &bootstrapTask;
 	return 0;
 }
 
+static void runqueue_add(TaskDescriptor* task) {
+	task->state = TASK_READY;
+	task->runqueueList.next = NULL;
+
+	if(RunQueueTail == NULL) {
+		RunQueueHead = task;
+	} else {
+		RunQueueTail->runqueueList.next = task;
+	}
+
+	RunQueueTail = task;
+}
+
+static TaskDescriptor* runqueue_pop() {
+	TaskDescriptor* task = RunQueueHead;
+	if(task == NULL)
+		return NULL;
+
+	RunQueueHead = task->runqueueList.next;
+	if(RunQueueHead == NULL)
+		RunQueueTail = NULL;
+
+	task->runqueueList.next = NULL;
+	return task;
+}
+
+static void reap_exited() {
+	if(ExitedTask == NULL)
+		return;
+
+	free(ExitedTask->storage);
+	ExitedTask->storage = NULL;
+	ExitedTask = NULL;
+}
+
+// Must be called with a critical section held. The outgoing task has already been put wherever it
+// needs to be (run queue, wait queue, or nowhere).
+static void task_switch() {
+	TaskDescriptor* prev = CurrentRunning;
+	TaskDescriptor* next;
+
+	while((next = runqueue_pop()) == NULL) {
+		// Everyone is blocked, so idle until an interrupt makes something ready
+		EnableCPUIRQ();
+		EnableCPUFIQ();
+		WaitForInterrupt();
+		DisableCPUIRQ();
+		DisableCPUFIQ();
+	}
+
+	next->state = TASK_RUNNING;
+
+	if(next == prev)
+		return;
+
+	CurrentRunning = next;
+	SwapTask(&prev->savedRegisters, &next->savedRegisters);
+
+	// Back in prev, with its own critical section nest count
+	reap_exited();
+}
+
+static void task_bootstrap() {
+	// Pairs with the critical section the task that switched to us was holding
+	reap_exited();
+	LeaveCriticalSection();
+
+	CurrentRunning->taskRoutine(CurrentRunning->unknown_passed_value);
+	task_exit();
+}
+
+int task_start(TaskDescriptor* task, const char* name, TaskRoutineFunction routine, void* opaque) {
+	memset(task, 0, sizeof(TaskDescriptor));
+	task->identifier1 = TaskDescriptorIdentifier1;
+	task->identifier2 = TaskDescriptorIdentifier2;
+
+	task->storage = malloc(TASK_STACK_SIZE);
+	if(!task->storage)
+		return -1;
+
+	task->storageSize = TASK_STACK_SIZE;
+	task->taskRoutine = routine;
+	task->unknown_passed_value = opaque;
+
+	int i;
+	for(i = 0; i < ((int)sizeof(task->taskName) - 1) && name[i] != '\0'; i++)
+		task->taskName[i] = name[i];
+	task->taskName[i] = '\0';
+
+	// It starts out inside the critical section task_switch holds, like every other task it can be switched to
+	task->criticalSectionNestCount = 1;
+	task->savedRegisters.sp = ((uint32_t)task->storage + TASK_STACK_SIZE) & ~0x7;
+	task->savedRegisters.lr = (uint32_t)task_bootstrap;
+
+	EnterCriticalSection();
+	runqueue_add(task);
+	LeaveCriticalSection();
+
+	return 0;
+}
+
+void task_exit() {
+	EnterCriticalSection();
+	CurrentRunning->state = TASK_STOPPED;
+	ExitedTask = CurrentRunning;
+	task_switch();
+
+	// not reached
+	LeaveCriticalSection();
+}
+
+int task_can_block() {
+	// Not from interrupt handlers or critical sections, and not before timed events work
+	return CurrentRunning->criticalSectionNestCount == 0 && EventHasInit;
+}
+
+void task_yield() {
+	if(CurrentRunning->criticalSectionNestCount != 0)
+		return;
+
+	EnterCriticalSection();
+	if(RunQueueHead != NULL) {
+		runqueue_add(CurrentRunning);
+		task_switch();
+	}
+	LeaveCriticalSection();
+}
+
+static void queue_remove(TaskQueue* queue, TaskDescriptor* task) {
+	TaskDescriptor* prev = NULL;
+	TaskDescriptor* cur = queue->head;
+
+	while(cur != NULL && cur != task) {
+		prev = cur;
+		cur = cur->linked_list_3.next;
+	}
+
+	if(cur == NULL)
+		return;
+
+	if(prev == NULL)
+		queue->head = cur->linked_list_3.next;
+	else
+		prev->linked_list_3.next = cur->linked_list_3.next;
+
+	if(queue->tail == cur)
+		queue->tail = prev;
+
+	cur->linked_list_3.next = NULL;
+	cur->linked_list_3.prev = NULL;
+}
+
+static void task_timeout(Event* event, void* opaque) {
+	TaskDescriptor* task = opaque;
+
+	if(task->state != TASK_SLEEPING)
+		return;
+
+	// Timed out while waiting on a queue
+	if(task->linked_list_3.prev != NULL)
+		queue_remove(task->linked_list_3.prev, task);
+
+	task->exitState = -1;
+	runqueue_add(task);
+}
+
+int task_sleep(uint64_t timeout) {
+	if(!task_can_block())
+		return -1;
+
+	EnterCriticalSection();
+	CurrentRunning->state = TASK_SLEEPING;
+	event_add(&CurrentRunning->sleepEvent, timeout, task_timeout, CurrentRunning);
+	task_switch();
+	LeaveCriticalSection();
+
+	return 0;
+}
+
+int task_wait(TaskQueue* queue, uint64_t timeout) {
+	if(!task_can_block())
+		return -1;
+
+	EnterCriticalSection();
+	if(queue->pending) {
+		queue->pending = FALSE;
+		LeaveCriticalSection();
+		return 0;
+	}
+
+	TaskDescriptor* task = CurrentRunning;
+
+	task->state = TASK_SLEEPING;
+	task->exitState = 0;
+	task->linked_list_3.next = NULL;
+	task->linked_list_3.prev = queue;
+
+	if(queue->tail == NULL)
+		queue->head = task;
+	else
+		queue->tail->linked_list_3.next = task;
+
+	queue->tail = task;
+
+	if(timeout != 0)
+		event_add(&task->sleepEvent, timeout, task_timeout, task);
+
+	task_switch();
+
+	int ret = task->exitState;
+	LeaveCriticalSection();
+
+	return ret;
+}
+
+void task_wake(TaskQueue* queue) {
+	EnterCriticalSection();
+
+	TaskDescriptor* task = queue->head;
+	queue->head = NULL;
+	queue->tail = NULL;
+	queue->pending = (task == NULL);
+
+	while(task != NULL) {
+		TaskDescriptor* next = task->linked_list_3.next;
+
+		task->linked_list_3.next = NULL;
+		task->linked_list_3.prev = NULL;
+
+		event_remove(&task->sleepEvent);
+		runqueue_add(task);
+
+		task = next;
+	}
+
+	LeaveCriticalSection();
+}
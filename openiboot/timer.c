@@ -2,6 +2,7 @@
 #include "timer.h"
 #include "clock.h"
 #include "interrupt.h"
+#include "tasks.h"
 #include "hardware/timer.h"
 
 const TimerRegisters HWTimers[] = {
@@ -245,6 +246,11 @@ void udelay(uint64_t delay) {
 		return;
 	}
 
+	// Long delays let other tasks run, short ones aren't worth a context switch
+	if(delay >= TASK_SLEEP_THRESHOLD && task_sleep(delay) == 0) {
+		return;
+	}
+
 	uint64_t startTime = timer_get_system_microtime();
 
 	// loop while elapsed time is less than requested delay
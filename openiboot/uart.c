@@ -3,6 +3,7 @@
 #include "clock.h"
 #include "hardware/uart.h"
 #include "timer.h"
+#include "tasks.h"
 
 const UARTRegisters HWUarts[] = {
 	{UART + UART0 + UART_ULCON, UART + UART0 + UART_UCON, UART + UART0 + UART_UFCON, 0,
@@ -269,6 +270,8 @@ int uart_read(int ureg, char *buffer, uint32_t length, uint64_t timeout) {
 			if((timer_get_system_microtime() - startTime) >= timeout) {
 				break;
 			}
+
+			task_yield();
 		}
 	}
 
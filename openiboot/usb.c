@@ -4,10 +4,12 @@
 #include "util.h"
 #include "hardware/power.h"
 #include "hardware/usb.h"
+#include "hardware/arm.h"
 #include "timer.h"
 #include "clock.h"
 #include "interrupt.h"
 #include "openiboot-asmhelpers.h"
+#include "log.h"
 
 static void change_state(USBState new_state);
 
@@ -26,14 +28,73 @@ USBEPRegisters* OutEPRegs;
 
 static uint8_t currentlySending;
 
-static USBDeviceDescriptor deviceDescriptor;
-static USBDeviceQualifierDescriptor deviceQualifierDescriptor;
-
-static uint8_t numStringDescriptors;
-static USBStringDescriptor** stringDescriptors;
-static USBFirstStringDescriptor* firstStringDescriptor;
-
-static USBConfiguration* configurations;
+enum {
+	USBStringLanguages = 0,
+	USBStringManufacturer,
+	USBStringProduct,
+	USBStringSerialNumber,
+	USBStringConfiguration,
+	USBStringInterface,
+	USBNumStrings
+};
+
+static const char* const stringTable[USBNumStrings] = {
+	NULL,
+	"Apple Inc.",
+	"Apple Mobile Device (OpenIBoot Mode)",
+	"",
+	"OpenIBoot Mode Configuration",
+	"IF0"
+};
+
+static const USBDeviceDescriptor deviceDescriptor = {
+	sizeof(USBDeviceDescriptor), USBDeviceDescriptorType, USB_2_0,
+	0, 0, 0, USB_MAX_PACKETSIZE,
+	0x525, PRODUCT_IPHONE, DEVICE_IPHONE,
+	USBStringManufacturer, USBStringProduct, USBStringSerialNumber,
+	1
+};
+
+static const USBDeviceQualifierDescriptor deviceQualifierDescriptor = {
+	sizeof(USBDeviceQualifierDescriptor), USBDeviceQualifierDescriptorType, USB_2_0,
+	0, 0, 0, USB_MAX_PACKETSIZE,
+	1, 0
+};
+
+static const USBConfigurationDescriptor configurationDescriptor = {
+	sizeof(USBConfigurationDescriptor), USBConfigurationDescriptorType, 0,
+	1, 1, USBStringConfiguration,
+	0x80,		// bus powered, no remote wakeup
+	500 / 2		// 500mA
+};
+
+static const uint8_t languageDescriptor[] = {
+	4, USBStringDescriptorType, USB_LANGID_ENGLISH_US & 0xFF, USB_LANGID_ENGLISH_US >> 8
+};
+
+// The strings never change, so they're converted to UTF-16 the first time and kept across usb_shutdown.
+#define STRING_POOL_LEN 0x100
+static uint8_t stringPool[STRING_POOL_LEN];
+static const USBStringDescriptor* stringDescriptors[USBNumStrings];
+
+// What GET_DESCRIPTOR returns for the configuration, laid out once per speed by usb_start. They stay valid until the
+// enumerate handler or the function changes, so re-enumerating the same interface costs nothing.
+#define CONFIGURATION_TREE_LEN (sizeof(USBConfigurationDescriptor) + sizeof(USBInterfaceDescriptor) \
+	+ (USB_MAX_INTERFACE_ENDPOINTS * sizeof(USBEndpointDescriptor)))
+
+enum {
+	TreeHighSpeed = 0,
+	TreeFullSpeed,
+	NumTrees
+};
+
+static USBInterface usbInterface;
+static uint8_t configurationTrees[NumTrees][CONFIGURATION_TREE_LEN];
+static uint16_t configurationTreeLen = 0;
+static USBEnumerateHandler treeHandler = NULL;
+static uint8_t treeClass;
+static uint8_t treeSubClass;
+static uint8_t treeProtocol;
 
 static uint8_t* controlSendBuffer = NULL;
 static uint8_t* controlRecvBuffer = NULL;
@@ -42,23 +103,18 @@ static RingBuffer* txQueue = NULL;
 
 static USBEnumerateHandler enumerateHandler;
 static USBStartHandler startHandler;
+static USBClassRequestHandler classRequestHandler = NULL;
+
+static uint8_t interfaceClass = OPENIBOOT_INTERFACE_CLASS;
+static uint8_t interfaceSubClass = OPENIBOOT_INTERFACE_SUBCLASS;
+static uint8_t interfaceProtocol = OPENIBOOT_INTERFACE_PROTOCOL;
 
 static void usbIRQHandler(uint32_t token);
 
 static void initializeDescriptors();
+static void buildStringDescriptors();
+static void buildConfigurationTrees();
 
-static uint8_t addConfiguration(uint8_t bConfigurationValue, uint8_t iConfiguration, uint8_t selfPowered, uint8_t remoteWakeup, uint16_t maxPower);
-
-static void endConfiguration(USBConfiguration* configuration);
-
-static USBInterface* addInterfaceDescriptor(USBConfiguration* configuration, uint8_t interface, uint8_t bAlternateSetting, uint8_t bInterfaceClass, uint8_t bInterfaceSubClass, uint8_t bInterfaceProtocol, uint8_t iInterface);
-
-static uint8_t addEndpointDescriptor(USBInterface* interface, uint8_t endpoint, USBDirection direction, USBTransferType transferType, USBSynchronisationType syncType, USBUsageType usageType, uint16_t wMaxPacketSize, uint8_t bInterval);
-
-static void releaseConfigurations();
-
-static uint8_t addStringDescriptor(const char* descriptorString);
-static void releaseStringDescriptors();
 static uint16_t packetsizeFromSpeed(uint8_t speed_id);
 
 static void sendControl(void* buffer, int bufferLen);
@@ -69,7 +125,7 @@ static void receive(int endpoint, USBTransferType transferType, void* buffer, in
 static int resetUSB();
 static void getEndpointInterruptStatuses();
 static void callEndpointHandlers();
-static uint32_t getConfigurationTree(int i, uint8_t speed_id, void* buffer);
+static uint32_t getConfigurationTree(int i, uint8_t speed_id, uint8_t descriptorType, void* buffer);
 static void setConfiguration(int i);
 
 static void handleTxInterrupts(int endpoint);
@@ -184,13 +240,25 @@ int usb_setup() {
 	return 0;
 }
 
+void usb_set_function(uint8_t bInterfaceClass, uint8_t bInterfaceSubClass, uint8_t bInterfaceProtocol, USBClassRequestHandler hClassRequest) {
+	interfaceClass = bInterfaceClass;
+	interfaceSubClass = bInterfaceSubClass;
+	interfaceProtocol = bInterfaceProtocol;
+	classRequestHandler = hClassRequest;
+}
+
 int usb_start(USBEnumerateHandler hEnumerate, USBStartHandler hStart) {
 	enumerateHandler = hEnumerate;
 	startHandler = hStart;
 	currentlySending = 0xFF;
 
-	if(txQueue == NULL)
+	if(txQueue == NULL) {
 		txQueue = createRingBuffer(TX_QUEUE_LEN);
+	} else {
+		// anything queued belongs to whoever had the controller before
+		txQueue->count = 0;
+		txQueue->readPtr = txQueue->writePtr = txQueue->bufferStart;
+	}
 
 	initializeDescriptors();
 
@@ -241,8 +309,17 @@ int usb_start(USBEnumerateHandler hEnumerate, USBStartHandler hStart) {
 	return 0;
 }
 
+// Only the lines the transfer touches have to be written back and dropped before the controller DMAs into or out of
+// the buffer. Past the size of the cache, one whole-cache operation is cheaper than walking the range.
+static void syncBuffer(void* buffer, int bufferLen) {
+	if(bufferLen >= ARM11_DCACHE_SIZE)
+		CleanAndInvalidateCPUDataCache();
+	else
+		CleanAndInvalidateCPUDataCacheRange(buffer, bufferLen);
+}
+
 static void receiveControl(void* buffer, int bufferLen) {
-	CleanAndInvalidateCPUDataCache();
+	syncBuffer(buffer, bufferLen);
 	receive(USB_CONTROLEP, USBControl, buffer, USB_MAX_PACKETSIZE, bufferLen);
 }
 
@@ -255,7 +332,7 @@ static void usbTxRx(int endpoint, USBDirection direction, USBTransferType transf
 		packetLength = packetsizeFromSpeed(usb_speed);
 	}
 
-	CleanAndInvalidateCPUDataCache();
+	syncBuffer(buffer, bufferLen);
 
 	if(direction == USBOut) {
 		receive(endpoint, transferType, buffer, packetLength, bufferLen);
@@ -575,7 +652,7 @@ static void usbIRQHandler(uint32_t token) {
 
 		if((status & GINTMSK_RESET) == GINTMSK_RESET) {
 			if(usb_state < USBError) {
-				bufferPrintf("usb: reset detected\r\n");
+				LogPrintf(LOG_USB, LOG_INFO, "usb: reset detected\r\n");
 				change_state(USBPowered);
 			}
 
@@ -584,7 +661,7 @@ static void usbIRQHandler(uint32_t token) {
 			SET_REG(USB + GINTSTS, GINTMSK_RESET);
 
 			if(retval) {
-				bufferPrintf("usb: listening for further usb events\r\n");
+				LogPrintf(LOG_USB, LOG_INFO, "usb: listening for further usb events\r\n");
 				return;	
 			}
 
@@ -603,8 +680,21 @@ static void usbIRQHandler(uint32_t token) {
 
 				uint16_t length;
 				uint32_t totalLength;
-				USBStringDescriptor* strDesc;
-				if(USBSetupPacketRequestTypeType(setupPacket->bmRequestType) != USBSetupPacketVendor) {
+				const USBStringDescriptor* strDesc;
+				if(USBSetupPacketRequestTypeType(setupPacket->bmRequestType) == USBSetupPacketClass && classRequestHandler != NULL) {
+					int classLength = classRequestHandler(setupPacket, controlSendBuffer);
+					if(classLength < 0) {
+						stallControl();
+					} else {
+						if(classLength > setupPacket->wLength)
+							classLength = setupPacket->wLength;
+
+						// data stage, or the status stage of a request without one
+						sendControl(controlSendBuffer, classLength);
+					}
+
+					receiveControl(controlRecvBuffer, sizeof(USBSetupPacket));
+				} else if(USBSetupPacketRequestTypeType(setupPacket->bmRequestType) != USBSetupPacketVendor) {
 					switch(setupPacket->bRequest) {
 						case USB_GET_DESCRIPTOR:
 							length = setupPacket->wLength;
@@ -618,13 +708,20 @@ static void usbIRQHandler(uint32_t token) {
 									memcpy(controlSendBuffer, usb_get_device_descriptor(), length);
 									break;
 								case USBConfigurationDescriptorType:
+								case USBOtherSpeedConfigurationDescriptorType:
 									// hopefully SET_ADDRESS was received beforehand to set the speed
-									totalLength = getConfigurationTree(setupPacket->wValue & 0xFF, usb_speed, controlSendBuffer);
-									if(length > totalLength)
+									totalLength = getConfigurationTree(setupPacket->wValue & 0xFF, usb_speed, setupPacket->wValue >> 8, controlSendBuffer);
+									if(totalLength == 0)
+										stall = TRUE;
+									else if(length > totalLength)
 										length = totalLength;
 									break;
 								case USBStringDescriptorType:
 									strDesc = usb_get_string_descriptor(setupPacket->wValue & 0xFF);
+									if(strDesc == NULL) {
+										stall = TRUE;
+										break;
+									}
 									if(length > strDesc->bLength)
 										length = strDesc->bLength;
 									memcpy(controlSendBuffer, strDesc, length);
@@ -723,245 +820,169 @@ static void usbIRQHandler(uint32_t token) {
 
 }
 
-static void create_descriptors() {
-	if(configurations == NULL) {
-		deviceDescriptor.bLength = sizeof(USBDeviceDescriptor);
-		deviceDescriptor.bDescriptorType = USBDeviceDescriptorType;
-		deviceDescriptor.bcdUSB = USB_2_0;
-		deviceDescriptor.bDeviceClass = 0;
-		deviceDescriptor.bDeviceSubClass = 0;
-		deviceDescriptor.bDeviceProtocol = 0;
-		deviceDescriptor.bMaxPacketSize = USB_MAX_PACKETSIZE;
-		deviceDescriptor.idVendor = 0x525;
-		deviceDescriptor.idProduct = PRODUCT_IPHONE;
-		deviceDescriptor.bcdDevice = DEVICE_IPHONE;
-		deviceDescriptor.iManufacturer = addStringDescriptor("Apple Inc.");
-		deviceDescriptor.iProduct = addStringDescriptor("Apple Mobile Device (OpenIBoot Mode)");
-		deviceDescriptor.iSerialNumber = addStringDescriptor("");
-		deviceDescriptor.bNumConfigurations = 0;
-
-		deviceQualifierDescriptor.bDescriptorType = USBDeviceDescriptorType;
-		deviceQualifierDescriptor.bcdUSB = USB_2_0;
-		deviceQualifierDescriptor.bDeviceClass = 0;
-		deviceQualifierDescriptor.bDeviceSubClass = 0;
-		deviceQualifierDescriptor.bDeviceProtocol = 0;
-		deviceDescriptor.bMaxPacketSize = USB_MAX_PACKETSIZE;
-		deviceDescriptor.bNumConfigurations = 0;
-
-		addConfiguration(1, addStringDescriptor("OpenIBoot Mode Configuration"), 0, 0, 500);
-	}
-}
-
-USBDeviceDescriptor* usb_get_device_descriptor() {
-	create_descriptors();
+const USBDeviceDescriptor* usb_get_device_descriptor() {
 	return &deviceDescriptor;
 }
 
-USBDeviceQualifierDescriptor* usb_get_device_qualifier_descriptor() {
-	create_descriptors();
+const USBDeviceQualifierDescriptor* usb_get_device_qualifier_descriptor() {
 	return &deviceQualifierDescriptor;
 }
 
 static void setConfiguration(int i) {
-	int8_t j;
-	for(j = 0; j < configurations[i].descriptor.bNumInterfaces; j++) {
-		int8_t k;
-		for(k = 0; k < configurations[i].interfaces[j].descriptor.bNumEndpoints; k++) {
-			int endpoint = configurations[i].interfaces[j].endpointDescriptors[k].bEndpointAddress & 0x3;
-			if((configurations[i].interfaces[j].endpointDescriptors[k].bEndpointAddress & (0x1 << 7)) == (0x1 << 7)) {
-				InEPRegs[endpoint].control = InEPRegs[endpoint].control | DCTL_SETD0PID;
-			} else {
-				OutEPRegs[endpoint].control = OutEPRegs[endpoint].control | DCTL_SETD0PID;
-			}
+	int8_t k;
+	for(k = 0; k < usbInterface.descriptor.bNumEndpoints; k++) {
+		int endpoint = usbInterface.endpointDescriptors[k].bEndpointAddress & 0xF;
+		if((usbInterface.endpointDescriptors[k].bEndpointAddress & (0x1 << 7)) == (0x1 << 7)) {
+			InEPRegs[endpoint].control = InEPRegs[endpoint].control | DCTL_SETD0PID;
+		} else {
+			OutEPRegs[endpoint].control = OutEPRegs[endpoint].control | DCTL_SETD0PID;
 		}
 	}
 }
 
-static uint32_t getConfigurationTree(int i, uint8_t speed_id, void* buffer) {
-	uint8_t *buf = (uint8_t*) buffer;
-	uint32_t pos = 0;
+static int treeForSpeed(uint8_t speed_id) {
+	return (speed_id == USB_HIGHSPEED) ? TreeHighSpeed : TreeFullSpeed;
+}
 
-	if(configurations == NULL) {
+static uint32_t getConfigurationTree(int i, uint8_t speed_id, uint8_t descriptorType, void* buffer) {
+	if(i != 0 || configurationTreeLen == 0) {
 		return 0;
 	}
 
-	memcpy(buf + pos, usb_get_configuration_descriptor(i, speed_id), sizeof(USBConfigurationDescriptor));
-	pos += sizeof(USBConfigurationDescriptor);
+	int tree = treeForSpeed(speed_id);
 
-	int8_t j;
-	for(j = 0; j < configurations[i].descriptor.bNumInterfaces; j++) {
-		memcpy(buf + pos, &configurations[i].interfaces[j].descriptor, sizeof(USBInterfaceDescriptor));
-		pos += sizeof(USBInterfaceDescriptor);
-		int8_t k;
-		for(k = 0; k < configurations[i].interfaces[j].descriptor.bNumEndpoints; k++) {
-			memcpy(buf + pos, &configurations[i].interfaces[j].endpointDescriptors[k], sizeof(USBEndpointDescriptor));
-			pos += sizeof(USBEndpointDescriptor);
-		}
-	}
+	// the other speed's tree is what we would look like at that speed, so a high-speed capable host can tell
+	if(descriptorType == USBOtherSpeedConfigurationDescriptorType)
+		tree = (tree == TreeHighSpeed) ? TreeFullSpeed : TreeHighSpeed;
 
-	return pos;
-}
+	memcpy(buffer, configurationTrees[tree], configurationTreeLen);
+	((USBConfigurationDescriptor*) buffer)->bDescriptorType = descriptorType;
 
-USBConfigurationDescriptor* usb_get_configuration_descriptor(int index, uint8_t speed_id) {
-	if(index == 0 && configurations[0].interfaces == NULL) {
-		USBInterface* interface = addInterfaceDescriptor(&configurations[0], 0, 0,
-			OPENIBOOT_INTERFACE_CLASS, OPENIBOOT_INTERFACE_SUBCLASS, OPENIBOOT_INTERFACE_PROTOCOL, addStringDescriptor("IF0"));
+	return configurationTreeLen;
+}
 
-		enumerateHandler(interface);
-		endConfiguration(&configurations[0]);
+const USBConfigurationDescriptor* usb_get_configuration_descriptor(int index, uint8_t speed_id) {
+	if(index != 0 || configurationTreeLen == 0) {
+		return NULL;
 	}
 
-	return &configurations[index].descriptor;
+	return (const USBConfigurationDescriptor*) configurationTrees[treeForSpeed(speed_id)];
 }
 
+// Only the address and attributes are recorded here; packet sizes and polling intervals are filled in per speed.
 void usb_add_endpoint(USBInterface* interface, int endpoint, USBDirection direction, USBTransferType transferType) {
-	if(transferType == USBInterrupt) {
-		if(usb_speed == USB_HIGHSPEED)
-			addEndpointDescriptor(interface, endpoint, direction, transferType, USBNoSynchronization, USBDataEndpoint, packetsizeFromSpeed(usb_speed), 9);
-		else
-			addEndpointDescriptor(interface, endpoint, direction, transferType, USBNoSynchronization, USBDataEndpoint, packetsizeFromSpeed(usb_speed), 32);
-	} else {
-		addEndpointDescriptor(interface, endpoint, direction, transferType, USBNoSynchronization, USBDataEndpoint, packetsizeFromSpeed(usb_speed), 0);
+	if(direction > USBIn || interface->descriptor.bNumEndpoints >= USB_MAX_INTERFACE_ENDPOINTS) {
+		bufferPrintf("usb: cannot add endpoint %d\r\n", endpoint);
+		return;
 	}
+
+	USBEndpointDescriptor* descriptor = &interface->endpointDescriptors[interface->descriptor.bNumEndpoints++];
+	descriptor->bLength = sizeof(USBEndpointDescriptor);
+	descriptor->bDescriptorType = USBEndpointDescriptorType;
+	descriptor->bEndpointAddress = (endpoint & 0xF) | ((direction & 0x1) << 7);	// see USB specs for the bitfield spec
+	descriptor->bmAttributes = (transferType & 0x3) | ((USBNoSynchronization & 0x3) << 2) | ((USBDataEndpoint & 0x3) << 4);
+	descriptor->wMaxPacketSize = 0;
+	descriptor->bInterval = 0;
 }
 
 static void initializeDescriptors() {
-	numStringDescriptors = 0;
-	stringDescriptors = NULL;
-	configurations = NULL;
-	firstStringDescriptor = NULL;
-	firstStringDescriptor = (USBFirstStringDescriptor*) malloc(sizeof(USBFirstStringDescriptor) + (sizeof(uint16_t) * 1));
-	firstStringDescriptor->bLength = sizeof(USBFirstStringDescriptor) + (sizeof(uint16_t) * 1);
-	firstStringDescriptor->bDescriptorType = USBStringDescriptorType;
-	firstStringDescriptor->wLANGID[0] = USB_LANGID_ENGLISH_US;
+	if(stringDescriptors[USBStringLanguages] == NULL)
+		buildStringDescriptors();
+
+	buildConfigurationTrees();
 }
 
-static void releaseConfigurations() {
-	if(configurations == NULL) {
-		return;
-	}
+static void buildStringDescriptors() {
+	int pos = 0;
+	int i;
 
-	int8_t i;
-	for(i = 0; i < deviceDescriptor.bNumConfigurations; i++) {
-		int8_t j;
-		for(j = 0; j < configurations[i].descriptor.bNumInterfaces; j++) {
-			free(configurations[i].interfaces[j].endpointDescriptors);
-		}
-		free(configurations[i].interfaces);
-	}
+	stringDescriptors[USBStringLanguages] = (const USBStringDescriptor*) languageDescriptor;
 
-	free(configurations);
-	deviceDescriptor.bNumConfigurations = 0;
-	configurations = NULL;
-}
+	for(i = USBStringLanguages + 1; i < USBNumStrings; i++) {
+		int sLen = strlen(stringTable[i]);
+		int bLength = sizeof(USBStringDescriptor) + sLen * 2;
+		if(pos + bLength > STRING_POOL_LEN) {
+			bufferPrintf("usb: no room for string descriptor %d\r\n", i);
+			stringDescriptors[i] = NULL;
+			continue;
+		}
 
-static uint8_t addConfiguration(uint8_t bConfigurationValue, uint8_t iConfiguration, uint8_t selfPowered, uint8_t remoteWakeup, uint16_t maxPower) {
-	uint8_t newIndex = deviceDescriptor.bNumConfigurations;
-	deviceDescriptor.bNumConfigurations++;
-	deviceQualifierDescriptor.bNumConfigurations++;
-
-	configurations = (USBConfiguration*) realloc(configurations, sizeof(USBConfiguration) * deviceDescriptor.bNumConfigurations);
-	configurations[newIndex].descriptor.bLength = sizeof(USBConfigurationDescriptor);
-	configurations[newIndex].descriptor.bDescriptorType = USBConfigurationDescriptorType;
-	configurations[newIndex].descriptor.wTotalLength = 0;
-	configurations[newIndex].descriptor.bNumInterfaces = 0;
-	configurations[newIndex].descriptor.bConfigurationValue = bConfigurationValue;
-	configurations[newIndex].descriptor.iConfiguration = iConfiguration;
-	configurations[newIndex].descriptor.bmAttributes = ((0x1) << 7) | ((selfPowered & 0x1) << 6) | ((remoteWakeup & 0x1) << 5);
-	configurations[newIndex].descriptor.bMaxPower = maxPower / 2;
-	configurations[newIndex].interfaces = NULL;
-
-	return newIndex;
-}
+		USBStringDescriptor* descriptor = (USBStringDescriptor*) (stringPool + pos);
+		descriptor->bLength = bLength;
+		descriptor->bDescriptorType = USBStringDescriptorType;
 
-static void endConfiguration(USBConfiguration* configuration) {
-	configuration->descriptor.wTotalLength = sizeof(USBConfigurationDescriptor);
+		// UTF-16LE; byte by byte, since the pool makes no promises about alignment
+		uint8_t* string = (uint8_t*) descriptor->bString;
+		int j;
+		for(j = 0; j < sLen; j++) {
+			string[j * 2] = stringTable[i][j];
+			string[j * 2 + 1] = 0;
+		}
 
-	int i;
-	for(i = 0; i < configurations->descriptor.bNumInterfaces; i++) {
-		configuration->descriptor.wTotalLength += sizeof(USBInterfaceDescriptor) + (configuration->interfaces[i].descriptor.bNumEndpoints * sizeof(USBEndpointDescriptor));
+		stringDescriptors[i] = descriptor;
+		pos += bLength;
 	}
 }
 
-static USBInterface* addInterfaceDescriptor(USBConfiguration* configuration, uint8_t bInterfaceNumber, uint8_t bAlternateSetting, uint8_t bInterfaceClass, uint8_t bInterfaceSubClass, uint8_t bInterfaceProtocol, uint8_t iInterface) {
-	uint8_t newIndex = configuration->descriptor.bNumInterfaces;
-	configuration->descriptor.bNumInterfaces++;
-
-	configuration->interfaces = (USBInterface*) realloc(configuration->interfaces, sizeof(USBInterface) * configuration->descriptor.bNumInterfaces);
-	configuration->interfaces[newIndex].descriptor.bLength = sizeof(USBInterfaceDescriptor);
-	configuration->interfaces[newIndex].descriptor.bDescriptorType = USBInterfaceDescriptorType;
-	configuration->interfaces[newIndex].descriptor.bInterfaceNumber = bInterfaceNumber;
-	configuration->interfaces[newIndex].descriptor.bAlternateSetting = bAlternateSetting;
-	configuration->interfaces[newIndex].descriptor.bInterfaceClass = bInterfaceClass;
-	configuration->interfaces[newIndex].descriptor.bInterfaceSubClass = bInterfaceSubClass;
-	configuration->interfaces[newIndex].descriptor.bInterfaceProtocol = bInterfaceProtocol;
-	configuration->interfaces[newIndex].descriptor.iInterface = iInterface;
-	configuration->interfaces[newIndex].descriptor.bNumEndpoints = 0;
-	configuration->interfaces[newIndex].endpointDescriptors = NULL;
-
-	return &configuration->interfaces[newIndex];
-}
+static void buildConfigurationTrees() {
+	if(configurationTreeLen != 0 && treeHandler == enumerateHandler
+			&& treeClass == interfaceClass && treeSubClass == interfaceSubClass && treeProtocol == interfaceProtocol) {
+		return;
+	}
 
-static uint8_t addEndpointDescriptor(USBInterface* interface, uint8_t endpoint, USBDirection direction, USBTransferType transferType, USBSynchronisationType syncType, USBUsageType usageType, uint16_t wMaxPacketSize, uint8_t bInterval) {
-	if(direction > 2)
-		return -1;
+	memset(&usbInterface, 0, sizeof(usbInterface));
+	usbInterface.descriptor.bLength = sizeof(USBInterfaceDescriptor);
+	usbInterface.descriptor.bDescriptorType = USBInterfaceDescriptorType;
+	usbInterface.descriptor.bInterfaceNumber = 0;
+	usbInterface.descriptor.bAlternateSetting = 0;
+	usbInterface.descriptor.bInterfaceClass = interfaceClass;
+	usbInterface.descriptor.bInterfaceSubClass = interfaceSubClass;
+	usbInterface.descriptor.bInterfaceProtocol = interfaceProtocol;
+	usbInterface.descriptor.iInterface = USBStringInterface;
 
-	uint8_t newIndex = interface->descriptor.bNumEndpoints;
-	interface->descriptor.bNumEndpoints++;
+	enumerateHandler(&usbInterface);
 
-	interface->endpointDescriptors = (USBEndpointDescriptor*) realloc(interface->endpointDescriptors, sizeof(USBEndpointDescriptor) * interface->descriptor.bNumEndpoints);
-	interface->endpointDescriptors[newIndex].bLength = sizeof(USBEndpointDescriptor);
-	interface->endpointDescriptors[newIndex].bDescriptorType = USBEndpointDescriptorType;
-	interface->endpointDescriptors[newIndex].bEndpointAddress = (endpoint & 0xF) | ((direction & 0x1) << 7);	// see USB specs for the bitfield spec
-	interface->endpointDescriptors[newIndex].bmAttributes = (transferType & 0x3) | ((syncType & 0x3) << 2) | ((usageType & 0x3) << 4);
-	interface->endpointDescriptors[newIndex].wMaxPacketSize = wMaxPacketSize;
-	interface->endpointDescriptors[newIndex].bInterval = bInterval;
+	configurationTreeLen = sizeof(USBConfigurationDescriptor) + sizeof(USBInterfaceDescriptor)
+		+ (usbInterface.descriptor.bNumEndpoints * sizeof(USBEndpointDescriptor));
 
-	return newIndex;
-}
+	int tree;
+	for(tree = 0; tree < NumTrees; tree++) {
+		uint8_t speed_id = (tree == TreeHighSpeed) ? USB_HIGHSPEED : USB_FULLSPEED;
+		uint8_t* buf = configurationTrees[tree];
+		uint32_t pos = 0;
 
-static uint8_t addStringDescriptor(const char* descriptorString) {
-	uint8_t newIndex = numStringDescriptors;
-	numStringDescriptors++;
+		memcpy(buf + pos, &configurationDescriptor, sizeof(USBConfigurationDescriptor));
+		((USBConfigurationDescriptor*) buf)->wTotalLength = configurationTreeLen;
+		pos += sizeof(USBConfigurationDescriptor);
 
-	stringDescriptors = (USBStringDescriptor**) realloc(stringDescriptors, sizeof(USBStringDescriptor*) * numStringDescriptors);
+		memcpy(buf + pos, &usbInterface.descriptor, sizeof(USBInterfaceDescriptor));
+		pos += sizeof(USBInterfaceDescriptor);
 
-	int sLen = strlen(descriptorString);
-	stringDescriptors[newIndex] = (USBStringDescriptor*) malloc(sizeof(USBStringDescriptor) + sLen * 2);
-	stringDescriptors[newIndex]->bLength = sizeof(USBStringDescriptor) + sLen * 2;
-	stringDescriptors[newIndex]->bDescriptorType = USBStringDescriptorType;
-	uint16_t* string = (uint16_t*) stringDescriptors[newIndex]->bString;
-	int i;
-	for(i = 0; i < sLen; i++) {
-		string[i] = descriptorString[i];
-	}
+		int8_t k;
+		for(k = 0; k < usbInterface.descriptor.bNumEndpoints; k++) {
+			USBEndpointDescriptor* descriptor = (USBEndpointDescriptor*) (buf + pos);
+			memcpy(descriptor, &usbInterface.endpointDescriptors[k], sizeof(USBEndpointDescriptor));
 
-	return (newIndex + 1);
-}
+			descriptor->wMaxPacketSize = packetsizeFromSpeed(speed_id);
+			if((descriptor->bmAttributes & 0x3) == USBInterrupt)
+				descriptor->bInterval = (speed_id == USB_HIGHSPEED) ? 9 : 32;
 
-USBStringDescriptor* usb_get_string_descriptor(int index) {
-	if(index == 0) {
-		return (USBStringDescriptor*) firstStringDescriptor;
-	} else {
-		return stringDescriptors[index - 1];
+			pos += sizeof(USBEndpointDescriptor);
+		}
 	}
-}
-
-static void releaseStringDescriptors() {
-	int8_t i;
 
-	if(stringDescriptors == NULL) {
-		return;
-	}
+	treeHandler = enumerateHandler;
+	treeClass = interfaceClass;
+	treeSubClass = interfaceSubClass;
+	treeProtocol = interfaceProtocol;
+}
 
-	for(i = 0; i < numStringDescriptors; i++) {
-		free(stringDescriptors[i]);
+const USBStringDescriptor* usb_get_string_descriptor(int index) {
+	if(index < 0 || index >= USBNumStrings) {
+		return NULL;
 	}
 
-	free(stringDescriptors);
-
-	numStringDescriptors = 0;
-	stringDescriptors = NULL;
+	return stringDescriptors[index];
 }
 
 static uint16_t packetsizeFromSpeed(uint8_t speed_id) {
@@ -1001,6 +1022,8 @@ int usb_install_ep_handler(int endpoint, USBDirection direction, USBEndpointHand
 }
 
 int usb_shutdown() {
+	interrupt_disable(USB_INTERRUPT);
+
 	power_ctrl(POWER_USB, ON);
 	clock_gate_switch(USB_OTGCLOCKGATE, ON);
 	clock_gate_switch(USB_PHYCLOCKGATE, ON);
@@ -1017,14 +1040,16 @@ int usb_shutdown() {
 	clock_gate_switch(USB_PHYCLOCKGATE, OFF);
 	power_ctrl(POWER_USB, OFF);
 
-	releaseConfigurations();
-	releaseStringDescriptors();
+	usb_set_function(OPENIBOOT_INTERFACE_CLASS, OPENIBOOT_INTERFACE_SUBCLASS, OPENIBOOT_INTERFACE_PROTOCOL, NULL);
+
+	// the next usb_setup starts over from scratch
+	usb_inited = FALSE;
 
 	return 0;
 }
 
 static void change_state(USBState new_state) {
-	bufferPrintf("USB state change: %d -> %d\r\n", usb_state, new_state);
+	LogPrintf(LOG_USB, LOG_INFO, "USB state change: %d -> %d\r\n", usb_state, new_state);
 	usb_state = new_state;
 	if(usb_state == USBConfigured) {
 		// TODO: set to host powered
@@ -1086,6 +1111,34 @@ static int8_t ringBufferEnqueue(RingBuffer* buffer, uint8_t value) {
 	return value;
 }
 
+static int maxBulkTransferAt(uint8_t speed_id) {
+	// largest whole number of packets that fits both the packet count and transfer size fields of DEPTSIZ
+	int packetLength = packetsizeFromSpeed(speed_id);
+	int maxPackets = DEPTSIZ_XFERSIZ_MASK / packetLength;
+	if(maxPackets > DEPTSIZ_PKTCNT_MASK)
+		maxPackets = DEPTSIZ_PKTCNT_MASK;
+
+	return maxPackets * packetLength;
+}
+
+int usb_max_bulk_transfer() {
+	return maxBulkTransferAt(usb_speed);
+}
+
+int usb_largest_bulk_transfer() {
+	static const uint8_t speeds[] = {USB_HIGHSPEED, USB_FULLSPEED, USB_LOWSPEED};
+	int largest = 0;
+	int i;
+
+	for(i = 0; i < (sizeof(speeds) / sizeof(speeds[0])); i++) {
+		int max = maxBulkTransferAt(speeds[i]);
+		if(max > largest)
+			largest = max;
+	}
+
+	return largest;
+}
+
 USBSpeed usb_get_speed() {
 	switch(usb_speed) {
 		case USB_HIGHSPEED:
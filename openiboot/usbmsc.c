@@ -0,0 +1,537 @@
+#include "openiboot.h"
+#include "usbmsc.h"
+#include "usb.h"
+#include "util.h"
+#include "nand.h"
+#include "ftl.h"
+#include "tasks.h"
+#include "log.h"
+#include "hardware/s5l8900.h"
+
+#define MSC_EP_IN 1
+#define MSC_EP_OUT 2
+
+// NAND is read and written this much at a time. One buffer is on the wire while the other is being filled or drained.
+#define MSC_BUFFER_LEN 0x10000
+#define MSC_REPLY_LEN 0x40
+
+// commit the FTL context once writes have stopped for this long (us), since hosts rarely ask us to
+#define MSC_SYNC_DELAY 1000000
+
+#define SCSI_TEST_UNIT_READY 0x00
+#define SCSI_REQUEST_SENSE 0x03
+#define SCSI_INQUIRY 0x12
+#define SCSI_MODE_SENSE_6 0x1A
+#define SCSI_START_STOP_UNIT 0x1B
+#define SCSI_PREVENT_ALLOW_REMOVAL 0x1E
+#define SCSI_READ_CAPACITY_10 0x25
+#define SCSI_READ_10 0x28
+#define SCSI_WRITE_10 0x2A
+#define SCSI_VERIFY_10 0x2F
+#define SCSI_SYNCHRONIZE_CACHE_10 0x35
+#define SCSI_MODE_SENSE_10 0x5A
+
+#define SENSE_NONE 0x00
+#define SENSE_MEDIUM_ERROR 0x03
+#define SENSE_ILLEGAL_REQUEST 0x05
+#define SENSE_DATA_PROTECT 0x07
+
+#define ASC_NONE 0x00
+#define ASC_WRITE_FAULT 0x03
+#define ASC_UNRECOVERED_READ_ERROR 0x11
+#define ASC_INVALID_COMMAND 0x20
+#define ASC_LBA_OUT_OF_RANGE 0x21
+#define ASC_INVALID_FIELD_IN_CDB 0x24
+#define ASC_WRITE_PROTECTED 0x27
+
+static const uint8_t inquiryData[36] = {
+	0x00,			// direct access block device
+	0x80,			// removable
+	0x04,			// SPC-2
+	0x02,			// response data format
+	36 - 5,			// additional length
+	0x00, 0x00, 0x00,
+	'A', 'p', 'p', 'l', 'e', ' ', ' ', ' ',
+	'N', 'A', 'N', 'D', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+	'1', '.', '0', ' '
+};
+
+static TaskDescriptor mscTask;
+static int mscTaskStarted = FALSE;
+static TaskQueue mscWork;
+
+static volatile int configured = FALSE;
+static volatile int resetPending = FALSE;
+static volatile int rxDone = FALSE;
+static volatile int txDone = FALSE;
+
+static uint8_t* cbwBuffer = NULL;
+static uint8_t* cswBuffer = NULL;
+static uint8_t* replyBuffer = NULL;
+static uint8_t* buffers[2] = {NULL, NULL};
+
+static uint32_t blockSize;
+static uint32_t blockCount;
+static uint32_t blocksPerBuffer;
+static int mscWritable;
+static int dirty = FALSE;
+
+static uint8_t senseKey = SENSE_NONE;
+static uint8_t senseASC = ASC_NONE;
+
+// After a READ, the pages following it are read into the idle buffer while we wait for the next command, so a host
+// reading sequentially finds its next request already waiting.
+static int prefetchPending = FALSE;
+static int aheadValid = FALSE;
+static uint32_t aheadLBA;
+static uint32_t aheadBlocks;
+static int aheadBuffer;
+
+static void dataReceived(uint32_t token) {
+	rxDone = TRUE;
+	task_wake(&mscWork);
+}
+
+static void dataSent(uint32_t token) {
+	txDone = TRUE;
+	task_wake(&mscWork);
+}
+
+static void startReceive(void* buffer, int bufferLen) {
+	rxDone = FALSE;
+	usb_receive_bulk(MSC_EP_OUT, buffer, bufferLen);
+}
+
+static void startSend(void* buffer, int bufferLen) {
+	txDone = FALSE;
+	usb_send_bulk(MSC_EP_IN, buffer, bufferLen);
+}
+
+// Returns FALSE if the host reset us while we were waiting.
+static int waitFor(volatile int* flag) {
+	while(!*flag) {
+		if(resetPending)
+			return FALSE;
+
+		task_wait(&mscWork, 0);
+	}
+
+	return !resetPending;
+}
+
+static void put32(uint8_t* buffer, uint32_t value) {
+	buffer[0] = value >> 24;
+	buffer[1] = value >> 16;
+	buffer[2] = value >> 8;
+	buffer[3] = value;
+}
+
+static uint32_t get32(const uint8_t* buffer) {
+	return (buffer[0] << 24) | (buffer[1] << 16) | (buffer[2] << 8) | buffer[3];
+}
+
+static uint32_t get16(const uint8_t* buffer) {
+	return (buffer[0] << 8) | buffer[1];
+}
+
+static int fail(uint8_t key, uint8_t asc) {
+	senseKey = key;
+	senseASC = asc;
+	return MSC_CSW_FAILED;
+}
+
+static int nandRead(uint32_t lba, uint32_t blocks, uint8_t* buffer) {
+	return FTL_Read(lba, blocks, buffer) == 0;
+}
+
+static int nandWrite(uint32_t lba, uint32_t blocks, uint8_t* buffer) {
+	dirty = TRUE;
+	return FTL_Write(lba, blocks, buffer) == 0;
+}
+
+static void sync() {
+	if(!dirty)
+		return;
+
+	if(!ftl_sync())
+		LogPrintf(LOG_USB, LOG_ERROR, "usbmsc: FTL sync failed\r\n");
+
+	dirty = FALSE;
+}
+
+// Keeps the data phase as long as the host asked for when a command can't fill it: made-up bytes going in, whatever
+// it sends going nowhere.
+static int skipData(MSCCommandBlockWrapper* cbw, uint32_t done) {
+	uint32_t left = cbw->dCBWDataTransferLength - done;
+	int in = (cbw->bmCBWFlags & MSC_CBW_DATA_IN) != 0;
+
+	aheadValid = FALSE;
+	prefetchPending = FALSE;
+
+	if(in)
+		memset(buffers[0], 0, (left > MSC_BUFFER_LEN) ? MSC_BUFFER_LEN : left);
+
+	while(left > 0) {
+		uint32_t length = (left > MSC_BUFFER_LEN) ? MSC_BUFFER_LEN : left;
+
+		if(in) {
+			startSend(buffers[0], length);
+			if(!waitFor(&txDone))
+				return FALSE;
+		} else {
+			startReceive(buffers[0], length);
+			if(!waitFor(&rxDone))
+				return FALSE;
+		}
+
+		left -= length;
+	}
+
+	return TRUE;
+}
+
+static int sendReply(MSCCommandBlockWrapper* cbw, const void* data, uint32_t length, uint32_t* done) {
+	if(length > cbw->dCBWDataTransferLength)
+		length = cbw->dCBWDataTransferLength;
+
+	if(length == 0)
+		return TRUE;
+
+	memcpy(replyBuffer, data, length);
+	startSend(replyBuffer, length);
+	if(!waitFor(&txDone))
+		return FALSE;
+
+	*done = length;
+	return TRUE;
+}
+
+static int readBlocks(uint32_t lba, uint32_t count, uint32_t* done) {
+	int cur;
+	uint32_t blocks;
+
+	if(aheadValid && aheadLBA == lba) {
+		cur = aheadBuffer;
+		blocks = (aheadBlocks > count) ? count : aheadBlocks;
+	} else {
+		cur = 0;
+		blocks = (count > blocksPerBuffer) ? blocksPerBuffer : count;
+		if(!nandRead(lba, blocks, buffers[cur]))
+			return FALSE;
+	}
+
+	aheadValid = FALSE;
+	prefetchPending = FALSE;
+
+	while(TRUE) {
+		startSend(buffers[cur], blocks * blockSize);
+		lba += blocks;
+		count -= blocks;
+
+		// read the next piece while this one goes out
+		uint32_t next = (count > blocksPerBuffer) ? blocksPerBuffer : count;
+		int ok = (next == 0) || nandRead(lba, next, buffers[cur ^ 1]);
+
+		if(!waitFor(&txDone))
+			return FALSE;
+
+		*done += blocks * blockSize;
+
+		if(next == 0 || !ok)
+			break;
+
+		cur ^= 1;
+		blocks = next;
+	}
+
+	if(count > 0)
+		return FALSE;
+
+	if(lba < blockCount) {
+		aheadLBA = lba;
+		aheadBuffer = cur ^ 1;
+		prefetchPending = TRUE;
+	}
+
+	return TRUE;
+}
+
+static int writeBlocks(uint32_t lba, uint32_t count, uint32_t* done) {
+	int cur = 0;
+	int ok = TRUE;
+	uint32_t written = 0;
+	uint32_t blocks = (count > blocksPerBuffer) ? blocksPerBuffer : count;
+
+	aheadValid = FALSE;
+	prefetchPending = FALSE;
+
+	startReceive(buffers[cur], blocks * blockSize);
+	while(blocks > 0) {
+		if(!waitFor(&rxDone))
+			return FALSE;
+
+		// let the host carry on into the other buffer while this one is written out
+		uint32_t next = count - written - blocks;
+		if(next > blocksPerBuffer)
+			next = blocksPerBuffer;
+
+		if(next > 0)
+			startReceive(buffers[cur ^ 1], next * blockSize);
+
+		// after a failure the rest is still taken off the wire, just not written
+		if(ok && !nandWrite(lba + written, blocks, buffers[cur]))
+			ok = FALSE;
+
+		written += blocks;
+		*done += blocks * blockSize;
+		cur ^= 1;
+		blocks = next;
+	}
+
+	return ok;
+}
+
+static void prefetch() {
+	if(!prefetchPending)
+		return;
+
+	prefetchPending = FALSE;
+
+	uint32_t blocks = blockCount - aheadLBA;
+	if(blocks > blocksPerBuffer)
+		blocks = blocksPerBuffer;
+
+	aheadBlocks = blocks;
+	aheadValid = nandRead(aheadLBA, blocks, buffers[aheadBuffer]);
+}
+
+// Returns the CSW status, or -1 if the host reset us partway through.
+static int handleCommand(MSCCommandBlockWrapper* cbw, uint32_t* done) {
+	uint8_t* cb = cbw->CBWCB;
+	uint8_t reply[18];
+	uint32_t lba;
+	uint32_t count;
+	int status = MSC_CSW_PASSED;
+
+	if(cbw->bCBWLUN != 0)
+		return fail(SENSE_ILLEGAL_REQUEST, ASC_INVALID_FIELD_IN_CDB);
+
+	switch(cb[0]) {
+		case SCSI_TEST_UNIT_READY:
+		case SCSI_VERIFY_10:
+			break;
+
+		case SCSI_REQUEST_SENSE:
+			memset(reply, 0, sizeof(reply));
+			reply[0] = 0x70;	// current error, fixed format
+			reply[2] = senseKey;
+			reply[7] = sizeof(reply) - 8;
+			reply[12] = senseASC;
+			senseKey = SENSE_NONE;
+			senseASC = ASC_NONE;
+			if(!sendReply(cbw, reply, sizeof(reply), done))
+				return -1;
+			break;
+
+		case SCSI_INQUIRY:
+			if(!sendReply(cbw, inquiryData, sizeof(inquiryData), done))
+				return -1;
+			break;
+
+		case SCSI_MODE_SENSE_6:
+			memset(reply, 0, 4);
+			reply[0] = 3;
+			reply[2] = mscWritable ? 0 : 0x80;	// write protect
+			if(!sendReply(cbw, reply, 4, done))
+				return -1;
+			break;
+
+		case SCSI_MODE_SENSE_10:
+			memset(reply, 0, 8);
+			reply[1] = 6;
+			reply[3] = mscWritable ? 0 : 0x80;
+			if(!sendReply(cbw, reply, 8, done))
+				return -1;
+			break;
+
+		case SCSI_START_STOP_UNIT:
+		case SCSI_PREVENT_ALLOW_REMOVAL:
+		case SCSI_SYNCHRONIZE_CACHE_10:
+			// about to be unplugged or asked for outright: get the FTL context onto NAND
+			sync();
+			break;
+
+		case SCSI_READ_CAPACITY_10:
+			put32(reply, blockCount - 1);
+			put32(reply + 4, blockSize);
+			if(!sendReply(cbw, reply, 8, done))
+				return -1;
+			break;
+
+		case SCSI_READ_10:
+		case SCSI_WRITE_10:
+			lba = get32(cb + 2);
+			count = get16(cb + 7);
+
+			if(lba >= blockCount || count > blockCount - lba) {
+				status = fail(SENSE_ILLEGAL_REQUEST, ASC_LBA_OUT_OF_RANGE);
+				break;
+			}
+
+			if(count * blockSize > cbw->dCBWDataTransferLength
+					|| ((cbw->bmCBWFlags & MSC_CBW_DATA_IN) != 0) != (cb[0] == SCSI_READ_10)) {
+				status = fail(SENSE_ILLEGAL_REQUEST, ASC_INVALID_FIELD_IN_CDB);
+				break;
+			}
+
+			if(cb[0] == SCSI_WRITE_10 && !mscWritable) {
+				status = fail(SENSE_DATA_PROTECT, ASC_WRITE_PROTECTED);
+				break;
+			}
+
+			if(count == 0)
+				break;
+
+			if(cb[0] == SCSI_READ_10) {
+				if(!readBlocks(lba, count, done))
+					status = fail(SENSE_MEDIUM_ERROR, ASC_UNRECOVERED_READ_ERROR);
+			} else {
+				if(!writeBlocks(lba, count, done))
+					status = fail(SENSE_MEDIUM_ERROR, ASC_WRITE_FAULT);
+			}
+
+			if(resetPending)
+				return -1;
+			break;
+
+		default:
+			LogPrintf(LOG_USB, LOG_DEBUG, "usbmsc: unsupported SCSI command 0x%x\r\n", cb[0]);
+			status = fail(SENSE_ILLEGAL_REQUEST, ASC_INVALID_COMMAND);
+	}
+
+	return status;
+}
+
+static void mscRoutine(void* opaque) {
+	MSCCommandBlockWrapper* cbw = (MSCCommandBlockWrapper*) cbwBuffer;
+	MSCCommandStatusWrapper* csw = (MSCCommandStatusWrapper*) cswBuffer;
+
+	while(TRUE) {
+		if(resetPending) {
+			resetPending = FALSE;
+			aheadValid = FALSE;
+			prefetchPending = FALSE;
+		}
+
+		if(!configured) {
+			task_wait(&mscWork, 0);
+			continue;
+		}
+
+		startReceive(cbwBuffer, (usb_get_speed() == USBHighSpeed) ? 512 : 64);
+
+		// the host can send the next command while we read ahead
+		prefetch();
+
+		while(!rxDone && !resetPending) {
+			if(dirty) {
+				if(task_wait(&mscWork, MSC_SYNC_DELAY) != 0)
+					sync();
+			} else {
+				task_wait(&mscWork, 0);
+			}
+		}
+
+		if(resetPending)
+			continue;
+
+		if(cbw->dCBWSignature != MSC_CBW_SIGNATURE) {
+			LogPrintf(LOG_USB, LOG_INFO, "usbmsc: ignoring invalid CBW\r\n");
+			continue;
+		}
+
+		uint32_t done = 0;
+		int status = handleCommand(cbw, &done);
+		if(status < 0)
+			continue;
+
+		if(done < cbw->dCBWDataTransferLength && status == MSC_CSW_FAILED && !skipData(cbw, done))
+			continue;
+
+		csw->dCSWSignature = MSC_CSW_SIGNATURE;
+		csw->dCSWTag = cbw->dCBWTag;
+		csw->dCSWDataResidue = cbw->dCBWDataTransferLength - done;
+		csw->bCSWStatus = status;
+
+		startSend(cswBuffer, sizeof(MSCCommandStatusWrapper));
+		waitFor(&txDone);
+	}
+}
+
+static int classRequest(USBSetupPacket* setupPacket, uint8_t* buffer) {
+	switch(setupPacket->bRequest) {
+		case MSC_REQUEST_GET_MAX_LUN:
+			buffer[0] = 0;
+			return 1;
+
+		case MSC_REQUEST_RESET:
+			resetPending = TRUE;
+			task_wake(&mscWork);
+			return 0;
+	}
+
+	return -1;
+}
+
+static void enumerateHandler(USBInterface* interface) {
+	usb_add_endpoint(interface, MSC_EP_IN, USBIn, USBBulk);
+	usb_add_endpoint(interface, MSC_EP_OUT, USBOut, USBBulk);
+}
+
+static void startHandler() {
+	configured = TRUE;
+	resetPending = TRUE;
+	task_wake(&mscWork);
+}
+
+int msc_start(int writable) {
+	if(ftl_setup() != 0) {
+		bufferPrintf("usbmsc: no FTL to export\r\n");
+		return -1;
+	}
+
+	NANDData* geometry = nand_get_geometry();
+	blockSize = geometry->bytesPerPage;
+	blockCount = geometry->userPagesTotal - 1;	// FTL_Read won't touch the last page
+	blocksPerBuffer = MSC_BUFFER_LEN / blockSize;
+	mscWritable = writable;
+
+	if(!cbwBuffer) {
+		cbwBuffer = memalign(DMA_ALIGN, 512);
+		cswBuffer = memalign(DMA_ALIGN, sizeof(MSCCommandStatusWrapper));
+		replyBuffer = memalign(DMA_ALIGN, MSC_REPLY_LEN);
+		buffers[0] = memalign(DMA_ALIGN, MSC_BUFFER_LEN);
+		buffers[1] = memalign(DMA_ALIGN, MSC_BUFFER_LEN);
+	}
+
+	bufferPrintf("usbmsc: exporting %d blocks of %d bytes%s. The USB console is going away.\r\n",
+			blockCount, blockSize, writable ? "" : " read-only");
+
+	// nothing is listening for console pushes on the new interface
+	setScrollbackListener(NULL);
+
+	configured = FALSE;
+	usb_shutdown();
+	usb_setup();
+	usb_install_ep_handler(MSC_EP_OUT, USBOut, dataReceived, 0);
+	usb_install_ep_handler(MSC_EP_IN, USBIn, dataSent, 0);
+	usb_set_function(MSC_INTERFACE_CLASS, MSC_INTERFACE_SUBCLASS_SCSI, MSC_INTERFACE_PROTOCOL_BOT, classRequest);
+	usb_start(enumerateHandler, startHandler);
+
+	if(!mscTaskStarted) {
+		task_start(&mscTask, "usbmsc", mscRoutine, NULL);
+		mscTaskStarted = TRUE;
+	}
+
+	return 0;
+}
@@ -422,64 +422,80 @@ void hexdump(uint32_t start, int length) {
 	bufferPrintf("\r\n");
 }
 
-static char* MyBuffer= NULL;
-static char* pMyBuffer = NULL;
-static size_t MyBufferLen = 0;
-
+// The scrollback is a ring with free-running indices. Producers (addToBuffer) only ever move
+// ScrollbackHead, the USB/UART drain is the consumer and only ever moves ScrollbackTail, so the
+// consumer doesn't have to mask interrupts. Producers do, since bufferPrintf can be called from
+// interrupt handlers. When a producer laps the consumer, the oldest output is overwritten and the
+// consumer skips forward the next time it drains.
 #define SCROLLBACK_LEN (1024*16)
+#define SCROLLBACK_MASK (SCROLLBACK_LEN - 1)
 
-void bufferDump(uint32_t location, unsigned int len) {
-	EnterCriticalSection();
-	if(pMyBuffer == NULL) {
-		MyBuffer = (char*) malloc(SCROLLBACK_LEN);
-		MyBufferLen = 0;
-		pMyBuffer = MyBuffer;
-	}
+static char Scrollback[SCROLLBACK_LEN];
+static volatile uint32_t ScrollbackHead = 0;
+static volatile uint32_t ScrollbackTail = 0;
 
-	memcpy(pMyBuffer, &len, sizeof(uint32_t));
-	memcpy(pMyBuffer + sizeof(uint32_t), &location, sizeof(uint32_t));
-	memcpy(pMyBuffer + sizeof(uint32_t) + sizeof(uint32_t), (void*) location, len);
-	uint32_t crc = 0;
-	crc32(&crc, (void*) location, len);
-	*((uint32_t*)(pMyBuffer + sizeof(uint32_t) + sizeof(uint32_t) + len)) = crc;
-	int totalLen = sizeof(uint32_t) + sizeof(uint32_t) + len + sizeof(uint32_t);
-	if(totalLen % 0x80 != 0) {
-		totalLen += 0x80 - (totalLen % 0x80);
-	}
-	MyBufferLen += totalLen;
-	pMyBuffer += totalLen;
-	LeaveCriticalSection();
+static ScrollbackListener scrollbackListener = NULL;
+
+void setScrollbackListener(ScrollbackListener listener) {
+	scrollbackListener = listener;
 }
 
 int addToBuffer(const char* toBuffer, int len) {
+	if(len <= 0)
+		return 1;
+
 	EnterCriticalSection();
-	if(pMyBuffer == NULL) {
-		MyBuffer = (char*) malloc(SCROLLBACK_LEN);
-		MyBufferLen = 0;
-		pMyBuffer = MyBuffer;
-		*pMyBuffer = '\0';
-	}
 
-	if((MyBufferLen + len) > SCROLLBACK_LEN) {
-		LeaveCriticalSection();
-		return 0;
+	uint32_t head = ScrollbackHead;
+
+	// Only the last SCROLLBACK_LEN bytes could survive anyway
+	if(len > SCROLLBACK_LEN) {
+		toBuffer += len - SCROLLBACK_LEN;
+		head += len - SCROLLBACK_LEN;
+		len = SCROLLBACK_LEN;
 	}
 
-	MyBufferLen += len;
+	uint32_t pos = head & SCROLLBACK_MASK;
+	uint32_t first = SCROLLBACK_LEN - pos;
+	if(first > len)
+		first = len;
 
-	if((MyBufferLen + 1) > SCROLLBACK_LEN) {
-		len -= (MyBufferLen + 1) - SCROLLBACK_LEN;
-		MyBufferLen = SCROLLBACK_LEN;
-	}
+	memcpy(Scrollback + pos, toBuffer, first);
+	memcpy(Scrollback, toBuffer + first, len - first);
+
+	// publish only after the data is in place
+	ScrollbackHead = head + len;
+
+	if(scrollbackListener)
+		scrollbackListener();
 
-	memcpy(pMyBuffer, toBuffer, len);
-	pMyBuffer[len] = '\0';
-	pMyBuffer += len;
 	LeaveCriticalSection();
 
 	return 1;
 }
 
+void bufferDump(uint32_t location, unsigned int len) {
+	static const uint8_t padding[0x80] = {0};
+	uint32_t crc = 0;
+
+	crc32(&crc, (void*) location, len);
+
+	// nothing else may land in the middle of the dump's framing
+	EnterCriticalSection();
+
+	addToBuffer((const char*) &len, sizeof(uint32_t));
+	addToBuffer((const char*) &location, sizeof(uint32_t));
+	addToBuffer((const char*) location, len);
+	addToBuffer((const char*) &crc, sizeof(uint32_t));
+
+	int totalLen = sizeof(uint32_t) + sizeof(uint32_t) + len + sizeof(uint32_t);
+	if(totalLen % 0x80 != 0) {
+		addToBuffer((const char*) padding, 0x80 - (totalLen % 0x80));
+	}
+
+	LeaveCriticalSection();
+}
+
 void bufferPrint(const char* toBuffer) {
 	if(UartHasInit)
 		uartPrint(toBuffer);
@@ -509,13 +525,29 @@ void bufferPrintf(const char* format, ...) {
 }
 
 void bufferFlush(char* destination, size_t length) {
-	EnterCriticalSection();
-	memcpy(destination, MyBuffer, length);
-	memmove(MyBuffer, MyBuffer + length, MyBufferLen - length);
-	MyBufferLen -= length;
-	pMyBuffer -= length;
-	*pMyBuffer = '\0';
-	LeaveCriticalSection();
+	uint32_t head = ScrollbackHead;
+	uint32_t tail = ScrollbackTail;
+
+	if((head - tail) > SCROLLBACK_LEN) {
+		// we were lapped, the oldest output is gone
+		tail = head - SCROLLBACK_LEN;
+	}
+
+	size_t available = head - tail;
+	if(length > available) {
+		memset(destination + available, 0, length - available);
+		length = available;
+	}
+
+	uint32_t pos = tail & SCROLLBACK_MASK;
+	size_t first = SCROLLBACK_LEN - pos;
+	if(first > length)
+		first = length;
+
+	memcpy(destination, Scrollback + pos, first);
+	memcpy(destination + first, Scrollback, length - first);
+
+	ScrollbackTail = tail + length;
 }
 
 void uartPrintf(const char* format, ...) {
@@ -544,12 +576,12 @@ void fbPrintf(const char* format, ...) {
 	LeaveCriticalSection();
 }
 
-char* getScrollback() {
-	return MyBuffer;
-}
-
 size_t getScrollbackLen() {
-	return MyBufferLen;
+	uint32_t used = ScrollbackHead - ScrollbackTail;
+	if(used > SCROLLBACK_LEN)
+		used = SCROLLBACK_LEN;
+
+	return used;
 }
 
 /*
@@ -150,7 +150,11 @@ void audiohw_play_pcm(const void* addr_in, uint32_t size, int use_speaker)
 
 	dma_request(DMA_MEMORY, 2, 1, dma, 2, 1, &controller, &channel, iis_transfer_done);
 
-	dma_perform((uint32_t)pcm_buffer, dma, pcm_buffer_size, 0, &controller, &channel);
+	if(dma_perform((uint32_t)pcm_buffer, dma, pcm_buffer_size, 0, &controller, &channel) != 0) {
+		bufferPrintf("audio: cannot start dma\r\n");
+		dma_cancel(controller, channel);
+		return;
+	}
 
 	dma_controller = controller;
 	dma_channel = channel;